@@ -60,6 +60,11 @@ public:
      *  @return a buffer containing the calculated integrals
      */
     virtual std::shared_ptr<BaseOneElectronIntegralBuffer<IntegralScalar, N>> calculate(const Shell& shell1, const Shell& shell2) = 0;
+
+    /**
+     *  @return a copy of this engine that has its own internal state, so that it can be used on another thread
+     */
+    virtual std::unique_ptr<BaseOneElectronIntegralEngine<Shell, N, IntegralScalar>> clone() const = 0;
 };
 
 
@@ -20,7 +20,9 @@
 
 #include "Mathematical/Representation/Tensor.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 
 
 namespace GQCP {
@@ -125,6 +127,70 @@ public:
     }
 
 
+    /**
+     *  Place the calculated integrals inside the matrix representation of the integrals, together with all the copies that are related through the 8-fold permutational symmetry of two-electron integrals over real basis functions in chemist's notation, i.e. (pq|rs) = (qp|rs) = (pq|sr) = (qp|sr) = (rs|pq) = (sr|pq) = (rs|qp) = (sr|qp).
+     * 
+     *  @param full_components          the components of the full matrix representation (over all the basis functions) of the operator
+     *  @param bf1                      the total basis function index of the first basis function in the first shell
+     *  @param bf2                      the total basis function index of the first basis function in the second shell
+     *  @param bf3                      the total basis function index of the first basis function in the third shell
+     *  @param bf4                      the total basis function index of the first basis function in the fourth shell
+     * 
+     *  @note This method should only be used for operators whose integrals have the full 8-fold permutational symmetry, such as the Coulomb repulsion operator over real basis functions.
+     */
+    void emplaceSymmetric(std::array<Tensor<IntegralScalar, 4>, N>& full_components, const size_t bf1, const size_t bf2, const size_t bf3, const size_t bf4) const {
+
+        for (size_t f1 = 0; f1 != this->nbf1; f1++) {              // f1: index of basis function within shell 1
+            const auto p = bf1 + f1;
+            for (size_t f2 = 0; f2 != this->nbf2; f2++) {          // f2: index of basis function within shell 2
+                const auto q = bf2 + f2;
+                for (size_t f3 = 0; f3 != this->nbf3; f3++) {      // f3: index of basis function within shell 3
+                    const auto r = bf3 + f3;
+                    for (size_t f4 = 0; f4 != this->nbf4; f4++) {  // f4: index of basis function within shell 4
+                        const auto s = bf4 + f4;
+
+                        for (size_t i = 0; i < N; i++) {
+                            const auto value = this->value(i, f1, f2, f3, f4);
+                            auto& component = full_components[i];
+
+                            component(p, q, r, s) = value;
+                            component(q, p, r, s) = value;
+                            component(p, q, s, r) = value;
+                            component(q, p, s, r) = value;
+                            component(r, s, p, q) = value;
+                            component(s, r, p, q) = value;
+                            component(r, s, q, p) = value;
+                            component(s, r, q, p) = value;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+
+    /**
+     *  @return the largest absolute value of the calculated integrals, over all components
+     */
+    double maximumAbsoluteValue() const {
+
+        double maximum = 0.0;
+        for (size_t f1 = 0; f1 != this->nbf1; f1++) {
+            for (size_t f2 = 0; f2 != this->nbf2; f2++) {
+                for (size_t f3 = 0; f3 != this->nbf3; f3++) {
+                    for (size_t f4 = 0; f4 != this->nbf4; f4++) {
+                        for (size_t i = 0; i < N; i++) {
+                            maximum = std::max<double>(maximum, std::abs(this->value(i, f1, f2, f3, f4)));
+                        }
+                    }
+                }
+            }
+        }
+
+        return maximum;
+    }
+
+
     /**
      *  @return the number of basis functions that are in the first shell
      */
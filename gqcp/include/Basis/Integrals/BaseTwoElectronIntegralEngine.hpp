@@ -20,6 +20,8 @@
 
 #include "Basis/Integrals/BaseTwoElectronIntegralBuffer.hpp"
 
+#include <memory>
+
 
 namespace GQCP {
 
@@ -60,6 +62,11 @@ public:
      *  @return a buffer containing the calculated integrals
      */
     virtual std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> calculate(const Shell& shell1, const Shell& shell2, const Shell& shell3, const Shell& shell4) = 0;
+
+    /**
+     *  @return a copy of this engine that has its own internal state, so that it can be used on another thread
+     */
+    virtual std::unique_ptr<BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>> clone() const = 0;
 };
 
 
@@ -0,0 +1,140 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/ScalarBasis/GTOShell.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+
+#include <utility>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A calculator for the Coulomb (direct) and exchange matrices of (AO) density matrices, that approximates the two-electron integrals through density fitting, also called the resolution of the identity (RI):
+ *      (mu nu|kappa lambda) ~ sum_{PQ} (mu nu|P) [V^{-1}]_{PQ} (Q|kappa lambda) = sum_Q B^Q_{mu nu} B^Q_{kappa lambda},
+ *  in which P and Q are the functions of an auxiliary basis, V_{PQ} = (P|Q) is the Coulomb metric and B^Q_{mu nu} = sum_P (mu nu|P) [L^{-T}]_{PQ} with V = L L^T its Cholesky decomposition.
+ *
+ *  Only the fitted three-index quantities B are stored, which requires K^2 N_aux elements instead of the K^4 elements of the two-electron integrals. The Coulomb and exchange matrices are defined as in `DirectJKCalculator`, i.e.
+ *      J(P)_{mu nu} = (mu nu|kappa lambda) P_{kappa lambda}
+ *      K(P)_{mu nu} = (mu lambda|kappa nu) P_{kappa lambda},
+ *  and they are calculated with matrix-matrix products only. The density matrices do not have to be symmetric.
+ */
+class DensityFittedJKCalculator {
+private:
+    // The number of basis functions.
+    size_t K;
+
+    // The fitted three-index quantities, where B(mu + K nu, Q) = B^Q_{mu nu}.
+    MatrixX<double> B;
+
+    // The number of threads over which the auxiliary basis functions are distributed.
+    size_t number_of_threads;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param three_center_integrals       The three-center Coulomb integrals (mu nu|P) as a K^2 x N_aux matrix, whose row index is mu + K nu.
+     *  @param metric                       The (positive definite) Coulomb metric V_{PQ} = (P|Q) of the auxiliary basis.
+     *  @param number_of_threads            The number of threads over which the auxiliary basis functions should be distributed.
+     */
+    DensityFittedJKCalculator(const MatrixX<double>& three_center_integrals, const SquareMatrix<double>& metric, const size_t number_of_threads = 1);
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Create a density-fitted J/K calculator that uses Libint2 to calculate the three- and two-center Coulomb integrals.
+     *
+     *  @param scalar_basis                 The scalar basis in which the Coulomb and exchange matrices should be expressed.
+     *  @param auxiliary_basis              The auxiliary basis in which the products of the basis functions are fitted, e.g. a JK-fitting basis.
+     *  @param number_of_threads            The number of threads over which the (auxiliary) shells should be distributed.
+     *
+     *  @return A density-fitted J/K calculator that uses Libint2.
+     */
+    static DensityFittedJKCalculator Libint(const ScalarBasis<GTOShell>& scalar_basis, const ScalarBasis<GTOShell>& auxiliary_basis, const size_t number_of_threads = 1);
+
+
+    /*
+     *  MARK: General information
+     */
+
+    /**
+     *  @return The number of auxiliary basis functions.
+     */
+    size_t numberOfAuxiliaryBasisFunctions() const { return this->B.cols(); }
+
+    /**
+     *  @return The number of basis functions, i.e. the dimension of the Coulomb and exchange matrices.
+     */
+    size_t numberOfBasisFunctions() const { return this->K; }
+
+    /**
+     *  @return The number of threads over which the auxiliary basis functions are distributed.
+     */
+    size_t numberOfThreads() const { return this->number_of_threads; }
+
+    /**
+     *  @return The fitted three-index quantities as a K^2 x N_aux matrix, whose element (mu + K nu, Q) is B^Q_{mu nu}.
+     */
+    const MatrixX<double>& threeIndexFactors() const { return this->B; }
+
+
+    /*
+     *  MARK: Coulomb and exchange matrices
+     */
+
+    /**
+     *  Calculate the Coulomb and exchange matrices of a number of density matrices.
+     *
+     *  @param density_matrices         The density matrices, expressed in the scalar basis of this calculator.
+     *
+     *  @return The Coulomb matrices (first) and the exchange matrices (second), in the order of the given density matrices.
+     *
+     *  @note Every density matrix is factorized through a singular value decomposition P = U S V^T, such that K(P) = sum_Q (B^Q V) S (B^Q U)^T only involves the non-zero singular values. For a density matrix of N_occ occupied orbitals, this reduces the cost of the exchange matrix from O(K^3 N_aux) to O(K^2 N_occ N_aux).
+     */
+    std::pair<std::vector<SquareMatrix<double>>, std::vector<SquareMatrix<double>>> calculate(const std::vector<SquareMatrix<double>>& density_matrices) const;
+
+    /**
+     *  @param P                        A density matrix, expressed in the scalar basis of this calculator.
+     *
+     *  @return The Coulomb matrix J(P).
+     */
+    SquareMatrix<double> calculateCoulomb(const SquareMatrix<double>& P) const { return this->calculate({P}).first[0]; }
+
+    /**
+     *  @param P                        A density matrix, expressed in the scalar basis of this calculator.
+     *
+     *  @return The exchange matrix K(P).
+     */
+    SquareMatrix<double> calculateExchange(const SquareMatrix<double>& P) const { return this->calculate({P}).second[0]; }
+};
+
+
+}  // namespace GQCP
@@ -0,0 +1,148 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/BaseTwoElectronIntegralEngine.hpp"
+#include "Basis/ScalarBasis/GTOShell.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Basis/ScalarBasis/ShellSet.hpp"
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A calculator for the Coulomb (direct) and exchange matrices of (AO) density matrices, that contracts the two-electron integrals with the density matrices as soon as they are calculated, instead of storing the two-electron integrals. This is the central ingredient of 'direct' SCF algorithms.
+ * 
+ *  For a density matrix P, the Coulomb and exchange matrices are defined as
+ *      J(P)_{mu nu} = (mu nu|kappa lambda) P_{kappa lambda}
+ *      K(P)_{mu nu} = (mu lambda|kappa nu) P_{kappa lambda},
+ *  such that they match the contractions in `QCModel::UHF` and `QCModel::GHF`. The density matrices do not have to be symmetric.
+ * 
+ *  Only the unique shell quartets (ab|cd) with a >= b, c >= d and ab >= cd are calculated. A shell quartet is skipped if its density-weighted Cauchy-Schwarz upper bound, i.e. sqrt((ab|ab)) * sqrt((cd|cd)) multiplied by the largest density matrix element that it is contracted with, is smaller than the screening threshold. Since this bound shrinks with the density matrices, incremental Fock matrix builds (that only use the change in the density matrix) become cheaper as an SCF algorithm converges.
+ * 
+ *  @note The integral engine should calculate the Coulomb repulsion integrals over real basis functions, since their 8-fold permutational symmetry is used.
+ */
+class DirectJKCalculator {
+private:
+    // The engine that calculates the two-electron integrals over shell quartets. Every calculation of J and K uses its own clones of this engine.
+    std::shared_ptr<const BaseTwoElectronIntegralEngine<GTOShell, 1, double>> engine;
+
+    // The shells over which the two-electron integrals are calculated.
+    ShellSet<GTOShell> shell_set;
+
+    // The index of the first basis function of every shell.
+    std::vector<size_t> basis_function_indices;
+
+    // The Cauchy-Schwarz upper bounds sqrt(max |(ab|ab)|) for every pair of shells.
+    MatrixX<double> schwarz_bounds;
+
+    // The threshold for the density-weighted Cauchy-Schwarz upper bound of a shell quartet, below which its contributions are neglected.
+    double screening_threshold;
+
+    // The number of threads over which the shell quartets are distributed.
+    size_t number_of_threads;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param engine                   The engine that calculates the Coulomb repulsion integrals over shell quartets. It is cloned, so it may be discarded afterwards.
+     *  @param shell_set                The shells over which the two-electron integrals should be calculated.
+     *  @param screening_threshold      The threshold for the density-weighted Cauchy-Schwarz upper bound of a shell quartet, below which its contributions are neglected.
+     *  @param number_of_threads        The number of threads over which the shell quartets should be distributed.
+     */
+    DirectJKCalculator(const BaseTwoElectronIntegralEngine<GTOShell, 1, double>& engine, const ShellSet<GTOShell>& shell_set, const double screening_threshold = 1.0e-12, const size_t number_of_threads = 1);
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Create a direct J/K calculator that uses Libint2 to calculate the Coulomb repulsion integrals.
+     * 
+     *  @param scalar_basis             The scalar basis in which the Coulomb and exchange matrices should be expressed.
+     *  @param screening_threshold      The threshold for the density-weighted Cauchy-Schwarz upper bound of a shell quartet, below which its contributions are neglected.
+     *  @param number_of_threads        The number of threads over which the shell quartets should be distributed.
+     * 
+     *  @return A direct J/K calculator that uses Libint2.
+     */
+    static DirectJKCalculator Libint(const ScalarBasis<GTOShell>& scalar_basis, const double screening_threshold = 1.0e-12, const size_t number_of_threads = 1);
+
+
+    /*
+     *  MARK: General information
+     */
+
+    /**
+     *  @return The number of basis functions, i.e. the dimension of the Coulomb and exchange matrices.
+     */
+    size_t numberOfBasisFunctions() const { return this->shell_set.numberOfBasisFunctions(); }
+
+    /**
+     *  @return The number of threads over which the shell quartets are distributed.
+     */
+    size_t numberOfThreads() const { return this->number_of_threads; }
+
+    /**
+     *  @return The threshold for the density-weighted Cauchy-Schwarz upper bound of a shell quartet, below which its contributions are neglected.
+     */
+    double screeningThreshold() const { return this->screening_threshold; }
+
+
+    /*
+     *  MARK: Coulomb and exchange matrices
+     */
+
+    /**
+     *  Calculate the Coulomb and exchange matrices of a number of density matrices, using only one pass over the two-electron integrals.
+     * 
+     *  @param density_matrices         The density matrices, expressed in the scalar basis of this calculator.
+     * 
+     *  @return The Coulomb matrices (first) and the exchange matrices (second), in the order of the given density matrices.
+     */
+    std::pair<std::vector<SquareMatrix<double>>, std::vector<SquareMatrix<double>>> calculate(const std::vector<SquareMatrix<double>>& density_matrices) const;
+
+    /**
+     *  @param P                        A density matrix, expressed in the scalar basis of this calculator.
+     * 
+     *  @return The Coulomb matrix J(P).
+     */
+    SquareMatrix<double> calculateCoulomb(const SquareMatrix<double>& P) const { return this->calculate({P}).first[0]; }
+
+    /**
+     *  @param P                        A density matrix, expressed in the scalar basis of this calculator.
+     * 
+     *  @return The exchange matrix K(P).
+     */
+    SquareMatrix<double> calculateExchange(const SquareMatrix<double>& P) const { return this->calculate({P}).second[0]; }
+};
+
+
+}  // namespace GQCP
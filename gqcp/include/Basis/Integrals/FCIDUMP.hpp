@@ -0,0 +1,185 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/PackedSymmetricRankFourTensor.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  The contents of an FCIDUMP file: the one- and two-electron integrals over real (restricted) orbitals, the core energy and the header information (the number of orbitals and electrons, the spin projection and the orbital symmetries).
+ *
+ *  Next to the FCIDUMP text format, the integrals can be stored in a compact binary format (with extension '.gqcpint'). Its layout consists of 8-byte words in native byte order only, so that it can be memory-mapped:
+ *      - the magic string "GQCPINT" (null-terminated) and the format version (uint64),
+ *      - the number of orbitals K, the number of electrons N (uint64), MS2 and ISYM (int64), the core energy (double) and the K orbital symmetries (int64),
+ *      - the lower triangle of the one-electron integrals h(p q) with p >= q (K(K+1)/2 doubles, in the order of `PackedSymmetricRankFourTensor::pairIndex`),
+ *      - the unique two-electron integrals, in the order of `PackedSymmetricRankFourTensor::packedElements`.
+ *
+ *  @note The two-electron integrals are expressed in chemist's notation, as in the FCIDUMP format.
+ */
+class FCIDUMP {
+private:
+    // The number of electrons.
+    size_t N;
+
+    // Twice the spin projection, i.e. N_alpha - N_beta.
+    int ms2;
+
+    // The irreducible representation of the wave function.
+    int isym;
+
+    // The irreducible representation of every orbital.
+    std::vector<int> orbsym;
+
+    // The core energy, e.g. the internuclear repulsion energy.
+    double core_energy;
+
+    // The one-electron integrals.
+    SquareMatrix<double> h;
+
+    // The unique two-electron integrals.
+    PackedSymmetricRankFourTensor g;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param h                            The (symmetric) one-electron integrals.
+     *  @param g                            The unique two-electron integrals, in chemist's notation.
+     *  @param N                            The number of electrons.
+     *  @param core_energy                  The core energy, e.g. the internuclear repulsion energy.
+     *  @param ms2                          Twice the spin projection, i.e. N_alpha - N_beta.
+     *  @param orbital_symmetries           The irreducible representation of every orbital. If empty, every orbital is assigned to the totally symmetric irreducible representation.
+     *  @param isym                         The irreducible representation of the wave function.
+     */
+    FCIDUMP(const SquareMatrix<double>& h, const PackedSymmetricRankFourTensor& g, const size_t N = 0, const double core_energy = 0.0, const int ms2 = 0, const std::vector<int>& orbital_symmetries = {}, const int isym = 1);
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Parse an FCIDUMP file.
+     *
+     *  The file is read in large blocks. Every block is split at line boundaries into chunks that are parsed concurrently, with a locale-independent number parser. The parsed entries are stored in the order in which they appear in the file, so that the result doesn't depend on the number of threads.
+     *
+     *  @param filename                     The name of the FCIDUMP file.
+     *  @param number_of_threads            The number of threads over which the lines of every block should be distributed.
+     *  @param block_size                   The number of bytes that are read at once.
+     *
+     *  @return The contents of the given FCIDUMP file.
+     *
+     *  @note Lines with only a first index (orbital energies) are skipped.
+     */
+    static FCIDUMP Read(const std::string& filename, const size_t number_of_threads = 1, const size_t block_size = 1 << 26);
+
+    /**
+     *  Read a binary integral file that was written by `writeBinary`.
+     *
+     *  @param filename                     The name of the binary integral file, with extension '.gqcpint'.
+     *
+     *  @return The contents of the given binary integral file.
+     */
+    static FCIDUMP ReadBinary(const std::string& filename);
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The core energy, e.g. the internuclear repulsion energy.
+     */
+    double coreEnergy() const { return this->core_energy; }
+
+    /**
+     *  @return A read-only reference to the one-electron integrals.
+     */
+    const SquareMatrix<double>& oneElectronIntegrals() const { return this->h; }
+
+    /**
+     *  @return A read-only reference to the irreducible representation of every orbital.
+     */
+    const std::vector<int>& orbitalSymmetries() const { return this->orbsym; }
+
+    /**
+     *  @return A read-only reference to the unique two-electron integrals, in chemist's notation.
+     */
+    const PackedSymmetricRankFourTensor& twoElectronIntegrals() const { return this->g; }
+
+
+    /*
+     *  MARK: General information
+     */
+
+    /**
+     *  @return The number of electrons.
+     */
+    size_t numberOfElectrons() const { return this->N; }
+
+    /**
+     *  @return The number of orbitals.
+     */
+    size_t numberOfOrbitals() const { return this->g.dimension(); }
+
+    /**
+     *  @return Twice the spin projection, i.e. N_alpha - N_beta.
+     */
+    int twiceSpinProjection() const { return this->ms2; }
+
+    /**
+     *  @return The irreducible representation of the wave function.
+     */
+    int waveFunctionSymmetry() const { return this->isym; }
+
+
+    /*
+     *  MARK: Writing
+     */
+
+    /**
+     *  Write these integrals to an FCIDUMP file. The unique two-electron integrals (ij|kl) with i >= j, k >= l and ij >= kl are listed first, followed by the one-electron integrals with i >= j and the core energy.
+     *
+     *  @param filename                     The name of the FCIDUMP file.
+     *  @param threshold                    The threshold below which (in absolute value) integrals aren't written.
+     *  @param number_of_threads            The number of threads over which the formatting of the two-electron integrals should be distributed.
+     */
+    void write(const std::string& filename, const double threshold = 0.0, const size_t number_of_threads = 1) const;
+
+    /**
+     *  Write these integrals to a binary integral file, whose layout is described in the class documentation.
+     *
+     *  @param filename                     The name of the binary integral file, with extension '.gqcpint'.
+     */
+    void writeBinary(const std::string& filename) const;
+};
+
+
+}  // namespace GQCP
@@ -25,23 +25,57 @@
 #include "Basis/Integrals/Interfaces/LibintInterfacer.hpp"
 #include "Basis/ScalarBasis/ScalarBasis.hpp"
 #include "Basis/ScalarBasis/ShellSet.hpp"
+#include "Mathematical/Representation/CholeskyDecomposedRankFourTensor.hpp"
+#include "Mathematical/Representation/PackedSymmetricRankFourTensor.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
 #include "Mathematical/Representation/SquareRankFourTensor.hpp"
 #include "Operator/FirstQuantized/Operator.hpp"
 #include "Utilities/aliases.hpp"
+#include "Utilities/threading.hpp"
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 
 namespace GQCP {
 
 
 /**
- *  A class that calculates integrals over ShellSets: it loops over all shells in the given ShellSets. It just has two static member functions, for cleaner interface calls.
+ *  A class that calculates integrals over ShellSets: it loops over all shells in the given ShellSets. It just has static member functions, for cleaner interface calls.
+ * 
+ *  The shells (or pairs of shells) can be distributed over multiple threads. Since integral engines have an internal state, every additional thread then works with its own clone of the given engine. The shells are handed out dynamically to the threads that are available, because the cost of the integrals over different shells can differ by orders of magnitude.
  */
 class IntegralCalculator {
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  @param engine                       the engine that should be cloned
+     *  @param number_of_threads            the number of threads that will calculate integrals
+     * 
+     *  @tparam Engine                      the (base) type of the integral engine
+     * 
+     *  @return a clone of the given engine for every thread but the first one, which can use the given engine itself
+     */
+    template <typename Engine>
+    static std::vector<std::unique_ptr<Engine>> cloneForThreads(const Engine& engine, const size_t number_of_threads) {
+
+        std::vector<std::unique_ptr<Engine>> clones;
+        for (size_t thread_index = 1; thread_index < number_of_threads; thread_index++) {
+            clones.push_back(engine.clone());
+        }
+
+        return clones;
+    }
+
+
 public:
     /*
      *  PUBLIC METHODS
@@ -53,13 +87,19 @@ public:
      *  @param engine                   the engine that can calculate one-electron integrals over shells (not const because we allow for non-const Engine::calculate() calls)
      *  @param left_shell_set           the set of shells that should appear on the left of the operator
      *  @param right_shell_set          the set of shells that should appear on the right of the operator
+     *  @param number_of_threads        the number of threads over which the left shells should be distributed
      * 
      *  @tparam Shell                   the type of shell the integral engine is able to handle
      *  @tparam N                       the number of components the operator has
      *  @tparam IntegralScalar          the scalar representation of an integral
      */
     template <typename Shell, size_t N, typename IntegralScalar>
-    static auto calculate(BaseOneElectronIntegralEngine<Shell, N, IntegralScalar>& engine, const ShellSet<Shell>& left_shell_set, const ShellSet<Shell>& right_shell_set) -> std::array<MatrixX<IntegralScalar>, N> {
+    static auto calculate(BaseOneElectronIntegralEngine<Shell, N, IntegralScalar>& engine, const ShellSet<Shell>& left_shell_set, const ShellSet<Shell>& right_shell_set, const size_t number_of_threads = 1) -> std::array<MatrixX<IntegralScalar>, N> {
+
+        if (number_of_threads == 0) {
+            throw std::invalid_argument("IntegralCalculator::calculate(BaseOneElectronIntegralEngine<Shell, N, IntegralScalar>&, const ShellSet<Shell>&, const ShellSet<Shell>&, const size_t): The number of threads should be at least 1.");
+        }
+
 
         // Initialize the N components of the matrix representations of the operator.
         const auto nbf_left = left_shell_set.numberOfBasisFunctions();
@@ -71,21 +111,25 @@ public:
         }
 
 
-        // Loop over all left and right shells and let the engine calculate the integrals over the pairs of shells.
+        // Loop over all left and right shells and let the engine calculate the integrals over the pairs of shells. Every left shell is handled by one thread, so the threads write to disjoint blocks of the matrices.
         const auto nsh_left = left_shell_set.numberOfShells();
         const auto left_shells = left_shell_set.asVector();
         const auto nsh_right = right_shell_set.numberOfShells();
         const auto right_shells = right_shell_set.asVector();
 
-        for (size_t left_shell_index = 0; left_shell_index < nsh_left; left_shell_index++) {
+        const auto clones = IntegralCalculator::cloneForThreads(static_cast<const BaseOneElectronIntegralEngine<Shell, N, IntegralScalar>&>(engine), std::min(number_of_threads, nsh_left));
+
+        forEachIndexDynamically(number_of_threads, nsh_left, [&](const size_t thread_index, const size_t left_shell_index) {
+            auto& thread_engine = (thread_index == 0) ? engine : *clones[thread_index - 1];
+
             const auto left_bf_index = left_shell_set.basisFunctionIndex(left_shell_index);
-            const auto left_shell = left_shells[left_shell_index];
+            const auto& left_shell = left_shells[left_shell_index];
 
             for (size_t right_shell_index = 0; right_shell_index < nsh_right; right_shell_index++) {
                 const auto right_bf_index = right_shell_set.basisFunctionIndex(right_shell_index);
-                const auto right_shell = right_shells[right_shell_index];
+                const auto& right_shell = right_shells[right_shell_index];
 
-                const auto buffer = engine.calculate(left_shell, right_shell);
+                const auto buffer = thread_engine.calculate(left_shell, right_shell);
 
                 // Only if the integrals are not all zero, place them inside the full matrices.
                 if (buffer->areIntegralsAllZero()) {
@@ -93,7 +137,7 @@ public:
                 }
                 buffer->emplace(components, left_bf_index, right_bf_index);
             }  // right shells loop
-        }      // left shells loop
+        });
 
         return components;
     }
@@ -105,13 +149,19 @@ public:
      *  @param engine                       the engine that can calculate two-electron integrals over shells
      *  @param left_shell_set               the set of shells that should appear on the left of the operator
      *  @param right_shell_set              the set of shells that should appear on the right of the operator
+     *  @param number_of_threads            the number of threads over which the pairs of left shells should be distributed
      * 
      *  @tparam Shell                       the type of shell the integral engine is able to handle
      *  @tparam N                           the number of components the operator has
      *  @tparam IntegralScalar              the scalar representation of an integral
      */
     template <typename Shell, size_t N, typename IntegralScalar>
-    static auto calculate(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>& engine, const ShellSet<Shell>& left_shell_set, const ShellSet<Shell>& right_shell_set) -> std::array<Tensor<IntegralScalar, 4>, N> {
+    static auto calculate(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>& engine, const ShellSet<Shell>& left_shell_set, const ShellSet<Shell>& right_shell_set, const size_t number_of_threads = 1) -> std::array<Tensor<IntegralScalar, 4>, N> {
+
+        if (number_of_threads == 0) {
+            throw std::invalid_argument("IntegralCalculator::calculate(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>&, const ShellSet<Shell>&, const ShellSet<Shell>&, const size_t): The number of threads should be at least 1.");
+        }
+
 
         // Initialize the N components of the matrix representations of the operator.
         const auto nbf_left = left_shell_set.numberOfBasisFunctions();
@@ -124,45 +174,265 @@ public:
         }
 
 
-        // Loop over all left and right shells and let the engine calculate the integrals over the 4-tuple of shells.
+        // Loop over all left and right shells and let the engine calculate the integrals over the 4-tuple of shells. Every pair of left shells is handled by one thread, so the threads write to disjoint blocks of the tensors.
         const auto nsh_left = left_shell_set.numberOfShells();
         const auto left_shells = left_shell_set.asVector();
         const auto nsh_right = right_shell_set.numberOfShells();
         const auto right_shells = right_shell_set.asVector();
 
-        for (size_t left_shell_index1 = 0; left_shell_index1 < nsh_left; left_shell_index1++) {
+        const auto number_of_left_pairs = nsh_left * nsh_left;
+        const auto clones = IntegralCalculator::cloneForThreads(static_cast<const BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>&>(engine), std::min(number_of_threads, number_of_left_pairs));
+
+        forEachIndexDynamically(number_of_threads, number_of_left_pairs, [&](const size_t thread_index, const size_t left_pair_index) {
+            auto& thread_engine = (thread_index == 0) ? engine : *clones[thread_index - 1];
+
+            const auto left_shell_index1 = left_pair_index / nsh_left;
             const auto left_bf1_index = left_shell_set.basisFunctionIndex(left_shell_index1);
-            const auto left_shell1 = left_shells[left_shell_index1];
+            const auto& left_shell1 = left_shells[left_shell_index1];
 
-            for (size_t left_shell_index2 = 0; left_shell_index2 < nsh_left; left_shell_index2++) {
-                const auto left_bf2_index = left_shell_set.basisFunctionIndex(left_shell_index2);
-                const auto left_shell2 = left_shells[left_shell_index2];
+            const auto left_shell_index2 = left_pair_index % nsh_left;
+            const auto left_bf2_index = left_shell_set.basisFunctionIndex(left_shell_index2);
+            const auto& left_shell2 = left_shells[left_shell_index2];
 
-                for (size_t right_shell_index1 = 0; right_shell_index1 < nsh_right; right_shell_index1++) {
-                    const auto right_bf1_index = right_shell_set.basisFunctionIndex(right_shell_index1);
-                    const auto right_shell1 = right_shells[right_shell_index1];
+            for (size_t right_shell_index1 = 0; right_shell_index1 < nsh_right; right_shell_index1++) {
+                const auto right_bf1_index = right_shell_set.basisFunctionIndex(right_shell_index1);
+                const auto& right_shell1 = right_shells[right_shell_index1];
 
-                    for (size_t right_shell_index2 = 0; right_shell_index2 < nsh_right; right_shell_index2++) {
-                        const auto right_bf2_index = right_shell_set.basisFunctionIndex(right_shell_index2);
-                        const auto right_shell2 = right_shells[right_shell_index2];
+                for (size_t right_shell_index2 = 0; right_shell_index2 < nsh_right; right_shell_index2++) {
+                    const auto right_bf2_index = right_shell_set.basisFunctionIndex(right_shell_index2);
+                    const auto& right_shell2 = right_shells[right_shell_index2];
 
-                        const auto buffer = engine.calculate(left_shell1, left_shell2, right_shell1, right_shell2);
+                    const auto buffer = thread_engine.calculate(left_shell1, left_shell2, right_shell1, right_shell2);
 
-                        // Only if the integrals are not all zero, place them inside the full matrices
-                        if (buffer->areIntegralsAllZero()) {
-                            continue;
-                        }
-                        buffer->emplace(components, left_bf1_index, left_bf2_index, right_bf1_index, right_bf2_index);  // place the calculated integrals inside the full tensors
+                    // Only if the integrals are not all zero, place them inside the full matrices
+                    if (buffer->areIntegralsAllZero()) {
+                        continue;
+                    }
+                    buffer->emplace(components, left_bf1_index, left_bf2_index, right_bf1_index, right_bf2_index);  // place the calculated integrals inside the full tensors
+
+                }  // right_shell_index2
+            }      // right_shell_index1
+        });
+
+        return components;
+    }
+
+
+    /**
+     *  Calculate all two-electron integrals over the basis functions inside the given shell set, using the 8-fold permutational symmetry of the integrals and Cauchy-Schwarz screening.
+     * 
+     *  Only the unique shell quartets (ab|cd) with a >= b, c >= d and ab >= cd are calculated, and every one of them is skipped if its Cauchy-Schwarz upper bound sqrt((ab|ab)) * sqrt((cd|cd)) is smaller than the given threshold. The integrals of the remaining quartets are placed in all their symmetry-related positions.
+     * 
+     *  @param engine                       the engine that can calculate two-electron integrals over shells
+     *  @param shell_set                    the set of shells that should appear on both sides of the operator
+     *  @param screening_threshold          the threshold for the Cauchy-Schwarz upper bound of a shell quartet, below which its integrals are considered to be zero
+     *  @param number_of_threads            the number of threads over which the unique pairs of shells should be distributed
+     * 
+     *  @tparam Shell                       the type of shell the integral engine is able to handle
+     *  @tparam N                           the number of components the operator has
+     *  @tparam IntegralScalar              the scalar representation of an integral
+     * 
+     *  @note This method should only be used for operators whose integrals have the full 8-fold permutational symmetry, such as the Coulomb repulsion operator over real basis functions.
+     */
+    template <typename Shell, size_t N, typename IntegralScalar>
+    static auto calculateScreened(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>& engine, const ShellSet<Shell>& shell_set, const double screening_threshold = 1.0e-12, const size_t number_of_threads = 1) -> std::array<Tensor<IntegralScalar, 4>, N> {
+
+        if (screening_threshold < 0.0) {
+            throw std::invalid_argument("IntegralCalculator::calculateScreened(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>&, const ShellSet<Shell>&, const double, const size_t): The screening threshold cannot be negative.");
+        }
+
+        if (number_of_threads == 0) {
+            throw std::invalid_argument("IntegralCalculator::calculateScreened(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>&, const ShellSet<Shell>&, const double, const size_t): The number of threads should be at least 1.");
+        }
+
+
+        // Initialize the N components of the matrix representations of the operator.
+        const auto nbf = shell_set.numberOfBasisFunctions();
+
+        std::array<Tensor<IntegralScalar, 4>, N> components;
+        for (auto& component : components) {
+            component = Tensor<IntegralScalar, 4>(nbf, nbf, nbf, nbf);
+            component.setZero();
+        }
+
+
+        // Enumerate the unique pairs of shells a >= b, such that the compound index ab = a * (a + 1) / 2 + b is their position in the enumeration.
+        const auto nsh = shell_set.numberOfShells();
+        const auto shells = shell_set.asVector();
+
+        std::vector<std::pair<size_t, size_t>> shell_pairs;
+        shell_pairs.reserve(nsh * (nsh + 1) / 2);
+        for (size_t a = 0; a < nsh; a++) {
+            for (size_t b = 0; b <= a; b++) {
+                shell_pairs.emplace_back(a, b);
+            }
+        }
+        const auto number_of_pairs = shell_pairs.size();
+
+        const auto clones = IntegralCalculator::cloneForThreads(static_cast<const BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>&>(engine), std::min(number_of_threads, number_of_pairs));
+        const auto engine_for_thread = [&engine, &clones](const size_t thread_index) -> BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>& {
+            return (thread_index == 0) ? engine : *clones[thread_index - 1];
+        };
+
+
+        // Calculate the Cauchy-Schwarz upper bounds Q(ab) = sqrt(max |(ab|ab)|) for every unique pair of shells.
+        std::vector<double> Q(number_of_pairs, 0.0);
+        forEachIndexDynamically(number_of_threads, number_of_pairs, [&](const size_t thread_index, const size_t ab) {
+            const auto& a = shells[shell_pairs[ab].first];
+            const auto& b = shells[shell_pairs[ab].second];
+
+            const auto buffer = engine_for_thread(thread_index).calculate(a, b, a, b);
+            if (!buffer->areIntegralsAllZero()) {
+                Q[ab] = std::sqrt(buffer->maximumAbsoluteValue());
+            }
+        });
+
+
+        // Loop over the unique shell quartets (ab|cd) with ab >= cd and let the engine calculate the integrals over the ones that are not negligible. Every pair ab is handled by one thread, and since the symmetry-related positions of different unique quartets never coincide, the threads write to disjoint elements of the tensors. The pairs with the most quartets are handed out first, to balance the load at the end.
+        forEachIndexDynamically(number_of_threads, number_of_pairs, [&](const size_t thread_index, const size_t task_index) {
+            auto& thread_engine = engine_for_thread(thread_index);
+
+            const auto ab = number_of_pairs - 1 - task_index;
+            const auto a = shell_pairs[ab].first;
+            const auto b = shell_pairs[ab].second;
+
+            for (size_t cd = 0; cd <= ab; cd++) {
+                if (Q[ab] * Q[cd] < screening_threshold) {
+                    continue;
+                }
 
-                    }  // sh4_index
-                }      // right_shell_index1
-            }          // left_shell_index2
-        }              // left_shell_index1
+                const auto c = shell_pairs[cd].first;
+                const auto d = shell_pairs[cd].second;
+                const auto buffer = thread_engine.calculate(shells[a], shells[b], shells[c], shells[d]);
+
+                // Only if the integrals are not all zero, place them inside the full tensors.
+                if (buffer->areIntegralsAllZero()) {
+                    continue;
+                }
+                buffer->emplaceSymmetric(components, shell_set.basisFunctionIndex(a), shell_set.basisFunctionIndex(b), shell_set.basisFunctionIndex(c), shell_set.basisFunctionIndex(d));
+            }
+        });
 
         return components;
     }
 
 
+    /**
+     *  Calculate the Cholesky decomposition of the two-electron integrals over the basis functions inside the given shell set, without calculating all the integrals.
+     * 
+     *  The diagonal integrals (pq|pq) are calculated from the shell quartets (ab|ab). Then, a pivoted Cholesky decomposition is performed, in which the pairs of basis functions of a pair of shells form a group: whenever the largest remaining diagonal integral belongs to the shell pair (cd), the integrals (ab|cd) over all unique shell pairs (ab) are calculated and used for as many Cholesky vectors as possible (see `CholeskyDecomposedRankFourTensor::FromPairColumns`).
+     * 
+     *  @param engine                       the engine that can calculate two-electron integrals over shells
+     *  @param shell_set                    the set of shells that should appear on both sides of the operator
+     *  @param threshold                    the threshold for the largest remaining diagonal integral, below which the decomposition is stopped
+     *  @param number_of_threads            the number of threads over which the unique pairs of shells should be distributed
+     * 
+     *  @tparam Shell                       the type of shell the integral engine is able to handle
+     * 
+     *  @return the Cholesky decomposition of the two-electron integrals
+     * 
+     *  @note This method should only be used for operators whose integrals have the full 8-fold permutational symmetry and a positive semi-definite pair matrix, such as the Coulomb repulsion operator over real basis functions.
+     */
+    template <typename Shell>
+    static CholeskyDecomposedRankFourTensor calculateCholeskyDecomposed(BaseTwoElectronIntegralEngine<Shell, 1, double>& engine, const ShellSet<Shell>& shell_set, const double threshold = 1.0e-08, const size_t number_of_threads = 1) {
+
+        if (number_of_threads == 0) {
+            throw std::invalid_argument("IntegralCalculator::calculateCholeskyDecomposed(BaseTwoElectronIntegralEngine<Shell, 1, double>&, const ShellSet<Shell>&, const double, const size_t): The number of threads should be at least 1.");
+        }
+
+
+        // Enumerate the unique pairs of shells a >= b and the (compound indices of the) unique pairs of basis functions p >= q that they contain.
+        const auto nbf = shell_set.numberOfBasisFunctions();
+        const auto nsh = shell_set.numberOfShells();
+        const auto shells = shell_set.asVector();
+
+        std::vector<size_t> bf_indices;  // the index of the first basis function of every shell
+        for (size_t a = 0; a < nsh; a++) {
+            bf_indices.push_back(shell_set.basisFunctionIndex(a));
+        }
+
+        std::vector<std::pair<size_t, size_t>> shell_pairs;
+        std::vector<std::vector<size_t>> pair_groups;
+        for (size_t a = 0; a < nsh; a++) {
+            for (size_t b = 0; b <= a; b++) {
+                shell_pairs.emplace_back(a, b);
+
+                std::vector<size_t> group;
+                for (size_t f1 = 0; f1 < shells[a].numberOfBasisFunctions(); f1++) {
+                    const auto f2_end = (a == b) ? f1 + 1 : shells[b].numberOfBasisFunctions();
+                    for (size_t f2 = 0; f2 < f2_end; f2++) {
+                        group.push_back(PackedSymmetricRankFourTensor::pairIndex(bf_indices[a] + f1, bf_indices[b] + f2));
+                    }
+                }
+                pair_groups.push_back(group);
+            }
+        }
+        const auto number_of_shell_pairs = shell_pairs.size();
+
+        const auto clones = IntegralCalculator::cloneForThreads(static_cast<const BaseTwoElectronIntegralEngine<Shell, 1, double>&>(engine), std::min(number_of_threads, number_of_shell_pairs));
+        const auto engine_for_thread = [&engine, &clones](const size_t thread_index) -> BaseTwoElectronIntegralEngine<Shell, 1, double>& {
+            return (thread_index == 0) ? engine : *clones[thread_index - 1];
+        };
+
+
+        // Calculate the diagonal integrals (pq|pq) from the shell quartets (ab|ab).
+        VectorX<double> diagonal = VectorX<double>::Zero(nbf * (nbf + 1) / 2);
+        forEachIndexDynamically(number_of_threads, number_of_shell_pairs, [&](const size_t thread_index, const size_t ab) {
+            const auto a = shell_pairs[ab].first;
+            const auto b = shell_pairs[ab].second;
+
+            const auto buffer = engine_for_thread(thread_index).calculate(shells[a], shells[b], shells[a], shells[b]);
+            if (buffer->areIntegralsAllZero()) {
+                return;
+            }
+
+            for (size_t f1 = 0; f1 < buffer->numberOfBasisFunctionsInShell1(); f1++) {
+                for (size_t f2 = 0; f2 < buffer->numberOfBasisFunctionsInShell2(); f2++) {
+                    diagonal(PackedSymmetricRankFourTensor::pairIndex(bf_indices[a] + f1, bf_indices[b] + f2)) = buffer->value(0, f1, f2, f1, f2);
+                }
+            }
+        });
+
+
+        // Calculate the columns (pq|rs) for all pairs rs of a shell pair cd, from the shell quartets (ab|cd). Every shell pair ab is handled by one thread, so the threads write to disjoint rows.
+        const auto calculate_columns = [&](const size_t cd) {
+            const auto c = shell_pairs[cd].first;
+            const auto d = shell_pairs[cd].second;
+
+            MatrixX<double> columns = MatrixX<double>::Zero(nbf * (nbf + 1) / 2, pair_groups[cd].size());
+            forEachIndexDynamically(number_of_threads, number_of_shell_pairs, [&](const size_t thread_index, const size_t ab) {
+                const auto a = shell_pairs[ab].first;
+                const auto b = shell_pairs[ab].second;
+
+                const auto buffer = engine_for_thread(thread_index).calculate(shells[a], shells[b], shells[c], shells[d]);
+                if (buffer->areIntegralsAllZero()) {
+                    return;
+                }
+
+                for (size_t f1 = 0; f1 < buffer->numberOfBasisFunctionsInShell1(); f1++) {
+                    for (size_t f2 = 0; f2 < buffer->numberOfBasisFunctionsInShell2(); f2++) {
+                        const auto pq = PackedSymmetricRankFourTensor::pairIndex(bf_indices[a] + f1, bf_indices[b] + f2);
+
+                        // Walk through the pairs rs in the same order as they appear in the group of cd.
+                        size_t j = 0;
+                        for (size_t f3 = 0; f3 < buffer->numberOfBasisFunctionsInShell3(); f3++) {
+                            const auto f4_end = (c == d) ? f3 + 1 : buffer->numberOfBasisFunctionsInShell4();
+                            for (size_t f4 = 0; f4 < f4_end; f4++) {
+                                columns(pq, j) = buffer->value(0, f1, f2, f3, f4);
+                                j++;
+                            }
+                        }
+                    }
+                }
+            });
+
+            return columns;
+        };
+
+        return CholeskyDecomposedRankFourTensor::FromPairColumns(nbf, diagonal, pair_groups, calculate_columns, threshold);
+    }
+
+
     /*
      *  PUBLIC METHODS - LIBINT2 INTEGRALS
      */
@@ -265,12 +535,22 @@ public:
      * 
      *  @param fq_two_op                    the first-quantized operator
      *  @param scalar_basis                 the scalar basis that contains the shells over which the integrals should be calculated
+     *  @param screening_threshold          the threshold for the Cauchy-Schwarz upper bound of a shell quartet, below which its integrals are considered to be zero
+     *  @param number_of_threads            the number of threads that should calculate the integrals
      * 
      *  @return the matrix representation (integrals) of the given first-quantized operator in this scalar basis
      */
-    static SquareRankFourTensor<double> calculateLibintIntegrals(const CoulombRepulsionOperator& fq_two_op, const ScalarBasis<GTOShell>& scalar_basis) {
+    static SquareRankFourTensor<double> calculateLibintIntegrals(const CoulombRepulsionOperator& fq_two_op, const ScalarBasis<GTOShell>& scalar_basis, const double screening_threshold = 1.0e-12, const size_t number_of_threads = 1) {
+
+        const auto shell_set = scalar_basis.shellSet();
+
+        // Construct the libint engine
+        auto engine = IntegralEngine::Libint(fq_two_op, shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum());
+
 
-        return SquareRankFourTensor<double>(IntegralCalculator::calculateLibintIntegrals(fq_two_op, scalar_basis, scalar_basis));  // the same scalar basis appear on the left and right of the operator
+        // Since the same scalar basis appears on the left and right of the operator, we can use the permutational symmetry of the Coulomb integrals and screen the negligible shell quartets.
+        const auto integrals = IntegralCalculator::calculateScreened(engine, shell_set, screening_threshold, number_of_threads);
+        return SquareRankFourTensor<double>(integrals[0]);
     }
 
 
@@ -280,10 +560,11 @@ public:
      *  @param fq_two_op                            the first-quantized operator
      *  @param left_scalar_basis                    the scalar basis that contains the shells that should appear to the left of the operator
      *  @param right_scalar_basis                   the scalar basis that contains the shells that should appear to the right of the operator
+     *  @param number_of_threads                    the number of threads that should calculate the integrals
      * 
      *  @return the matrix representation (integrals) of the given first-quantized operator in this scalar basis
      */
-    static Tensor<double, 4> calculateLibintIntegrals(const CoulombRepulsionOperator& fq_two_op, const ScalarBasis<GTOShell>& left_scalar_basis, const ScalarBasis<GTOShell>& right_scalar_basis) {
+    static Tensor<double, 4> calculateLibintIntegrals(const CoulombRepulsionOperator& fq_two_op, const ScalarBasis<GTOShell>& left_scalar_basis, const ScalarBasis<GTOShell>& right_scalar_basis, const size_t number_of_threads = 1) {
 
         const auto left_shell_set = left_scalar_basis.shellSet();
         const auto right_shell_set = right_scalar_basis.shellSet();
@@ -295,11 +576,32 @@ public:
 
 
         // Calculate the integrals using the engine
-        const auto integrals = IntegralCalculator::calculate(engine, left_shell_set, right_shell_set);
+        const auto integrals = IntegralCalculator::calculate(engine, left_shell_set, right_shell_set, number_of_threads);
         return integrals[0];
     }
 
 
+    /**
+     *  Calculate the Cholesky decomposition of the Coulomb repulsion integrals within a given scalar basis, using Libint2, without calculating all the integrals.
+     * 
+     *  @param fq_two_op                    the first-quantized Coulomb repulsion operator
+     *  @param scalar_basis                 the scalar basis that contains the shells over which the integrals should be calculated
+     *  @param threshold                    the threshold for the largest remaining diagonal integral, below which the decomposition is stopped
+     *  @param number_of_threads            the number of threads that should calculate the integrals
+     * 
+     *  @return the Cholesky decomposition of the Coulomb repulsion integrals in this scalar basis
+     */
+    static CholeskyDecomposedRankFourTensor calculateLibintCholeskyDecomposedIntegrals(const CoulombRepulsionOperator& fq_two_op, const ScalarBasis<GTOShell>& scalar_basis, const double threshold = 1.0e-08, const size_t number_of_threads = 1) {
+
+        const auto shell_set = scalar_basis.shellSet();
+
+        // Construct the libint engine
+        auto engine = IntegralEngine::Libint(fq_two_op, shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum());
+
+        return IntegralCalculator::calculateCholeskyDecomposed(engine, shell_set, threshold, number_of_threads);
+    }
+
+
     /*
      *  PUBLIC METHODS - LIBCINT INTEGRALS
      *  Note that the Libcint integrals should only be used for Cartesian ShellSets
@@ -353,18 +655,20 @@ public:
      *
      *  @param fq_op                                the first-quantized operator
      *  @param scalar_basis                         the scalar basis that contains the shells over which the integrals should be calculated
+     *  @param screening_threshold                  the threshold for the Cauchy-Schwarz upper bound of a shell quartet, below which its integrals are considered to be zero
+     *  @param number_of_threads                    the number of threads that should calculate the integrals
      * 
      *  @note Only use this function for all-Cartesian ShellSets.
      * 
      *  @return the matrix representation of the Coulomb repulsion operator in this AO basis, using the libcint integral engine
      */
-    static SquareRankFourTensor<double> calculateLibcintIntegrals(const CoulombRepulsionOperator& fq_op, const ScalarBasis<GTOShell>& scalar_basis) {
+    static SquareRankFourTensor<double> calculateLibcintIntegrals(const CoulombRepulsionOperator& fq_op, const ScalarBasis<GTOShell>& scalar_basis, const double screening_threshold = 1.0e-12, const size_t number_of_threads = 1) {
 
         const auto shell_set = scalar_basis.shellSet();
 
         auto engine = IntegralEngine::Libcint(fq_op, shell_set);
-        const auto integrals = IntegralCalculator::calculate(engine, shell_set, shell_set);
-        return integrals[0];
+        const auto integrals = IntegralCalculator::calculateScreened(engine, shell_set, screening_threshold, number_of_threads);
+        return SquareRankFourTensor<double>(integrals[0]);
     }
 };
 
@@ -22,7 +22,9 @@
 #include "Molecule/Molecule.hpp"
 #include "Operator/FirstQuantized/Operator.hpp"
 
+#include <algorithm>
 #include <functional>
+#include <utility>
 
 
 extern "C" {
@@ -197,6 +199,45 @@ public:
         libcint_env {new double[10000]} {}
 
 
+    /**
+     *  Make a deep copy of the raw libcint arrays, so that every copy owns (and deallocates) its own memory.
+     * 
+     *  @param other        the container that should be copied
+     */
+    RawContainer(const RawContainer& other) :
+        RawContainer(other.natm, other.nbf, other.nsh) {
+
+        std::copy(other.libcint_atm, other.libcint_atm + this->natm * atm_slots, this->libcint_atm);
+        std::copy(other.libcint_bas, other.libcint_bas + this->nbf * bas_slots, this->libcint_bas);
+        std::copy(other.libcint_env, other.libcint_env + 10000, this->libcint_env);
+    }
+
+
+    /*
+     *  OPERATORS
+     */
+
+    /**
+     *  Replace the contents of this container by a deep copy of the raw libcint arrays of another one.
+     * 
+     *  @param other        the container that should be copied
+     */
+    RawContainer& operator=(const RawContainer& other) {
+
+        if (this != &other) {
+            RawContainer copy {other};
+            std::swap(this->natm, copy.natm);
+            std::swap(this->nbf, copy.nbf);
+            std::swap(this->nsh, copy.nsh);
+            std::swap(this->libcint_atm, copy.libcint_atm);
+            std::swap(this->libcint_bas, copy.libcint_bas);
+            std::swap(this->libcint_env, copy.libcint_env);
+        }
+
+        return *this;
+    }
+
+
     /*
      *  DESTRUCTOR
      */
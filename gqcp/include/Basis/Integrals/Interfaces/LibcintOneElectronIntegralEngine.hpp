@@ -144,6 +144,11 @@ public:
 
         return std::make_shared<LibcintOneElectronIntegralBuffer<IntegralScalar, N>>(buffer_converted, nbf1, nbf2, result, this->scaling_factor);
     }
+
+    /**
+     *  @return a copy of this engine that has its own internal state, so that it can be used on another thread
+     */
+    std::unique_ptr<BaseOneElectronIntegralEngine<Shell, N, IntegralScalar>> clone() const override { return std::unique_ptr<BaseOneElectronIntegralEngine<Shell, N, IntegralScalar>>(new LibcintOneElectronIntegralEngine(*this)); }
 };
 
 
@@ -108,6 +108,11 @@ public:
         std::vector<double> buffer_converted {libcint_buffer, libcint_buffer + N * nbf1 * nbf2 * nbf3 * nbf4};  // std::vector constructor from .begin() and .end()
         return std::make_shared<LibcintTwoElectronIntegralBuffer<IntegralScalar, N>>(buffer_converted, nbf1, nbf2, nbf3, nbf4, result);
     }
+
+    /**
+     *  @return a copy of this engine that has its own internal state, so that it can be used on another thread
+     */
+    std::unique_ptr<BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>> clone() const override { return std::unique_ptr<BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>>(new LibcintTwoElectronIntegralEngine(*this)); }
 };
 
 
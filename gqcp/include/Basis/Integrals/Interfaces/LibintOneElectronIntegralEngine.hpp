@@ -113,6 +113,11 @@ public:
         this->libint2_engine.compute(libint_shell1, libint_shell2);
         return std::make_shared<LibintOneElectronIntegralBuffer<N>>(libint2_buffer, shell1.numberOfBasisFunctions(), shell2.numberOfBasisFunctions(), this->component_offset, this->scaling_factor);
     }
+
+    /**
+     *  @return a copy of this engine that has its own internal state, so that it can be used on another thread
+     */
+    std::unique_ptr<BaseOneElectronIntegralEngine<GTOShell, N, IntegralScalar>> clone() const override { return std::unique_ptr<BaseOneElectronIntegralEngine<GTOShell, N, IntegralScalar>>(new LibintOneElectronIntegralEngine(*this)); }
 };
 
 
@@ -79,6 +79,11 @@ public:
         this->libint2_engine.compute(libint_shell1, libint_shell2, libint_shell3, libint_shell4);
         return std::make_shared<LibintTwoElectronIntegralBuffer<N>>(libint2_buffer, shell1.numberOfBasisFunctions(), shell2.numberOfBasisFunctions(), shell3.numberOfBasisFunctions(), shell4.numberOfBasisFunctions());
     }
+
+    /**
+     *  @return a copy of this engine that has its own internal state, so that it can be used on another thread
+     */
+    std::unique_ptr<BaseTwoElectronIntegralEngine<GTOShell, N, IntegralScalar>> clone() const override { return std::unique_ptr<BaseTwoElectronIntegralEngine<GTOShell, N, IntegralScalar>>(new LibintTwoElectronIntegralEngine(*this)); }
 };
 
 
@@ -20,21 +20,30 @@
 
 #include "Mathematical/Representation/Matrix.hpp"
 
+#include <vector>
+
 
 namespace GQCP {
 
 
 /**
- *  An implementation of the McMurchie-Davidson expansion coefficients through recurrence relations.
+ *  A table of the McMurchie-Davidson expansion coefficients E^{i,j}_t of the (1-D) overlap distribution of two Cartesian GTOs.
+ * 
+ *  All coefficients with i <= i_max and j <= j_max are calculated upon construction, iteratively through the recurrence relations, such that every coefficient is calculated only once and looking up a coefficient is cheap. One table can therefore be shared by all the integrals over the same pair of primitives.
  */
 class McMurchieDavidsonCoefficient {
 private:
     double K;  // one of the components of the center of the left Cartesian GTO
-    double L;  // one of the components of the center of the left Cartesian GTO
+    double L;  // one of the components of the center of the right Cartesian GTO
 
     double alpha;  // the Gaussian exponent of the left Cartesian GTO
     double beta;   // the Gaussian exponent of the right Cartesian GTO
 
+    int i_max;  // the largest Cartesian exponent of the left Cartesian GTO that is tabulated
+    int j_max;  // the largest Cartesian exponent of the right Cartesian GTO that is tabulated
+
+    std::vector<double> coefficients;  // the tabulated coefficients E^{i,j}_t, with t as the fastest-changing index
+
 
 public:
     // CONSTRUCTORS
@@ -42,10 +51,12 @@ public:
     /**
      *  @param K                one of the components of the center of the left Cartesian GTO
      *  @param alpha            the Gaussian exponent of the left Cartesian GTO
-     *  @param L                one of the components of the center of the left Cartesian GTO
+     *  @param L                one of the components of the center of the right Cartesian GTO
      *  @param beta             the Gaussian exponent of the right Cartesian GTO
+     *  @param i_max            the largest Cartesian exponent of the left Cartesian GTO for which the coefficients should be tabulated
+     *  @param j_max            the largest Cartesian exponent of the right Cartesian GTO for which the coefficients should be tabulated
      */
-    McMurchieDavidsonCoefficient(const double K, const double alpha, const double L, const double beta);
+    McMurchieDavidsonCoefficient(const double K, const double alpha, const double L, const double beta, const int i_max, const int j_max);
 
 
     // OPERATORS
@@ -72,11 +83,31 @@ public:
      */
     double distance() const { return this->K - this->L; }
 
+    /**
+     *  @return the Gaussian exponent of the left Cartesian GTO
+     */
+    double leftGaussianExponent() const { return this->alpha; }
+
+    /**
+     *  @return the largest Cartesian exponent of the left Cartesian GTO that is tabulated
+     */
+    int maximumLeftExponent() const { return this->i_max; }
+
+    /**
+     *  @return the largest Cartesian exponent of the right Cartesian GTO that is tabulated
+     */
+    int maximumRightExponent() const { return this->j_max; }
+
     /**
      *  @return the reduced exponent of the Gaussian overlap distribution
      */
     double reducedExponent() const;
 
+    /**
+     *  @return the Gaussian exponent of the right Cartesian GTO
+     */
+    double rightGaussianExponent() const { return this->beta; }
+
     /**
      *  @return the total exponent of the Gaussian overlap distribution
      */
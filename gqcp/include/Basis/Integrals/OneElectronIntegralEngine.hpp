@@ -119,6 +119,11 @@ public:
 
         return std::make_shared<OneElectronIntegralBuffer<IntegralScalar, N>>(shell1.numberOfBasisFunctions(), shell2.numberOfBasisFunctions(), integrals);
     }
+
+    /**
+     *  @return a copy of this engine that has its own internal state, so that it can be used on another thread
+     */
+    std::unique_ptr<BaseOneElectronIntegralEngine<Shell, N, IntegralScalar>> clone() const override { return std::unique_ptr<BaseOneElectronIntegralEngine<Shell, N, IntegralScalar>>(new OneElectronIntegralEngine(*this)); }
 };
 
 
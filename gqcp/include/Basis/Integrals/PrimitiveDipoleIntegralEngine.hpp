@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "Basis/Integrals/McMurchieDavidsonCoefficient.hpp"
 #include "Basis/Integrals/PrimitiveCartesianOperatorIntegralEngine.hpp"
 #include "Mathematical/Functions/CartesianGTO.hpp"
 #include "Operator/FirstQuantized/ElectronicDipoleOperator.hpp"
@@ -71,6 +72,15 @@ public:
      *  @return the dipole integral over the two given 1-D primitives
      */
     IntegralScalar calculate1D(const double alpha, const double K, const int i, const double beta, const double L, const int j);
+
+    /**
+     *  @param E                the tabulated McMurchie-Davidson coefficients of the two 1-D primitives, which should contain the coefficients up to (i, j)
+     *  @param i                the Cartesian exponent of the left 1-D primitive
+     *  @param j                the Cartesian exponent of the right 1-D primitive
+     * 
+     *  @return the dipole integral over the two given 1-D primitives
+     */
+    IntegralScalar calculate1D(const McMurchieDavidsonCoefficient& E, const int i, const int j);
 };
 
 
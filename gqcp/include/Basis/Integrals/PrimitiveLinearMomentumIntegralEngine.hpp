@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "Basis/Integrals/McMurchieDavidsonCoefficient.hpp"
 #include "Basis/Integrals/PrimitiveCartesianOperatorIntegralEngine.hpp"
 #include "Mathematical/Functions/CartesianGTO.hpp"
 #include "Operator/FirstQuantized/LinearMomentumOperator.hpp"
@@ -61,6 +62,15 @@ public:
      *  @return the linear momentum integral over the two given 1-D primitives
      */
     IntegralScalar calculate1D(const double alpha, const double K, const int i, const double beta, const double L, const int j);
+
+    /**
+     *  @param E                the tabulated McMurchie-Davidson coefficients of the two 1-D primitives, which should contain the coefficients up to (i, j + 1)
+     *  @param i                the Cartesian exponent of the left 1-D primitive
+     *  @param j                the Cartesian exponent of the right 1-D primitive
+     * 
+     *  @return the linear momentum integral over the two given 1-D primitives
+     */
+    IntegralScalar calculate1D(const McMurchieDavidsonCoefficient& E, const int i, const int j);
 };
 
 
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "Basis/Integrals/McMurchieDavidsonCoefficient.hpp"
 #include "Mathematical/Functions/CartesianGTO.hpp"
 #include "Operator/FirstQuantized/OverlapOperator.hpp"
 
@@ -56,6 +57,15 @@ public:
      */
     IntegralScalar calculate1D(const double alpha, const double K, const int i, const double beta, const double L, const int j);
 
+    /**
+     *  @param E                the tabulated McMurchie-Davidson coefficients of the two 1-D primitives, which should contain the coefficients up to (i, j)
+     *  @param i                the Cartesian exponent of the left 1-D primitive
+     *  @param j                the Cartesian exponent of the right 1-D primitive
+     * 
+     *  @return the overlap integral over the two given 1-D primitives
+     */
+    IntegralScalar calculate1D(const McMurchieDavidsonCoefficient& E, const int i, const int j);
+
     /**
      *  Prepare this engine's internal state such that it is able to calculate integrals over the given component of the operator.
      * 
@@ -139,6 +139,74 @@ public:
     }
 
 
+    /**
+     *  Extract the dense block of a full matrix that corresponds to the given occupation types.
+     *
+     *  @tparam Scalar                      the scalar type of the elements of the matrix
+     *
+     *  @param row_type                     the spinor occupation type for the rows
+     *  @param column_type                  the spinor occupation type for the columns
+     *  @param M                            a matrix whose rows and columns are indexed by all the spinors in this orbital space
+     *
+     *  @return the dense block of the given matrix, laid out in the same way as the dense representation of the implicit matrix slices that are created for the same occupation types
+     */
+    template <typename Scalar>
+    MatrixX<Scalar> denseBlockOf(const OccupationType row_type, const OccupationType column_type, const MatrixX<Scalar>& M) const {
+
+        const auto& row_indices = this->indices(row_type);
+        const auto& column_indices = this->indices(column_type);
+
+        MatrixX<Scalar> M_block {static_cast<long>(row_indices.size()), static_cast<long>(column_indices.size())};  // need static_cast for Eigen
+        for (size_t q = 0; q < column_indices.size(); q++) {
+            for (size_t p = 0; p < row_indices.size(); p++) {
+                M_block(p, q) = M(row_indices[p], column_indices[q]);
+            }
+        }
+
+        return M_block;
+    }
+
+
+    /**
+     *  Extract the dense block of a full rank-four tensor that corresponds to the given occupation types.
+     *
+     *  @tparam Scalar                      the scalar type of the elements of the tensor
+     *
+     *  @param axis1_type                   the spinor occupation type for the first tensor axis
+     *  @param axis2_type                   the spinor occupation type for the second tensor axis
+     *  @param axis3_type                   the spinor occupation type for the third tensor axis
+     *  @param axis4_type                   the spinor occupation type for the fourth tensor axis
+     *  @param T                            a rank-four tensor whose axes are indexed by all the spinors in this orbital space
+     *
+     *  @return the dense block of the given tensor, laid out in the same way as the dense representation of the implicit rank-four tensor slices that are created for the same occupation types
+     *
+     *  @note The elements are gathered once into contiguous (column-major) storage, so that contractions with the block can be performed as matrix-matrix multiplications.
+     */
+    template <typename Scalar>
+    Tensor<Scalar, 4> denseBlockOf(const OccupationType axis1_type, const OccupationType axis2_type, const OccupationType axis3_type, const OccupationType axis4_type, const Tensor<Scalar, 4>& T) const {
+
+        const auto& axis1_indices = this->indices(axis1_type);
+        const auto& axis2_indices = this->indices(axis2_type);
+        const auto& axis3_indices = this->indices(axis3_type);
+        const auto& axis4_indices = this->indices(axis4_type);
+
+        Tensor<Scalar, 4> T_block {static_cast<long>(axis1_indices.size()), static_cast<long>(axis2_indices.size()), static_cast<long>(axis3_indices.size()), static_cast<long>(axis4_indices.size())};  // need static_cast for Tensor
+
+        // Loop over the axes in column-major order, so that the block is written contiguously.
+        for (size_t s = 0; s < axis4_indices.size(); s++) {
+            for (size_t r = 0; r < axis3_indices.size(); r++) {
+                for (size_t q = 0; q < axis2_indices.size(); q++) {
+                    for (size_t p = 0; p < axis1_indices.size(); p++) {
+                        T_block(p, q, r, s) = T(axis1_indices[p], axis2_indices[q], axis3_indices[r], axis4_indices[s]);
+                    }
+                }
+            }
+        }
+
+        return T_block;
+    }
+
+
     /**
      *  @return a textual description of this orbital space
      */
@@ -26,6 +26,7 @@
 #include "Basis/Transformations/RTransformation.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
 #include "Operator/FirstQuantized/Operator.hpp"
+#include "Operator/SecondQuantized/CholeskyDecomposedRSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/EvaluatableScalarRSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/RSQTwoElectronOperator.hpp"
@@ -144,6 +145,25 @@ public:
     }
 
 
+    /**
+     *  Quantize the Coulomb operator in this restricted spin-orbital basis, through a pivoted Cholesky decomposition of its integrals in the scalar basis. The full set of integrals is never calculated or stored.
+     * 
+     *  @param fq_op                    The first-quantized Coulomb operator.
+     *  @param threshold                The threshold for the largest remaining diagonal integral, below which the decomposition is stopped. It bounds the error of every integral in the scalar basis.
+     *  @param number_of_threads        The number of threads over which the calculation of the integrals and the transformation of the Cholesky vectors should be distributed.
+     * 
+     *  @return The Cholesky-decomposed second-quantized operator corresponding to the Coulomb operator.
+     * 
+     *  @note This method is only available for real spin-orbital bases.
+     */
+    template <typename Z = ExpansionScalar>
+    enable_if_t<std::is_same<Z, double>::value, CholeskyDecomposedRSQTwoElectronOperator> quantizeCholeskyDecomposed(const CoulombRepulsionOperator& fq_op, const double threshold = 1.0e-08, const size_t number_of_threads = 1) const {
+
+        const auto g = IntegralCalculator::calculateLibintCholeskyDecomposedIntegrals(fq_op, this->scalarBasis(), threshold, number_of_threads);  // in AO/scalar basis
+        return CholeskyDecomposedRSQTwoElectronOperator {g.transformed(this->expansion().matrix(), number_of_threads)};  // in spatial/spin-orbital basis
+    }
+
+
     /**
      *  Quantize the (one-electron) electronic density operator.
      * 
@@ -101,6 +101,11 @@ public:
      *  @return This as an Eigen::JacobiRotation.
      */
     Eigen::JacobiRotation<double> Eigen() const { return Eigen::JacobiRotation<double> {std::cos(this->angle()), std::sin(this->angle())}; }
+
+    /**
+     *  @return The 2x2 block of the Jacobi rotation matrix (cfr. `Transformation::FromJacobi`) that lives in the (p,q)-plane, where the first row and column correspond to p and the second row and column correspond to q.
+     */
+    Eigen::Matrix2d planeMatrix() const;
 };
 
 
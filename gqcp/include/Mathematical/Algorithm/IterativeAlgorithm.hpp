@@ -150,6 +150,17 @@ public:
      */
     template <typename Z = Step<Environment>>
     enable_if_t<std::is_same<Environment, typename Z::Environment>::value, void> replace(const Z& step, const size_t index) { this->steps.replace(step, index); }
+
+
+    /**
+     *  Replace the convergence criterion, e.g. to tighten the threshold of an algorithm that is performed repeatedly.
+     * 
+     *  @tparam Criterion                           the type of the convergence criterion that is used
+     * 
+     *  @param convergence_criterion                the convergence criterion that must be fulfilled in order for the algorithm to have converged
+     */
+    template <typename Criterion>
+    void replaceConvergenceCriterion(const Criterion& convergence_criterion) { this->convergence_criterion = std::make_shared<Criterion>(convergence_criterion); }
 };
 
 
@@ -22,6 +22,7 @@
 #include "Mathematical/Optimization/LinearEquation/LinearEquationSolver.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
 
+#include <type_traits>
 #include <vector>
 
 
@@ -44,19 +45,41 @@ public:
      */
 
     /**
-     *  @param subject              the subject
+     *  @param subjects             the subjects that should be combined, e.g. a std::vector or a window on a BoundedHistory
+     *  @param errors               the error vectors that correspond to the subjects
      * 
      *  @return the DIIS-accelerated subject
      */
-    template <typename Subject>
-    Subject accelerate(const std::vector<Subject>& subjects, const std::vector<VectorX<Scalar>>& errors) const {
+    template <typename Subjects, typename Errors>
+    auto accelerate(const Subjects& subjects, const Errors& errors) const -> typename std::decay<decltype(subjects[0])>::type {
 
-        const auto diis_coefficients = this->calculateDIISCoefficients(errors);
+        using Subject = typename std::decay<decltype(subjects[0])>::type;
+        return this->accelerate(
+            subjects, errors, [](const Subject& subject) -> const Subject& { return subject; }, [](const VectorX<Scalar>& error) -> const VectorX<Scalar>& { return error; });
+    }
+
+
+    /**
+     *  Accelerate a part of composite subjects (e.g. the alpha-component of spin-resolved Fock matrices), without copying those parts out of the subjects.
+     * 
+     *  @param subjects             the composite subjects, e.g. a std::vector or a window on a BoundedHistory
+     *  @param errors               the composite error vectors that correspond to the subjects
+     *  @param subject_part         a function that returns (a reference to) the part of a composite subject that should be accelerated
+     *  @param error_part           a function that returns a reference to the part of a composite error vector that corresponds to that part
+     * 
+     *  @return the DIIS-accelerated part of the subjects
+     */
+    template <typename Subjects, typename Errors, typename SubjectPart, typename ErrorPart>
+    auto accelerate(const Subjects& subjects, const Errors& errors, const SubjectPart& subject_part, const ErrorPart& error_part) const -> typename std::decay<decltype(subject_part(subjects[0]))>::type {
+
+        using Subject = typename std::decay<decltype(subject_part(subjects[0]))>::type;
+
+        const auto diis_coefficients = this->calculateDIISCoefficients(errors, error_part);
 
         // Construct and return the DIIS-accelerated subject
-        Subject accelerated_subject = diis_coefficients(0) * subjects.at(0);  // defaultly initializing may cause problems: the default constructor for a Matrix is a 0x0-matrix
+        Subject accelerated_subject = diis_coefficients(0) * subject_part(subjects[0]);  // defaultly initializing may cause problems: the default constructor for a Matrix is a 0x0-matrix
         for (size_t i = 1; i < errors.size(); i++) {
-            accelerated_subject += diis_coefficients(i) * subjects.at(i);
+            accelerated_subject += diis_coefficients(i) * subject_part(subjects[i]);
         }
         return accelerated_subject;
     }
@@ -65,9 +88,26 @@ public:
     /**
      *  Find the linear combination of errors that minimizes the total error measure in the least squares sense (i.e. according to the DIIS algorithm).
      * 
+     *  @param errors               the error vectors, e.g. a std::vector or a window on a BoundedHistory
+     * 
+     *  @return the coefficients that minimize the error measure
+     */
+    template <typename Errors>
+    VectorX<Scalar> calculateDIISCoefficients(const Errors& errors) const {
+        return this->calculateDIISCoefficients(errors, [](const VectorX<Scalar>& error) -> const VectorX<Scalar>& { return error; });
+    }
+
+
+    /**
+     *  Find the linear combination of (parts of composite) errors that minimizes the total error measure in the least squares sense (i.e. according to the DIIS algorithm).
+     * 
+     *  @param errors               the composite error vectors, e.g. a std::vector or a window on a BoundedHistory
+     *  @param error_part           a function that returns a reference to the part of a composite error vector that should be used
+     * 
      *  @return the coefficients that minimize the error measure
      */
-    VectorX<Scalar> calculateDIISCoefficients(const std::vector<VectorX<Scalar>>& errors) const {
+    template <typename Errors, typename ErrorPart>
+    VectorX<Scalar> calculateDIISCoefficients(const Errors& errors, const ErrorPart& error_part) const {
 
         const auto n = errors.size();
 
@@ -75,10 +115,10 @@ public:
         SquareMatrix<Scalar> B = -1 * SquareMatrix<Scalar>::Ones(n + 1, n + 1);  // +1 for the Lagrange multiplier
         B(n, n) = 0;
         for (size_t i = 0; i < n; i++) {
-            const auto& error_i = errors[i];
+            const auto& error_i = error_part(errors[i]);
 
             for (size_t j = 0; j < n; j++) {
-                const auto& error_j = errors[j];
+                const auto& error_j = error_part(errors[j]);
                 B(i, j) = error_i.dot(error_j);
             }
         }
@@ -33,8 +33,9 @@ namespace GQCP {
  * 
  *  @tparam _Iterate            the type of the iterative variables
  *  @tparam _Environment        the type of the calculation environment
+ *  @tparam _Iterates           the type of the collection in which the environment stores the iterates, e.g. a std::deque or a BoundedHistory
  */
-template <typename _Iterate, typename _Environment>
+template <typename _Iterate, typename _Environment, typename _Iterates = std::deque<_Iterate>>
 class ConsecutiveIteratesNormConvergence:
     public ConvergenceCriterion<_Environment> {
 
@@ -42,6 +43,7 @@ public:
     using Iterate = _Iterate;
     using Scalar = typename Iterate::Scalar;
     using Environment = _Environment;
+    using Iterates = _Iterates;
     static_assert(std::is_same<Scalar, typename Environment::Scalar>::value, "The scalar types of the iterate and environment must match.");
 
 
@@ -50,7 +52,7 @@ private:
 
     std::string iterate_description;  // the description of the the iterates that are compared
 
-    std::function<std::deque<Iterate>(const Environment&)> extractor;  // a function that can extract the correct iterates from the environment, as it's not mandatory to check convergence on the variables, but any iterate (whose .norm() can be calculated) can in principle be used
+    std::function<const Iterates&(const Environment&)> extractor;  // a function that can extract (a reference to) the correct iterates from the environment, as it's not mandatory to check convergence on the variables, but any iterate (whose .norm() can be calculated) can in principle be used
 
 
 public:
@@ -60,11 +62,11 @@ public:
 
     /**
      *  @param threshold                    the threshold that is used in comparing the iterates
-     *  @param extractor                    a function that can extract the correct iterates from the environment. The default is to check the environment on a property called 'variables'
+     *  @param extractor                    a function that can extract (a reference to) the correct iterates from the environment. The default is to check the environment on a property called 'variables'
      *  @param iterate_description          the description of the the iterates that are compared
      */
     ConsecutiveIteratesNormConvergence(
-        const double threshold = 1.0e-08, const std::function<std::deque<Iterate>(const Environment&)> extractor = [](const Environment& environment) { return environment.variables; }, const std::string& iterate_description = "a general iterate") :
+        const double threshold = 1.0e-08, const std::function<const Iterates&(const Environment&)> extractor = [](const Environment& environment) -> const Iterates& { return environment.variables; }, const std::string& iterate_description = "a general iterate") :
         m_threshold {threshold},
         extractor {extractor},
         iterate_description {iterate_description} {}
@@ -89,16 +91,15 @@ public:
      */
     bool isFulfilled(Environment& environment) override {
 
-        const auto iterates = this->extractor(environment);
+        const auto& iterates = this->extractor(environment);
 
         if (iterates.size() < 2) {
             return false;  // we can't calculate convergence
         }
 
-        // Get the two most recent density matrices and compare the norm of their difference
-        const auto second_to_last_it = iterates.end() - 2;  // 'it' for 'iterator'
-        const auto& previous = *second_to_last_it;          // dereference the iterator
-        const auto current = iterates.back();
+        // Get the two most recent iterates and compare the norm of their difference
+        const auto& previous = iterates[iterates.size() - 2];
+        const auto& current = iterates.back();
 
         return ((current - previous).norm() <= this->m_threshold);
     }
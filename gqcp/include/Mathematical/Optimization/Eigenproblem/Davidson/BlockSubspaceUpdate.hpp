@@ -0,0 +1,111 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  A step that adds all projected correction vectors to the subspace at once (if their norm is large enough) and collapses the subspace if it becomes too large.
+ * 
+ *  In contrast to `SubspaceUpdate`, the correction vectors are projected onto the orthogonal complement of the subspace as one block, which replaces the matrix-vector multiplications of the projection by matrix-matrix multiplications.
+ */
+class BlockSubspaceUpdate:
+    public Step<EigenproblemEnvironment> {
+
+
+private:
+    size_t maximum_subspace_dimension;
+    double threshold;  // the threshold on the norm used for determining if a new projected correction vector should be added to the subspace
+
+
+public:
+    /*
+     * CONSTRUCTORS
+     */
+
+    /**
+     *  @param maximum_subspace_dimension           the maximum dimension of the subspace before collapsing
+     *  @param threshold                            the threshold on the norm used for determining if a new projected correction vector should be added to the subspace
+     */
+    BlockSubspaceUpdate(const size_t maximum_subspace_dimension = 30, const double threshold = 1.0e-03) :
+        maximum_subspace_dimension {maximum_subspace_dimension},
+        threshold {threshold} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return a textual description of this algorithmic step
+     */
+    std::string description() const override {
+        return "Add all projected correction vectors to the subspace at once (if their norm is large enough) and collapse the subspace if it becomes too large. The new subspace vectors (after a collapse) are linear combinations of current subspace vectors, with coefficients found in the lowest eigenvectors of the subspace matrix.";
+    }
+
+
+    /**
+     *  Add all projected correction vectors to the subspace at once (if their norm is large enough) and collapse the subspace if it becomes too large. The new subspace vectors (after a collapse) are linear combinations of current subspace vectors, with coefficients found in the lowest eigenvectors of the subspace matrix.
+     * 
+     *  @param environment              the environment that acts as a sort of calculation space
+     */
+    void execute(EigenproblemEnvironment& environment) override {
+
+        auto& V = environment.V;
+        const auto& Delta = environment.Delta;
+
+        // If the subspace will potentially become too large, collapse it in advance. Since X = V Z, the matrix-vector products of the collapsed subspace are VA Z: they don't have to be recalculated, and they can't be left stale either, since the matrix-vector product step only calculates the products for the columns that were added to V.
+        const auto current_subspace_dimension = V.cols();
+        if (static_cast<size_t>(current_subspace_dimension + Delta.cols()) > this->maximum_subspace_dimension) {
+            V = environment.X;
+            environment.VA = environment.VA * environment.Z;
+        }
+
+        // Project all correction vectors on the orthogonal complement of V at once. Since a single classical Gram-Schmidt projection loses orthogonality, we repeat it once.
+        MatrixX<double> W = Delta - V * (V.transpose() * Delta);
+        W -= V * (V.transpose() * W);
+
+        // The projected correction vectors still have to be orthonormalized among each other. The ones that are accepted are moved to the leading columns of W.
+        Eigen::Index number_of_new_vectors = 0;
+        for (Eigen::Index column_index = 0; column_index < Delta.cols(); column_index++) {
+            VectorX<double> w = W.col(column_index);
+            for (Eigen::Index i = 0; i < number_of_new_vectors; i++) {
+                w -= W.col(i).dot(w) * W.col(i);
+            }
+
+            const double norm = w.norm();
+            if (norm > this->threshold) {
+                W.col(number_of_new_vectors) = w / norm;
+                number_of_new_vectors++;
+            }
+        }
+
+        // Add the new vectors to the subspace.
+        V.conservativeResize(Eigen::NoChange, V.cols() + number_of_new_vectors);  // the number of rows doesn't change
+        V.rightCols(number_of_new_vectors) = W.leftCols(number_of_new_vectors);
+    }
+};
+
+
+}  // namespace GQCP
@@ -20,9 +20,14 @@
 
 #include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
 #include "Mathematical/Algorithm/StepCollection.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Davidson/BlockSubspaceUpdate.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/CorrectionVectorCalculation.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Davidson/DavidsonSubspaceStorage.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/GuessVectorUpdate.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Davidson/InPlaceSubspaceUpdate.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Davidson/IncrementalSubspaceMatrixCalculation.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/MatrixVectorProductCalculation.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Davidson/PreallocatedMatrixVectorProductCalculation.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/ResidualVectorCalculation.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/ResidualVectorConvergence.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/SubspaceMatrixCalculation.hpp"
@@ -35,6 +40,45 @@ namespace GQCP {
 namespace EigenproblemSolver {
 
 
+/**
+ *  @param number_of_requested_eigenpairs       the number of solutions the Davidson solver should find
+ *  @param maximum_subspace_dimension           the maximum dimension of the subspace before collapsing, which should be at least twice the number of requested eigenpairs
+ *  @param convergence_threshold                the threshold that is used in determining the norm on the residuals, which determines convergence
+ *  @param correction_threshold                 the threshold used in solving the (approximated) residue correction equation
+ *  @param maximum_number_of_iterations         the maximum number of iterations the algorithm may perform
+ *  @param inclusion_threshold                  the threshold on the norm used for determining if a new projected correction vector should be added to the subspace
+ *  @param subspace_storage                     specifies if the workspaces should be allocated in memory or in memory-mapped files
+ * 
+ *  @return an iterative algorithm that can find the lowest n eigenvectors of a matrix using Davidson's algorithm, in which the subspace vectors V and their matrix-vector products VA are stored in workspaces that are allocated only once, the subspace matrix is updated incrementally and the subspace is collapsed in place
+ * 
+ *  @note After the algorithm has been performed, only the leading `subspace_dimension` columns of the environment's V and VA span the subspace.
+ */
+inline IterativeAlgorithm<EigenproblemEnvironment> PreallocatedDavidson(const size_t number_of_requested_eigenpairs = 1, const size_t maximum_subspace_dimension = 15, const double convergence_threshold = 1.0e-08, double correction_threshold = 1.0e-12, const size_t maximum_number_of_iterations = 128, const double inclusion_threshold = 1.0e-03, const DavidsonSubspaceStorage& subspace_storage = DavidsonSubspaceStorage::InMemory()) {
+
+    if (maximum_subspace_dimension < 2 * number_of_requested_eigenpairs) {
+        throw std::invalid_argument("EigenproblemSolver::PreallocatedDavidson(const size_t, const size_t, const double, double, const size_t, const double, const DavidsonSubspaceStorage&): The maximum subspace dimension should be at least twice the number of requested eigenpairs.");
+    }
+
+
+    // Create the iteration cycle that effectively 'defines' our Davidson solver with preallocated workspaces.
+    StepCollection<EigenproblemEnvironment> davidson_cycle {};
+
+    davidson_cycle
+        .add(PreallocatedMatrixVectorProductCalculation(maximum_subspace_dimension, subspace_storage))
+        .add(IncrementalSubspaceMatrixCalculation())
+        .add(SubspaceMatrixDiagonalization(number_of_requested_eigenpairs))
+        .add(GuessVectorUpdate())
+        .add(ResidualVectorCalculation(number_of_requested_eigenpairs))
+        .add(CorrectionVectorCalculation(number_of_requested_eigenpairs, correction_threshold))  // this solves the residual equations
+        .add(InPlaceSubspaceUpdate(maximum_subspace_dimension, inclusion_threshold));
+
+    // Create a convergence criterion on the norm of the residual vectors
+    const ResidualVectorConvergence<EigenproblemEnvironment> convergence_criterion {convergence_threshold};
+
+    return IterativeAlgorithm<EigenproblemEnvironment>(davidson_cycle, convergence_criterion, maximum_number_of_iterations);
+}
+
+
 /**
  *  @param number_of_requested_eigenpairs       the number of solutions the Davidson solver should find
  *  @param maximum_subspace_dimension           the maximum dimension of the subspace before collapsing
@@ -42,10 +86,18 @@ namespace EigenproblemSolver {
  *  @param correction_threshold                 the threshold used in solving the (approximated) residue correction equation
  *  @param maximum_number_of_iterations         the maximum number of iterations the algorithm may perform
  *  @param inclusion_threshold                  the threshold on the norm used for determining if a new projected correction vector should be added to the subspace
+ *  @param subspace_storage                     specifies if the subspace vectors and their matrix-vector products should be stored in memory or in memory-mapped files
  * 
  *  @return an iterative algorithm that can find the lowest n eigenvectors of a matrix using Davidson's algorithm
+ * 
+ *  @note If memory-mapped storage is requested, the subspace is kept in preallocated out-of-core workspaces (see `PreallocatedDavidson`), so the maximum subspace dimension should then be at least twice the number of requested eigenpairs.
  */
-IterativeAlgorithm<EigenproblemEnvironment> Davidson(const size_t number_of_requested_eigenpairs = 1, const size_t maximum_subspace_dimension = 15, const double convergence_threshold = 1.0e-08, double correction_threshold = 1.0e-12, const size_t maximum_number_of_iterations = 128, const double inclusion_threshold = 1.0e-03) {
+inline IterativeAlgorithm<EigenproblemEnvironment> Davidson(const size_t number_of_requested_eigenpairs = 1, const size_t maximum_subspace_dimension = 15, const double convergence_threshold = 1.0e-08, double correction_threshold = 1.0e-12, const size_t maximum_number_of_iterations = 128, const double inclusion_threshold = 1.0e-03, const DavidsonSubspaceStorage& subspace_storage = DavidsonSubspaceStorage::InMemory()) {
+
+    if (subspace_storage.isMemoryMapped()) {
+        return PreallocatedDavidson(number_of_requested_eigenpairs, maximum_subspace_dimension, convergence_threshold, correction_threshold, maximum_number_of_iterations, inclusion_threshold, subspace_storage);
+    }
+
 
     // Create the iteration cycle that effectively 'defines' our Davidson solver
     StepCollection<EigenproblemEnvironment> davidson_cycle {};
@@ -66,5 +118,48 @@ IterativeAlgorithm<EigenproblemEnvironment> Davidson(const size_t number_of_requ
 }
 
 
+/**
+ *  @param number_of_requested_eigenpairs       the number of solutions the Davidson solver should find
+ *  @param block_size                           the number of (lowest) eigenpairs of the subspace matrix whose correction vectors are added to the subspace in every iteration, which should be at least the number of requested eigenpairs
+ *  @param maximum_subspace_dimension           the maximum dimension of the subspace before collapsing, which should be at least twice the block size
+ *  @param convergence_threshold                the threshold that is used in determining the norm on the residuals of the requested eigenpairs, which determines convergence
+ *  @param correction_threshold                 the threshold used in solving the (approximated) residue correction equation
+ *  @param maximum_number_of_iterations         the maximum number of iterations the algorithm may perform
+ *  @param inclusion_threshold                  the threshold on the norm used for determining if a new projected correction vector should be added to the subspace
+ * 
+ *  @return an iterative algorithm that can find the lowest n eigenvectors of a matrix using a block-Davidson algorithm, in which all correction vectors are added to the subspace as one block and their matrix-vector products are calculated as one block as well
+ * 
+ *  @note The initial subspace should contain at least `block_size` guess vectors.
+ */
+inline IterativeAlgorithm<EigenproblemEnvironment> BlockDavidson(const size_t number_of_requested_eigenpairs, const size_t block_size, const size_t maximum_subspace_dimension = 30, const double convergence_threshold = 1.0e-08, double correction_threshold = 1.0e-12, const size_t maximum_number_of_iterations = 128, const double inclusion_threshold = 1.0e-03) {
+
+    if (block_size < number_of_requested_eigenpairs) {
+        throw std::invalid_argument("EigenproblemSolver::BlockDavidson(const size_t, const size_t, const size_t, const double, double, const size_t, const double): The block size should be at least the number of requested eigenpairs.");
+    }
+
+    if (maximum_subspace_dimension < 2 * block_size) {
+        throw std::invalid_argument("EigenproblemSolver::BlockDavidson(const size_t, const size_t, const size_t, const double, double, const size_t, const double): The maximum subspace dimension should be at least twice the block size.");
+    }
+
+
+    // Create the iteration cycle that effectively 'defines' our block-Davidson solver. All steps act on the whole block of (lowest) eigenpairs of the subspace matrix.
+    StepCollection<EigenproblemEnvironment> davidson_cycle {};
+
+    davidson_cycle
+        .add(MatrixVectorProductCalculation())
+        .add(SubspaceMatrixCalculation())
+        .add(SubspaceMatrixDiagonalization(block_size))
+        .add(GuessVectorUpdate())
+        .add(ResidualVectorCalculation(block_size))
+        .add(CorrectionVectorCalculation(block_size, correction_threshold))  // this solves the residual equations
+        .add(BlockSubspaceUpdate(maximum_subspace_dimension, inclusion_threshold));
+
+    // Create a convergence criterion on the norm of the residual vectors of the requested eigenpairs only.
+    const ResidualVectorConvergence<EigenproblemEnvironment> convergence_criterion {convergence_threshold, number_of_requested_eigenpairs};
+
+    return IterativeAlgorithm<EigenproblemEnvironment>(davidson_cycle, convergence_criterion, maximum_number_of_iterations);
+}
+
+
 }  // namespace EigenproblemSolver
 }  // namespace GQCP
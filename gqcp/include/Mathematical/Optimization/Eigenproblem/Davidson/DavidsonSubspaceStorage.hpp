@@ -0,0 +1,91 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include <stdexcept>
+#include <string>
+
+
+namespace GQCP {
+
+
+/**
+ *  A specification of where the Davidson subspace vectors (V) and their matrix-vector products (VA) should be stored.
+ *
+ *  By default, they are stored in memory. For very large eigenvalue problems, they can be stored in memory-mapped files on a (local) disk instead, so that only the current guesses for the eigenvectors, the residual vectors and the correction vectors have to fit in memory.
+ */
+class DavidsonSubspaceStorage {
+private:
+    // The directory in which the memory-mapped files are created. An empty directory indicates in-memory storage.
+    std::string m_directory;
+
+
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param directory            The directory in which the memory-mapped files are created. An empty directory indicates in-memory storage.
+     */
+    DavidsonSubspaceStorage(const std::string& directory) :
+        m_directory {directory} {}
+
+
+public:
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  @return A specification that stores the subspace vectors and their matrix-vector products in memory.
+     */
+    static DavidsonSubspaceStorage InMemory() { return DavidsonSubspaceStorage(""); }
+
+    /**
+     *  @param directory            The directory in which the memory-mapped files are created. Preferably, this is a directory on a local disk.
+     *
+     *  @return A specification that stores the subspace vectors and their matrix-vector products in memory-mapped files in the given directory.
+     */
+    static DavidsonSubspaceStorage MemoryMapped(const std::string& directory) {
+
+        if (directory.empty()) {
+            throw std::invalid_argument("DavidsonSubspaceStorage::MemoryMapped(const std::string&): The directory should not be empty.");
+        }
+
+        return DavidsonSubspaceStorage(directory);
+    }
+
+
+    /*
+     *  MARK: General information
+     */
+
+    /**
+     *  @return The directory in which the memory-mapped files are created.
+     */
+    const std::string& directory() const { return this->m_directory; }
+
+    /**
+     *  @return If the subspace vectors and their matrix-vector products are stored in memory-mapped files.
+     */
+    bool isMemoryMapped() const { return !this->m_directory.empty(); }
+};
+
+
+}  // namespace GQCP
@@ -52,7 +52,9 @@ public:
     void execute(EigenproblemEnvironment& environment) override {
 
         // X contains the new guesses for the eigenvectors, V is the subspace and Z are the eigenvectors of the subspace matrix
-        environment.X = environment.V * environment.Z;  // X is a linear combination of the current subspace vectors
+        // Only the leading columns of V that correspond to the subspace matrix are used, since V may be a preallocated (memory-mapped) workspace.
+        const auto subspace_dimension = environment.Z.rows();
+        environment.X = environment.subspaceVectors().leftCols(subspace_dimension) * environment.Z;  // X is a linear combination of the current subspace vectors
         environment.eigenvectors = environment.X;
     }
 };
@@ -0,0 +1,129 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
+
+#include <algorithm>
+
+
+namespace GQCP {
+
+
+/**
+ *  A step that adds projected correction vectors to the preallocated subspace workspace (if their norm is large enough) and collapses the subspace in place if it becomes too large.
+ * 
+ *  Upon a collapse, the subspace vectors are replaced by the current guesses for the eigenvectors X = V Z. Since VA Z is then equal to A X and the subspace matrix becomes the diagonal matrix of the subspace eigenvalues, no matrix-vector products or projections have to be recalculated.
+ */
+class InPlaceSubspaceUpdate:
+    public Step<EigenproblemEnvironment> {
+
+
+private:
+    size_t maximum_subspace_dimension;
+    double threshold;  // the threshold on the norm used for determining if a new projected correction vector should be added to the subspace
+
+
+public:
+    /*
+     * CONSTRUCTORS
+     */
+
+    /**
+     *  @param maximum_subspace_dimension           the maximum dimension of the subspace before collapsing
+     *  @param threshold                            the threshold on the norm used for determining if a new projected correction vector should be added to the subspace
+     */
+    InPlaceSubspaceUpdate(const size_t maximum_subspace_dimension = 15, const double threshold = 1.0e-03) :
+        maximum_subspace_dimension {maximum_subspace_dimension},
+        threshold {threshold} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return a textual description of this algorithmic step
+     */
+    std::string description() const override {
+        return "Add projected correction vectors to the preallocated subspace (if their norm is large enough) and collapse the subspace in place if it becomes too large. The new subspace vectors (after a collapse) are linear combinations of current subspace vectors, with coefficients found in the lowest eigenvectors of the subspace matrix.";
+    }
+
+
+    /**
+     *  Add projected correction vectors to the preallocated subspace (if their norm is large enough) and collapse the subspace in place if it becomes too large. The new subspace vectors (after a collapse) are linear combinations of current subspace vectors, with coefficients found in the lowest eigenvectors of the subspace matrix.
+     * 
+     *  @param environment              the environment that acts as a sort of calculation space
+     */
+    void execute(EigenproblemEnvironment& environment) override {
+
+        auto V = environment.subspaceVectors();
+        auto VA = environment.subspaceMatrixVectorProducts();
+        const auto row_block_size = environment.row_block_size;
+        auto& subspace_dimension = environment.subspace_dimension;
+        const auto& Delta = environment.Delta;
+
+        // If the subspace will potentially become too large, collapse it in advance.
+        if (subspace_dimension + Delta.cols() > this->maximum_subspace_dimension) {
+            const auto& Z = environment.Z;
+            const auto collapsed_dimension = Z.cols();
+
+            // The new subspace vectors are the current guesses for the eigenvectors, which have already been calculated.
+            V.leftCols(collapsed_dimension) = environment.X;
+
+            // Transform VA in blocks of rows, so that the temporary that avoids aliasing stays small.
+            for (long row = 0; row < VA.rows(); row += row_block_size) {
+                const auto rows = std::min(row_block_size, VA.rows() - row);
+                VA.block(row, 0, rows, collapsed_dimension) = (VA.block(row, 0, rows, subspace_dimension) * Z).eval();
+            }
+
+            environment.S = SquareMatrix<double>::Zero(collapsed_dimension);
+            environment.S.diagonal() = environment.Lambda;
+            subspace_dimension = collapsed_dimension;
+        }
+
+        // Update the current subspace V with new vectors: add the normalized orthogonal projection of the correction vectors if their norm is large enough.
+        // Note that we can't add more than one vector simultaneously, as the inclusion of one vector changes the subspace, which in turn changes its orthogonal complement.
+        // The projection on the orthogonal complement of V streams through V in blocks of rows: first for the overlaps with the subspace vectors, and then for their subtraction.
+        for (Eigen::Index column_index = 0; column_index < Delta.cols(); column_index++) {
+            VectorX<double> v = Delta.col(column_index);
+
+            VectorX<double> overlaps = VectorX<double>::Zero(subspace_dimension);
+            for (long row = 0; row < V.rows(); row += row_block_size) {
+                const auto rows = std::min(row_block_size, V.rows() - row);
+                overlaps.noalias() += V.block(row, 0, rows, subspace_dimension).transpose() * v.segment(row, rows);
+            }
+
+            for (long row = 0; row < V.rows(); row += row_block_size) {
+                const auto rows = std::min(row_block_size, V.rows() - row);
+                v.segment(row, rows).noalias() -= V.block(row, 0, rows, subspace_dimension) * overlaps;
+            }
+            const double norm = v.norm();
+
+            if (norm > this->threshold) {
+                V.col(subspace_dimension) = v / norm;  // add the new vector to the first unused column of the workspace
+                subspace_dimension++;
+            }
+        }
+    }
+};
+
+
+}  // namespace GQCP
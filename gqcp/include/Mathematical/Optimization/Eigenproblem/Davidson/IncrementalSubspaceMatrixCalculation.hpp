@@ -0,0 +1,84 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
+
+#include <algorithm>
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that updates the subspace matrix, i.e. the projection of the matrix A onto the subspace spanned by the vectors in V, by only calculating the rows and columns that belong to the new subspace vectors.
+ * 
+ *  This step is meant to be used with preallocated workspaces V and VA, in which only the leading `subspace_dimension` columns span the subspace.
+ */
+class IncrementalSubspaceMatrixCalculation:
+    public Step<EigenproblemEnvironment> {
+
+public:
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return a textual description of this algorithmic step
+     */
+    std::string description() const override {
+        return "Update the subspace matrix, i.e. the projection of the matrix A onto the subspace spanned by the vectors in V, by only calculating the rows and columns that belong to the new subspace vectors.";
+    }
+
+
+    /**
+     *  Update the subspace matrix, i.e. the projection of the matrix A onto the subspace spanned by the vectors in V, by only calculating the rows and columns that belong to the new subspace vectors.
+     * 
+     *  @param environment              the environment that acts as a sort of calculation space
+     */
+    void execute(EigenproblemEnvironment& environment) override {
+
+        const auto V = environment.subspaceVectors();              // the subspace of guess vectors
+        const auto VA = environment.subspaceMatrixVectorProducts();  // VA = A * V (implicitly calculated through the matrix-vector product)
+        auto& S = environment.S;                                     // the "subspace matrix": the projection of the matrix A onto the subspace spanned by the vectors in V
+
+        const auto previous_dimension = S.cols();
+        const auto subspace_dimension = static_cast<long>(environment.subspace_dimension);
+        const auto number_of_new_vectors = subspace_dimension - previous_dimension;
+
+        if (number_of_new_vectors <= 0) {
+            return;
+        }
+
+        // Calculate the new columns of the subspace matrix, streaming through V and VA in blocks of rows. Since the subspace matrix is symmetric, the new rows are their transposes.
+        MatrixX<double> new_columns = MatrixX<double>::Zero(subspace_dimension, number_of_new_vectors);
+        for (long row = 0; row < V.rows(); row += environment.row_block_size) {
+            const auto rows = std::min(environment.row_block_size, V.rows() - row);
+            new_columns.noalias() += V.block(row, 0, rows, subspace_dimension).transpose() * VA.block(row, previous_dimension, rows, number_of_new_vectors);
+        }
+
+        S.conservativeResize(subspace_dimension, subspace_dimension);
+        S.rightCols(number_of_new_vectors) = new_columns;
+        S.bottomLeftCorner(number_of_new_vectors, previous_dimension) = new_columns.topRows(previous_dimension).transpose();
+    }
+};
+
+
+}  // namespace GQCP
@@ -42,7 +42,7 @@ public:
      *  @return a textual description of this algorithmic step
      */
     std::string description() const override {
-        return "Calculate the matrix-vector products for all the (new) guess vectors and add them to the environment.";
+        return "Calculate the matrix-vector products for all the (new) guess vectors, as one block, and add them to the environment.";
     }
 
 
@@ -59,7 +59,7 @@ public:
 
 
         auto& VA = environment.VA;  // VA = A * V (implicitly calculated through the matrix-vector product)
-        const auto& matvec = environment.matrix_vector_product_function;
+        const auto& block_matvec = environment.block_matrix_vector_product_function;
 
         // Check how many vectors there currently are in V and in VA: only calculate the expensive matrix-vector product for 'new' vectors.
         // If there is no difference, no matrix-vector products should be calculated.
@@ -82,9 +82,9 @@ public:
                 start_index = vectors_in_VA - 1;  // -1 because of computers
             }
 
-            for (size_t column_index = start_index; column_index < vectors_in_V; column_index++) {
-                VA.col(column_index) = matvec(V.col(column_index));
-            }
+            // All necessary matrix-vector products are calculated as one block, so that a native block implementation only has to traverse the matrix representation once.
+            const auto number_of_vectors = vectors_in_V - start_index;
+            VA.middleCols(start_index, number_of_vectors) = block_matvec(V.middleCols(start_index, number_of_vectors));
         }
     }
 };
@@ -0,0 +1,121 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Davidson/DavidsonSubspaceStorage.hpp"
+#include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
+
+#include <memory>
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the matrix-vector products for the new subspace vectors, in which V and VA are workspaces that are preallocated to the maximum subspace dimension, either in memory or in memory-mapped files.
+ * 
+ *  The number of columns of the subspace matrix S is used as the number of (leading) subspace vectors whose matrix-vector products are already known, so this step should be followed by an `IncrementalSubspaceMatrixCalculation`.
+ */
+class PreallocatedMatrixVectorProductCalculation:
+    public Step<EigenproblemEnvironment> {
+
+private:
+    size_t maximum_subspace_dimension;
+    DavidsonSubspaceStorage subspace_storage;  // specifies if the workspaces should be allocated in memory or in memory-mapped files
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param maximum_subspace_dimension           the maximum dimension of the subspace, i.e. the number of columns of the preallocated workspaces
+     *  @param subspace_storage                     specifies if the workspaces should be allocated in memory or in memory-mapped files
+     */
+    PreallocatedMatrixVectorProductCalculation(const size_t maximum_subspace_dimension = 15, const DavidsonSubspaceStorage& subspace_storage = DavidsonSubspaceStorage::InMemory()) :
+        maximum_subspace_dimension {maximum_subspace_dimension},
+        subspace_storage {subspace_storage} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return a textual description of this algorithmic step
+     */
+    std::string description() const override {
+        return "Calculate the matrix-vector products for the new guess vectors, as one block, and write them into the preallocated workspace VA.";
+    }
+
+
+    /**
+     *  Calculate the matrix-vector products for the new guess vectors, as one block, and write them into the preallocated workspace VA.
+     * 
+     *  @param environment              the environment that acts as a sort of calculation space
+     */
+    void execute(EigenproblemEnvironment& environment) override {
+
+        auto& S = environment.S;  // the subspace matrix
+
+        // In the first iteration, the initial guess vectors span the subspace. We allocate the workspaces only once, for the maximum subspace dimension.
+        if (environment.subspace_dimension == 0) {
+            auto& V = environment.V;
+            auto& VA = environment.VA;
+
+            if (static_cast<size_t>(V.cols()) > this->maximum_subspace_dimension) {
+                throw std::invalid_argument("PreallocatedMatrixVectorProductCalculation::execute(EigenproblemEnvironment&): The number of initial guess vectors exceeds the maximum subspace dimension.");
+            }
+
+            environment.subspace_dimension = V.cols();
+
+            if (this->subspace_storage.isMemoryMapped()) {
+                // Move the initial guess vectors to the memory-mapped workspace, so that the in-memory V and VA can be released.
+                environment.mapped_V = std::make_shared<MemoryMappedMatrix>(V.rows(), this->maximum_subspace_dimension, this->subspace_storage.directory());
+                environment.mapped_VA = std::make_shared<MemoryMappedMatrix>(V.rows(), this->maximum_subspace_dimension, this->subspace_storage.directory());
+                environment.mapped_V->map().leftCols(V.cols()) = V;
+
+                V.resize(0, 0);
+                VA.resize(0, 0);
+            } else {
+                V.conservativeResize(Eigen::NoChange, this->maximum_subspace_dimension);  // the number of rows doesn't change
+                VA.resize(V.rows(), this->maximum_subspace_dimension);
+            }
+
+            S.resize(0, 0);
+        }
+
+
+        // Only calculate the expensive matrix-vector products for the subspace vectors that aren't part of the subspace matrix yet.
+        auto V = environment.subspaceVectors();              // the subspace of guess vectors
+        auto VA = environment.subspaceMatrixVectorProducts();  // VA = A * V (implicitly calculated through the matrix-vector product)
+
+        const auto start_index = S.cols();
+        const auto number_of_vectors = static_cast<long>(environment.subspace_dimension) - start_index;
+
+        if (number_of_vectors > 0) {
+            VA.middleCols(start_index, number_of_vectors) = environment.block_matrix_vector_product_function(V.middleCols(start_index, number_of_vectors));
+        }
+    }
+};
+
+
+}  // namespace GQCP
@@ -66,17 +66,17 @@ public:
      */
     void execute(EigenproblemEnvironment& environment) override {
 
-        const auto dim = environment.dimension;
-
-        const auto& VA = environment.VA;          // VA = A * V (implicitly calculated through the matrix-vector product)
+        const auto VA = environment.subspaceMatrixVectorProducts();  // VA = A * V (implicitly calculated through the matrix-vector product)
         const auto& Z = environment.Z;            // the (requested number of) eigenvectors of the subspace matrix S
         const auto& Lambda = environment.Lambda;  // the (requested number of) eigenvalues of the subspace matrix S
         const auto& X = environment.X;            // contains the new guesses for the eigenvectors (as a linear combination of the current subspace V)
 
         // Calculate the residual vectors: r_i = VA * z_i - Lambda * x_i
-        environment.R = MatrixX<double>::Zero(dim, this->number_of_requested_eigenpairs);
+        // Only the leading columns of VA that correspond to the subspace matrix are used, since VA may be a preallocated workspace. All products VA * z_i are calculated at once, so that VA is only traversed once.
+        const auto subspace_dimension = Z.rows();
+        environment.R = VA.leftCols(subspace_dimension) * Z.leftCols(this->number_of_requested_eigenpairs);
         for (size_t column_index = 0; column_index < this->number_of_requested_eigenpairs; column_index++) {
-            environment.R.col(column_index) = VA * Z.col(column_index) - Lambda(column_index) * X.col(column_index);
+            environment.R.col(column_index) -= Lambda(column_index) * X.col(column_index);
         }
     }
 };
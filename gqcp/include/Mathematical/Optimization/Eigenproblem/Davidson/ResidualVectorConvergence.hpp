@@ -20,6 +20,9 @@
 
 #include "Mathematical/Algorithm/ConvergenceCriterion.hpp"
 
+#include <algorithm>
+#include <limits>
+
 
 namespace GQCP {
 
@@ -39,6 +42,7 @@ public:
 
 private:
     double threshold;  // the threshold that is used in checking the norm of the residual vectors
+    size_t number_of_checked_residual_vectors;  // the number of (leading) residual vectors whose norm should be checked
 
 
 public:
@@ -47,10 +51,12 @@ public:
      */
 
     /**
-     *  @param threshold                    the threshold that is used in checking the norm of the residual vectors
+     *  @param threshold                                the threshold that is used in checking the norm of the residual vectors
+     *  @param number_of_checked_residual_vectors       the number of (leading) residual vectors whose norm should be checked, by default all of them
      */
-    ResidualVectorConvergence(const double threshold = 1.0e-08) :
-        threshold {threshold} {}
+    ResidualVectorConvergence(const double threshold = 1.0e-08, const size_t number_of_checked_residual_vectors = std::numeric_limits<size_t>::max()) :
+        threshold {threshold},
+        number_of_checked_residual_vectors {number_of_checked_residual_vectors} {}
 
 
     /*
@@ -61,7 +67,7 @@ public:
      *  @return a textual description of this algorithmic step
      */
     std::string description() const override {
-        return "A convergence criterion that checks if the norm of each of the residual vectors is smaller than a threshold.";
+        return "A convergence criterion that checks if the norm of each of the (leading) residual vectors is smaller than a threshold.";
     }
 
 
@@ -75,7 +81,8 @@ public:
         const auto& R = environment.R;  // the residual vectors
 
         if (R.cols() > 0) {  // if there are residual vectors available
-            const auto are_any_values_larger = (R.colwise().norm().array() > this->threshold).any();
+            const auto number_of_residual_vectors = std::min<size_t>(this->number_of_checked_residual_vectors, R.cols());
+            const auto are_any_values_larger = (R.leftCols(number_of_residual_vectors).colwise().norm().array() > this->threshold).any();
             return !are_any_values_larger;
         }
 
@@ -75,6 +75,10 @@ public:
 
         // Use our own dense diagonalization algorithm to find the number of requested eigenpairs
         const auto& S = environment.S;
+        if (static_cast<size_t>(S.cols()) < this->number_of_requested_eigenpairs) {
+            throw std::invalid_argument("SubspaceMatrixDiagonalization::execute(EigenproblemEnvironment&): The subspace contains fewer vectors than the number of requested eigenpairs. Please supply more initial guess vectors.");
+        }
+
         auto dense_environment = EigenproblemEnvironment::Dense(S);
         auto dense_diagonalizer = EigenproblemSolver::Dense();
         dense_diagonalizer.perform(dense_environment);
@@ -20,8 +20,11 @@
 
 #include "Mathematical/Optimization/Eigenproblem/Eigenpair.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/MemoryMappedMatrix.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
 
+#include <memory>
+
 
 namespace GQCP {
 
@@ -32,6 +35,7 @@ namespace GQCP {
 class EigenproblemEnvironment {
 public:
     VectorFunction<double> matrix_vector_product_function;  // a vector function that returns the matrix-vector product (i.e. the matrix-vector product representation of the matrix)
+    BlockVectorFunction<double> block_matrix_vector_product_function;  // a function that returns the matrix-vector products for a block of vectors (the columns of a matrix) at once
 
     SquareMatrix<double> A;    // the self-adjoint matrix whose eigenvalue problem should be solved
     VectorX<double> diagonal;  // the diagonal of the matrix
@@ -46,6 +50,10 @@ public:
 
     MatrixX<double> V;   // the subspace of guess vectors in an iterative diagonalization algorithm
     MatrixX<double> VA;  // VA = A * V (implicitly calculated through the matrix-vector product)
+    size_t subspace_dimension = 0;  // the number of leading columns of V (and VA) that span the current subspace, for Davidson variants in which V and VA are preallocated workspaces
+    std::shared_ptr<MemoryMappedMatrix> mapped_V;   // if set, the out-of-core replacement of the preallocated workspace V
+    std::shared_ptr<MemoryMappedMatrix> mapped_VA;  // if set, the out-of-core replacement of the preallocated workspace VA
+    long row_block_size = 4096;                     // the number of rows of the preallocated workspaces that are processed at once, which bounds the amount of (memory-mapped) data that should be resident in memory
     MatrixX<double> X;   // contains the new guesses for the eigenvectors (as a linear combination of the current subspace V)
 
     MatrixX<double> R;      // the residual vectors
@@ -65,15 +73,37 @@ public:
 
     /**
      *  @param matrix_vector_product            a vector function that returns the matrix-vector product (i.e. the matrix-vector product representation of the matrix)
+     *  @param block_matrix_vector_product      a function that returns the matrix-vector products for a block of vectors (the columns of a matrix) at once
      *  @param diagonal                         the diagonal of the matrix whose eigenvalue problem should be solved
+     *  @param V                                a matrix of initial guess vectors (each column of the matrix is an initial guess vector)
      */
-    EigenproblemEnvironment(const VectorFunction<double>& matrix_vector_product_function, const VectorX<double>& diagonal, const MatrixX<double>& V) :
+    EigenproblemEnvironment(const VectorFunction<double>& matrix_vector_product_function, const BlockVectorFunction<double>& block_matrix_vector_product_function, const VectorX<double>& diagonal, const MatrixX<double>& V) :
         dimension {static_cast<size_t>(diagonal.size())},
         matrix_vector_product_function {matrix_vector_product_function},
+        block_matrix_vector_product_function {block_matrix_vector_product_function},
         diagonal {diagonal},
         V {V},
         VA {MatrixX<double>::Zero(V.rows(), 0)} {}  // the initial environment should have no columns in VA
 
+    /**
+     *  @param matrix_vector_product            a vector function that returns the matrix-vector product (i.e. the matrix-vector product representation of the matrix)
+     *  @param diagonal                         the diagonal of the matrix whose eigenvalue problem should be solved
+     *  @param V                                a matrix of initial guess vectors (each column of the matrix is an initial guess vector)
+     * 
+     *  @note Since no native block matrix-vector product is given, the matrix-vector products for a block of vectors are calculated one vector at a time.
+     */
+    EigenproblemEnvironment(const VectorFunction<double>& matrix_vector_product_function, const VectorX<double>& diagonal, const MatrixX<double>& V) :
+        EigenproblemEnvironment(
+            matrix_vector_product_function,
+            [matrix_vector_product_function](const MatrixX<double>& X) {
+                MatrixX<double> AX = MatrixX<double>::Zero(X.rows(), X.cols());
+                for (Eigen::Index column_index = 0; column_index < X.cols(); column_index++) {
+                    AX.col(column_index) = matrix_vector_product_function(X.col(column_index));
+                }
+                return AX;
+            },
+            diagonal, V) {}
+
 
     /*
      *  STATIC PUBLIC METHODS
@@ -95,6 +125,16 @@ public:
      */
     static EigenproblemEnvironment Iterative(const VectorFunction<double>& matrix_vector_product_function, const VectorX<double>& diagonal, const MatrixX<double>& V) { return EigenproblemEnvironment(matrix_vector_product_function, diagonal, V); }
 
+    /**
+     *  @param matrix_vector_product            a vector function that returns the matrix-vector product (i.e. the matrix-vector product representation of the matrix)
+     *  @param block_matrix_vector_product      a function that returns the matrix-vector products for a block of vectors (the columns of a matrix) at once
+     *  @param diagonal                         the diagonal of the matrix whose eigenvalue problem should be solved
+     *  @param V                                a matrix of initial guess vectors (each column of the matrix is an initial guess vector)
+     * 
+     *  @return an environment that can be used to solve the eigenvalue problem for the matrix that is represented by the given (block) matrix-vector products
+     */
+    static EigenproblemEnvironment Iterative(const VectorFunction<double>& matrix_vector_product_function, const BlockVectorFunction<double>& block_matrix_vector_product_function, const VectorX<double>& diagonal, const MatrixX<double>& V) { return EigenproblemEnvironment(matrix_vector_product_function, block_matrix_vector_product_function, diagonal, V); }
+
     /**
      *  @param A                                the matrix whose eigenvalue problem should be solved
      *  @param V                                a matrix of initial guess vectors (each column of the matrix is an initial guess vector)
@@ -104,7 +144,8 @@ public:
     static EigenproblemEnvironment Iterative(const SquareMatrix<double>& A, const MatrixX<double>& V) {
 
         const auto matrix_vector_product_function = [A](const VectorX<double>& x) { return A * x; };
-        return EigenproblemEnvironment::Iterative(matrix_vector_product_function, A.diagonal(), V);
+        const auto block_matrix_vector_product_function = [A](const MatrixX<double>& X) { return A * X; };
+        return EigenproblemEnvironment::Iterative(matrix_vector_product_function, block_matrix_vector_product_function, A.diagonal(), V);
     }
 
 
@@ -112,6 +153,20 @@ public:
      *  PUBLIC METHODS
      */
 
+    /**
+     *  @return a writable view on the subspace vectors, i.e. on the memory-mapped workspace if it has been set up and on V otherwise
+     */
+    Eigen::Map<Eigen::MatrixXd> subspaceVectors() {
+        return this->mapped_V ? this->mapped_V->map() : Eigen::Map<Eigen::MatrixXd>(this->V.data(), this->V.rows(), this->V.cols());
+    }
+
+    /**
+     *  @return a writable view on the matrix-vector products of the subspace vectors, i.e. on the memory-mapped workspace if it has been set up and on VA otherwise
+     */
+    Eigen::Map<Eigen::MatrixXd> subspaceMatrixVectorProducts() {
+        return this->mapped_VA ? this->mapped_VA->map() : Eigen::Map<Eigen::MatrixXd>(this->VA.data(), this->VA.rows(), this->VA.cols());
+    }
+
     /**
      *  @param number_of_requested_eigenpairs               the number of eigenpairs you would like to retrieve
      * 
@@ -29,7 +29,7 @@ namespace EigenproblemSolver {
 /**
  *  @return an algorithm that can diagonalize a dense matrix
  */
-Algorithm<EigenproblemEnvironment> Dense() {
+inline Algorithm<EigenproblemEnvironment> Dense() {
 
     // Our dense eigenproblem solver is just a wrapper around Eigen's routines.
     StepCollection<EigenproblemEnvironment> steps {};
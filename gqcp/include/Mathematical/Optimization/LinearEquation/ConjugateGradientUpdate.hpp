@@ -0,0 +1,110 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/LinearEquation/LinearEquationEnvironment.hpp"
+
+#include <cmath>
+
+
+namespace GQCP {
+
+
+/**
+ *  A step that performs one iteration of the (Jacobi-)preconditioned conjugate gradient algorithm, for every right-hand side at once. The left-hand side matrix should be self-adjoint and positive definite.
+ * 
+ *  In the first iteration, the residual vectors of the initial guesses are calculated. Afterwards, every iteration requires one block matrix-vector product for the search directions of all right-hand sides.
+ * 
+ *  @tparam _Scalar             the scalar type of the elements of the vectors and matrices
+ */
+template <typename _Scalar>
+class ConjugateGradientUpdate:
+    public Step<LinearEquationEnvironment<_Scalar>> {
+
+public:
+    using Scalar = _Scalar;
+
+
+public:
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return a textual description of this algorithmic step
+     */
+    std::string description() const override {
+        return "Update the solutions, the residual vectors and the search directions through one iteration of the preconditioned conjugate gradient algorithm.";
+    }
+
+
+    /**
+     *  Update the solutions, the residual vectors and the search directions through one iteration of the preconditioned conjugate gradient algorithm.
+     * 
+     *  @param environment              the environment that this step can read from and write to
+     */
+    void execute(LinearEquationEnvironment<Scalar>& environment) override {
+
+        auto& x = environment.x;  // the current solutions
+        auto& R = environment.R;  // the residual vectors
+        auto& Z = environment.Z;  // the preconditioned residual vectors
+        auto& P = environment.P;  // the search directions
+        const auto& block_matvec = environment.block_matrix_vector_product_function;
+
+        // In the first iteration, the residual vectors are calculated from the initial guesses. The initial search directions are the preconditioned residual vectors.
+        if (environment.krylov_dimension == 0) {
+            R = environment.b - block_matvec(x);
+            Z = environment.precondition(R);
+            P = Z;
+        }
+
+
+        // Calculate the matrix-vector products of all search directions as one block, and update the solutions and the residual vectors.
+        const MatrixX<Scalar> AP = block_matvec(P);
+        const auto number_of_equations = x.cols();
+
+        VectorX<Scalar> rz = VectorX<Scalar>::Zero(number_of_equations);  // the inner products r^H M^(-1) r before the update
+        for (Eigen::Index column_index = 0; column_index < number_of_equations; column_index++) {
+            rz(column_index) = R.col(column_index).dot(Z.col(column_index));
+            const Scalar pAp = P.col(column_index).dot(AP.col(column_index));
+
+            // If the search direction vanishes, its right-hand side has been solved exactly.
+            const Scalar alpha = (std::abs(pAp) > 0.0) ? rz(column_index) / pAp : Scalar {0.0};
+            x.col(column_index) += alpha * P.col(column_index);
+            R.col(column_index) -= alpha * AP.col(column_index);
+        }
+
+
+        // Update the search directions such that they are A-conjugate to the previous ones.
+        Z = environment.precondition(R);
+        for (Eigen::Index column_index = 0; column_index < number_of_equations; column_index++) {
+            const Scalar rz_new = R.col(column_index).dot(Z.col(column_index));
+            const Scalar beta = (std::abs(rz(column_index)) > 0.0) ? rz_new / rz(column_index) : Scalar {0.0};
+
+            P.col(column_index) = Z.col(column_index) + beta * P.col(column_index);
+        }
+
+        environment.krylov_dimension++;
+        environment.residual_norms = R.colwise().norm().transpose();
+    }
+};
+
+
+}  // namespace GQCP
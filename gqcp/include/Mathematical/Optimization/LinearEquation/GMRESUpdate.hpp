@@ -0,0 +1,178 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/LinearEquation/LinearEquationEnvironment.hpp"
+
+#include <Eigen/Jacobi>
+
+#include <cmath>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A step that performs one iteration of the restarted generalized minimal residual (GMRES) algorithm with right (Jacobi) preconditioning, for every right-hand side at once. The left-hand side matrix may be non-self-adjoint.
+ * 
+ *  Every iteration extends the Krylov subspace of every right-hand side by one Arnoldi vector, which requires one block matrix-vector product. The Hessenberg matrices are reduced to upper triangular form by Givens rotations as they grow, so that the residual norms are available without any extra matrix-vector products and the solutions can be updated in every iteration. When the Krylov subspace reaches its maximum dimension, the algorithm is restarted from the current solutions.
+ * 
+ *  @tparam _Scalar             the scalar type of the elements of the vectors and matrices
+ */
+template <typename _Scalar>
+class GMRESUpdate:
+    public Step<LinearEquationEnvironment<_Scalar>> {
+
+public:
+    using Scalar = _Scalar;
+
+
+private:
+    size_t maximum_subspace_dimension;  // the maximum dimension of the Krylov subspace, after which the algorithm is restarted
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param maximum_subspace_dimension           the maximum dimension of the Krylov subspace, after which the algorithm is restarted
+     */
+    GMRESUpdate(const size_t maximum_subspace_dimension = 30) :
+        maximum_subspace_dimension {maximum_subspace_dimension} {
+
+        if (maximum_subspace_dimension == 0) {
+            throw std::invalid_argument("GMRESUpdate(const size_t): The maximum subspace dimension should be at least one.");
+        }
+    }
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return a textual description of this algorithmic step
+     */
+    std::string description() const override {
+        return "Extend the Krylov subspace with one Arnoldi vector (restarting if it has become too large) and update the solutions through one iteration of the right-preconditioned GMRES algorithm.";
+    }
+
+
+    /**
+     *  Extend the Krylov subspace with one Arnoldi vector (restarting if it has become too large) and update the solutions through one iteration of the right-preconditioned GMRES algorithm.
+     * 
+     *  @param environment              the environment that this step can read from and write to
+     */
+    void execute(LinearEquationEnvironment<Scalar>& environment) override {
+
+        auto& x = environment.x;  // the current solutions
+        const auto& block_matvec = environment.block_matrix_vector_product_function;
+
+        const auto dim = x.rows();
+        const auto number_of_equations = x.cols();
+        const auto m = this->maximum_subspace_dimension;
+
+        auto& V = environment.krylov_bases;
+        auto& H = environment.hessenberg_matrices;
+        auto& rotations = environment.givens_rotations;
+        auto& g = environment.g;
+        auto& residual_norms = environment.residual_norms;
+
+        // (Re)start the Arnoldi process from the residual vectors of the current solutions. This is the only place where the residual vectors are calculated explicitly.
+        if ((environment.krylov_dimension == 0) || (environment.krylov_dimension == m)) {
+            const MatrixX<Scalar> R = environment.b - block_matvec(x);
+
+            environment.x_restart = x;
+            environment.krylov_dimension = 0;
+
+            V.assign(number_of_equations, MatrixX<Scalar>::Zero(dim, m + 1));
+            H.assign(number_of_equations, MatrixX<Scalar>::Zero(m + 1, m));
+            rotations.assign(number_of_equations, std::vector<Eigen::JacobiRotation<Scalar>>(m));
+            g = MatrixX<Scalar>::Zero(m + 1, number_of_equations);
+
+            residual_norms = R.colwise().norm().transpose();
+            for (Eigen::Index column_index = 0; column_index < number_of_equations; column_index++) {
+                if (residual_norms(column_index) > 0.0) {
+                    V[column_index].col(0) = R.col(column_index) / residual_norms(column_index);
+                    g(0, column_index) = residual_norms(column_index);
+                }
+            }
+        }
+
+        const auto k = environment.krylov_dimension;  // the index of the Arnoldi vector that is added in this iteration
+
+
+        // Calculate the matrix-vector products of the preconditioned last Arnoldi vectors as one block. A right-hand side with a vanishing residual has been solved exactly, and its Arnoldi vector is zero.
+        MatrixX<Scalar> V_last = MatrixX<Scalar>::Zero(dim, number_of_equations);
+        for (Eigen::Index column_index = 0; column_index < number_of_equations; column_index++) {
+            V_last.col(column_index) = V[column_index].col(k);
+        }
+        const MatrixX<Scalar> AMV = block_matvec(environment.precondition(V_last));
+
+
+        for (Eigen::Index column_index = 0; column_index < number_of_equations; column_index++) {
+            if (residual_norms(column_index) == 0.0) {
+                continue;
+            }
+
+            auto& V_i = V[column_index];
+            auto& H_i = H[column_index];
+            auto& rotations_i = rotations[column_index];
+
+            // Orthogonalize the new vector against the Krylov subspace through modified Gram-Schmidt.
+            VectorX<Scalar> w = AMV.col(column_index);
+            for (size_t j = 0; j <= k; j++) {
+                H_i(j, k) = V_i.col(j).dot(w);
+                w -= H_i(j, k) * V_i.col(j);
+            }
+            H_i(k + 1, k) = w.norm();
+            if (std::abs(H_i(k + 1, k)) > 0.0) {
+                V_i.col(k + 1) = w / H_i(k + 1, k);
+            }
+
+
+            // Apply the previous Givens rotations to the new column of the Hessenberg matrix, and eliminate its sub-diagonal element with a new one.
+            for (size_t j = 0; j < k; j++) {
+                H_i.col(k).applyOnTheLeft(j, j + 1, rotations_i[j].adjoint());
+            }
+
+            Scalar r;
+            rotations_i[k].makeGivens(H_i(k, k), H_i(k + 1, k), &r);
+            H_i(k, k) = r;
+            H_i(k + 1, k) = 0.0;
+            g.col(column_index).applyOnTheLeft(k, k + 1, rotations_i[k].adjoint());
+
+            residual_norms(column_index) = std::abs(g(k + 1, column_index));
+
+
+            // Update the solution from the solution of the triangular least-squares problem in the current Krylov subspace.
+            const VectorX<Scalar> y = H_i.topLeftCorner(k + 1, k + 1).template triangularView<Eigen::Upper>().solve(g.col(column_index).head(k + 1));
+            x.col(column_index) = environment.x_restart.col(column_index) + environment.precondition(V_i.leftCols(k + 1) * y);
+        }
+
+        environment.krylov_dimension++;
+    }
+};
+
+
+}  // namespace GQCP
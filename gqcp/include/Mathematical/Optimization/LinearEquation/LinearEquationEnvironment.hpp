@@ -21,6 +21,11 @@
 #include "Mathematical/Optimization/OptimizationEnvironment.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
 
+#include <Eigen/Jacobi>
+
+#include <stdexcept>
+#include <vector>
+
 
 namespace GQCP {
 
@@ -40,7 +45,37 @@ public:
     MatrixX<Scalar> A;  // the matrix that corresponds to the left-hand side of the linear system of equations
     MatrixX<Scalar> b;  // the matrix/vector that corresponds to the right-hand side of the linear system of equations
 
-    MatrixX<Scalar> x;  // the matrix/vector of solutions
+    MatrixX<Scalar> x;  // the matrix/vector of solutions (for iterative solvers, it initially contains the guesses)
+
+    BlockVectorFunction<Scalar> block_matrix_vector_product_function;  // a function that returns the matrix-vector products of the left-hand side matrix with a block of vectors (the columns of a matrix) at once
+    VectorX<Scalar> diagonal;                                          // the diagonal of the left-hand side matrix, which is used as a (Jacobi) preconditioner
+    double preconditioner_threshold = 1.0e-08;                         // the threshold on the absolute value of a diagonal element, below which the corresponding residual element isn't preconditioned
+
+    size_t krylov_dimension = 0;  // the number of iterations since the iterative solver has been (re)started, i.e. the dimension of the current Krylov subspace
+    VectorX<double> residual_norms;  // the norm of the residual vector (or an estimate thereof) for every right-hand side
+
+    MatrixX<Scalar> R;  // the residual vectors (conjugate gradient)
+    MatrixX<Scalar> Z;  // the preconditioned residual vectors (conjugate gradient)
+    MatrixX<Scalar> P;  // the search directions (conjugate gradient)
+
+    MatrixX<Scalar> Q_previous;       // the previous (unnormalized) Lanczos vectors (MINRES)
+    MatrixX<Scalar> Q;                // the current (unnormalized) Lanczos vectors (MINRES)
+    MatrixX<Scalar> Y;                // the preconditioned current Lanczos vectors (MINRES)
+    MatrixX<Scalar> W_previous;       // the previous search directions (MINRES)
+    MatrixX<Scalar> W;                // the current search directions (MINRES)
+    VectorX<double> beta_previous;    // the previous off-diagonal elements of the Lanczos tridiagonal matrix (MINRES)
+    VectorX<double> beta;             // the current off-diagonal elements of the Lanczos tridiagonal matrix (MINRES)
+    VectorX<double> delta_bar;        // the rotated sub-diagonal elements of the Lanczos tridiagonal matrix (MINRES)
+    VectorX<double> epsilon;          // the rotated second super-diagonal elements of the Lanczos tridiagonal matrix (MINRES)
+    VectorX<double> givens_cosines;   // the cosines of the last Givens rotations (MINRES)
+    VectorX<double> givens_sines;     // the sines of the last Givens rotations (MINRES)
+    VectorX<double> phi_bar;          // the rotated right-hand sides of the least-squares problems, whose absolute values equal the norms of the preconditioned residuals (MINRES)
+
+    MatrixX<Scalar> x_restart;                                             // the solutions at the (re)start of the current Krylov subspace (GMRES)
+    std::vector<MatrixX<Scalar>> krylov_bases;                              // an orthonormal basis of the Krylov subspace for every right-hand side (GMRES)
+    std::vector<MatrixX<Scalar>> hessenberg_matrices;                       // the Arnoldi Hessenberg matrices, that have been reduced to upper triangular form through Givens rotations (GMRES)
+    std::vector<std::vector<Eigen::JacobiRotation<Scalar>>> givens_rotations;  // the Givens rotations that reduce every Hessenberg matrix to upper triangular form (GMRES)
+    MatrixX<Scalar> g;                                                      // the rotated right-hand sides of the least-squares problems (GMRES)
 
 
 public:
@@ -55,6 +90,112 @@ public:
     LinearEquationEnvironment(const MatrixX<Scalar>& A, const MatrixX<Scalar>& b) :
         A {A},
         b {b} {}
+
+
+    /**
+     *  @param block_matrix_vector_product_function     a function that returns the matrix-vector products of the left-hand side matrix with a block of vectors (the columns of a matrix) at once
+     *  @param diagonal                                 the diagonal of the left-hand side matrix, which is used as a (Jacobi) preconditioner. If it is empty, no preconditioner is used.
+     *  @param b                                        the matrix/vector that corresponds to the right-hand side of the linear system of equations: every column is a right-hand side
+     *  @param x                                        the initial guesses for the solutions. If it is empty, zero vectors are used.
+     */
+    LinearEquationEnvironment(const BlockVectorFunction<Scalar>& block_matrix_vector_product_function, const VectorX<Scalar>& diagonal, const MatrixX<Scalar>& b, const MatrixX<Scalar>& x) :
+        b {b},
+        x {(x.size() == 0) ? MatrixX<Scalar>::Zero(b.rows(), b.cols()) : x},
+        block_matrix_vector_product_function {block_matrix_vector_product_function},
+        diagonal {diagonal} {
+
+        if ((this->x.rows() != b.rows()) || (this->x.cols() != b.cols())) {
+            throw std::invalid_argument("LinearEquationEnvironment(const BlockVectorFunction<Scalar>&, const VectorX<Scalar>&, const MatrixX<Scalar>&, const MatrixX<Scalar>&): The initial guesses are not compatible with the right-hand sides.");
+        }
+
+        if ((diagonal.size() != 0) && (diagonal.size() != b.rows())) {
+            throw std::invalid_argument("LinearEquationEnvironment(const BlockVectorFunction<Scalar>&, const VectorX<Scalar>&, const MatrixX<Scalar>&, const MatrixX<Scalar>&): The diagonal is not compatible with the right-hand sides.");
+        }
+    }
+
+
+    /*
+     *  STATIC PUBLIC METHODS
+     */
+
+    /**
+     *  @param A            the matrix that corresponds to the left-hand side of the linear system of equations
+     *  @param b            the matrix/vector that corresponds to the right-hand side of the linear system of equations
+     * 
+     *  @return an environment that can be used to solve the linear system of equations through a decomposition of the given dense matrix
+     */
+    static LinearEquationEnvironment<Scalar> Dense(const MatrixX<Scalar>& A, const MatrixX<Scalar>& b) { return LinearEquationEnvironment<Scalar>(A, b); }
+
+    /**
+     *  @param matrix_vector_product_function       a vector function that returns the matrix-vector product of the left-hand side matrix with a vector
+     *  @param diagonal                             the diagonal of the left-hand side matrix, which is used as a (Jacobi) preconditioner. If it is empty, no preconditioner is used.
+     *  @param b                                    the matrix/vector that corresponds to the right-hand side of the linear system of equations: every column is a right-hand side
+     *  @param x                                    the initial guesses for the solutions. If it is empty, zero vectors are used.
+     * 
+     *  @return an environment that can be used to solve the linear system of equations for the matrix that is represented by the given matrix-vector product
+     * 
+     *  @note Since no native block matrix-vector product is given, the matrix-vector products for a block of vectors are calculated one vector at a time.
+     */
+    static LinearEquationEnvironment<Scalar> Iterative(const VectorFunction<Scalar>& matrix_vector_product_function, const VectorX<Scalar>& diagonal, const MatrixX<Scalar>& b, const MatrixX<Scalar>& x = MatrixX<Scalar> {}) {
+
+        const auto block_matrix_vector_product_function = [matrix_vector_product_function](const MatrixX<Scalar>& X) {
+            MatrixX<Scalar> AX = MatrixX<Scalar>::Zero(X.rows(), X.cols());
+            for (Eigen::Index column_index = 0; column_index < X.cols(); column_index++) {
+                AX.col(column_index) = matrix_vector_product_function(X.col(column_index));
+            }
+            return AX;
+        };
+
+        return LinearEquationEnvironment<Scalar>(block_matrix_vector_product_function, diagonal, b, x);
+    }
+
+    /**
+     *  @param matrix_vector_product_function           a vector function that returns the matrix-vector product of the left-hand side matrix with a vector
+     *  @param block_matrix_vector_product_function     a function that returns the matrix-vector products of the left-hand side matrix with a block of vectors (the columns of a matrix) at once
+     *  @param diagonal                                 the diagonal of the left-hand side matrix, which is used as a (Jacobi) preconditioner. If it is empty, no preconditioner is used.
+     *  @param b                                        the matrix/vector that corresponds to the right-hand side of the linear system of equations: every column is a right-hand side
+     *  @param x                                        the initial guesses for the solutions. If it is empty, zero vectors are used.
+     * 
+     *  @return an environment that can be used to solve the linear system of equations for the matrix that is represented by the given block matrix-vector product
+     * 
+     *  @note The iterative solvers only use the block matrix-vector product, so that all right-hand sides are handled in one traversal of the matrix representation. The single-vector product is accepted for symmetry with `EigenproblemEnvironment::Iterative`.
+     */
+    static LinearEquationEnvironment<Scalar> Iterative(const VectorFunction<Scalar>& matrix_vector_product_function, const BlockVectorFunction<Scalar>& block_matrix_vector_product_function, const VectorX<Scalar>& diagonal, const MatrixX<Scalar>& b, const MatrixX<Scalar>& x = MatrixX<Scalar> {}) { return LinearEquationEnvironment<Scalar>(block_matrix_vector_product_function, diagonal, b, x); }
+
+    /**
+     *  @param A            the matrix that corresponds to the left-hand side of the linear system of equations
+     *  @param b            the matrix/vector that corresponds to the right-hand side of the linear system of equations: every column is a right-hand side
+     *  @param x            the initial guesses for the solutions. If it is empty, zero vectors are used.
+     * 
+     *  @return an environment that can be used to solve the linear system of equations iteratively, through matrix-vector products with the given dense matrix
+     */
+    static LinearEquationEnvironment<Scalar> Iterative(const MatrixX<Scalar>& A, const MatrixX<Scalar>& b, const MatrixX<Scalar>& x = MatrixX<Scalar> {}) {
+
+        const auto block_matrix_vector_product_function = [A](const MatrixX<Scalar>& X) { return MatrixX<Scalar> {A * X}; };
+        return LinearEquationEnvironment<Scalar>(block_matrix_vector_product_function, A.diagonal(), b, x);
+    }
+
+
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  Apply the (Jacobi) preconditioner, i.e. divide every element of the given vectors by the absolute value of the corresponding diagonal element. Elements whose diagonal element is smaller than the preconditioner threshold aren't scaled, so that the preconditioner stays positive definite.
+     * 
+     *  @param X            the vectors (the columns of a matrix) that should be preconditioned
+     * 
+     *  @return the preconditioned vectors
+     */
+    MatrixX<Scalar> precondition(const MatrixX<Scalar>& X) const {
+
+        if (this->diagonal.size() == 0) {
+            return X;
+        }
+
+        const Eigen::ArrayXd scaling = (this->diagonal.array().abs() > this->preconditioner_threshold).select(this->diagonal.array().abs().inverse(), 1.0);
+        return MatrixX<Scalar> {X.array().colwise() * scaling.cast<Scalar>()};
+    }
 };
 
 
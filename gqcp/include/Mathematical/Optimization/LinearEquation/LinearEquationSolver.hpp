@@ -19,9 +19,14 @@
 
 
 #include "Mathematical/Algorithm/Algorithm.hpp"
+#include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
 #include "Mathematical/Optimization/LinearEquation/ColPivHouseholderQRSolution.hpp"
+#include "Mathematical/Optimization/LinearEquation/ConjugateGradientUpdate.hpp"
+#include "Mathematical/Optimization/LinearEquation/GMRESUpdate.hpp"
 #include "Mathematical/Optimization/LinearEquation/HouseholderQRSolution.hpp"
 #include "Mathematical/Optimization/LinearEquation/LinearEquationEnvironment.hpp"
+#include "Mathematical/Optimization/LinearEquation/MINRESUpdate.hpp"
+#include "Mathematical/Optimization/LinearEquation/ResidualNormConvergence.hpp"
 
 
 namespace GQCP {
@@ -57,6 +62,45 @@ public:
     }
 
 
+    /**
+     *  @param convergence_threshold                the threshold on the norms of the residual vectors, which determines convergence
+     *  @param maximum_number_of_iterations         the maximum number of iterations the algorithm may perform
+     * 
+     *  @return an iterative linear equations solver that uses the (Jacobi-)preconditioned conjugate gradient algorithm, which requires a self-adjoint, positive definite left-hand side matrix
+     * 
+     *  @note The environment should be set up with `LinearEquationEnvironment::Iterative`. Every iteration requires one block matrix-vector product for all right-hand sides.
+     */
+    static IterativeAlgorithm<LinearEquationEnvironment<Scalar>> ConjugateGradient(const double convergence_threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        StepCollection<LinearEquationEnvironment<Scalar>> conjugate_gradient_cycle {};
+        conjugate_gradient_cycle.add(ConjugateGradientUpdate<Scalar>());
+
+        const ResidualNormConvergence<Scalar> convergence_criterion {convergence_threshold};
+
+        return IterativeAlgorithm<LinearEquationEnvironment<Scalar>>(conjugate_gradient_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
+    /**
+     *  @param maximum_subspace_dimension           the maximum dimension of the Krylov subspace, after which the algorithm is restarted
+     *  @param convergence_threshold                the threshold on the norms of the residual vectors, which determines convergence
+     *  @param maximum_number_of_iterations         the maximum number of iterations the algorithm may perform
+     * 
+     *  @return an iterative linear equations solver that uses the restarted, right-preconditioned GMRES algorithm, which can handle any non-singular left-hand side matrix
+     * 
+     *  @note The environment should be set up with `LinearEquationEnvironment::Iterative`. Every iteration requires one block matrix-vector product for all right-hand sides, and every (re)start requires an extra one to calculate the residual vectors.
+     */
+    static IterativeAlgorithm<LinearEquationEnvironment<Scalar>> GMRES(const size_t maximum_subspace_dimension = 30, const double convergence_threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        StepCollection<LinearEquationEnvironment<Scalar>> gmres_cycle {};
+        gmres_cycle.add(GMRESUpdate<Scalar>(maximum_subspace_dimension));
+
+        const ResidualNormConvergence<Scalar> convergence_criterion {convergence_threshold};
+
+        return IterativeAlgorithm<LinearEquationEnvironment<Scalar>>(gmres_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
     /**
      *  @return a linear equations solver that uses the Householder QR algorithm
      */
@@ -68,6 +112,25 @@ public:
 
         return Algorithm<LinearEquationEnvironment<Scalar>>(householder_steps);
     }
+
+
+    /**
+     *  @param convergence_threshold                the threshold on the norms of the (preconditioned) residual vectors, which determines convergence
+     *  @param maximum_number_of_iterations         the maximum number of iterations the algorithm may perform
+     * 
+     *  @return an iterative linear equations solver that uses the (Jacobi-)preconditioned MINRES algorithm, which requires a self-adjoint, but possibly indefinite, left-hand side matrix
+     * 
+     *  @note The environment should be set up with `LinearEquationEnvironment::Iterative`. Every iteration requires one block matrix-vector product for all right-hand sides. The residual norms that are checked are the ones in the metric of the inverse preconditioner, which MINRES minimizes.
+     */
+    static IterativeAlgorithm<LinearEquationEnvironment<Scalar>> MINRES(const double convergence_threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        StepCollection<LinearEquationEnvironment<Scalar>> minres_cycle {};
+        minres_cycle.add(MINRESUpdate<Scalar>());
+
+        const ResidualNormConvergence<Scalar> convergence_criterion {convergence_threshold};
+
+        return IterativeAlgorithm<LinearEquationEnvironment<Scalar>>(minres_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
 };
 
 
@@ -0,0 +1,168 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/LinearEquation/LinearEquationEnvironment.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+namespace GQCP {
+
+
+/**
+ *  A step that performs one iteration of the (Jacobi-)preconditioned minimal residual (MINRES) algorithm of Paige and Saunders, for every right-hand side at once. The left-hand side matrix should be self-adjoint, but may be indefinite.
+ * 
+ *  Every iteration extends the Krylov subspace by one Lanczos vector and updates the solution through short recurrences, so that only a fixed number of vectors per right-hand side has to be stored. The norms of the preconditioned residuals are available as a by-product of the QR decomposition of the Lanczos tridiagonal matrix.
+ * 
+ *  @tparam _Scalar             the scalar type of the elements of the vectors and matrices
+ */
+template <typename _Scalar>
+class MINRESUpdate:
+    public Step<LinearEquationEnvironment<_Scalar>> {
+
+public:
+    using Scalar = _Scalar;
+
+
+public:
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return a textual description of this algorithmic step
+     */
+    std::string description() const override {
+        return "Extend the Krylov subspace with one Lanczos vector and update the solutions through one iteration of the preconditioned MINRES algorithm.";
+    }
+
+
+    /**
+     *  Extend the Krylov subspace with one Lanczos vector and update the solutions through one iteration of the preconditioned MINRES algorithm.
+     * 
+     *  @param environment              the environment that this step can read from and write to
+     */
+    void execute(LinearEquationEnvironment<Scalar>& environment) override {
+
+        auto& x = environment.x;  // the current solutions
+        const auto& block_matvec = environment.block_matrix_vector_product_function;
+
+        const auto dim = x.rows();
+        const auto number_of_equations = x.cols();
+
+        auto& Q_previous = environment.Q_previous;
+        auto& Q = environment.Q;
+        auto& Y = environment.Y;
+        auto& W_previous = environment.W_previous;
+        auto& W = environment.W;
+
+        auto& beta_previous = environment.beta_previous;
+        auto& beta = environment.beta;
+        auto& delta_bar = environment.delta_bar;
+        auto& epsilon = environment.epsilon;
+        auto& c = environment.givens_cosines;
+        auto& s = environment.givens_sines;
+        auto& phi_bar = environment.phi_bar;
+
+        // In the first iteration, the Lanczos process is started from the residual vectors of the initial guesses.
+        if (environment.krylov_dimension == 0) {
+            Q = environment.b - block_matvec(x);
+            Q_previous = Q;
+            Y = environment.precondition(Q);
+
+            W = MatrixX<Scalar>::Zero(dim, number_of_equations);
+            W_previous = MatrixX<Scalar>::Zero(dim, number_of_equations);
+
+            beta = VectorX<double>::Zero(number_of_equations);
+            for (Eigen::Index column_index = 0; column_index < number_of_equations; column_index++) {
+                beta(column_index) = std::sqrt(std::max(std::real(Q.col(column_index).dot(Y.col(column_index))), 0.0));
+            }
+            beta_previous = VectorX<double>::Zero(number_of_equations);
+            delta_bar = VectorX<double>::Zero(number_of_equations);
+            epsilon = VectorX<double>::Zero(number_of_equations);
+            c = VectorX<double>::Constant(number_of_equations, -1.0);
+            s = VectorX<double>::Zero(number_of_equations);
+            phi_bar = beta;
+        }
+
+
+        // Normalize the Lanczos vectors (in the metric of the preconditioner) and calculate their matrix-vector products as one block. A vanishing beta means that the right-hand side has been solved exactly, and its Lanczos vector is set to zero.
+        MatrixX<Scalar> V = MatrixX<Scalar>::Zero(dim, number_of_equations);
+        for (Eigen::Index column_index = 0; column_index < number_of_equations; column_index++) {
+            if (beta(column_index) > 0.0) {
+                V.col(column_index) = Y.col(column_index) / beta(column_index);
+            }
+        }
+        MatrixX<Scalar> AV = block_matvec(V);
+
+
+        for (Eigen::Index column_index = 0; column_index < number_of_equations; column_index++) {
+
+            // Perform the three-term Lanczos recurrence.
+            if (beta_previous(column_index) > 0.0) {
+                AV.col(column_index) -= (beta(column_index) / beta_previous(column_index)) * Q_previous.col(column_index);
+            }
+
+            const double alpha = std::real(V.col(column_index).dot(AV.col(column_index)));
+            if (beta(column_index) > 0.0) {
+                AV.col(column_index) -= (alpha / beta(column_index)) * Q.col(column_index);
+            }
+
+            Q_previous.col(column_index) = Q.col(column_index);
+            Q.col(column_index) = AV.col(column_index);
+            Y.col(column_index) = environment.precondition(AV.col(column_index));
+
+            beta_previous(column_index) = beta(column_index);
+            beta(column_index) = std::sqrt(std::max(std::real(Q.col(column_index).dot(Y.col(column_index))), 0.0));
+
+
+            // Apply the previous Givens rotation to the new column of the tridiagonal matrix.
+            const double epsilon_previous = epsilon(column_index);
+            const double delta = c(column_index) * delta_bar(column_index) + s(column_index) * alpha;
+            const double gamma_bar = s(column_index) * delta_bar(column_index) - c(column_index) * alpha;
+            epsilon(column_index) = s(column_index) * beta(column_index);
+            delta_bar(column_index) = -c(column_index) * beta(column_index);
+
+            // Calculate the next Givens rotation, which eliminates the new sub-diagonal element.
+            const double gamma = std::max(std::hypot(gamma_bar, beta(column_index)), std::numeric_limits<double>::epsilon());
+            c(column_index) = gamma_bar / gamma;
+            s(column_index) = beta(column_index) / gamma;
+            const double phi = c(column_index) * phi_bar(column_index);
+            phi_bar(column_index) *= s(column_index);
+
+
+            // Update the search directions and the solution.
+            const VectorX<Scalar> w = (V.col(column_index) - epsilon_previous * W_previous.col(column_index) - delta * W.col(column_index)) / gamma;
+            W_previous.col(column_index) = W.col(column_index);
+            W.col(column_index) = w;
+
+            x.col(column_index) += phi * w;
+        }
+
+        environment.krylov_dimension++;
+        environment.residual_norms = phi_bar.cwiseAbs();
+    }
+};
+
+
+}  // namespace GQCP
@@ -0,0 +1,88 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/ConvergenceCriterion.hpp"
+#include "Mathematical/Optimization/LinearEquation/LinearEquationEnvironment.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  A convergence criterion that checks if the norm of the residual vector (or the estimate thereof that is maintained by an iterative linear equations solver) of every right-hand side is smaller than a threshold.
+ * 
+ *  @tparam _Scalar             the scalar type that is used to represent the variables of the system of equations
+ */
+template <typename _Scalar>
+class ResidualNormConvergence:
+    public ConvergenceCriterion<LinearEquationEnvironment<_Scalar>> {
+
+public:
+    using Scalar = _Scalar;
+    using Environment = LinearEquationEnvironment<Scalar>;
+
+
+private:
+    double threshold;  // the threshold that is used in checking the norms of the residual vectors
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param threshold                the threshold that is used in checking the norms of the residual vectors
+     */
+    ResidualNormConvergence(const double threshold = 1.0e-08) :
+        threshold {threshold} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return a textual description of this convergence criterion
+     */
+    std::string description() const override {
+        return "A convergence criterion that checks if the norm of the residual vector of every right-hand side is smaller than a threshold.";
+    }
+
+
+    /**
+     *  @param environment                  the environment that acts as a sort of calculation space
+     * 
+     *  @return if the norm of the residual vector of every right-hand side is smaller than a threshold
+     */
+    bool isFulfilled(Environment& environment) override {
+
+        const auto& residual_norms = environment.residual_norms;
+
+        if (residual_norms.size() > 0) {  // if the residual vectors have been calculated
+            return (residual_norms.array() < this->threshold).all();
+        }
+
+        return false;  // no iterations have been performed
+    }
+};
+
+
+}  // namespace GQCP
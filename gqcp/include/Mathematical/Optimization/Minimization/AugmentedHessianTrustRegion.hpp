@@ -0,0 +1,87 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Optimization/Eigenproblem/Eigenpair.hpp"
+#include "Mathematical/Representation/Matrix.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  A calculator of (restricted) minimization steps that only requires Hessian-vector products, through the augmented-Hessian method.
+ * 
+ *  The step x is found from the lowest eigenvector (1, x) of the augmented Hessian
+ *      ( 0   g^T )
+ *      ( g   H   ),
+ *  which is a level-shifted Newton step (H - lambda) x = -g, with a shift lambda that is always lower than the lowest eigenvalue of the Hessian. The step is therefore always a descent direction, also when the Hessian is indefinite. The lowest eigenvector is found with Davidson's algorithm, using the diagonal of the Hessian for the Davidson corrections. Steps that are longer than the trust radius are scaled back onto the trust region.
+ */
+class AugmentedHessianTrustRegion {
+private:
+    double trust_radius;  // the maximum norm of a step
+
+    size_t maximum_subspace_dimension;    // the maximum dimension of the Davidson subspace before collapsing
+    double convergence_threshold;         // the threshold on the norm of the Davidson residual vector
+    size_t maximum_number_of_iterations;  // the maximum number of Davidson iterations
+
+
+public:
+    // CONSTRUCTORS
+
+    /**
+     *  @param trust_radius                         the maximum norm of a step
+     *  @param maximum_subspace_dimension           the maximum dimension of the Davidson subspace before collapsing
+     *  @param convergence_threshold                the threshold on the norm of the Davidson residual vector
+     *  @param maximum_number_of_iterations         the maximum number of Davidson iterations
+     */
+    AugmentedHessianTrustRegion(const double trust_radius = 0.5, const size_t maximum_subspace_dimension = 15, const double convergence_threshold = 1.0e-06, const size_t maximum_number_of_iterations = 128);
+
+
+    // PUBLIC METHODS
+
+    /**
+     *  @param gradient                     the gradient at the current point
+     *  @param hessian_vector_product       a function that returns the product of the Hessian at the current point with a vector
+     *  @param hessian_diagonal             the diagonal of the Hessian at the current point
+     * 
+     *  @return the augmented-Hessian step, whose norm is at most the trust radius
+     * 
+     *  @note If the dimension of the augmented Hessian doesn't exceed the maximum Davidson subspace dimension, it is set up through Hessian-vector products and diagonalized densely.
+     */
+    VectorX<double> calculateStep(const VectorX<double>& gradient, const VectorFunction<double>& hessian_vector_product, const VectorX<double>& hessian_diagonal) const;
+
+    /**
+     *  @param hessian_vector_product       a function that returns the product of the Hessian with a vector
+     *  @param hessian_diagonal             the diagonal of the Hessian
+     * 
+     *  @return the lowest eigenpair of the Hessian
+     * 
+     *  @note If the dimension of the Hessian doesn't exceed the maximum Davidson subspace dimension, it is set up through Hessian-vector products and diagonalized densely.
+     */
+    Eigenpair<double> calculateLowestHessianEigenpair(const VectorFunction<double>& hessian_vector_product, const VectorX<double>& hessian_diagonal) const;
+
+    /**
+     *  @return the maximum norm of a step
+     */
+    double trustRadius() const { return this->trust_radius; }
+};
+
+
+}  // namespace GQCP
@@ -0,0 +1,208 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+#include "Mathematical/Representation/SquareRankFourTensor.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A real square rank-4 tensor with the 8-fold permutational symmetry of two-electron integrals over real orbitals (in chemist's notation), that is represented through Cholesky vectors:
+ *      g(p q r s) ~ sum_L L^L(p q) L^L(r s),
+ *  in which every Cholesky vector L^L is a symmetric K x K matrix.
+ *
+ *  The Cholesky vectors are obtained from a pivoted (incomplete) Cholesky decomposition of the positive semi-definite pair matrix M(pq, rs) = g(p q r s), which stops when the largest remaining diagonal element M(pq, pq) is smaller than a threshold. Since every error element is bounded by the square root of the product of two remaining diagonal elements, the threshold bounds the error of every element of the tensor. The number of Cholesky vectors N_L typically grows linearly with K, so that only K^2 N_L instead of K^4 elements have to be stored.
+ */
+class CholeskyDecomposedRankFourTensor {
+private:
+    // The dimension of every axis of the tensor.
+    size_t dim;
+
+    // The Cholesky vectors, where L(p + K q, L) = L^L(p q). Every column is a contiguous (column-major) K x K matrix.
+    MatrixX<double> L;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Create a tensor without any Cholesky vectors, i.e. a zero tensor.
+     *
+     *  @param dim              The dimension of every axis of the tensor.
+     */
+    CholeskyDecomposedRankFourTensor(const size_t dim = 0);
+
+    /**
+     *  @param dim                  The dimension of every axis of the tensor.
+     *  @param cholesky_vectors     The Cholesky vectors as a K^2 x N_L matrix, whose element (p + K q, L) is L^L(p q).
+     */
+    CholeskyDecomposedRankFourTensor(const size_t dim, const MatrixX<double>& cholesky_vectors);
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Decompose a dense square rank-4 tensor.
+     *
+     *  @param tensor           A dense square rank-4 tensor that has the 8-fold permutational symmetry of two-electron integrals over real orbitals, and whose pair matrix is positive semi-definite.
+     *  @param threshold        The threshold for the largest remaining diagonal element, below which the decomposition is stopped.
+     *
+     *  @return The Cholesky decomposition of the given tensor.
+     */
+    static CholeskyDecomposedRankFourTensor FromFull(const SquareRankFourTensor<double>& tensor, const double threshold = 1.0e-08);
+
+    /**
+     *  Perform a pivoted Cholesky decomposition of a pair matrix M(pq, rs) = g(p q r s), of which the columns are only calculated when they are needed.
+     *
+     *  The unique pairs (p >= q) are divided into groups, of which all columns are calculated at once. When the largest remaining diagonal element is found, the columns of its group are calculated and as many pivots as possible are taken from that group: the pivots in the group are chosen in order of decreasing remaining diagonal, as long as their remaining diagonal is larger than the threshold and larger than a fraction 1e-2 of the largest remaining diagonal. This amortizes the calculation of the columns of, e.g., a pair of shells over multiple Cholesky vectors.
+     *
+     *  @param dim                  The dimension K of every axis of the tensor.
+     *  @param diagonal             The diagonal elements M(pq, pq) of the pair matrix, for all unique pairs p >= q in the order of `PackedSymmetricRankFourTensor::pairIndex`.
+     *  @param pair_groups          The groups of (compound) pair indices, that together contain every unique pair once.
+     *  @param calculate_columns    A function that calculates the columns M(:, rs) of the pair matrix for all pairs rs in the group with the given index, as a K(K+1)/2 x (group size) matrix whose rows are in the order of `PackedSymmetricRankFourTensor::pairIndex`.
+     *  @param threshold            The threshold for the largest remaining diagonal element, below which the decomposition is stopped.
+     *
+     *  @return The Cholesky decomposition of the pair matrix.
+     */
+    static CholeskyDecomposedRankFourTensor FromPairColumns(const size_t dim, const VectorX<double>& diagonal, const std::vector<std::vector<size_t>>& pair_groups, const std::function<MatrixX<double>(const size_t)>& calculate_columns, const double threshold = 1.0e-08);
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @param p            The first index.
+     *  @param q            The second index.
+     *  @param r            The third index.
+     *  @param s            The fourth index.
+     *
+     *  @return The element g(p q r s), calculated from the Cholesky vectors.
+     */
+    double operator()(const size_t p, const size_t q, const size_t r, const size_t s) const { return this->L.row(p + this->dim * q).dot(this->L.row(r + this->dim * s)); }
+
+    /**
+     *  @param index        The index of a Cholesky vector.
+     *
+     *  @return The Cholesky vector with the given index, as a K x K matrix.
+     */
+    SquareMatrix<double> choleskyVector(const size_t index) const;
+
+    /**
+     *  @return A read-only reference to the Cholesky vectors as a K^2 x N_L matrix, whose element (p + K q, L) is L^L(p q).
+     */
+    const MatrixX<double>& choleskyVectors() const { return this->L; }
+
+
+    /*
+     *  MARK: General information
+     */
+
+    /**
+     *  @return The dimension of every axis of this tensor.
+     */
+    size_t dimension() const { return this->dim; }
+
+    /**
+     *  @return The number of Cholesky vectors.
+     */
+    size_t numberOfCholeskyVectors() const { return static_cast<size_t>(this->L.cols()); }
+
+
+    /*
+     *  MARK: Conversions
+     */
+
+    /**
+     *  @return The dense square rank-4 tensor that these Cholesky vectors represent.
+     */
+    SquareRankFourTensor<double> full() const;
+
+
+    /*
+     *  MARK: Contractions
+     */
+
+    /**
+     *  @param D            A K x K matrix.
+     *
+     *  @return The matrix J(p q) = g(p q r s) D(r s).
+     */
+    SquareMatrix<double> contractWithLastPair(const SquareMatrix<double>& D) const;
+
+    /**
+     *  @param D            A K x K matrix.
+     *
+     *  @return The matrix K(p s) = g(p q r s) D(q r).
+     */
+    SquareMatrix<double> contractWithInnerPair(const SquareMatrix<double>& D) const;
+
+    /**
+     *  @param d            A dense square rank-4 tensor.
+     *
+     *  @return The full contraction g(p q r s) d(p q r s).
+     */
+    double contractFully(const SquareRankFourTensor<double>& d) const;
+
+
+    /*
+     *  MARK: Basis transformations
+     */
+
+    /**
+     *  Transform this tensor to another (real) orbital basis, i.e. calculate
+     *      g'(P Q R S) = C(p P) C(q Q) C(r R) C(s S) g(p q r s),
+     *  by transforming every Cholesky vector as L'^L = C^T L^L C. This scales as O(K^3 N_L) instead of O(K^5).
+     *
+     *  @param C                    The (real) K x k transformation matrix, whose columns are the expansion coefficients of the new orbitals in terms of the old ones. Using fewer columns than rows transforms directly to a subset of orbitals, such as an active space.
+     *  @param number_of_threads    The number of threads over which the Cholesky vectors should be distributed.
+     *
+     *  @return The transformed tensor with dimension k.
+     */
+    CholeskyDecomposedRankFourTensor transformed(const MatrixX<double>& C, const size_t number_of_threads = 1) const;
+
+    /**
+     *  In-place apply a plane rotation to both indices of every Cholesky vector. Only the rows and columns p and q are updated:
+     *      L'(p, :) = G(0,0) L(p, :) + G(1,0) L(q, :)
+     *      L'(q, :) = G(0,1) L(p, :) + G(1,1) L(q, :),
+     *  and similarly for the columns.
+     *
+     *  @param p            The first index that is rotated.
+     *  @param q            The second index that is rotated.
+     *  @param G            The 2x2 matrix that is applied, whose first row and column correspond to p and whose second row and column correspond to q.
+     *
+     *  @note This update scales as O(K N_L).
+     */
+    void rotatePlane(const size_t p, const size_t q, const Eigen::Matrix2d& G);
+};
+
+
+}  // namespace GQCP
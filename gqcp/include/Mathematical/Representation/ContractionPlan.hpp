@@ -0,0 +1,560 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include <boost/algorithm/string.hpp>
+
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace GQCP {
+
+
+// Forward declaration, since `Tensor::einsum` is implemented through contraction plans.
+template <typename _Scalar, int _Rank>
+class Tensor;
+
+
+/**
+ *  A contraction between two tensors, whose NumPy 'einsum'-like labels have been resolved once into the permutations that turn the contraction into a single matrix-matrix product. A plan only depends on the labels, so it can be evaluated for any pair of tensors with compatible dimensions.
+ *
+ *  Two evaluation strategies are prepared:
+ *      - the 'natural' strategy keeps the free axes of both sides in their original order, which requires a final shuffle of the product if the output labels are ordered differently;
+ *      - the 'fused' strategy (only if the output labels are a block of free left-hand side labels and a block of free right-hand side labels, in either order) orders the free axes like the output and, if necessary, swaps the operands of the matrix product, so that the final shuffle is absorbed into the shuffles of the operands.
+ *  At evaluation, the strategy that shuffles the fewest elements is chosen.
+ *
+ *  @tparam N               The number of axes that are contracted over.
+ *  @tparam LHSRank         The rank of the left-hand side tensor.
+ *  @tparam RHSRank         The rank of the right-hand side tensor.
+ */
+template <int N, int LHSRank, int RHSRank>
+class ContractionPlan {
+public:
+    // The rank of the result of the contraction.
+    static constexpr int ResultRank = LHSRank + RHSRank - 2 * N;
+
+
+private:
+    // A way to evaluate the contraction as the matrix-matrix product of two permuted operands.
+    struct Strategy {
+        // If the left-hand side tensor is the first operand of the matrix-matrix product.
+        bool lhs_first;
+
+        // The permutation of the axes of the left-hand side tensor: (free, contracted) if it's the first operand, (contracted, free) otherwise.
+        Eigen::array<int, LHSRank> lhs_permutation;
+
+        // The permutation of the axes of the right-hand side tensor: (contracted, free) if the left-hand side is the first operand, (free, contracted) otherwise.
+        Eigen::array<int, RHSRank> rhs_permutation;
+
+        // The permutation that shuffles the axes of the product (the free axes of the first operand, followed by those of the second one) to the output axes.
+        Eigen::array<int, ResultRank> output_permutation;
+
+        // If the permutations are identities, i.e. if no shuffles are needed.
+        bool lhs_is_identity;
+        bool rhs_is_identity;
+        bool output_is_identity;
+    };
+
+    // The strategy that keeps the free axes in their original order.
+    Strategy natural;
+
+    // The strategy that orders the free axes like the output, if the output labels allow it.
+    Strategy fused;
+    bool has_fused;
+
+    // The contracted axes of the left-hand side, and the matching axes of the right-hand side.
+    std::array<int, N> lhs_contracted_axes;
+    std::array<int, N> rhs_contracted_axes;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Resolve the labels of a contraction into a plan.
+     *
+     *  @param lhs_labels           The labels for the axes of the tensor on the left-hand side of the contraction.
+     *  @param rhs_labels           The labels for the axes of the tensor on the right-hand side of the contraction.
+     *  @param output_labels        The labels for the the resulting/output tensor.
+     */
+    ContractionPlan(const std::string& lhs_labels, const std::string& rhs_labels, const std::string& output_labels) {
+
+        if (lhs_labels.size() != LHSRank) {
+            throw std::invalid_argument("ContractionPlan(const std::string&, const std::string&, const std::string&): The number of indices for the left-hand side of the contraction does not match the rank of the left-hand side tensor.");
+        }
+
+        if (rhs_labels.size() != RHSRank) {
+            throw std::invalid_argument("ContractionPlan(const std::string&, const std::string&, const std::string&): The number of indices for the right-hand side of the contraction does not match the rank of the right-hand side tensor.");
+        }
+
+        if (output_labels.size() != ResultRank) {
+            throw std::invalid_argument("ContractionPlan(const std::string&, const std::string&, const std::string&): The number of output indices does not match the number of axes that should be contracted over.");
+        }
+
+
+        // The axes whose labels appear on both sides are contracted over, in the order of the left-hand side.
+        std::vector<int> lhs_free_axes;
+        std::vector<int> rhs_free_axes;
+        size_t number_of_contracted_axes = 0;
+        for (int i = 0; i < LHSRank; i++) {
+            const auto match = rhs_labels.find(lhs_labels[i]);
+
+            if (match != std::string::npos) {
+                if (number_of_contracted_axes < N) {
+                    this->lhs_contracted_axes[number_of_contracted_axes] = i;
+                    this->rhs_contracted_axes[number_of_contracted_axes] = static_cast<int>(match);
+                }
+                number_of_contracted_axes++;
+            } else {
+                lhs_free_axes.push_back(i);
+            }
+        }
+
+        if (number_of_contracted_axes != N) {
+            throw std::invalid_argument("ContractionPlan(const std::string&, const std::string&, const std::string&): The number of labels that appear in both the left-hand side and the right-hand side does not match the number of axes that should be contracted over.");
+        }
+
+        for (int i = 0; i < RHSRank; i++) {
+            if (lhs_labels.find(rhs_labels[i]) == std::string::npos) {
+                rhs_free_axes.push_back(i);
+            }
+        }
+
+
+        // Locate every output label among the free axes.
+        std::vector<int> output_position_of_lhs_axis(LHSRank, -1);
+        std::vector<int> output_position_of_rhs_axis(RHSRank, -1);
+        for (int i = 0; i < ResultRank; i++) {
+            const auto lhs_match = lhs_labels.find(output_labels[i]);
+            const auto rhs_match = rhs_labels.find(output_labels[i]);
+
+            if ((lhs_match != std::string::npos) && (rhs_match == std::string::npos)) {
+                output_position_of_lhs_axis[lhs_match] = i;
+            } else if ((rhs_match != std::string::npos) && (lhs_match == std::string::npos)) {
+                output_position_of_rhs_axis[rhs_match] = i;
+            } else {
+                throw std::invalid_argument("ContractionPlan(const std::string&, const std::string&, const std::string&): The output labels do not correspond to the axes that are not contracted over.");
+            }
+        }
+
+
+        const auto is_unlocated = [](const int position) { return position < 0; };
+        if (std::any_of(lhs_free_axes.begin(), lhs_free_axes.end(), [&](const int axis) { return is_unlocated(output_position_of_lhs_axis[axis]); }) ||
+            std::any_of(rhs_free_axes.begin(), rhs_free_axes.end(), [&](const int axis) { return is_unlocated(output_position_of_rhs_axis[axis]); })) {
+            throw std::invalid_argument("ContractionPlan(const std::string&, const std::string&, const std::string&): The output labels do not correspond to the axes that are not contracted over.");
+        }
+
+
+        // The natural strategy keeps the original order of the free axes.
+        this->natural = this->strategyFor(true, lhs_free_axes, rhs_free_axes, output_position_of_lhs_axis, output_position_of_rhs_axis);
+
+
+        // The fused strategy orders the free axes like the output, which is possible if the free left-hand side axes occupy either the first or the last positions of the output.
+        auto lhs_free_axes_sorted = lhs_free_axes;
+        std::sort(lhs_free_axes_sorted.begin(), lhs_free_axes_sorted.end(), [&output_position_of_lhs_axis](const int a, const int b) { return output_position_of_lhs_axis[a] < output_position_of_lhs_axis[b]; });
+        auto rhs_free_axes_sorted = rhs_free_axes;
+        std::sort(rhs_free_axes_sorted.begin(), rhs_free_axes_sorted.end(), [&output_position_of_rhs_axis](const int a, const int b) { return output_position_of_rhs_axis[a] < output_position_of_rhs_axis[b]; });
+
+        const int number_of_lhs_free_axes = static_cast<int>(lhs_free_axes.size());
+        bool lhs_block_first = true;
+        bool lhs_block_last = true;
+        for (const auto axis : lhs_free_axes) {
+            lhs_block_first = lhs_block_first && (output_position_of_lhs_axis[axis] < number_of_lhs_free_axes);
+            lhs_block_last = lhs_block_last && (output_position_of_lhs_axis[axis] >= ResultRank - number_of_lhs_free_axes);
+        }
+
+        this->has_fused = lhs_block_first || lhs_block_last;
+        if (this->has_fused) {
+            this->fused = this->strategyFor(lhs_block_first, lhs_free_axes_sorted, rhs_free_axes_sorted, output_position_of_lhs_axis, output_position_of_rhs_axis);
+        }
+    }
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Resolve a NumPy 'einsum'-like contraction string into a plan.
+     *
+     *  @param contraction_string   The string used to specify the wanted contraction, e.g. "ijkl,jk->il". Any spaces are discarded.
+     *
+     *  @return The plan for the given contraction.
+     */
+    static ContractionPlan FromString(std::string contraction_string) {
+
+        // Remove unnecessary symbols from string.
+        boost::erase_all(contraction_string, " ");  // Remove all spaces.
+        boost::erase_all(contraction_string, ">");
+        boost::replace_all(contraction_string, "-", " ");
+        boost::replace_all(contraction_string, ",", " ");
+
+        // Split the stringstream in the necessary components, 3 in most cases.
+        std::vector<std::string> segment_list;
+        boost::split(segment_list, contraction_string, boost::is_any_of(" "));
+
+        // If a contraction over all indices is done, only 2 sets of labels are saved in the vector. The last set of labels is an empty string, and is added manually.
+        if (segment_list.size() == 2) {
+            segment_list.push_back("");
+        }
+
+        if (segment_list.size() != 3) {
+            throw std::invalid_argument("ContractionPlan::FromString(std::string): The contraction string should be of the form 'lhs,rhs->output'.");
+        }
+
+        return ContractionPlan(segment_list[0], segment_list[1], segment_list[2]);
+    }
+
+
+    /**
+     *  Look up the plan for a NumPy 'einsum'-like contraction string in a cache, which is private to the calling thread. The contraction string is only parsed the first time it is encountered.
+     *
+     *  @param contraction_string   The string used to specify the wanted contraction, e.g. "ijkl,jk->il". Any spaces are discarded.
+     *
+     *  @return A reference to the cached plan for the given contraction.
+     */
+    static const ContractionPlan& Cached(const std::string& contraction_string) {
+
+        static thread_local std::unordered_map<std::string, ContractionPlan> cache;
+
+        auto it = cache.find(contraction_string);
+        if (it == cache.end()) {
+            it = cache.emplace(contraction_string, ContractionPlan::FromString(contraction_string)).first;
+        }
+
+        return it->second;
+    }
+
+
+    /**
+     *  Look up the plan for the given labels in a cache, which is private to the calling thread. The labels are only resolved the first time they are encountered.
+     *
+     *  @param lhs_labels           The labels for the axes of the tensor on the left-hand side of the contraction.
+     *  @param rhs_labels           The labels for the axes of the tensor on the right-hand side of the contraction.
+     *  @param output_labels        The labels for the the resulting/output tensor.
+     *
+     *  @return A reference to the cached plan for the given labels.
+     */
+    static const ContractionPlan& Cached(const std::string& lhs_labels, const std::string& rhs_labels, const std::string& output_labels) {
+
+        static thread_local std::unordered_map<std::string, ContractionPlan> cache;
+
+        const auto key = lhs_labels + ',' + rhs_labels + "->" + output_labels;
+        auto it = cache.find(key);
+        if (it == cache.end()) {
+            it = cache.emplace(key, ContractionPlan(lhs_labels, rhs_labels, output_labels)).first;
+        }
+
+        return it->second;
+    }
+
+
+    /*
+     *  MARK: Evaluation
+     */
+
+    /**
+     *  Evaluate the contraction on the calling thread. The matrix-matrix product is dispatched to BLAS-3 (if available).
+     *
+     *  @param lhs                  The left-hand side of the contraction.
+     *  @param rhs                  The right-hand side of the contraction.
+     *
+     *  @return The result of the tensor contraction.
+     */
+    template <typename Scalar>
+    Tensor<Scalar, ResultRank> evaluate(const Eigen::Tensor<Scalar, LHSRank>& lhs, const Eigen::Tensor<Scalar, RHSRank>& rhs) const {
+
+        using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+
+        const auto& strategy = this->strategyFor(lhs, rhs);
+
+        Eigen::Tensor<Scalar, LHSRank> lhs_permuted;
+        const Scalar* lhs_data = lhs.data();
+        if (!strategy.lhs_is_identity) {
+            lhs_permuted = lhs.shuffle(strategy.lhs_permutation);
+            lhs_data = lhs_permuted.data();
+        }
+
+        Eigen::Tensor<Scalar, RHSRank> rhs_permuted;
+        const Scalar* rhs_data = rhs.data();
+        if (!strategy.rhs_is_identity) {
+            rhs_permuted = rhs.shuffle(strategy.rhs_permutation);
+            rhs_data = rhs_permuted.data();
+        }
+
+        const auto dimensions = this->productDimensions(strategy, lhs, rhs);
+        const Scalar* first_data = strategy.lhs_first ? lhs_data : rhs_data;
+        const Scalar* second_data = strategy.lhs_first ? rhs_data : lhs_data;
+
+        if (strategy.output_is_identity) {
+            Tensor<Scalar, ResultRank> result {this->intermediateDimensions(strategy, lhs, rhs)};
+            Eigen::Map<MatrixType>(result.data(), dimensions[0], dimensions[2]).noalias() = Eigen::Map<const MatrixType>(first_data, dimensions[0], dimensions[1]) * Eigen::Map<const MatrixType>(second_data, dimensions[1], dimensions[2]);
+            return result;
+        }
+
+        MatrixType product = Eigen::Map<const MatrixType>(first_data, dimensions[0], dimensions[1]) * Eigen::Map<const MatrixType>(second_data, dimensions[1], dimensions[2]);
+        const Eigen::TensorMap<Eigen::Tensor<Scalar, ResultRank>> T_intermediate {product.data(), this->intermediateDimensions(strategy, lhs, rhs)};
+
+        return Tensor<Scalar, ResultRank>(T_intermediate.shuffle(strategy.output_permutation));
+    }
+
+
+    /**
+     *  Evaluate the contraction on an Eigen device, such as an `Eigen::ThreadPoolDevice`. Both the shuffles and the matrix-matrix product (as a rank-two tensor contraction) are run on the device.
+     *
+     *  @param lhs                  The left-hand side of the contraction.
+     *  @param rhs                  The right-hand side of the contraction.
+     *  @param device               The Eigen device on which the contraction should be evaluated.
+     *
+     *  @return The result of the tensor contraction.
+     */
+    template <typename Scalar, typename Device>
+    Tensor<Scalar, ResultRank> evaluate(const Eigen::Tensor<Scalar, LHSRank>& lhs, const Eigen::Tensor<Scalar, RHSRank>& rhs, const Device& device) const {
+
+        const auto& strategy = this->strategyFor(lhs, rhs);
+
+        Eigen::Tensor<Scalar, LHSRank> lhs_permuted;
+        const Scalar* lhs_data = lhs.data();
+        if (!strategy.lhs_is_identity) {
+            lhs_permuted.resize(permutedDimensions(lhs, strategy.lhs_permutation));
+            lhs_permuted.device(device) = lhs.shuffle(strategy.lhs_permutation);
+            lhs_data = lhs_permuted.data();
+        }
+
+        Eigen::Tensor<Scalar, RHSRank> rhs_permuted;
+        const Scalar* rhs_data = rhs.data();
+        if (!strategy.rhs_is_identity) {
+            rhs_permuted.resize(permutedDimensions(rhs, strategy.rhs_permutation));
+            rhs_permuted.device(device) = rhs.shuffle(strategy.rhs_permutation);
+            rhs_data = rhs_permuted.data();
+        }
+
+        const auto dimensions = this->productDimensions(strategy, lhs, rhs);
+        const Eigen::TensorMap<const Eigen::Tensor<Scalar, 2>> first {strategy.lhs_first ? lhs_data : rhs_data, dimensions[0], dimensions[1]};
+        const Eigen::TensorMap<const Eigen::Tensor<Scalar, 2>> second {strategy.lhs_first ? rhs_data : lhs_data, dimensions[1], dimensions[2]};
+        const Eigen::array<Eigen::IndexPair<Eigen::Index>, 1> contraction_pair {Eigen::IndexPair<Eigen::Index>(1, 0)};
+
+        const auto intermediate_dimensions = this->intermediateDimensions(strategy, lhs, rhs);
+        if (strategy.output_is_identity) {
+            Tensor<Scalar, ResultRank> result {intermediate_dimensions};
+            Eigen::TensorMap<Eigen::Tensor<Scalar, 2>> result_matrix {result.data(), dimensions[0], dimensions[2]};
+            result_matrix.device(device) = first.contract(second, contraction_pair);
+            return result;
+        }
+
+        Eigen::Tensor<Scalar, 2> product {dimensions[0], dimensions[2]};
+        product.device(device) = first.contract(second, contraction_pair);
+        const Eigen::TensorMap<Eigen::Tensor<Scalar, ResultRank>> T_intermediate {product.data(), intermediate_dimensions};
+
+        Tensor<Scalar, ResultRank> result {permutedDimensions(T_intermediate, strategy.output_permutation)};
+        result.device(device) = T_intermediate.shuffle(strategy.output_permutation);
+        return result;
+    }
+
+
+private:
+    /*
+     *  MARK: Helpers
+     */
+
+    /**
+     *  @return If the given permutation is the identity.
+     */
+    template <typename Permutation>
+    static bool isIdentity(const Permutation& permutation) {
+        for (size_t i = 0; i < permutation.size(); i++) {
+            if (permutation[i] != static_cast<int>(i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+
+    /**
+     *  @return The dimensions of the given tensor after shuffling its axes with the given permutation.
+     */
+    template <typename TensorType, typename Permutation>
+    static Eigen::array<Eigen::Index, std::tuple_size<Permutation>::value> permutedDimensions(const TensorType& tensor, const Permutation& permutation) {
+        Eigen::array<Eigen::Index, std::tuple_size<Permutation>::value> dimensions {};
+        for (size_t i = 0; i < permutation.size(); i++) {
+            dimensions[i] = tensor.dimension(permutation[i]);
+        }
+        return dimensions;
+    }
+
+
+    /**
+     *  Create an evaluation strategy.
+     *
+     *  @param lhs_first                        If the left-hand side tensor should be the first operand of the matrix-matrix product.
+     *  @param lhs_free_axes                    The free axes of the left-hand side tensor, in the order in which they should appear in the product.
+     *  @param rhs_free_axes                    The free axes of the right-hand side tensor, in the order in which they should appear in the product.
+     *  @param output_position_of_lhs_axis      For every free left-hand side axis, its position in the output.
+     *  @param output_position_of_rhs_axis      For every free right-hand side axis, its position in the output.
+     *
+     *  @return The evaluation strategy.
+     */
+    Strategy strategyFor(const bool lhs_first, const std::vector<int>& lhs_free_axes, const std::vector<int>& rhs_free_axes, const std::vector<int>& output_position_of_lhs_axis, const std::vector<int>& output_position_of_rhs_axis) const {
+
+        Strategy strategy {};
+        strategy.lhs_first = lhs_first;
+
+        // The first operand is permuted as (free, contracted), the second one as (contracted, free).
+        const size_t lhs_offset = lhs_first ? 0 : N;
+        const size_t lhs_contracted_offset = lhs_first ? lhs_free_axes.size() : 0;
+        for (size_t i = 0; i < lhs_free_axes.size(); i++) {
+            strategy.lhs_permutation[lhs_offset + i] = lhs_free_axes[i];
+        }
+        for (size_t i = 0; i < N; i++) {
+            strategy.lhs_permutation[lhs_contracted_offset + i] = this->lhs_contracted_axes[i];
+        }
+
+        const size_t rhs_offset = lhs_first ? N : 0;
+        const size_t rhs_contracted_offset = lhs_first ? 0 : rhs_free_axes.size();
+        for (size_t i = 0; i < rhs_free_axes.size(); i++) {
+            strategy.rhs_permutation[rhs_offset + i] = rhs_free_axes[i];
+        }
+        for (size_t i = 0; i < N; i++) {
+            strategy.rhs_permutation[rhs_contracted_offset + i] = this->rhs_contracted_axes[i];
+        }
+
+
+        // The axes of the product are the free axes of the first operand, followed by those of the second one.
+        std::vector<int> output_positions;
+        const auto& first_free_axes = lhs_first ? lhs_free_axes : rhs_free_axes;
+        const auto& second_free_axes = lhs_first ? rhs_free_axes : lhs_free_axes;
+        const auto& first_output_positions = lhs_first ? output_position_of_lhs_axis : output_position_of_rhs_axis;
+        const auto& second_output_positions = lhs_first ? output_position_of_rhs_axis : output_position_of_lhs_axis;
+        for (const auto axis : first_free_axes) {
+            output_positions.push_back(first_output_positions[axis]);
+        }
+        for (const auto axis : second_free_axes) {
+            output_positions.push_back(second_output_positions[axis]);
+        }
+
+        for (size_t i = 0; i < output_positions.size(); i++) {
+            strategy.output_permutation[output_positions[i]] = static_cast<int>(i);
+        }
+
+        strategy.lhs_is_identity = isIdentity(strategy.lhs_permutation);
+        strategy.rhs_is_identity = isIdentity(strategy.rhs_permutation);
+        strategy.output_is_identity = isIdentity(strategy.output_permutation);
+
+        return strategy;
+    }
+
+
+    /**
+     *  Check if the contracted dimensions of the given tensors match, and choose the strategy that shuffles the fewest elements.
+     *
+     *  @param lhs                  The left-hand side of the contraction.
+     *  @param rhs                  The right-hand side of the contraction.
+     *
+     *  @return The cheapest evaluation strategy.
+     */
+    template <typename LHS, typename RHS>
+    const Strategy& strategyFor(const LHS& lhs, const RHS& rhs) const {
+
+        for (size_t i = 0; i < N; i++) {
+            if (lhs.dimension(this->lhs_contracted_axes[i]) != rhs.dimension(this->rhs_contracted_axes[i])) {
+                throw std::invalid_argument("ContractionPlan::evaluate(const Eigen::Tensor<Scalar, LHSRank>&, const Eigen::Tensor<Scalar, RHSRank>&): The dimensions of the axes that are contracted over do not match.");
+            }
+        }
+
+        const auto dimensions = this->productDimensions(this->natural, lhs, rhs);
+        const auto output_size = dimensions[0] * dimensions[2];
+
+        const auto cost_of = [&](const Strategy& strategy) {
+            return (strategy.lhs_is_identity ? 0 : lhs.size()) + (strategy.rhs_is_identity ? 0 : rhs.size()) + (strategy.output_is_identity ? 0 : output_size);
+        };
+
+        if (this->has_fused && (cost_of(this->fused) < cost_of(this->natural))) {
+            return this->fused;
+        }
+        return this->natural;
+    }
+
+
+    /**
+     *  @return The number of rows of the first operand, the contracted dimension, and the number of columns of the second operand of the matrix-matrix product.
+     */
+    template <typename LHS, typename RHS>
+    std::array<Eigen::Index, 3> productDimensions(const Strategy& strategy, const LHS& lhs, const RHS& rhs) const {
+
+        Eigen::Index contracted_dimension = 1;
+        for (size_t i = 0; i < N; i++) {
+            contracted_dimension *= lhs.dimension(this->lhs_contracted_axes[i]);
+        }
+
+        const Eigen::Index lhs_free_dimension = (contracted_dimension == 0) ? 0 : lhs.size() / contracted_dimension;
+        const Eigen::Index rhs_free_dimension = (contracted_dimension == 0) ? 0 : rhs.size() / contracted_dimension;
+
+        if (strategy.lhs_first) {
+            return {lhs_free_dimension, contracted_dimension, rhs_free_dimension};
+        }
+        return {rhs_free_dimension, contracted_dimension, lhs_free_dimension};
+    }
+
+
+    /**
+     *  @return The dimensions of the product, whose axes are the free axes of the first operand, followed by those of the second one.
+     */
+    template <typename LHS, typename RHS>
+    Eigen::array<Eigen::Index, ResultRank> intermediateDimensions(const Strategy& strategy, const LHS& lhs, const RHS& rhs) const {
+
+        Eigen::array<Eigen::Index, ResultRank> dimensions {};
+        size_t position = 0;
+
+        const auto add_free_dimensions_of_lhs = [&]() {
+            const size_t offset = strategy.lhs_first ? 0 : N;
+            for (size_t i = 0; i < LHSRank - N; i++) {
+                dimensions[position++] = lhs.dimension(strategy.lhs_permutation[offset + i]);
+            }
+        };
+        const auto add_free_dimensions_of_rhs = [&]() {
+            const size_t offset = strategy.lhs_first ? N : 0;
+            for (size_t i = 0; i < RHSRank - N; i++) {
+                dimensions[position++] = rhs.dimension(strategy.rhs_permutation[offset + i]);
+            }
+        };
+
+        if (strategy.lhs_first) {
+            add_free_dimensions_of_lhs();
+            add_free_dimensions_of_rhs();
+        } else {
+            add_free_dimensions_of_rhs();
+            add_free_dimensions_of_lhs();
+        }
+
+        return dimensions;
+    }
+};
+
+
+}  // namespace GQCP
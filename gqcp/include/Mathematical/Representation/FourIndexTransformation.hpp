@@ -0,0 +1,108 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/SquareRankFourTensor.hpp"
+#include "Utilities/threading.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/**
+ *  Transform a square rank-four tensor in chemist's notation (e.g. two-electron integrals) to another (possibly smaller) orbital basis, i.e. calculate
+ *      g'(P Q R S) = C^*(p P) C(q Q) C^*(r R) C(s S) g(p q r s).
+ *
+ *  The new orbitals are processed in batches of the last index S. For every batch, the four quarter-transformations are matrix-matrix products on views of the column-major storage, so that no rank-four temporaries are created: the only intermediates are the quarter-transformed slices of a batch, which have K^3 elements per new orbital.
+ *
+ *  @tparam Scalar                  The scalar type of the tensor elements and transformation coefficients: real or complex.
+ *
+ *  @param g                        The tensor in the old orbital basis, with dimension K.
+ *  @param C                        The K x k transformation matrix, whose columns are the expansion coefficients of the new orbitals in terms of the old ones. Using fewer columns than rows transforms directly to a subset of orbitals, such as an active space.
+ *  @param number_of_threads        The number of threads over which the batches of new orbitals should be distributed.
+ *  @param batch_size               The number of new orbitals that are transformed together. If zero, the batch size is chosen such that the intermediates of a batch don't exceed 2^25 elements.
+ *
+ *  @return The transformed tensor, with dimension k.
+ */
+template <typename Scalar>
+SquareRankFourTensor<Scalar> fourIndexTransformed(const SquareRankFourTensor<Scalar>& g, const MatrixX<Scalar>& C, const size_t number_of_threads = 1, size_t batch_size = 0) {
+
+    using EigenMatrix = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+
+    const size_t K = g.dimension();
+    if (static_cast<size_t>(C.rows()) != K) {
+        throw std::invalid_argument("fourIndexTransformed(const SquareRankFourTensor<Scalar>&, const MatrixX<Scalar>&, const size_t, size_t): The number of rows of the transformation matrix should be equal to the dimension of the tensor.");
+    }
+    const size_t k = C.cols();
+
+    SquareRankFourTensor<Scalar> result {k};
+    if (k == 0) {
+        return result;
+    }
+
+    if (batch_size == 0) {
+        batch_size = std::max<size_t>(1, std::min<size_t>((k + number_of_threads - 1) / number_of_threads, (size_t {1} << 25) / std::max<size_t>(K * K * K, 1)));
+    }
+    const size_t number_of_batches = (k + batch_size - 1) / batch_size;
+
+
+    // Prepare the views on the column-major storage and the (conjugated) transformation matrices that every thread shares.
+    const Eigen::Map<const EigenMatrix> g_matrix {g.data(), static_cast<Eigen::Index>(K * K * K), static_cast<Eigen::Index>(K)};  // g(pqr, s)
+    const MatrixX<Scalar> C_conjugate = C.conjugate();
+    const MatrixX<Scalar> C_adjoint = C.adjoint();
+
+    forEachIndexDynamically(number_of_threads, number_of_batches, [&](const size_t, const size_t batch_index) {
+        const size_t S_begin = batch_index * batch_size;
+        const size_t S_size = std::min(batch_size, k - S_begin);
+
+        // The first quarter-transformation acts on the last index: X(pqr, S) = g(pqr, s) C(s S).
+        const MatrixX<Scalar> X = g_matrix * C.middleCols(S_begin, S_size);
+
+        MatrixX<Scalar> Y {K * K, k};  // Y(pq, R)
+        MatrixX<Scalar> Z {k, K * k};  // Z(P, qR)
+        for (size_t i = 0; i < S_size; i++) {
+            const size_t S = S_begin + i;
+
+            // The second quarter-transformation acts on the third index: Y(pq, R) = X(pq, r; S) C^*(r R).
+            const Eigen::Map<const EigenMatrix> X_S {X.col(i).data(), static_cast<Eigen::Index>(K * K), static_cast<Eigen::Index>(K)};
+            Y.noalias() = X_S * C_conjugate;
+
+            // The third quarter-transformation acts on the first index: Z(P, qR) = C^*(p P) Y(p, qR).
+            const Eigen::Map<const EigenMatrix> Y_view {Y.data(), static_cast<Eigen::Index>(K), static_cast<Eigen::Index>(K * k)};
+            Z.noalias() = C_adjoint * Y_view;
+
+            // The fourth quarter-transformation acts on the second index: g'(P Q R S) = Z(P, q; R) C(q Q). Every (R, S) block of the result is contiguous.
+            for (size_t R = 0; R < k; R++) {
+                const Eigen::Map<const EigenMatrix> Z_R {Z.data() + R * k * K, static_cast<Eigen::Index>(k), static_cast<Eigen::Index>(K)};
+                Eigen::Map<EigenMatrix> result_RS {result.data() + (R + S * k) * k * k, static_cast<Eigen::Index>(k), static_cast<Eigen::Index>(k)};
+                result_RS.noalias() = Z_R * C;
+            }
+        }
+    });
+
+    return result;
+}
+
+
+}  // namespace GQCP
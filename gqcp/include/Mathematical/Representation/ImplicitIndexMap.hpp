@@ -0,0 +1,103 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include <cstddef>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A map between the indices of one axis of an implicit object (e.g. an implicit matrix or tensor slice) and the indices of its dense representation, that can be queried in constant time.
+ *
+ *  If the implicit indices form a contiguous range that maps in order onto the dense indices (e.g. an occupied or virtual orbital block), a dense index is found by subtracting an offset. Otherwise, the dense indices are looked up in a table that is indexed by the implicit indices.
+ */
+class ImplicitIndexMap {
+private:
+    // The value of an entry in the lookup table for an implicit index that isn't part of the map.
+    static constexpr size_t absent = static_cast<size_t>(-1);
+
+    // The number of implicit indices that are part of this map.
+    size_t dim;
+
+    // If the implicit indices are contiguous, the implicit index that corresponds to the dense index 0.
+    size_t offset;
+
+    // If the implicit indices are contiguous and in the same order as the dense indices.
+    bool is_contiguous;
+
+    // For non-contiguous maps, the dense index of every implicit index, or `absent` if the implicit index isn't part of the map.
+    std::vector<size_t> dense_indices;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Create an index map from an ordered map between implicit and dense indices.
+     *
+     *  @param implicit_to_dense            Maps the implicit indices to the indices of the dense representation.
+     */
+    ImplicitIndexMap(const std::map<size_t, size_t>& implicit_to_dense = {});
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  Convert an implicit index to the index in the dense representation.
+     *
+     *  @param index                The implicit index.
+     *
+     *  @return The index in the dense representation that corresponds to the given implicit index.
+     */
+    size_t denseIndexOf(const size_t index) const {
+
+        if (this->is_contiguous) {
+            const auto dense_index = index - this->offset;  // Indices smaller than the offset wrap around to a large value.
+            if (dense_index < this->dim) {
+                return dense_index;
+            }
+        } else if ((index < this->dense_indices.size()) && (this->dense_indices[index] != ImplicitIndexMap::absent)) {
+            return this->dense_indices[index];
+        }
+
+        throw std::out_of_range("ImplicitIndexMap::denseIndexOf(const size_t): The given implicit index is not part of this index map.");
+    }
+
+    /**
+     *  @return The number of implicit indices that are part of this map.
+     */
+    size_t dimension() const { return this->dim; }
+
+    /**
+     *  @return If the implicit indices form a contiguous range that maps in order onto the dense indices.
+     */
+    bool isContiguous() const { return this->is_contiguous; }
+};
+
+
+}  // namespace GQCP
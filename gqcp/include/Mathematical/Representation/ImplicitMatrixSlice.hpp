@@ -18,6 +18,7 @@
 #pragma once
 
 
+#include "Mathematical/Representation/ImplicitIndexMap.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
 
 #include <map>
@@ -44,6 +45,9 @@ private:
     std::map<size_t, size_t> rows_implicit_to_dense;  // maps the row indices of the implicit matrix to the row indices of the dense representation of the slice
     std::map<size_t, size_t> cols_implicit_to_dense;  // maps the column indices of the implicit matrix to the column indices of the dense representation of the slice
 
+    ImplicitIndexMap row_lookup;     // a constant-time lookup of the row indices of the dense representation of the slice
+    ImplicitIndexMap column_lookup;  // a constant-time lookup of the column indices of the dense representation of the slice
+
     MatrixX<Scalar> M;  // the dense representation of the slice
 
 
@@ -62,6 +66,8 @@ public:
     ImplicitMatrixSlice(const std::map<size_t, size_t>& rows_implicit_to_dense, const std::map<size_t, size_t>& cols_implicit_to_dense, const MatrixX<Scalar>& M) :
         rows_implicit_to_dense {rows_implicit_to_dense},
         cols_implicit_to_dense {cols_implicit_to_dense},
+        row_lookup {rows_implicit_to_dense},
+        column_lookup {cols_implicit_to_dense},
         M {M} {
 
         // Check if the maps are consistent with the dense representation of the slice.
@@ -259,7 +265,7 @@ public:
      * 
      *  @return the column index the dense representation of this slice.
      */
-    size_t denseIndexOfColumn(const size_t col) const { return this->cols_implicit_to_dense.at(col); }
+    size_t denseIndexOfColumn(const size_t col) const { return this->column_lookup.denseIndexOf(col); }
 
     /**
      *  Convert an implicit row index to the row index in the dense representation of this slice.
@@ -268,7 +274,7 @@ public:
      * 
      *  @return the row index the dense representation of this slice.
      */
-    size_t denseIndexOfRow(const size_t row) const { return this->rows_implicit_to_dense.at(row); }
+    size_t denseIndexOfRow(const size_t row) const { return this->row_lookup.denseIndexOf(row); }
 
     /**
      *  @return the map between the row indices of the implicit matrix and the row indices of the dense representation of the slice
@@ -18,9 +18,11 @@
 #pragma once
 
 
+#include "Mathematical/Representation/ImplicitIndexMap.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
 #include "Mathematical/Representation/Tensor.hpp"
 
+#include <array>
 #include <map>
 #include <numeric>
 #include <vector>
@@ -42,6 +44,7 @@ public:
 
 private:
     std::vector<std::map<size_t, size_t>> indices_implicit_to_dense;  // an array of maps, mapping the implicit tensor indices to these of the dense representation
+    std::array<ImplicitIndexMap, 4> index_lookups;                     // a constant-time lookup of the indices of the dense representation, for every axis
 
     Tensor<Scalar, 4> T;  // the dense representation of the slice
 
@@ -67,6 +70,8 @@ public:
             if (this->indices_implicit_to_dense[axis_index].size() != dimensions[axis_index]) {
                 throw std::invalid_argument("ImplicitRankFourTensorSlice(const std::vector<std::map<size_t, size_t>>&, const Tensor<Scalar, 4>&): The given dense representation of the slice has an incompatible dimension for axis number " + std::to_string(axis_index) + ".");
             }
+
+            this->index_lookups[axis_index] = ImplicitIndexMap(this->indices_implicit_to_dense[axis_index]);
         }
     }
 
@@ -289,7 +294,7 @@ public:
      *  @return the index of the dense representation of this slice for the given axis
      */
     template <size_t Axis>
-    size_t denseIndexOf(const size_t index) const { return this->indices_implicit_to_dense[Axis].at(index); }
+    size_t denseIndexOf(const size_t index) const { return this->index_lookups[Axis].denseIndexOf(index); }
 
     /**
      *  @return an array of maps, mapping the implicit tensor indices to these of the dense representation
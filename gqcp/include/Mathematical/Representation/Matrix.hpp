@@ -486,5 +486,8 @@ using VectorFunction = std::function<VectorX<Scalar>(const VectorX<Scalar>&)>;
 template <typename Scalar>
 using MatrixFunction = std::function<MatrixX<Scalar>(const VectorX<Scalar>&)>;
 
+template <typename Scalar>
+using BlockVectorFunction = std::function<MatrixX<Scalar>(const MatrixX<Scalar>&)>;
+
 
 }  // namespace GQCP
@@ -223,7 +223,8 @@ template <>
 class MatrixRepresentationEvaluationContainer<VectorX<double>> {
 public:
     size_t index = 0;  // current position of the iterator in the dimension of the ONV basis
-    size_t end;        // total dimension
+    size_t begin = 0;  // the first position of the iterator
+    size_t end;        // the position past the last position of the iterator (by default the total dimension)
 
     VectorX<double> matvec;                     // matvec containing the evaluations
     const VectorX<double>& coefficient_vector;  // vector with which is multiplied
@@ -249,6 +250,20 @@ public:
         coefficient_vector {coefficient_vector},
         matvec {VectorX<double>::Zero(coefficient_vector.rows())} {}
 
+    /**
+     *  A container that only iterates over the indices [begin, end). Its matvec still has the full dimension, since the evaluations in the given range also contribute to elements outside of it. This allows the matrix-vector product to be split over multiple threads, each with their own container.
+     * 
+     *  @param coefficient_vector       the vector with which is multiplied
+     *  @param begin                    the first index of the iteration
+     *  @param end                      the index past the last index of the iteration
+     */
+    MatrixRepresentationEvaluationContainer(const VectorX<double>& coefficient_vector, const size_t begin, const size_t end) :
+        index {begin},
+        begin {begin},
+        end {end},
+        coefficient_vector {coefficient_vector},
+        matvec {VectorX<double>::Zero(coefficient_vector.rows())} {}
+
 
     /*
      *  PUBLIC METHODS
@@ -285,14 +300,14 @@ public:
     }
 
     /**
-     *  Tests if the iteration is finished, if true the index is reset to 0 
+     *  Tests if the iteration is finished, if true the index is reset to its first position
      *  If false the nonsequential_double is updated to the value of the current iteration
      * 
      *  @return true if the iteration is finished
      */
     bool isFinished() {
         if (this->index == this->end) {
-            this->index = 0;
+            this->index = this->begin;
             return true;
         } else {
             this->nonsequential_double = this->coefficient_vector(this->index);
@@ -301,4 +316,100 @@ public:
     }
 };
 
+
+/**
+ *  A specialization that calculates the matrix-vector products of the matrix representation with a block of coefficient vectors (i.e. the columns of a matrix) simultaneously, so that the matrix elements only have to be evaluated once for all vectors in the block.
+ *
+ *  Internally, the coefficient vectors and the matrix-vector products are stored in a transposed way, so that the elements that belong to one address are stored contiguously.
+ */
+template <>
+class MatrixRepresentationEvaluationContainer<MatrixX<double>> {
+public:
+    size_t index = 0;  // current position of the iterator in the dimension of the ONV basis
+    size_t begin = 0;  // the first position of the iterator
+    size_t end;        // the position past the last position of the iterator (by default the total dimension)
+
+    MatrixX<double> coefficient_vectors_transposed;  // the (transposed) block of vectors with which is multiplied
+    MatrixX<double> matvecs_transposed;              // the (transposed) matrix-vector products containing the evaluations
+    VectorX<double> sequential_vector;               // vector which temporarily contains the sum of added values for all vectors in the block, analogous to the sequential double for a single matrix-vector product
+    VectorX<double> nonsequential_vector;            // vector gathered from the coefficients of the current index, analogous to the nonsequential double for a single matrix-vector product
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param coefficient_vectors      the vectors with which is multiplied, as the columns of a matrix
+     *  @param begin                    the first index of the iteration
+     *  @param end                      the index past the last index of the iteration
+     */
+    MatrixRepresentationEvaluationContainer(const MatrixX<double>& coefficient_vectors, const size_t begin, const size_t end) :
+        index {begin},
+        begin {begin},
+        end {end},
+        coefficient_vectors_transposed {coefficient_vectors.transpose()},
+        matvecs_transposed {MatrixX<double>::Zero(coefficient_vectors.cols(), coefficient_vectors.rows())},
+        sequential_vector {VectorX<double>::Zero(coefficient_vectors.cols())},
+        nonsequential_vector {VectorX<double>::Zero(coefficient_vectors.cols())} {}
+
+    /**
+     *  @param coefficient_vectors      the vectors with which is multiplied, as the columns of a matrix
+     */
+    MatrixRepresentationEvaluationContainer(const MatrixX<double>& coefficient_vectors) :
+        MatrixRepresentationEvaluationContainer(coefficient_vectors, 0, coefficient_vectors.rows()) {}
+
+
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  Add a value to the matrix evaluation in which the current iterator index corresponds to the row and the given index corresponds to the column
+     * 
+     *  @param column    column index of the matrix
+     *  @param value     the value which is added to a given position in the matrix
+     */
+    void addColumnwise(const size_t column, const double value) { this->sequential_vector += value * this->coefficient_vectors_transposed.col(column); }
+
+    /**
+     *  Add a value to the matrix evaluation in which the current iterator index corresponds to the column and the given index corresponds to the row
+     * 
+     *  @param row       row index of the matrix
+     *  @param value     the value which is added to a given position in the matrix
+     */
+    void addRowwise(const size_t row, const double value) { this->matvecs_transposed.col(row) += value * this->nonsequential_vector; }
+
+    /**
+     *  @return the evaluation that is stored, i.e. the matrix-vector products as the columns of a matrix
+     */
+    MatrixX<double> evaluation() const { return this->matvecs_transposed.transpose(); }
+
+    /**
+     *  Move to the next index in the iteration, this is accompanied by an addition to the matrix-vector products and reset of the sequential vector
+     */
+    void increment() {
+        this->matvecs_transposed.col(this->index) += this->sequential_vector;
+        this->sequential_vector.setZero();
+        this->index++;
+    }
+
+    /**
+     *  Tests if the iteration is finished, if true the index is reset to its first position
+     *  If false the nonsequential vector is updated to the coefficients of the current iteration
+     * 
+     *  @return true if the iteration is finished
+     */
+    bool isFinished() {
+        if (this->index == this->end) {
+            this->index = this->begin;
+            return true;
+        } else {
+            this->nonsequential_vector = this->coefficient_vectors_transposed.col(this->index);
+            return false;
+        }
+    }
+};
+
 }  // namespace GQCP
@@ -0,0 +1,112 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include <Eigen/Dense>
+
+#include <cstddef>
+#include <string>
+
+
+namespace GQCP {
+
+
+/**
+ *  A dense, column-major matrix of doubles whose elements are stored in a memory-mapped file rather than in (anonymous) memory.
+ *
+ *  The operating system pages the elements in and out of physical memory when they are accessed, so the matrix may be (much) larger than the available RAM. It is most efficient when the elements are accessed sequentially, e.g. in contiguous blocks of rows of every column.
+ *
+ *  The backing file is created in a given directory and is removed from the file system immediately after it has been opened, so it never outlives the matrix (or the process).
+ */
+class MemoryMappedMatrix {
+private:
+    // The number of rows of the matrix.
+    long number_of_rows;
+
+    // The number of columns of the matrix.
+    long number_of_columns;
+
+    // The file descriptor of the (already unlinked) backing file.
+    int file_descriptor;
+
+    // A pointer to the first element of the mapped file.
+    double* mapped_data;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Create a zero-initialized matrix in a new memory-mapped file.
+     *
+     *  @param rows             The number of rows of the matrix.
+     *  @param cols             The number of columns of the matrix.
+     *  @param directory        The directory in which the backing file should be created. Preferably, this is a directory on a local disk.
+     */
+    MemoryMappedMatrix(const size_t rows, const size_t cols, const std::string& directory);
+
+    // A memory-mapped matrix owns its backing file, so it can't be copied.
+    MemoryMappedMatrix(const MemoryMappedMatrix&) = delete;
+    MemoryMappedMatrix& operator=(const MemoryMappedMatrix&) = delete;
+
+
+    /*
+     *  MARK: Destructor
+     */
+
+    /**
+     *  Unmap and close the backing file, which releases its disk space.
+     */
+    ~MemoryMappedMatrix();
+
+
+    /*
+     *  MARK: General information
+     */
+
+    /**
+     *  @return The number of columns of this matrix.
+     */
+    size_t cols() const { return static_cast<size_t>(this->number_of_columns); }
+
+    /**
+     *  @return The number of rows of this matrix.
+     */
+    size_t rows() const { return static_cast<size_t>(this->number_of_rows); }
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return A writable Eigen view on the elements of this matrix.
+     */
+    Eigen::Map<Eigen::MatrixXd> map() { return Eigen::Map<Eigen::MatrixXd>(this->mapped_data, this->number_of_rows, this->number_of_columns); }
+
+    /**
+     *  @return A read-only Eigen view on the elements of this matrix.
+     */
+    Eigen::Map<const Eigen::MatrixXd> map() const { return Eigen::Map<const Eigen::MatrixXd>(this->mapped_data, this->number_of_rows, this->number_of_columns); }
+};
+
+
+}  // namespace GQCP
@@ -0,0 +1,212 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+#include "Mathematical/Representation/SquareRankFourTensor.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+
+namespace GQCP {
+
+
+/**
+ *  A real square rank-4 tensor that has the 8-fold permutational symmetry of two-electron integrals over real orbitals, expressed in chemist's notation:
+ *      g(p q r s) = g(q p r s) = g(p q s r) = g(q p s r) = g(r s p q) = g(s r p q) = g(r s q p) = g(s r q p).
+ *
+ *  Only the unique elements are stored, which requires about K^4/8 elements instead of the K^4 elements of a dense `SquareRankFourTensor`. The pair indices pq (p >= q) are compounded in a lower-triangular way, and the unique elements are the lower triangle (pq >= rs) of the resulting symmetric pair matrix.
+ */
+class PackedSymmetricRankFourTensor {
+private:
+    // The dimension of every axis of the tensor.
+    size_t dim;
+
+    // The unique elements of the tensor, in the packed order.
+    VectorX<double> elements;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Create a zero-initialized packed tensor.
+     *
+     *  @param dim              The dimension of every axis of the tensor.
+     */
+    PackedSymmetricRankFourTensor(const size_t dim = 0);
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Pack a dense square rank-4 tensor.
+     *
+     *  @param tensor           A dense square rank-4 tensor that has the 8-fold permutational symmetry of two-electron integrals over real orbitals.
+     *
+     *  @return The packed representation of the given tensor.
+     *
+     *  @note Only the elements g(p q r s) with p >= q, r >= s and pq >= rs are read, so the symmetry of the given tensor isn't checked.
+     */
+    static PackedSymmetricRankFourTensor FromFull(const SquareRankFourTensor<double>& tensor);
+
+    /**
+     *  Create a random packed tensor, with values uniformly distributed between [-1,1].
+     *
+     *  @param dim              The dimension of every axis of the tensor.
+     *
+     *  @return A random packed tensor.
+     */
+    static PackedSymmetricRankFourTensor Random(const size_t dim);
+
+
+    /*
+     *  MARK: Indices
+     */
+
+    /**
+     *  @param p            The first index.
+     *  @param q            The second index.
+     *
+     *  @return The lower-triangular compound index of the unordered pair (p, q).
+     */
+    static size_t pairIndex(const size_t p, const size_t q) {
+        const auto larger = std::max(p, q);
+        const auto smaller = std::min(p, q);
+        return larger * (larger + 1) / 2 + smaller;
+    }
+
+    /**
+     *  @return The position of the element g(p q r s) in the packed storage.
+     */
+    static size_t packedIndex(const size_t p, const size_t q, const size_t r, const size_t s) { return pairIndex(pairIndex(p, q), pairIndex(r, s)); }
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return A read-only reference to the element g(p q r s).
+     */
+    const double& operator()(const size_t p, const size_t q, const size_t r, const size_t s) const { return this->elements(packedIndex(p, q, r, s)); }
+
+    /**
+     *  @return A writable reference to the element g(p q r s). Since all 8 symmetry-related elements share their storage, writing to it changes all of them.
+     */
+    double& operator()(const size_t p, const size_t q, const size_t r, const size_t s) { return this->elements(packedIndex(p, q, r, s)); }
+
+    /**
+     *  @return A read-only reference to the unique elements of this tensor, in the packed order.
+     */
+    const VectorX<double>& packedElements() const { return this->elements; }
+
+    /**
+     *  @return A writable reference to the unique elements of this tensor, in the packed order.
+     */
+    VectorX<double>& packedElements() { return this->elements; }
+
+
+    /*
+     *  MARK: General information
+     */
+
+    /**
+     *  @return The dimension of every axis of this tensor.
+     */
+    size_t dimension() const { return this->dim; }
+
+    /**
+     *  @return The number of unique elements that are stored.
+     */
+    size_t numberOfElements() const { return static_cast<size_t>(this->elements.size()); }
+
+    /**
+     *  @return The number of unordered index pairs (p, q), i.e. K(K+1)/2.
+     */
+    size_t numberOfPairs() const { return this->dim * (this->dim + 1) / 2; }
+
+
+    /*
+     *  MARK: Conversions
+     */
+
+    /**
+     *  @return The dense square rank-4 tensor that this packed tensor represents.
+     */
+    SquareRankFourTensor<double> full() const;
+
+    /**
+     *  @return The pair matrix M(pq, rs) = g(p q r s) for p >= q and r >= s, i.e. the symmetric matrix whose lower triangle is stored.
+     */
+    SquareMatrix<double> pairMatrix() const;
+
+
+    /*
+     *  MARK: Comparing
+     */
+
+    /**
+     *  @param other            The other packed tensor.
+     *  @param tolerance        The tolerance for the comparison.
+     *
+     *  @return If this packed tensor is approximately equal to the other one.
+     */
+    bool isApprox(const PackedSymmetricRankFourTensor& other, const double tolerance = 1.0e-12) const;
+
+
+    /*
+     *  MARK: Basis transformations
+     */
+
+    /**
+     *  Transform this tensor to another (real) orbital basis, i.e. calculate
+     *      g'(P Q R S) = C(p P) C(q Q) C(r R) C(s S) g(p q r s).
+     *
+     *  @param C                    The (real) K x k transformation matrix, whose columns are the expansion coefficients of the new orbitals in terms of the old ones. Using fewer columns than rows transforms directly to a subset of orbitals, such as an active space.
+     *  @param number_of_threads    The number of threads over which the batches of orbital pairs should be distributed.
+     *
+     *  @return The transformed tensor with dimension k, in packed storage.
+     *
+     *  @note The transformation is done in two half-transformations of symmetric matrices, so that no dense rank-4 intermediates are needed: apart from batch buffers, the only intermediate is the half-transformed pair matrix, which has about K^2 k^2 / 4 elements. The second half-transformation writes directly into the packed storage of the result. Every half-transformation unpacks a batch of orbital pairs at once, so that the first quarter-transformation of the whole batch is a single matrix-matrix product.
+     */
+    PackedSymmetricRankFourTensor transformed(const MatrixX<double>& C, const size_t number_of_threads = 1) const;
+
+    /**
+     *  In-place apply a plane rotation to all four indices of this tensor. Only the orbitals p and q change:
+     *      phi'_p = G(0,0) phi_p + G(1,0) phi_q
+     *      phi'_q = G(0,1) phi_p + G(1,1) phi_q.
+     *
+     *  @param p            The first index that is rotated.
+     *  @param q            The second index that is rotated.
+     *  @param G            The 2x2 matrix that is applied, whose first row and column correspond to p and whose second row and column correspond to q.
+     *
+     *  @note Only the 2K-1 orbital pairs that contain p or q change, and every one of them mixes with at most three others. Updating the affected part of the pair matrix therefore scales as O(K^3), without unpacking the tensor.
+     */
+    void rotatePlane(const size_t p, const size_t q, const Eigen::Matrix2d& G);
+};
+
+
+}  // namespace GQCP
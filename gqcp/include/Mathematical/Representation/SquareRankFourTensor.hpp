@@ -244,6 +244,50 @@ public:
 
         return M;
     }
+
+
+    /**
+     *  In-place apply a plane rotation along one of the axes of this tensor. Only the slices whose index along that axis equals p or q are updated:
+     *      T'(..., p, ...) = G(0,0) T(..., p, ...) + G(1,0) T(..., q, ...)
+     *      T'(..., q, ...) = G(0,1) T(..., p, ...) + G(1,1) T(..., q, ...)
+     *
+     *  @param axis         The axis (0, 1, 2 or 3) along which the rotation should be applied.
+     *  @param p            The first index that is rotated.
+     *  @param q            The second index that is rotated.
+     *  @param G            The 2x2 matrix that is applied, whose first row and column correspond to p and whose second row and column correspond to q.
+     *
+     *  @note This update scales as O(K^3), which is how a Jacobi rotation matrix (that only differs from the identity in the columns p and q) can be applied to a single axis without any O(K^5) contraction.
+     */
+    template <typename RotationScalar>
+    void rotateAxis(const size_t axis, const size_t p, const size_t q, const Eigen::Matrix<RotationScalar, 2, 2>& G) {
+
+        if (axis > 3) {
+            throw std::invalid_argument("SquareRankFourTensor::rotateAxis(const size_t, const size_t, const size_t, const Eigen::Matrix<RotationScalar, 2, 2>&): The given axis is out of bounds.");
+        }
+
+        // In the column-major storage, the elements with consecutive indices along the given axis are 'stride' elements apart, and the slices along the given axis are repeated in 'number_of_blocks' blocks.
+        const auto K = this->dimension();
+        size_t stride = 1;
+        for (size_t a = 0; a < axis; a++) {
+            stride *= K;
+        }
+        const auto block_size = stride * K;
+        const auto number_of_blocks = (K * K * K * K) / block_size;
+
+        Scalar* data = this->data();
+        for (size_t block = 0; block < number_of_blocks; block++) {
+            Scalar* p_slice = data + block * block_size + p * stride;
+            Scalar* q_slice = data + block * block_size + q * stride;
+
+            for (size_t i = 0; i < stride; i++) {
+                const Scalar x = p_slice[i];
+                const Scalar y = q_slice[i];
+
+                p_slice[i] = G(0, 0) * x + G(1, 0) * y;
+                q_slice[i] = G(0, 1) * x + G(1, 1) * y;
+            }
+        }
+    }
 };
 
 }  // namespace GQCP
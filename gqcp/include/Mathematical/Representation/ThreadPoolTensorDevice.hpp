@@ -0,0 +1,105 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+// The thread pool of Eigen's Tensor module is only available if EIGEN_USE_THREADS is defined before the module is included. The library defines it as a (public) compile option.
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/**
+ *  A pool of threads together with the Eigen device that evaluates tensor expressions on it. It can be passed to `Tensor::einsum` and `ContractionPlan::evaluate` through `eigen()`.
+ *
+ *  @note Creating the threads is relatively expensive, so a device should be created once and reused for many contractions.
+ */
+class ThreadPoolTensorDevice {
+private:
+    // The number of threads in the pool.
+    size_t number_of_threads;
+
+    // The pool of threads that evaluates the tensor expressions.
+    Eigen::ThreadPool pool;
+
+    // The Eigen device that distributes tensor expressions over the pool.
+    Eigen::ThreadPoolDevice device;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param number_of_threads            The number of threads in the pool.
+     */
+    ThreadPoolTensorDevice(const size_t number_of_threads) :
+        number_of_threads {ThreadPoolTensorDevice::checked(number_of_threads)},
+        pool {static_cast<int>(number_of_threads)},
+        device {&pool, static_cast<int>(number_of_threads)} {}
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The Eigen device that distributes tensor expressions over the pool.
+     */
+    const Eigen::ThreadPoolDevice& eigen() const { return this->device; }
+
+    /**
+     *  @return The number of threads in the pool.
+     */
+    size_t numberOfThreads() const { return this->number_of_threads; }
+
+
+private:
+    /**
+     *  @param number_of_threads            The requested number of threads.
+     *
+     *  @return The requested number of threads, if it is valid.
+     */
+    static size_t checked(const size_t number_of_threads) {
+        if (number_of_threads == 0) {
+            throw std::invalid_argument("ThreadPoolTensorDevice(const size_t): The number of threads should be at least 1.");
+        }
+        return number_of_threads;
+    }
+};
+
+
+/*
+ *  MARK: Library-wide device
+ */
+
+/**
+ *  @return The library-wide device on which tensor contractions are evaluated if no device is given explicitly, e.g. by `Tensor::einsum`. It has as many threads as the library-wide number of threads (see `setNumberOfThreads`), and is recreated when that number changes.
+ *
+ *  @note The returned pointer keeps the device alive while it is used, even if the library-wide number of threads is changed in the meantime.
+ */
+std::shared_ptr<const ThreadPoolTensorDevice> libraryTensorDevice();
+
+
+}  // namespace GQCP
@@ -0,0 +1,458 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/**
+ *  A fixed-width bitstring that consists of multiple 64-bit words, which can represent the occupations of more than 64 spinors.
+ *
+ *  Just like for an unsigned integer, bit 0 is the least significant bit. It is stored in the first word, i.e. word i contains the bits [64 i, 64 i + 64).
+ *
+ *  @tparam _Bits               The number of bits in this bitstring. It should be a multiple of 64.
+ */
+template <size_t _Bits>
+class Bitstring {
+public:
+    // The number of bits in this bitstring.
+    static constexpr size_t Bits = _Bits;
+
+    // The number of 64-bit words that are used to store this bitstring.
+    static constexpr size_t NumberOfWords = _Bits / 64;
+
+    static_assert((_Bits > 0) && (_Bits % 64 == 0), "Bitstring: The number of bits should be a positive multiple of 64.");
+
+
+private:
+    // The words that store the bits of this bitstring, starting with the least significant word.
+    std::array<uint64_t, NumberOfWords> words;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Create a bitstring in which all bits are unset.
+     */
+    Bitstring() :
+        words {} {}
+
+
+    /**
+     *  Create a bitstring whose least significant word is given, and whose other bits are unset.
+     *
+     *  @param value                The value of the least significant 64 bits.
+     */
+    explicit Bitstring(const uint64_t value) :
+        words {} {
+
+        this->words[0] = value;
+    }
+
+
+    /*
+     *  MARK: Operators
+     */
+
+    /**
+     *  @param other                Another bitstring.
+     *
+     *  @return If this bitstring is equal to the other one.
+     */
+    bool operator==(const Bitstring<Bits>& other) const { return this->words == other.words; }
+
+    /**
+     *  @param other                Another bitstring.
+     *
+     *  @return If this bitstring differs from the other one.
+     */
+    bool operator!=(const Bitstring<Bits>& other) const { return !this->operator==(other); }
+
+    /**
+     *  @param other                Another bitstring.
+     *
+     *  @return If the unsigned integer that this bitstring represents is smaller than the one of the other bitstring.
+     */
+    bool operator<(const Bitstring<Bits>& other) const {
+
+        // Compare from the most significant word to the least significant one.
+        for (size_t w = NumberOfWords; w-- > 0;) {
+            if (this->words[w] != other.words[w]) {
+                return this->words[w] < other.words[w];
+            }
+        }
+        return false;
+    }
+
+    /**
+     *  In-place bitwise AND.
+     */
+    Bitstring<Bits>& operator&=(const Bitstring<Bits>& other) {
+        for (size_t w = 0; w < NumberOfWords; w++) {
+            this->words[w] &= other.words[w];
+        }
+        return *this;
+    }
+
+    /**
+     *  In-place bitwise OR.
+     */
+    Bitstring<Bits>& operator|=(const Bitstring<Bits>& other) {
+        for (size_t w = 0; w < NumberOfWords; w++) {
+            this->words[w] |= other.words[w];
+        }
+        return *this;
+    }
+
+    /**
+     *  In-place bitwise XOR.
+     */
+    Bitstring<Bits>& operator^=(const Bitstring<Bits>& other) {
+        for (size_t w = 0; w < NumberOfWords; w++) {
+            this->words[w] ^= other.words[w];
+        }
+        return *this;
+    }
+
+    /**
+     *  @return The bitwise AND of this bitstring and the other one.
+     */
+    Bitstring<Bits> operator&(const Bitstring<Bits>& other) const {
+        auto result = *this;
+        return result &= other;
+    }
+
+    /**
+     *  @return The bitwise OR of this bitstring and the other one.
+     */
+    Bitstring<Bits> operator|(const Bitstring<Bits>& other) const {
+        auto result = *this;
+        return result |= other;
+    }
+
+    /**
+     *  @return The bitwise XOR of this bitstring and the other one.
+     */
+    Bitstring<Bits> operator^(const Bitstring<Bits>& other) const {
+        auto result = *this;
+        return result ^= other;
+    }
+
+    /**
+     *  @return The bitwise complement of this bitstring.
+     */
+    Bitstring<Bits> operator~() const {
+        Bitstring<Bits> result;
+        for (size_t w = 0; w < NumberOfWords; w++) {
+            result.words[w] = ~this->words[w];
+        }
+        return result;
+    }
+
+    /**
+     *  @param shift                The number of positions that the bits should be shifted.
+     *
+     *  @return This bitstring, shifted towards its least significant bit. Bits that are shifted in are unset.
+     */
+    Bitstring<Bits> operator>>(const size_t shift) const {
+
+        Bitstring<Bits> result;
+        if (shift >= Bits) {
+            return result;
+        }
+
+        const auto word_shift = shift / 64;
+        const auto bit_shift = shift % 64;
+        for (size_t w = 0; w + word_shift < NumberOfWords; w++) {
+            result.words[w] = this->words[w + word_shift] >> bit_shift;
+
+            // Carry in the lowest bits of the next word.
+            if ((bit_shift != 0) && (w + word_shift + 1 < NumberOfWords)) {
+                result.words[w] |= this->words[w + word_shift + 1] << (64 - bit_shift);
+            }
+        }
+        return result;
+    }
+
+    /**
+     *  @param shift                The number of positions that the bits should be shifted.
+     *
+     *  @return This bitstring, shifted towards its most significant bit. Bits that are shifted in are unset.
+     */
+    Bitstring<Bits> operator<<(const size_t shift) const {
+
+        Bitstring<Bits> result;
+        if (shift >= Bits) {
+            return result;
+        }
+
+        const auto word_shift = shift / 64;
+        const auto bit_shift = shift % 64;
+        for (size_t w = NumberOfWords; w-- > word_shift;) {
+            result.words[w] = this->words[w - word_shift] << bit_shift;
+
+            // Carry in the highest bits of the previous word.
+            if ((bit_shift != 0) && (w > word_shift)) {
+                result.words[w] |= this->words[w - word_shift - 1] >> (64 - bit_shift);
+            }
+        }
+        return result;
+    }
+
+
+    /*
+     *  MARK: Bit manipulation
+     */
+
+    /**
+     *  @return The number of set bits.
+     */
+    size_t count() const {
+
+        size_t count = 0;
+        for (const auto& word : this->words) {
+            count += __builtin_popcountll(word);
+        }
+        return count;
+    }
+
+    /**
+     *  @param p                    A bit index.
+     *
+     *  @return The number of set bits with an index that is smaller than p.
+     */
+    size_t countBelow(const size_t p) const {
+
+        if (p >= Bits) {
+            return this->count();
+        }
+
+        // Count the full words and mask the word that contains bit p.
+        const auto word_index = p / 64;
+        const auto bit_index = p % 64;
+
+        size_t count = 0;
+        for (size_t w = 0; w < word_index; w++) {
+            count += __builtin_popcountll(this->words[w]);
+        }
+        if (bit_index != 0) {
+            count += __builtin_popcountll(this->words[word_index] & ((uint64_t {1} << bit_index) - 1));
+        }
+        return count;
+    }
+
+    /**
+     *  @return The index of the least significant set bit, or the number of bits if no bit is set.
+     */
+    size_t countTrailingZeros() const {
+
+        for (size_t w = 0; w < NumberOfWords; w++) {
+            if (this->words[w] != 0) {
+                return 64 * w + __builtin_ctzll(this->words[w]);
+            }
+        }
+        return Bits;
+    }
+
+    /**
+     *  Flip the bit at the given index.
+     *
+     *  @param p                    A bit index.
+     */
+    void flip(const size_t p) { this->words[p / 64] ^= uint64_t {1} << (p % 64); }
+
+    /**
+     *  @return If no bit is set.
+     */
+    bool none() const { return *this == Bitstring<Bits> {}; }
+
+    /**
+     *  Unset the least significant set bit, if there is any.
+     */
+    void removeLeastSignificantBit() {
+
+        for (auto& word : this->words) {
+            if (word != 0) {
+                word &= word - 1;
+                return;
+            }
+        }
+    }
+
+    /**
+     *  Unset the bit at the given index.
+     *
+     *  @param p                    A bit index.
+     */
+    void reset(const size_t p) { this->words[p / 64] &= ~(uint64_t {1} << (p % 64)); }
+
+    /**
+     *  Set the bit at the given index.
+     *
+     *  @param p                    A bit index.
+     */
+    void set(const size_t p) { this->words[p / 64] |= uint64_t {1} << (p % 64); }
+
+    /**
+     *  @param index_start          The first bit index of the slice (included).
+     *  @param index_end            The last bit index of the slice (not included).
+     *
+     *  @return The bits in [index_start, index_end), shifted such that index_start becomes the least significant bit.
+     */
+    Bitstring<Bits> slice(const size_t index_start, const size_t index_end) const {
+
+        // Shift the slice to the least significant bits, and unset every bit from the length of the slice onwards.
+        auto result = *this >> index_start;
+        const auto length = index_end - index_start;
+        for (size_t w = 0; w < NumberOfWords; w++) {
+            if (64 * w >= length) {
+                result.words[w] = 0;
+            } else if (64 * (w + 1) > length) {
+                result.words[w] &= (uint64_t {1} << (length - 64 * w)) - 1;
+            }
+        }
+        return result;
+    }
+
+    /**
+     *  @param p                    A bit index.
+     *
+     *  @return If the bit at the given index is set.
+     */
+    bool test(const size_t p) const { return (this->words[p / 64] >> (p % 64)) & 1; }
+
+    /**
+     *  @param w                    A word index.
+     *
+     *  @return The word at the given index, where the word 0 contains the least significant bits.
+     */
+    uint64_t word(const size_t w) const { return this->words[w]; }
+};
+
+
+/*
+ *  MARK: Bitstring traits
+ */
+
+/**
+ *  The bit operations that are needed to use a type as the representation of an ONV. Every operation has the same semantics as the member function of `Bitstring` with the same name, taking the bitstring as its first argument.
+ *
+ *  @tparam Representation          The type that represents a bitstring.
+ */
+template <typename Representation>
+struct BitstringTraits {};
+
+
+/**
+ *  A specialization of the bitstring traits for a single unsigned 64-bit integer, which maps every operation directly on the corresponding intrinsic.
+ */
+template <>
+struct BitstringTraits<size_t> {
+
+    // The number of bits that can be represented.
+    static constexpr size_t number_of_bits = 64;
+
+    static size_t count(const size_t x) { return __builtin_popcountll(x); }
+
+    static size_t countBelow(const size_t x, const size_t p) { return (p >= 64) ? __builtin_popcountll(x) : __builtin_popcountll(x & ((size_t {1} << p) - 1)); }
+
+    static size_t countTrailingZeros(const size_t x) { return (x == 0) ? 64 : __builtin_ctzll(x); }
+
+    static void flip(size_t& x, const size_t p) { x ^= size_t {1} << p; }
+
+    static bool none(const size_t x) { return x == 0; }
+
+    static void removeLeastSignificantBit(size_t& x) { x &= x - 1; }
+
+    static size_t slice(const size_t x, const size_t index_start, const size_t index_end) {
+        const auto length = index_end - index_start;
+        const auto shifted = (index_start >= 64) ? 0 : (x >> index_start);
+        return (length >= 64) ? shifted : (shifted & ((size_t {1} << length) - 1));
+    }
+
+    static bool test(const size_t x, const size_t p) { return (x >> p) & 1; }
+};
+
+
+/**
+ *  A specialization of the bitstring traits for multi-word bitstrings.
+ */
+template <size_t Bits>
+struct BitstringTraits<Bitstring<Bits>> {
+
+    // The number of bits that can be represented.
+    static constexpr size_t number_of_bits = Bits;
+
+    static size_t count(const Bitstring<Bits>& x) { return x.count(); }
+
+    static size_t countBelow(const Bitstring<Bits>& x, const size_t p) { return x.countBelow(p); }
+
+    static size_t countTrailingZeros(const Bitstring<Bits>& x) { return x.countTrailingZeros(); }
+
+    static void flip(Bitstring<Bits>& x, const size_t p) { x.flip(p); }
+
+    static bool none(const Bitstring<Bits>& x) { return x.none(); }
+
+    static void removeLeastSignificantBit(Bitstring<Bits>& x) { x.removeLeastSignificantBit(); }
+
+    static Bitstring<Bits> slice(const Bitstring<Bits>& x, const size_t index_start, const size_t index_end) { return x.slice(index_start, index_end); }
+
+    static bool test(const Bitstring<Bits>& x, const size_t p) { return x.test(p); }
+};
+
+
+}  // namespace GQCP
+
+
+namespace std {
+
+
+/*
+ *  MARK: Hashing
+ */
+
+/**
+ *  A hash function for multi-word bitstrings, so that they can be used as keys of unordered containers, just like unsigned integers.
+ */
+template <size_t Bits>
+struct hash<GQCP::Bitstring<Bits>> {
+
+    size_t operator()(const GQCP::Bitstring<Bits>& bitstring) const {
+
+        // Combine the hashes of the words in the same way as boost::hash_combine.
+        size_t seed = 0;
+        for (size_t w = 0; w < GQCP::Bitstring<Bits>::NumberOfWords; w++) {
+            seed ^= std::hash<uint64_t> {}(bitstring.word(w)) + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2);
+        }
+        return seed;
+    }
+};
+
+
+}  // namespace std
@@ -26,11 +26,14 @@ namespace GQCP {
  *  A type that can be used to build (spin-unresolved) ONV paths in a graphical representation of a CI addressing scheme.
  * 
  *  When modifying paths, instances of this type accordingly update the path's corresponding address and total sign.
+ *
+ *  @tparam ONVBasis            The type of the ONV basis in which the ONV (path) lives.
+ *  @tparam _ONV                The type of the ONV whose path is represented. It defaults to the ONV that is naturally related to the ONV basis, but it may be an ONV with a wider representation.
  */
-template <typename ONVBasis>
+template <typename ONVBasis, typename _ONV = typename ONVBasis::ONV>
 class ONVPath {
 public:
-    using ONV = typename ONVBasis::ONV;
+    using ONV = _ONV;
 
 private:
     // The ONV basis in which the ONV (path) lives. A (const) reference in order to avoid unnecessary copying.
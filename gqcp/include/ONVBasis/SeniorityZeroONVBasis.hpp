@@ -20,6 +20,7 @@
 
 #include "Mathematical/Representation/Matrix.hpp"
 #include "ONVBasis/SpinUnresolvedONVBasis.hpp"
+#include "Operator/SecondQuantized/PackedRSQHamiltonian.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 
 #include <functional>
@@ -37,6 +38,59 @@ private:
     size_t N_P;  // The number of electron pairs.
 
 
+    /*
+     *  MARK: Restricted Hamiltonian evaluations
+     */
+
+    /**
+     *  Calculate the dense matrix representation of a restricted Hamiltonian in this ONV basis.
+     *
+     *  @param h                The parameters of the core (i.e. one-electron) part of the Hamiltonian.
+     *  @param g                The parameters of the two-electron part of the Hamiltonian, whose elements can be accessed as g(p, q, r, s). They can be dense or packed.
+     *
+     *  @return A dense matrix represention of the Hamiltonian.
+     */
+    template <typename TwoElectronParameters>
+    SquareMatrix<double> evaluateHamiltonianDense(const SquareMatrix<double>& h, const TwoElectronParameters& g) const;
+
+    /**
+     *  Calculate the diagonal of the dense matrix representation of a restricted Hamiltonian in this ONV basis.
+     *
+     *  @param h                The parameters of the core (i.e. one-electron) part of the Hamiltonian.
+     *  @param g                The parameters of the two-electron part of the Hamiltonian, whose elements can be accessed as g(p, q, r, s). They can be dense or packed.
+     *
+     *  @return The diagonal of the dense matrix represention of the Hamiltonian.
+     */
+    template <typename TwoElectronParameters>
+    VectorX<double> evaluateHamiltonianDiagonal(const SquareMatrix<double>& h, const TwoElectronParameters& g) const;
+
+    /**
+     *  Calculate the matrix-vector product of (the matrix representation of) a restricted Hamiltonian with the given coefficient vector.
+     *
+     *  @param h                The parameters of the core (i.e. one-electron) part of the Hamiltonian.
+     *  @param g                The parameters of the two-electron part of the Hamiltonian, whose elements can be accessed as g(p, q, r, s). They can be dense or packed.
+     *  @param x                The coefficient vector of a linear expansion.
+     *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector product.
+     *
+     *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
+     */
+    template <typename TwoElectronParameters>
+    VectorX<double> evaluateHamiltonianMatrixVectorProduct(const SquareMatrix<double>& h, const TwoElectronParameters& g, const VectorX<double>& x, const size_t number_of_threads) const;
+
+    /**
+     *  Calculate the matrix-vector products of (the matrix representation of) a restricted Hamiltonian with a block of coefficient vectors.
+     *
+     *  @param h                The parameters of the core (i.e. one-electron) part of the Hamiltonian.
+     *  @param g                The parameters of the two-electron part of the Hamiltonian, whose elements can be accessed as g(p, q, r, s). They can be dense or packed.
+     *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+     *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector products.
+     *
+     *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+     */
+    template <typename TwoElectronParameters>
+    MatrixX<double> evaluateHamiltonianBlockMatrixVectorProduct(const SquareMatrix<double>& h, const TwoElectronParameters& g, const MatrixX<double>& X, const size_t number_of_threads) const;
+
+
 public:
     /*
      *  MARK: Constructors
@@ -119,6 +173,15 @@ public:
      */
     SquareMatrix<double> evaluateOperatorDense(const RSQHamiltonian<double>& hamiltonian) const;
 
+    /**
+     *  Calculate the dense matrix representation of a restricted Hamiltonian with packed two-electron integrals in this ONV basis.
+     *
+     *  @param hamiltonian      A restricted Hamiltonian with packed two-electron integrals, expressed in an orthonormal orbital basis.
+     *
+     *  @return A dense matrix represention of the Hamiltonian.
+     */
+    SquareMatrix<double> evaluateOperatorDense(const PackedRSQHamiltonian& hamiltonian) const;
+
 
     /*
      *  MARK: Diagonal restricted operator evaluations
@@ -151,6 +214,15 @@ public:
      */
     VectorX<double> evaluateOperatorDiagonal(const RSQHamiltonian<double>& hamiltonian) const;
 
+    /**
+     *  Calculate the diagonal of the dense matrix representation of a restricted Hamiltonian with packed two-electron integrals in this ONV basis.
+     *
+     *  @param hamiltonian      A restricted Hamiltonian with packed two-electron integrals, expressed in an orthonormal orbital basis.
+     *
+     *  @return The diagonal of the dense matrix represention of the Hamiltonian.
+     */
+    VectorX<double> evaluateOperatorDiagonal(const PackedRSQHamiltonian& hamiltonian) const;
+
 
     /*
      *  MARK: Restricted matrix-vector product evaluations
@@ -171,10 +243,44 @@ public:
      *
      *  @param hamiltonian      A restricted Hamiltonian expressed in an orthonormal orbital basis.
      *  @param x                The coefficient vector of a linear expansion.
+     *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector product.
+     *
+     *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
+     */
+    VectorX<double> evaluateOperatorMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const VectorX<double>& x, const size_t number_of_threads = 1) const;
+
+    /**
+     *  Calculate the matrix-vector product of (the matrix representation of) a restricted Hamiltonian with packed two-electron integrals with the given coefficient vector.
+     *
+     *  @param hamiltonian      A restricted Hamiltonian with packed two-electron integrals, expressed in an orthonormal orbital basis.
+     *  @param x                The coefficient vector of a linear expansion.
+     *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector product.
      *
      *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
      */
-    VectorX<double> evaluateOperatorMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const VectorX<double>& x) const;
+    VectorX<double> evaluateOperatorMatrixVectorProduct(const PackedRSQHamiltonian& hamiltonian, const VectorX<double>& x, const size_t number_of_threads = 1) const;
+
+    /**
+     *  Calculate the matrix-vector products of (the matrix representation of) a restricted Hamiltonian with a block of coefficient vectors.
+     *
+     *  @param hamiltonian      A restricted Hamiltonian expressed in an orthonormal orbital basis.
+     *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+     *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector products.
+     *
+     *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+     */
+    MatrixX<double> evaluateOperatorBlockMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const MatrixX<double>& X, const size_t number_of_threads = 1) const;
+
+    /**
+     *  Calculate the matrix-vector products of (the matrix representation of) a restricted Hamiltonian with packed two-electron integrals with a block of coefficient vectors.
+     *
+     *  @param hamiltonian      A restricted Hamiltonian with packed two-electron integrals, expressed in an orthonormal orbital basis.
+     *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+     *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector products.
+     *
+     *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+     */
+    MatrixX<double> evaluateOperatorBlockMatrixVectorProduct(const PackedRSQHamiltonian& hamiltonian, const MatrixX<double>& X, const size_t number_of_threads = 1) const;
 };
 
 
@@ -0,0 +1,132 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "ONVBasis/SpinResolvedONVBasis.hpp"
+
+#include <Eigen/Sparse>
+
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  An object that calculates matrix-vector products of a fixed Hamiltonian in a fixed full spin-resolved ONV basis.
+ *
+ *  All Hamiltonian-dependent intermediates (the sparse pure-alpha and pure-beta Hamiltonian matrices and the sparse beta two-electron intermediates 'theta(pq)' from Helgaker, Jørgensen, Olsen (2000)) are calculated upon construction, so that every subsequent matrix-vector product only consists of (sparse) matrix multiplications. This is especially useful in iterative algorithms, which require many matrix-vector products with the same Hamiltonian.
+ *
+ *  The matrix-vector products can be calculated on multiple threads. Every thread then calculates the contributions to a contiguous block of alpha-string columns of the (re-mapped) result, so no reduction is needed and the result does not depend on the number of threads.
+ */
+class SpinResolvedMatrixVectorProductEngine {
+private:
+    // The dimension of the alpha ONV basis.
+    long dim_alpha;
+
+    // The dimension of the beta ONV basis.
+    long dim_beta;
+
+    // The sparse matrix representation of the pure alpha part of the Hamiltonian, in the alpha ONV basis.
+    Eigen::SparseMatrix<double> H_a;
+
+    // The sparse matrix representation of the pure beta part of the Hamiltonian, in the beta ONV basis.
+    Eigen::SparseMatrix<double> H_b;
+
+    // The one-electron coupling elements 'sigma(pq)' for the alpha ONV basis, for p <= q.
+    std::vector<Eigen::SparseMatrix<double>> alpha_couplings;
+
+    // The sparse matrix representations of the beta two-electron intermediates 'theta(pq)', for p <= q. They are stored in the same order as the alpha couplings.
+    std::vector<Eigen::SparseMatrix<double>> beta_intermediates;
+
+    // The number of threads that are used in calculating a matrix-vector product.
+    size_t number_of_threads;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param onv_basis            The full spin-resolved ONV basis in which the Hamiltonian should be represented.
+     *  @param hamiltonian          An unrestricted Hamiltonian expressed in an orthonormal orbital basis.
+     *  @param number_of_threads    The number of threads that should be used in calculating a matrix-vector product.
+     */
+    SpinResolvedMatrixVectorProductEngine(const SpinResolvedONVBasis& onv_basis, const USQHamiltonian<double>& hamiltonian, const size_t number_of_threads = 1);
+
+    /**
+     *  @param onv_basis            The full spin-resolved ONV basis in which the Hamiltonian should be represented.
+     *  @param hamiltonian          A restricted Hamiltonian expressed in an orthonormal orbital basis.
+     *  @param number_of_threads    The number of threads that should be used in calculating a matrix-vector product.
+     */
+    SpinResolvedMatrixVectorProductEngine(const SpinResolvedONVBasis& onv_basis, const RSQHamiltonian<double>& hamiltonian, const size_t number_of_threads = 1);
+
+
+    /*
+     *  MARK: General information
+     */
+
+    /**
+     *  @return The dimension of the ONV basis in which the matrix-vector products are calculated.
+     */
+    size_t dimension() const { return static_cast<size_t>(this->dim_alpha * this->dim_beta); }
+
+    /**
+     *  @return The number of threads that are used in calculating a matrix-vector product.
+     */
+    size_t numberOfThreads() const { return this->number_of_threads; }
+
+
+    /*
+     *  MARK: Matrix-vector products
+     */
+
+    /**
+     *  Calculate the matrix-vector product of (the matrix representation of) the Hamiltonian with the given coefficient vector.
+     *
+     *  @param x                The coefficient vector of a linear expansion.
+     *
+     *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
+     */
+    VectorX<double> evaluate(const VectorX<double>& x) const;
+
+    /**
+     *  Calculate the matrix-vector product of (the matrix representation of) the Hamiltonian with the given coefficient vector.
+     *
+     *  @param x                The coefficient vector of a linear expansion.
+     *
+     *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
+     */
+    VectorX<double> operator()(const VectorX<double>& x) const { return this->evaluate(x); }
+
+    /**
+     *  Calculate the matrix-vector products of (the matrix representation of) the Hamiltonian with a block of coefficient vectors.
+     *
+     *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+     *
+     *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+     *
+     *  @note Every sparse intermediate is traversed only once for the whole block, which reduces the memory traffic compared to separate matrix-vector products.
+     */
+    MatrixX<double> evaluateBlock(const MatrixX<double>& X) const;
+};
+
+
+}  // namespace GQCP
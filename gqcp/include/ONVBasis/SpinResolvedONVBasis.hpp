@@ -243,10 +243,22 @@ public:
      *
      *  @param hamiltonian      A restricted Hamiltonian expressed in an orthonormal orbital basis.
      *  @param x                The coefficient vector of a linear expansion.
+     *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector product.
      *
      *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
      */
-    VectorX<double> evaluateOperatorMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const VectorX<double>& x) const;
+    VectorX<double> evaluateOperatorMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const VectorX<double>& x, const size_t number_of_threads = 1) const;
+
+    /**
+     *  Calculate the matrix-vector products of (the matrix representation of) a restricted Hamiltonian with a block of coefficient vectors.
+     *
+     *  @param hamiltonian      A restricted Hamiltonian expressed in an orthonormal orbital basis.
+     *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+     *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector products.
+     *
+     *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+     */
+    MatrixX<double> evaluateOperatorBlockMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const MatrixX<double>& X, const size_t number_of_threads = 1) const;
 
     /**
      *  Calculate the matrix-vector product of (the matrix representation of) a Hubbard Hamiltonian with the given coefficient vector.
@@ -296,10 +308,22 @@ public:
      *
      *  @param hamiltonian      An unrestricted Hamiltonian expressed in an orthonormal orbital basis.
      *  @param x                The coefficient vector of a linear expansion.
+     *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector product.
      *
      *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
      */
-    VectorX<double> evaluateOperatorMatrixVectorProduct(const USQHamiltonian<double>& usq_hamiltonian, const VectorX<double>& x) const;
+    VectorX<double> evaluateOperatorMatrixVectorProduct(const USQHamiltonian<double>& usq_hamiltonian, const VectorX<double>& x, const size_t number_of_threads = 1) const;
+
+    /**
+     *  Calculate the matrix-vector products of (the matrix representation of) an unrestricted Hamiltonian with a block of coefficient vectors.
+     *
+     *  @param hamiltonian      An unrestricted Hamiltonian expressed in an orthonormal orbital basis.
+     *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+     *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector products.
+     *
+     *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+     */
+    MatrixX<double> evaluateOperatorBlockMatrixVectorProduct(const USQHamiltonian<double>& hamiltonian, const MatrixX<double>& X, const size_t number_of_threads = 1) const;
 };
 
 
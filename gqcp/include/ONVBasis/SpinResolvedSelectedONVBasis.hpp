@@ -22,6 +22,7 @@
 #include "ONVBasis/SeniorityZeroONVBasis.hpp"
 #include "ONVBasis/SpinResolvedONV.hpp"
 #include "ONVBasis/SpinResolvedONVBasis.hpp"
+#include "ONVBasis/SpinResolvedSelectedONVConnections.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 
 
@@ -45,6 +46,9 @@ private:
     // A collection of ONVs that span a 'selected' part of a Fock space.
     std::vector<SpinResolvedONV> onvs;
 
+    // The ONVs, indexed by their alpha and beta strings, so that only the connected ONVs J have to be visited for every ONV I. It is kept up to date when the ONV basis is expanded, so that it isn't rebuilt for every evaluation.
+    SpinResolvedSelectedONVConnections connections;
+
 
 public:
     /*
@@ -350,14 +354,13 @@ public:
     template <typename Matrix>
     void evaluate(const ScalarUSQOneElectronOperator<double>& f, MatrixRepresentationEvaluationContainer<Matrix>& container) const {
 
-        const auto dim = this->dimension();
         const auto& f_a = f.alpha().parameters();
         const auto& f_b = f.beta().parameters();
 
         for (; !container.isFinished(); container.increment()) {
-            SpinResolvedONV onv_I = this->onvWithIndex(container.index);
-            SpinUnresolvedONV alpha_I = onv_I.onv(Spin::alpha);
-            SpinUnresolvedONV beta_I = onv_I.onv(Spin::beta);
+            const auto& onv_I = this->onvWithIndex(container.index);
+            const auto& alpha_I = onv_I.onv(Spin::alpha);
+            const auto& beta_I = onv_I.onv(Spin::beta);
 
             // Calculate the diagonal elements.
             for (size_t p = 0; p < this->numberOfOrbitals(); p++) {
@@ -370,12 +373,11 @@ public:
                 }
             }
 
-            // Calculate the off-diagonal elements, by going over all other ONVs J. (I != J)
-            for (size_t J = container.index + 1; J < dim; J++) {
-
-                SpinResolvedONV onv_J = this->onvWithIndex(J);
-                SpinUnresolvedONV alpha_J = onv_J.onv(Spin::alpha);
-                SpinUnresolvedONV beta_J = onv_J.onv(Spin::beta);
+            // Calculate the off-diagonal elements, by going over all other connected ONVs J. (J > I)
+            this->connections.forEachConnectionOf(container.index, [&](const size_t J) {
+                const auto& onv_J = this->onvWithIndex(J);
+                const auto& alpha_J = onv_J.onv(Spin::alpha);
+                const auto& beta_J = onv_J.onv(Spin::beta);
 
                 // 1 excitation in the alpha part, 0 in the beta part.
                 if ((alpha_I.countNumberOfDifferences(alpha_J) == 2) && (beta_I.countNumberOfDifferences(beta_J) == 0)) {
@@ -406,8 +408,8 @@ public:
                     container.addColumnwise(J, sign * value);
                     container.addRowwise(J, sign * value);
                 }
-            }  // loop over addresses J > I
-        }      // container loop
+            });  // loop over connected addresses J > I
+        }        // container loop
     }
 
 
@@ -423,7 +425,6 @@ public:
     void evaluate(const USQHamiltonian<double>& hamiltonian, MatrixRepresentationEvaluationContainer<Matrix>& container) const {
 
         // Prepare some variables.
-        const size_t dim = this->dimension();
         const size_t K = this->numberOfOrbitals();
 
         const auto& h_a = hamiltonian.core().alpha().parameters();
@@ -435,9 +436,9 @@ public:
         const auto& g_ab = hamiltonian.twoElectron().alphaBeta().parameters();
 
         for (; !container.isFinished(); container.increment()) {  // loop over all addresses (I)
-            SpinResolvedONV onv_I = this->onvWithIndex(container.index);
-            SpinUnresolvedONV alpha_I = onv_I.onv(Spin::alpha);
-            SpinUnresolvedONV beta_I = onv_I.onv(Spin::beta);
+            const auto& onv_I = this->onvWithIndex(container.index);
+            const auto& alpha_I = onv_I.onv(Spin::alpha);
+            const auto& beta_I = onv_I.onv(Spin::beta);
 
             // Calculate the diagonal elements (I=J).
             for (size_t p = 0; p < K; p++) {
@@ -476,12 +477,11 @@ public:
                 }
             }  // loop over q
 
-            // Calculate the off-diagonal elements, by going over all other ONVs (J>I).
-            for (size_t J = container.index + 1; J < dim; J++) {
-
-                SpinResolvedONV onv_J = this->onvWithIndex(J);
-                SpinUnresolvedONV alpha_J = onv_J.onv(Spin::alpha);
-                SpinUnresolvedONV beta_J = onv_J.onv(Spin::beta);
+            // Calculate the off-diagonal elements, by going over all other connected ONVs (J>I).
+            this->connections.forEachConnectionOf(container.index, [&](const size_t J) {
+                const auto& onv_J = this->onvWithIndex(J);
+                const auto& alpha_J = onv_J.onv(Spin::alpha);
+                const auto& beta_J = onv_J.onv(Spin::beta);
 
                 // 1 excitation in the alpha part, 0 excitations in the beta part.
                 if ((alpha_I.countNumberOfDifferences(alpha_J) == 2) && (beta_I.countNumberOfDifferences(beta_J) == 0)) {
@@ -612,8 +612,8 @@ public:
                     container.addColumnwise(J, sign * value);
                     container.addRowwise(J, sign * value);
                 }
-            }  // loop over addresses J > I
-        }      // loop over addresses I
+            });  // loop over connected addresses J > I
+        }        // loop over addresses I
     }
 };
 
@@ -0,0 +1,207 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "ONVBasis/SpinResolvedONV.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A lookup structure that finds the ONVs in a collection of spin-resolved ONVs that are connected to a given ONV through at most a double excitation, without comparing every pair of ONVs.
+ *
+ *  The ONVs are indexed by their alpha and by their beta string, in hash maps that are keyed on the unsigned representations of the strings. Pure alpha (resp. beta) excitations only have to be looked for among the ONVs that share the beta (resp. alpha) string, and mixed alpha-beta excitations are found by generating the single excitations of the alpha string and looking them up (as in Holmes, Tubman, Umrigar (2016) and Sharma et al. (2017)). The cost of finding the connections of an ONV therefore depends on the number of ONVs that share a string with it, rather than on the total number of ONVs.
+ *
+ *  @tparam _Representation         The type of the bitstrings that represent the alpha and beta strings. It should have a specialization of `BitstringTraits` and of `std::hash`.
+ */
+template <typename _Representation>
+class BasicSpinResolvedSelectedONVConnections {
+public:
+    // The type of the bitstrings that represent the alpha and beta strings.
+    using Representation = _Representation;
+
+    // The bit operations on the representation.
+    using Traits = BitstringTraits<Representation>;
+
+    // The type of the alpha and beta strings.
+    using ONV = BasicSpinUnresolvedONV<Representation>;
+
+
+private:
+    // The number of spatial orbitals.
+    size_t K;
+
+    // The unsigned representations of the alpha strings of the ONVs, in the order of their addresses.
+    std::vector<Representation> alpha_representations;
+
+    // The unsigned representations of the beta strings of the ONVs, in the order of their addresses.
+    std::vector<Representation> beta_representations;
+
+    // For every alpha string that appears, the addresses of the ONVs that contain it, in ascending order.
+    std::unordered_map<Representation, std::vector<size_t>> alpha_string_addresses;
+
+    // For every beta string that appears, the addresses of the ONVs that contain it, in ascending order.
+    std::unordered_map<Representation, std::vector<size_t>> beta_string_addresses;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Construct the lookup structure for an empty collection of ONVs.
+     *
+     *  @param K                The number of spatial orbitals.
+     */
+    BasicSpinResolvedSelectedONVConnections(const size_t K = 0) :
+        K {K} {}
+
+    /**
+     *  @param onvs             The spin-resolved ONVs, in the order of their addresses. They should all be expressed in the same number of orbitals.
+     */
+    BasicSpinResolvedSelectedONVConnections(const std::vector<SpinResolvedONV>& onvs) :
+        BasicSpinResolvedSelectedONVConnections(onvs.empty() ? 0 : onvs[0].onv(Spin::alpha).numberOfSpinors()) {
+
+        this->alpha_representations.reserve(onvs.size());
+        this->beta_representations.reserve(onvs.size());
+
+        for (const auto& onv : onvs) {
+            this->expandWith(onv);
+        }
+    }
+
+
+    /*
+     *  MARK: Modifying
+     */
+
+    /**
+     *  Index the ONV with the given alpha and beta strings, whose address is the number of ONVs that have been indexed before.
+     *
+     *  @param onv_alpha        The alpha string of the ONV. It should be expressed in the same number of orbitals as the other ONVs.
+     *  @param onv_beta         The beta string of the ONV. It should be expressed in the same number of orbitals as the other ONVs.
+     */
+    void expandWith(const ONV& onv_alpha, const ONV& onv_beta) {
+
+        const auto I = this->alpha_representations.size();
+        const auto& alpha = onv_alpha.unsignedRepresentation();
+        const auto& beta = onv_beta.unsignedRepresentation();
+
+        this->alpha_representations.push_back(alpha);
+        this->beta_representations.push_back(beta);
+
+        // Since the addresses are increasing, the address lists stay sorted.
+        this->alpha_string_addresses[alpha].push_back(I);
+        this->beta_string_addresses[beta].push_back(I);
+    }
+
+    /**
+     *  Index the given ONV, whose address is the number of ONVs that have been indexed before.
+     *
+     *  @param onv              The spin-resolved ONV. It should be expressed in the same number of orbitals as the other ONVs.
+     */
+    void expandWith(const SpinResolvedONV& onv) { this->expandWith(onv.onv(Spin::alpha), onv.onv(Spin::beta)); }
+
+
+    /*
+     *  MARK: Connections
+     */
+
+    /**
+     *  Apply the given callback to the address of every ONV that has a larger address than the given one, and that is connected to it through a single or double excitation.
+     *
+     *  @tparam Callback        The type of the callback, which is a template parameter so that the call can be inlined.
+     *
+     *  @param I                The address of an ONV.
+     *  @param callback         The function that should be called for every connected ONV. Its argument is the address J > I of the connected ONV.
+     */
+    template <typename Callback>
+    void forEachConnectionOf(const size_t I, const Callback& callback) const {
+
+        const auto& alpha_I = this->alpha_representations[I];
+        const auto& beta_I = this->beta_representations[I];
+
+        // Loop over the addresses J > I in the given (sorted) list of addresses, and call the callback for those J whose number of different occupations in the alpha and beta strings pass the given predicate.
+        const auto visit = [this, I, &alpha_I, &beta_I, &callback](const std::vector<size_t>& addresses, const auto& is_connected) {
+            for (auto it = std::upper_bound(addresses.begin(), addresses.end(), I); it != addresses.end(); ++it) {
+                const auto J = *it;
+
+                const auto alpha_differences = Traits::count(alpha_I ^ this->alpha_representations[J]);
+                const auto beta_differences = Traits::count(beta_I ^ this->beta_representations[J]);
+                if (is_connected(alpha_differences, beta_differences)) {
+                    callback(J);
+                }
+            }
+        };
+
+
+        // Pure alpha single and double excitations: the beta strings are equal.
+        visit(this->beta_string_addresses.at(beta_I), [](const size_t alpha_differences, const size_t) {
+            return (alpha_differences == 2) || (alpha_differences == 4);
+        });
+
+        // Pure beta single and double excitations: the alpha strings are equal.
+        visit(this->alpha_string_addresses.at(alpha_I), [](const size_t, const size_t beta_differences) {
+            return (beta_differences == 2) || (beta_differences == 4);
+        });
+
+        // Mixed alpha-beta double excitations: generate all single excitations of the alpha string, and look for the ONVs that contain the excited alpha string and a singly-excited beta string.
+        for (size_t p = 0; p < this->K; p++) {
+            if (!Traits::test(alpha_I, p)) {
+                continue;  // p should be occupied
+            }
+
+            for (size_t q = 0; q < this->K; q++) {
+                if (Traits::test(alpha_I, q)) {
+                    continue;  // q should be unoccupied
+                }
+
+                auto excited_alpha = alpha_I;
+                Traits::flip(excited_alpha, p);
+                Traits::flip(excited_alpha, q);
+
+                const auto it = this->alpha_string_addresses.find(excited_alpha);
+                if (it == this->alpha_string_addresses.end()) {
+                    continue;  // the excited alpha string does not appear in any ONV
+                }
+
+                visit(it->second, [](const size_t, const size_t beta_differences) {
+                    return beta_differences == 2;
+                });
+            }
+        }
+    }
+};
+
+
+/*
+ *  MARK: Convenience aliases
+ */
+
+// The lookup structure for the ONVs of at most 64 spatial orbitals, whose strings are represented by single unsigned integers.
+using SpinResolvedSelectedONVConnections = BasicSpinResolvedSelectedONVConnections<size_t>;
+
+
+}  // namespace GQCP
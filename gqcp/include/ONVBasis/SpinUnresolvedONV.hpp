@@ -20,6 +20,16 @@
 
 #include "Basis/SpinorBasis/OrbitalSpace.hpp"
 #include "Basis/Transformations/GTransformation.hpp"
+#include "ONVBasis/Bitstring.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 
 namespace GQCP {
@@ -34,17 +44,31 @@ namespace GQCP {
  *
  *  In GQCP, bitstrings are read from right to left. This means that the least significant bit relates to the first orbital.
  *  This notation is consistent with how normally bit strings are read in computer science, leading to more efficient code. The least significant bit has index 0. The previous example is then represented by the bit string "0111" (with unsigned representation 7).
- * 
- *  IMPORTANT: Since this type heavily uses unsigned bitset representations, it should not be used for M > 64 spinors.
+ *
+ *  The type of the bitstring is chosen at compile time. `SpinUnresolvedONV` uses a single unsigned integer, which supports up to 64 spinors. For more spinors, a multi-word `Bitstring` can be used, e.g. `BasicSpinUnresolvedONV<Bitstring<128>>`.
+ *
+ *  @tparam _Representation         The type of the bitstring that represents the occupations. It should have a specialization of `BitstringTraits`.
  */
-class SpinUnresolvedONV {
+template <typename _Representation>
+class BasicSpinUnresolvedONV {
+public:
+    // The type of the bitstring that represents the occupations.
+    using Representation = _Representation;
+
+    // The bit operations on the representation.
+    using Traits = BitstringTraits<Representation>;
+
+    // The type of 'this'.
+    using Self = BasicSpinUnresolvedONV<Representation>;
+
+
 private:
     size_t M;  // the number of spinors that this ONV is expressed in
     size_t N;  // the number of electrons that appear in this ONV, i.e. the number of spinor that is occupied
 
-    size_t unsigned_representation;        // the representation of this ONV as an unsigned integer
-    std::vector<size_t> occupied_indices;  // the indices of the spinors that are occupied in this ONV
-                                           // it is a vector of N elements in which occupied_indices[j] returns the index of the spinor that the electron j occupies
+    Representation unsigned_representation;  // the representation of this ONV as an unsigned integer
+    std::vector<size_t> occupied_indices;    // the indices of the spinors that are occupied in this ONV
+                                             // it is a vector of N elements in which occupied_indices[j] returns the index of the spinor that the electron j occupies
 
 
 public:
@@ -57,7 +81,12 @@ public:
      *  @param N                                the number of electrons that appear in this ONV, i.e. the number of spinor that is occupied
      *  @param unsigned_representation          the representation of this ONV as an unsigned integer
      */
-    SpinUnresolvedONV(const size_t M, const size_t N, const size_t unsigned_representation);
+    BasicSpinUnresolvedONV(const size_t M, const size_t N, const Representation& unsigned_representation) :
+        BasicSpinUnresolvedONV(M, N) {
+
+        this->unsigned_representation = unsigned_representation;
+        this->updateOccupationIndices();  // throws error if the representation and N are not compatible
+    }
 
     /**
      *  Construct a SpinResolvedONV ONV without an unsigned representation
@@ -65,7 +94,16 @@ public:
      *  @param M                the number of spinors that this ONV is expressed in
      *  @param N                the number of electrons that appear in this ONV, i.e. the number of spinor that is occupied
      */
-    SpinUnresolvedONV(const size_t M, const size_t N);
+    BasicSpinUnresolvedONV(const size_t M, const size_t N) :
+        M {M},
+        N {N},
+        unsigned_representation {},
+        occupied_indices(N, 0) {
+
+        if (M > Traits::number_of_bits) {
+            throw std::invalid_argument("BasicSpinUnresolvedONV(const size_t, const size_t): The number of spinors exceeds the number of bits of the representation.");
+        }
+    }
 
 
     // NAMED CONSTRUCTORS
@@ -77,7 +115,23 @@ public:
      * 
      *  @return a spin-unresolved ONV from a textual/string representation.
      */
-    static SpinUnresolvedONV FromString(const std::string& string_representation);
+    static Self FromString(const std::string& string_representation) {
+
+        // The least significant bit has the highest position in the string.
+        const auto M = string_representation.size();
+        std::vector<size_t> occupied_indices;
+        for (size_t p = 0; p < M; p++) {
+            const auto character = string_representation[M - 1 - p];
+
+            if (character == '1') {
+                occupied_indices.push_back(p);
+            } else if (character != '0') {
+                throw std::invalid_argument("BasicSpinUnresolvedONV::FromString(const std::string&): The string representation may only contain '0' and '1'.");
+            }
+        }
+
+        return Self::FromOccupiedIndices(occupied_indices, M);
+    }
 
     /**
      *  Create a spin-unresolved ONV from a set of occupied indices.
@@ -87,7 +141,21 @@ public:
      * 
      *  @return a spin-resolved ONV from a set of occupied indices
      */
-    static SpinUnresolvedONV FromOccupiedIndices(const std::vector<size_t>& occupied_indices, const size_t M);
+    static Self FromOccupiedIndices(const std::vector<size_t>& occupied_indices, const size_t M) {
+
+        // Generate the corresponding unsigned representation and use that constructor.
+        if (M > Traits::number_of_bits) {
+            throw std::invalid_argument("BasicSpinUnresolvedONV::FromOccupiedIndices(const std::vector<size_t>&, const size_t): The number of spinors exceeds the number of bits of the representation.");
+        }
+
+        Representation unsigned_representation {};
+        for (const auto& index : occupied_indices) {
+            Traits::flip(unsigned_representation, index);
+        }
+
+        const size_t N = occupied_indices.size();
+        return Self(M, N, unsigned_representation);
+    }
 
     /**
      *  Create a spin-unresolved ONV that represents the GHF single Slater determinant, occupying the N spinors with the lowest spinor energy.
@@ -98,7 +166,20 @@ public:
      * 
      *  @param a spin-unresolved ONV that represents the GHF single Slater determinant
      */
-    static SpinUnresolvedONV GHF(const size_t M, const size_t N, const VectorX<double>& orbital_energies);
+    static Self GHF(const size_t M, const size_t N, const VectorX<double>& orbital_energies) {
+
+        // The GHF ONV is that one in which the N spinors with the lowest energy are occupied.
+
+        // Create an array that contains the indices of the spinors with ascending energy.
+        std::vector<size_t> indices(M);                // zero-initialized with M elements
+        std::iota(indices.begin(), indices.end(), 0);  // start with 0
+
+        // Sort the indices according to the orbital energies.
+        std::stable_sort(indices.begin(), indices.end(), [&orbital_energies](const size_t i, const size_t j) { return orbital_energies(i) < orbital_energies(j); });
+
+        const std::vector<size_t> occupied_indices {indices.begin(), indices.begin() + N};  // the first N elements
+        return Self::FromOccupiedIndices(occupied_indices, M);
+    }
 
 
     // OPERATORS
@@ -109,21 +190,23 @@ public:
      *
      *  @return the updated output stream
      */
-    friend std::ostream& operator<<(std::ostream& os, const SpinUnresolvedONV& onv);
+    friend std::ostream& operator<<(std::ostream& os, const Self& onv) { return os << onv.asString(); }
 
     /**
      *  @param other    the other spin-unresolved ONV
      *
      *  @return if this spin-unresolved ONV is the same as the other spin-unresolved ONV
      */
-    bool operator==(const SpinUnresolvedONV& other) const;
+    bool operator==(const Self& other) const {
+        return this->unsigned_representation == other.unsigned_representation && this->M == other.M;  // this ensures that N, M and representation are equal
+    }
 
     /**
      *  @param other    the other spin-unresolved ONV
      *
      *  @return if this spin-unresolved ONV is not the same as the other spin-unresolved ONV
      */
-    bool operator!=(const SpinUnresolvedONV& other) const;
+    bool operator!=(const Self& other) const { return !(this->operator==(other)); }
 
 
     // PUBLIC METHODS
@@ -137,7 +220,15 @@ public:
      *
      *  IMPORTANT: This function does not update the occupation indices for performance reasons. If required, call updateOccupationIndices()!
      */
-    bool annihilate(const size_t p);
+    bool annihilate(const size_t p) {
+
+        if (this->isOccupied(p)) {
+            Traits::flip(this->unsigned_representation, p);
+            return true;
+        } else {
+            return false;
+        }
+    }
 
     /**
      *  Annihilate the electron at a given spinor index, keeping track of any sign changes.
@@ -149,7 +240,15 @@ public:
      *
      *  IMPORTANT: This function does not update the occupation indices for performance reasons. If required, call updateOccupationIndices()!
      */
-    bool annihilate(const size_t p, int& sign);
+    bool annihilate(const size_t p, int& sign) {
+
+        if (this->annihilate(p)) {  // we have to first check if we can annihilate before applying the phase factor
+            sign *= this->operatorPhaseFactor(p);
+            return true;
+        } else {
+            return false;
+        }
+    }
 
     /**
      *  Annihilate the electrons at the given spinor indices.
@@ -160,7 +259,17 @@ public:
      *
      *  IMPORTANT: This function does not update the occupation indices for performance reasons. If required, call updateOccupationIndices()!
      */
-    bool annihilateAll(const std::vector<size_t>& indices);
+    bool annihilateAll(const std::vector<size_t>& indices) {
+
+        if (this->areOccupied(indices)) {  // only if all indices are occupied, we will annihilate
+            for (const auto& index : indices) {
+                this->annihilate(index);
+            }
+            return true;
+        } else {
+            return false;
+        }
+    }
 
     /**
      *  @param indices          the 0-based spinor indices, counted in this ONV from right to left
@@ -170,26 +279,67 @@ public:
      *
      *  IMPORTANT: This function does not update the occupation indices for performance reasons. If required, call updateOccupationIndices()!
      */
-    bool annihilateAll(const std::vector<size_t>& indices, int& sign);
+    bool annihilateAll(const std::vector<size_t>& indices, int& sign) {
+
+        if (this->areOccupied(indices)) {  // only if all indices are occupied, we will annihilate
+            for (const auto& index : indices) {
+                this->annihilate(index, sign);
+            }
+            return true;
+        } else {
+            return false;
+        }
+    }
 
     /**
      *  @param indices          the 0-based spinor indices, counted in this ONV from right to left
      *
      *  @return if all the spinors with the given indices are occupied
      */
-    bool areOccupied(const std::vector<size_t>& indices) const;
+    bool areOccupied(const std::vector<size_t>& indices) const {
+
+        for (const auto& index : indices) {
+            if (!this->isOccupied(index)) {
+                return false;
+            }
+        }
+
+        // Only if all indices have been tested to be occupied, we can return true
+        return true;
+    }
 
     /**
      *  @param indices          the 0-based spinor indices, counted in this ONV from right to left
      *
      *  @return if all the spinors with the given indices are unoccupied
      */
-    bool areUnoccupied(const std::vector<size_t>& indices) const;
+    bool areUnoccupied(const std::vector<size_t>& indices) const {
+
+        for (const auto& index : indices) {
+            if (this->isOccupied(index)) {
+                return false;
+            }
+        }
+
+        // Only if all indices have been tested to be unoccupied, we can return true
+        return true;
+    }
 
     /**
      *  @return a string representation of this spin-unresolved ONV
      */
-    std::string asString() const;
+    std::string asString() const {
+
+        // The least significant bit should end up at the highest position in the string.
+        std::string text(this->M, '0');  // the string that will contain the textual representation of this spin-unresolved ONV
+        for (size_t p = 0; p < this->M; p++) {
+            if (Traits::test(this->unsigned_representation, p)) {
+                text[this->M - 1 - p] = '1';
+            }
+        }
+
+        return text;
+    }
 
     /**
      *  Calculate the overlap <on|of>: the projection of between this spin-unresolved ONV ('of') and another spin-unresolved ONV ('on'), expressed in different general orthonormal spinor bases.
@@ -201,14 +351,36 @@ public:
      * 
      *  @return The overlap element <on|of>.
      */
-    double calculateProjection(const SpinUnresolvedONV& onv_on, const GTransformation<double>& C_of, const GTransformation<double>& C_on, const SquareMatrix<double>& S) const;
+    double calculateProjection(const Self& onv_on, const GTransformation<double>& C_of, const GTransformation<double>& C_on, const SquareMatrix<double>& S) const {
+
+        // Make a reference copy in order to improve readibility of the following code.
+        const auto& onv_of = *this;
+
+
+        // Calculate the raw matrix representation of the transformation between the spinor bases, since we're going to have to slice its rows and columns.
+        MatrixX<double> U = C_on.matrix().adjoint() * S * C_of.matrix();
+
+
+        // U's columns should be the ones occupied in the 'of'-ONV.
+        // U's rows should be the ones occupied in the 'on'-ONV.
+        // While waiting for Eigen 3.4 to release (which has better slicing APIs), we'll remove the UNoccupied rows/columns.
+        const auto unoccupied_indices_of = onv_of.unoccupiedIndices();
+        const auto unoccupied_indices_on = onv_on.unoccupiedIndices();
+
+        U.removeColumns(unoccupied_indices_of);
+        U.removeRows(unoccupied_indices_on);
+
+
+        // The requested overlap element is the determinant of the resulting matrix.
+        return U.determinant();
+    }
 
     /**
      *  @param other        the other spin-unresolved ONV
      *
      *  @return the number of different occupations between this spin-unresolved ONV and the other, i.e. two times the number of electron excitations
      */
-    size_t countNumberOfDifferences(const SpinUnresolvedONV& other) const;
+    size_t countNumberOfDifferences(const Self& other) const { return Traits::count(this->unsigned_representation ^ other.unsigned_representation); }
 
     /**
      *  @param p            the 0-based spinor index, counted in this ONV from right to left
@@ -217,7 +389,15 @@ public:
      *
      *  IMPORTANT: This function does not update the occupation indices for performance reasons. If required, call updateOccupationIndices()!
      */
-    bool create(const size_t p);
+    bool create(const size_t p) {
+
+        if (!this->isOccupied(p)) {
+            Traits::flip(this->unsigned_representation, p);
+            return true;
+        } else {
+            return false;
+        }
+    }
 
     /**
      *  @param p            the 0-based spinor index, counted in this ONV from right to left
@@ -227,7 +407,15 @@ public:
      *
      *  IMPORTANT: This function does not update the occupation indices for performance reasons. If required, call updateOccupationIndices()!
      */
-    bool create(const size_t p, int& sign);
+    bool create(const size_t p, int& sign) {
+
+        if (this->create(p)) {  // we have to first check if we can create before applying the phase factor
+            sign *= this->operatorPhaseFactor(p);
+            return true;
+        } else {
+            return false;
+        }
+    }
 
     /**
      *  @param indices          the 0-based spinor indices, counted in this ONV from right to left
@@ -236,7 +424,17 @@ public:
      *
      *  IMPORTANT: This function does not update the occupation indices for performance reasons. If required, call updateOccupationIndices()!
      */
-    bool createAll(const std::vector<size_t>& indices);
+    bool createAll(const std::vector<size_t>& indices) {
+
+        if (this->areUnoccupied(indices)) {
+            for (const auto& index : indices) {
+                this->create(index);
+            }
+            return true;
+        } else {
+            return false;
+        }
+    }
 
     /**
      *  @param indices          the 0-based spinor indices, counted in this ONV from right to left
@@ -246,49 +444,93 @@ public:
      *
      *  IMPORTANT: This function does not update the occupation indices for performance reasons. If required, call updateOccupationIndices()!
      */
-    bool createAll(const std::vector<size_t>& indices, int& sign);
+    bool createAll(const std::vector<size_t>& indices, int& sign) {
+
+        if (this->areUnoccupied(indices)) {
+            for (const auto& index : indices) {
+                this->create(index, sign);
+            }
+            return true;
+        } else {
+            return false;
+        }
+    }
 
     /**
      *  @param other            the other spin-unresolved ONV
      *
      *  @return the indices of the spinors (from right to left) that are occupied in this spin-unresolved ONV, but unoccupied in the other
      */
-    std::vector<size_t> findDifferentOccupations(const SpinUnresolvedONV& other) const;
+    std::vector<size_t> findDifferentOccupations(const Self& other) const {
+
+        // Find the indices that are occupied in this, but unoccupied in other.
+        const auto differences = this->unsigned_representation ^ other.unsigned_representation;
+        return Self::setBitPositionsOf(differences & this->unsigned_representation);
+    }
 
     /**
      *  @param other            the other spin-unresolved ONV
      *
      *  @return the indices of the spinors (from right to left) that are occupied both this spin-unresolved ONV and the other
      */
-    std::vector<size_t> findMatchingOccupations(const SpinUnresolvedONV& other) const;
+    std::vector<size_t> findMatchingOccupations(const Self& other) const {
+        return Self::setBitPositionsOf(this->unsigned_representation & other.unsigned_representation);
+    }
 
     /**
      *  Iterate over every occupied spinor index in this ONV and apply the given callback function.
      * 
      *  @param callback         the function that should be called in every iteration step over all occupied spinor indices. The argument of this callback function is the index of the occupied spinor.
      */
-    void forEach(const std::function<void(const size_t)>& callback) const;
+    void forEach(const std::function<void(const size_t)>& callback) const {
+
+        // Loop over every electron in this ONV and retrieve the index of the spinor that it occupies.
+        for (size_t e = 0; e < this->numberOfElectrons(); e++) {
+            const size_t p = this->occupationIndexOf(e);
+            callback(p);
+        }  // electron index loop
+    }
 
     /**
      *  Iterate over every unique pair of occupied spinor indices in this ONV and apply the given callback function.
      * 
      *  @param callback         the function that should be called in every iteration step over all pairs of occupied spinor indices. The arguments of this callback function are the indices of the occupied spinor, where the first index is always larger than the second.
      */
-    void forEach(const std::function<void(const size_t, const size_t)>& callback) const;
+    void forEach(const std::function<void(const size_t, const size_t)>& callback) const {
+
+        // Loop over every electron in this ONV and retrieve the index of the spinor that it occupies.
+        for (size_t e1 = 0; e1 < this->numberOfElectrons(); e1++) {
+            const size_t p = this->occupationIndexOf(e1);
+
+            // Loop over every different electron in this ONV and retrieve the index of the spinor that it occupies.
+            for (size_t e2 = 0; e2 < e1; e2++) {
+                const size_t q = this->occupationIndexOf(e2);
+
+                callback(p, q);
+            }  // electron 2 index loop
+        }      // electron 1 index loop
+    }
 
     /**
      *  @param p            the 0-based spinor index, counted in this ONV from right to left
      *
      *  @return if the p-th spinor is occupied
      */
-    bool isOccupied(const size_t p) const;
+    bool isOccupied(const size_t p) const {
+
+        if (p > this->M - 1) {
+            throw std::invalid_argument("SpinUnresolvedONV::isOccupied(size_t): The index is out of the bitset bounds");
+        }
+
+        return Traits::test(this->unsigned_representation, p);
+    }
 
     /**
      *  @param p            the 0-based spinor index, counted in this ONV from right to left
      *
      *  @return if the p-th spinor is not occupied
      */
-    bool isUnoccupied(const size_t p) const;
+    bool isUnoccupied(const size_t p) const { return !this->isOccupied(p); }
 
     /**
      *  @return the number of electrons that this ONV contains.
@@ -319,19 +561,36 @@ public:
      *
      *  @example Let's say that there are m electrons in the orbitals up to p (not included). If m is even, the phase factor is (+1) and if m is odd, the phase factor is (-1), since electrons are fermions.
      */
-    int operatorPhaseFactor(const size_t p) const;
+    int operatorPhaseFactor(const size_t p) const {
+
+        const size_t m = Traits::countBelow(this->unsigned_representation, p);  // count the number of set bits in the slice [0,p-1]
+
+        if (m % 2 == 0) {  // even number of electrons: phase factor (+1)
+            return 1;
+        } else {  // odd number of electrons: phase factor (-1)
+            return -1;
+        }
+    }
 
     /**
      *  @return the implicit orbital space that is related to this spin-unresolved ONV by taking this as a reference determinant
      */
-    OrbitalSpace orbitalSpace() const;
+    OrbitalSpace orbitalSpace() const {
+
+        // Create an occupied-virtual orbital space.
+        return OrbitalSpace(this->occupiedIndices(), this->unoccupiedIndices());
+    }
 
     /**
      *  @param unsigned_representation      the new representation as an unsigned integer
      *
      *  Set the representation of an spin-unresolved ONV to a new representation and call update the occupation indices accordingly
      */
-    void replaceRepresentationWith(const size_t unsigned_representation);
+    void replaceRepresentationWith(const Representation& unsigned_representation) {
+
+        this->unsigned_representation = unsigned_representation;
+        this->updateOccupationIndices();
+    }
 
     /**
      *  @param index_start      the starting index (included), read from right to left
@@ -343,23 +602,91 @@ public:
      *      "010011".slice(1, 4) => "01[001]1" -> "001", where the spinor indices are:
      *       543210
      */
-    size_t slice(const size_t index_start, const size_t index_end) const;
+    Representation slice(const size_t index_start, const size_t index_end) const {
+
+        // First, do some checks
+        if (index_end <= index_start) {
+            throw std::invalid_argument("SpinUnresolvedONV::slice(size_t, size_t): index_end should be larger than index_start.");
+        }
+
+        if (index_end > this->M + 1) {
+            throw std::invalid_argument("SpinUnresolvedONV::slice(size_t, size_t): The last slicing index index_end cannot be greater than the number of spatial orbitals M.");
+        }
+
+        // The union of these conditions also include the case that index_start > this->M
+        return Traits::slice(this->unsigned_representation, index_start, index_end);
+    }
 
     /**
      *  @return the unsigned representation of this spin-unresolved ONV
      */
-    size_t unsignedRepresentation() const { return this->unsigned_representation; }
+    const Representation& unsignedRepresentation() const { return this->unsigned_representation; }
 
     /**
      *  @return the spinor indices that are not occupied in this ONV.
      */
-    std::vector<size_t> unoccupiedIndices() const;
+    std::vector<size_t> unoccupiedIndices() const {
+
+        // Create a vector containing all indices.
+        std::vector<size_t> all_indices(this->M);
+        std::iota(all_indices.begin(), all_indices.end(), 0);  // fill all_indices with increasing numbers, starting by 0
+
+        // The unoccupied indices are {all indices}\{occupied indices}.
+        std::vector<size_t> unoccupied_indices;
+        std::set_difference(all_indices.begin(), all_indices.end(), this->occupied_indices.begin(), this->occupied_indices.end(),
+                            std::inserter(unoccupied_indices, unoccupied_indices.begin()));
+
+        return unoccupied_indices;
+    }
 
     /**
      *  Extract the positions of the set bits from 'this->unsigned_representation' and places them in 'this->occupied_indices'.
      */
-    void updateOccupationIndices();
+    void updateOccupationIndices() {
+
+        if (Traits::count(this->unsigned_representation) != this->N) {
+            throw std::invalid_argument("SpinUnresolvedONV::updateOccupationIndices(): The current representation and electron count are not compatible");
+        }
+
+        auto representation_copy = this->unsigned_representation;
+        for (size_t electron_index = 0; electron_index < this->N; electron_index++) {
+            this->occupied_indices[electron_index] = Traits::countTrailingZeros(representation_copy);  // retrieves occupation index
+            Traits::removeLeastSignificantBit(representation_copy);
+        }
+    }
+
+
+private:
+    /**
+     *  @param representation           a bitstring
+     *
+     *  @return the positions of the set bits in the given bitstring, in ascending order
+     */
+    static std::vector<size_t> setBitPositionsOf(Representation representation) {
+
+        std::vector<size_t> positions;
+        positions.reserve(Traits::count(representation));
+
+        while (!Traits::none(representation)) {
+            positions.push_back(Traits::countTrailingZeros(representation));
+            Traits::removeLeastSignificantBit(representation);
+        }
+
+        return positions;
+    }
 };
 
 
+/*
+ *  MARK: Convenience aliases
+ */
+
+// A spin-unresolved ONV for at most 64 spinors, whose occupations are represented by a single unsigned integer.
+using SpinUnresolvedONV = BasicSpinUnresolvedONV<size_t>;
+
+// A spin-unresolved ONV whose occupations are represented by a multi-word bitstring with the given number of bits.
+template <size_t Bits>
+using MultiWordSpinUnresolvedONV = BasicSpinUnresolvedONV<Bitstring<Bits>>;
+
+
 }  // namespace GQCP
@@ -35,6 +35,8 @@ namespace GQCP {
 
 /**
  *  The full spin-unresolved ONV basis for a number of spinors/spin-orbitals and number of electrons.
+ *
+ *  The operator evaluations represent the ONVs by a single unsigned integer for up to 64 spinors, and by a multi-word `Bitstring` for more spinors.
  */
 class SpinUnresolvedONVBasis {
 private:
@@ -144,6 +146,29 @@ public:
      */
     size_t addressOf(const SpinUnresolvedONV& onv) const { return this->addressOf(onv.unsignedRepresentation()); }
 
+    /**
+     *  Calculate the address (i.e. the ordering number) of a spin-unresolved ONV whose occupations are represented by a multi-word bitstring.
+     * 
+     *  @param onv          The spin-unresolved ONV.
+     *
+     *  @return The address (i.e. the ordering number) of the given spin-unresolved ONV.
+     */
+    template <size_t Bits>
+    size_t addressOf(const MultiWordSpinUnresolvedONV<Bits>& onv) const {
+
+        // An implementation of the formula in Helgaker, starting the addressing count from zero.
+        auto copy = onv.unsignedRepresentation();
+        size_t address = 0;
+        size_t electron_count = 0;  // counts the number of electrons in the spin string up to orbital p
+        while (!copy.none()) {      // we will remove the least significant bit each loop, we are finished when no bits are left
+            const auto p = copy.countTrailingZeros();
+            electron_count++;  // each bit is an electron hence we add it up to the electron count
+            address += this->vertexWeight(p, electron_count);
+            copy.removeLeastSignificantBit();
+        }
+        return address;
+    }
+
     /**
      *  Calculate the next allowed unsigned representation of a spin-unresolved ONV in this ONV basis.
      * 
@@ -157,6 +182,37 @@ public:
      */
     size_t nextPermutationOf(const size_t representation) const;
 
+    /**
+     *  Calculate the next allowed multi-word representation of a spin-unresolved ONV in this ONV basis.
+     * 
+     *  @param representation       A multi-word representation of a spin-unresolved ONV.
+     *
+     *  @return The next allowed multi-word representation of a spin-unresolved ONV in this ONV basis.
+     */
+    template <size_t Bits>
+    Bitstring<Bits> nextPermutationOf(const Bitstring<Bits>& representation) const {
+
+        // Find the lowest run of set bits [start, end). Its highest bit moves up by one, and the rest of the run moves to the least significant bits, like in the single-word case.
+        const auto start = representation.countTrailingZeros();
+        auto end = start;
+        while ((end < Bits) && representation.test(end)) {
+            end++;
+        }
+
+        auto next = representation;
+        for (size_t p = start; p < end; p++) {
+            next.reset(p);
+        }
+        if (end < Bits) {
+            next.set(end);
+        }
+        for (size_t p = 0; p + 1 < end - start; p++) {
+            next.set(p);
+        }
+
+        return next;
+    }
+
     /**
      *  Calculate the unsigned representation of a spin-unresolved ONV that corresponds to the address/ordering number in this ONV basis.
      *
@@ -190,6 +246,42 @@ public:
      */
     void transformONVCorrespondingToAddress(SpinUnresolvedONV& onv, const size_t address) const;
 
+    /**
+     *  Modify a spin-unresolved ONV whose occupations are represented by a multi-word bitstring to the next allowed ONV in this ONV basis.
+     *
+     *  @param onv      A spin-unresolved ONV.
+     */
+    template <size_t Bits>
+    void transformONVToNextPermutation(MultiWordSpinUnresolvedONV<Bits>& onv) const {
+
+        onv.replaceRepresentationWith(this->nextPermutationOf(onv.unsignedRepresentation()));
+    }
+
+    /**
+     *  Modify a spin-unresolved ONV whose occupations are represented by a multi-word bitstring to the one with the given address in this ONV basis.
+     *
+     *  @param onv          A spin-unresolved ONV.
+     *  @param address      The target address in this ONV basis.
+     */
+    template <size_t Bits>
+    void transformONVCorrespondingToAddress(MultiWordSpinUnresolvedONV<Bits>& onv, size_t address) const {
+
+        // Walk the addressing scheme from the last orbital to the first one, like in the single-word case.
+        Bitstring<Bits> representation;
+        size_t m = this->numberOfElectrons();  // counts the number of electrons in the spin string up to orbital p
+        for (size_t p = this->numberOfOrbitals(); (p > 0) && (m > 0); p--) {
+            const auto weight = this->vertexWeight(p - 1, m);
+
+            if (weight <= address) {  // the algorithm can move diagonally, so we found an occupied orbital
+                address -= weight;
+                representation.set(p - 1);
+                m--;
+            }
+        }
+
+        onv.replaceRepresentationWith(representation);
+    }
+
 
     /*
      *  MARK: Couplings
@@ -243,6 +335,32 @@ public:
     void forEach(const std::function<void(const SpinUnresolvedONV&, const size_t)>& callback) const;
 
 
+    /*
+     *  MARK: Representations
+     */
+
+    /**
+     *  Call the given callback with a bitstring of the narrowest type that can represent the occupations of all the spinors in this ONV basis. A single unsigned integer is used for up to 64 spinors, so the evaluations only pay for multiple words when they need them.
+     *
+     *  @tparam Callback            The type of the callback. It should be callable with every representation, e.g. a generic lambda.
+     *
+     *  @param callback             The function that should be called. Its argument is a value-initialized bitstring, whose type should be used as the representation of the ONVs.
+     */
+    template <typename Callback>
+    void forNarrowestRepresentation(const Callback& callback) const {
+
+        if (this->M <= BitstringTraits<size_t>::number_of_bits) {
+            callback(size_t {});
+        } else if (this->M <= BitstringTraits<Bitstring<128>>::number_of_bits) {
+            callback(Bitstring<128> {});
+        } else if (this->M <= BitstringTraits<Bitstring<256>>::number_of_bits) {
+            callback(Bitstring<256> {});
+        } else {
+            throw std::invalid_argument("SpinUnresolvedONVBasis::forNarrowestRepresentation(const Callback&): There is no representation for more than 256 spinors.");
+        }
+    }
+
+
     /*
      *  MARK: Dense generalized operator evaluations
      */
@@ -394,30 +512,44 @@ public:
      *
      *  @param f                A generalized one-electron operator expressed in an orthonormal orbital basis.
      *  @param x                The coefficient vector of a linear expansion.
+     *  @param number_of_threads    The number of threads that should be used. Every thread iterates over a contiguous part of the ONV basis.
      *
      *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the one-electron operator.
      */
-    VectorX<double> evaluateOperatorMatrixVectorProduct(const ScalarGSQOneElectronOperator<double>& f, const VectorX<double>& x) const;
+    VectorX<double> evaluateOperatorMatrixVectorProduct(const ScalarGSQOneElectronOperator<double>& f, const VectorX<double>& x, const size_t number_of_threads = 1) const;
 
     /**
      *  Calculate the matrix-vector product of (the matrix representation of) a generalized two-electron operator with the given coefficient vector.
      *
      *  @param g                A generalized two-electron operator expressed in an orthonormal orbital basis.
      *  @param x                The coefficient vector of a linear expansion.
+     *  @param number_of_threads    The number of threads that should be used. Every thread iterates over a contiguous part of the ONV basis.
      *
      *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the two-electron operator.
      */
-    VectorX<double> evaluateOperatorMatrixVectorProduct(const ScalarGSQTwoElectronOperator<double>& g, const VectorX<double>& x) const;
+    VectorX<double> evaluateOperatorMatrixVectorProduct(const ScalarGSQTwoElectronOperator<double>& g, const VectorX<double>& x, const size_t number_of_threads = 1) const;
 
     /**
      *  Calculate the matrix-vector product of (the matrix representation of) a generalized Hamiltonian with the given coefficient vector.
      *
      *  @param hamiltonian      A generalized Hamiltonian expressed in an orthonormal orbital basis.
      *  @param x                The coefficient vector of a linear expansion.
+     *  @param number_of_threads    The number of threads that should be used. Every thread iterates over a contiguous part of the ONV basis.
      *
      *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
      */
-    VectorX<double> evaluateOperatorMatrixVectorProduct(const GSQHamiltonian<double>& hamiltonian, const VectorX<double>& x) const;
+    VectorX<double> evaluateOperatorMatrixVectorProduct(const GSQHamiltonian<double>& hamiltonian, const VectorX<double>& x, const size_t number_of_threads = 1) const;
+
+    /**
+     *  Calculate the matrix-vector products of (the matrix representation of) a generalized Hamiltonian with a block of coefficient vectors. The matrix elements are evaluated only once for the whole block.
+     *
+     *  @param hamiltonian      A generalized Hamiltonian expressed in an orthonormal orbital basis.
+     *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+     *  @param number_of_threads    The number of threads that should be used. Every thread iterates over a contiguous part of the ONV basis.
+     *
+     *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+     */
+    MatrixX<double> evaluateOperatorBlockMatrixVectorProduct(const GSQHamiltonian<double>& hamiltonian, const MatrixX<double>& X, const size_t number_of_threads = 1) const;
 
 
     /*
@@ -428,23 +560,27 @@ public:
      *  Calculate the matrix representation of a generalized one-electron operator in this ONV basis and emplace it in the given container.
      * 
      *  @tparam Matrix                      The type of matrix used to store the evaluations.
+     *  @tparam Representation              The type of the bitstring that represents the ONVs during the evaluation. It should have at least as many bits as there are spinors.
      *
      *  @param f_op                         A generalized one-electron operator expressed in an orthonormal spinor basis.
      *  @param container                    A specialized container for emplacing evaluations/matrix elements.
      */
-    template <typename Matrix>
+    template <typename Matrix, typename Representation = size_t>
     void evaluate(const ScalarGSQOneElectronOperator<double>& f_op, MatrixRepresentationEvaluationContainer<Matrix>& container) const {
 
+        using ONV = BasicSpinUnresolvedONV<Representation>;
+
         const auto& f = f_op.parameters();
         const auto dim = this->dimension();
 
-        SpinUnresolvedONV onv = this->constructONVFromAddress(0);  // start with ONV with address 0
+        ONV onv {this->numberOfOrbitals(), this->numberOfElectrons()};
+        this->transformONVCorrespondingToAddress(onv, container.index);  // start with the ONV at the first index of the container (usually the ONV with address 0)
 
         for (; !container.isFinished(); container.increment()) {  // loops over all possible ONVs
             for (size_t e1 = 0; e1 < N; e1++) {                   // loop over electrons that can be annihilated
 
                 // Create an ONVPath for each new ONV.
-                ONVPath<SpinUnresolvedONVBasis> onv_path {*this, onv};
+                ONVPath<SpinUnresolvedONVBasis, ONV> onv_path {*this, onv, container.index};
 
                 size_t q = onv.occupationIndexOf(e1);  // retrieve orbital index of the electron that will be annihilated
 
@@ -485,13 +621,16 @@ public:
      *  Calculate the matrix representation of a generalized Hamiltonian in this ONV basis and emplace it in the given container.
      *
      *  @tparam Matrix                      The type of matrix used to store the evaluations.
+     *  @tparam Representation              The type of the bitstring that represents the ONVs during the evaluation. It should have at least as many bits as there are spinors.
      *
      *  @param hamiltonian                  An generalized Hamiltonian expressed in an orthonormal spinor basis.
      *  @param container                    A specialized container for emplacing evaluations/matrix elements.
      */
-    template <typename Matrix>
+    template <typename Matrix, typename Representation = size_t>
     void evaluate(const GSQHamiltonian<double>& hamiltonian, MatrixRepresentationEvaluationContainer<Matrix>& container) const {
 
+        using ONV = BasicSpinUnresolvedONV<Representation>;
+
         // Prepare some variables.
         const auto& h_op = hamiltonian.core();
         const auto& g_op = hamiltonian.twoElectron();  // 'op' for 'operator'
@@ -508,9 +647,11 @@ public:
         const size_t dim = this->dimension();
 
 
-        SpinUnresolvedONV onv = this->constructONVFromAddress(0);  // onv with address 0
-        for (; !container.isFinished(); container.increment()) {   // I loops over all addresses in the spin-unresolved ONV basis
-            if (container.index > 0) {
+        const size_t first_index = container.index;  // usually 0, but the container may only iterate over a part of the ONV basis
+        ONV onv {M, N};
+        this->transformONVCorrespondingToAddress(onv, first_index);  // onv with the first address of the container
+        for (; !container.isFinished(); container.increment()) {     // I loops over all addresses in the spin-unresolved ONV basis
+            if (container.index > first_index) {
                 this->transformONVToNextPermutation(onv);
             }
             int sign1 = -1;                      // start with -1 because we flip at the start of the annihilation (so we start at 1, followed by:  -1, 1, ...)
@@ -696,8 +837,8 @@ public:
      *  @param q         the orbital index
      *  @param e         the electron count
      */
-    template <int T>
-    void shiftUntilNextUnoccupiedOrbital(const SpinUnresolvedONV& onv, size_t& address, size_t& q, size_t& e) const {
+    template <int T, typename Representation>
+    void shiftUntilNextUnoccupiedOrbital(const BasicSpinUnresolvedONV<Representation>& onv, size_t& address, size_t& q, size_t& e) const {
 
         // Test whether the current orbital index is occupied
         while (e < this->N && q == onv.occupationIndexOf(e)) {
@@ -728,8 +869,8 @@ public:
      *  @param e         the electron count
      *  @param sign      the sign which is flipped for each iteration
      */
-    template <int T>
-    void shiftUntilNextUnoccupiedOrbital(const SpinUnresolvedONV& onv, size_t& address, size_t& q, size_t& e, int& sign) const {
+    template <int T, typename Representation>
+    void shiftUntilNextUnoccupiedOrbital(const BasicSpinUnresolvedONV<Representation>& onv, size_t& address, size_t& q, size_t& e, int& sign) const {
 
         // Test whether the current orbital index is occupied
         while (e < this->N && q == onv.occupationIndexOf(e)) {
@@ -761,8 +902,8 @@ public:
      *  @param e         the electron count
      *  @param sign      the sign which is flipped for each iteration
      */
-    template <int T>
-    void shiftUntilPreviousUnoccupiedOrbital(const SpinUnresolvedONV& onv, size_t& address, size_t& q, size_t& e, int& sign) const {
+    template <int T, typename Representation>
+    void shiftUntilPreviousUnoccupiedOrbital(const BasicSpinUnresolvedONV<Representation>& onv, size_t& address, size_t& q, size_t& e, int& sign) const {
 
         // Test whether the current orbital index is occupied
         while (e != -1 && q == onv.occupationIndexOf(e)) {
@@ -0,0 +1,241 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Transformations/BasisTransformable.hpp"
+#include "Basis/Transformations/JacobiRotatable.hpp"
+#include "Basis/Transformations/RTransformation.hpp"
+#include "DensityMatrix/Orbital2DM.hpp"
+#include "Mathematical/Representation/CholeskyDecomposedRankFourTensor.hpp"
+#include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
+#include "Operator/SecondQuantized/RSQTwoElectronOperator.hpp"
+
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+// Forward declaration, since the traits have to be specialized before the class can conform to `BasisTransformable` and `JacobiRotatable`.
+class CholeskyDecomposedRSQTwoElectronOperator;
+
+
+/*
+ *  MARK: BasisTransformableTraits
+ */
+
+/**
+ *  A type that provides compile-time information related to the abstract interface `BasisTransformable`.
+ */
+template <>
+struct BasisTransformableTraits<CholeskyDecomposedRSQTwoElectronOperator> {
+
+    // The type of transformation that is naturally associated to a `CholeskyDecomposedRSQTwoElectronOperator`.
+    using Transformation = RTransformation<double>;
+};
+
+
+/*
+ *  MARK: JacobiRotatableTraits
+ */
+
+/**
+ *  A type that provides compile-time information related to the abstract interface `JacobiRotatable`.
+ */
+template <>
+struct JacobiRotatableTraits<CholeskyDecomposedRSQTwoElectronOperator> {
+
+    // The type of Jacobi rotation for which the Jacobi rotation should be defined.
+    using JacobiRotationType = JacobiRotation;
+};
+
+
+/**
+ *  A real, scalar restricted two-electron operator (in chemist's notation) whose parameters are represented through Cholesky vectors, i.e.
+ *      g_pqrs ~ sum_L L^L_pq L^L_rs.
+ *
+ *  For the Coulomb repulsion operator, the number of Cholesky vectors N_L typically scales linearly with the number of orbitals K, so the K^2 N_L parameters require a fraction of the memory of the K^4 dense parameters. Basis transformations scale as O(K^3 N_L), Jacobi rotations as O(K N_L), and the dense parameters can be recovered on demand.
+ */
+class CholeskyDecomposedRSQTwoElectronOperator:
+    public BasisTransformable<CholeskyDecomposedRSQTwoElectronOperator>,
+    public JacobiRotatable<CholeskyDecomposedRSQTwoElectronOperator> {
+public:
+    // The scalar type used for a single parameter/matrix element.
+    using Scalar = double;
+
+    // The type of 'this'.
+    using Self = CholeskyDecomposedRSQTwoElectronOperator;
+
+    // The type of transformation that is naturally associated to a restricted two-electron operator.
+    using Transformation = RTransformation<double>;
+
+
+private:
+    // The Cholesky decomposition of the parameters of this operator.
+    CholeskyDecomposedRankFourTensor g;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param g            The Cholesky decomposition of the two-electron integrals, in chemist's notation.
+     */
+    CholeskyDecomposedRSQTwoElectronOperator(const CholeskyDecomposedRankFourTensor& g) :
+        g {g} {}
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Decompose the parameters of a dense two-electron operator.
+     *
+     *  @param g_op             The dense two-electron operator, whose parameters should have the 8-fold permutational symmetry of two-electron integrals over real orbitals, such as the Coulomb repulsion operator.
+     *  @param threshold        The threshold for the largest remaining diagonal element of the pair matrix, below which the decomposition is stopped.
+     *
+     *  @return The Cholesky-decomposed two-electron operator.
+     */
+    static Self FromDense(const ScalarRSQTwoElectronOperator<double>& g_op, const double threshold = 1.0e-08) {
+
+        if (g_op.isAntisymmetrized() || g_op.isExpressedUsingPhysicistsNotation()) {
+            throw std::invalid_argument("CholeskyDecomposedRSQTwoElectronOperator::FromDense(const ScalarRSQTwoElectronOperator<double>&, const double): Only non-antisymmetrized two-electron integrals in chemist's notation can be Cholesky-decomposed.");
+        }
+
+        return Self {CholeskyDecomposedRankFourTensor::FromFull(g_op.parameters(), threshold)};
+    }
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return A read-only reference to the Cholesky decomposition of the parameters of this operator.
+     */
+    const CholeskyDecomposedRankFourTensor& decomposition() const { return this->g; }
+
+    /**
+     *  @return The dense two-electron operator that this operator represents.
+     */
+    ScalarRSQTwoElectronOperator<double> dense() const { return ScalarRSQTwoElectronOperator<double> {this->g.full()}; }
+
+
+    /*
+     *  MARK: General information
+     */
+
+    /**
+     *  @return The number of Cholesky vectors.
+     */
+    size_t numberOfCholeskyVectors() const { return this->g.numberOfCholeskyVectors(); }
+
+    /**
+     *  @return The number of orbitals this operator is expressed with.
+     */
+    size_t numberOfOrbitals() const { return this->g.dimension(); }
+
+
+    /*
+     *  MARK: Calculations
+     */
+
+    /**
+     *  Calculate the expectation value of this two-electron operator, given a two-electron density matrix. (This includes the prefactor 1/2.)
+     *
+     *  @param d            The 2-DM (that represents the wave function).
+     *
+     *  @return The expectation value of this two-electron operator, with the given 2-DM.
+     */
+    StorageArray<double, ScalarVectorizer> calculateExpectationValue(const Orbital2DM<double>& d) const {
+
+        if (this->numberOfOrbitals() != d.numberOfOrbitals()) {
+            throw std::invalid_argument("CholeskyDecomposedRSQTwoElectronOperator::calculateExpectationValue(const Orbital2DM<double>&): The given 2-DM's dimension is not compatible with the two-electron operator.");
+        }
+
+        return StorageArray<double, ScalarVectorizer> {0.5 * this->g.contractFully(d), ScalarVectorizer {}};
+    }
+
+
+    /**
+     *  @return The one-electron operator that is the difference between this two-electron operator (E_PQRS) and a product of one-electron operators (E_PQ E_RS), i.e. k_pq = -1/2 g_prrq = -1/2 sum_L (L^L L^L)_pq.
+     */
+    ScalarRSQOneElectronOperator<double> effectiveOneElectronPartition() const {
+
+        const auto K = this->numberOfOrbitals();
+        const SquareMatrix<double> k = -0.5 * this->g.contractWithInnerPair(SquareMatrix<double>::Identity(K));
+
+        return ScalarRSQOneElectronOperator<double> {k};
+    }
+
+
+    /*
+     *  MARK: Conforming to `BasisTransformable`
+     */
+
+    /**
+     *  Apply the basis transformation and return the resulting two-electron operator.
+     *
+     *  @param T            The basis transformation.
+     *
+     *  @return The basis-transformed two-electron operator.
+     */
+    Self transformed(const Transformation& T) const override { return Self {this->g.transformed(T.matrix())}; }
+
+    // Allow the `rotate` method from `BasisTransformable`, since there's also a `rotate` from `JacobiRotatable`.
+    using BasisTransformable<Self>::rotate;
+
+    // Allow the `rotated` method from `BasisTransformable`, since there's also a `rotated` from `JacobiRotatable`.
+    using BasisTransformable<Self>::rotated;
+
+
+    /*
+     *  MARK: Conforming to `JacobiRotatable`
+     */
+
+    /**
+     *  Apply the Jacobi rotation and return the result.
+     *
+     *  @param jacobi_rotation          The Jacobi rotation.
+     *
+     *  @return The Jacobi-transformed object.
+     */
+    Self rotated(const JacobiRotation& jacobi_rotation) const override {
+
+        auto result = *this;
+        result.rotate(jacobi_rotation);
+        return result;
+    }
+
+
+    /**
+     *  In-place apply the Jacobi rotation.
+     *
+     *  @param jacobi_rotation          The Jacobi rotation.
+     *
+     *  @note Since the Jacobi rotation matrix only differs from the identity in the columns p and q, only the rows and columns p and q of every Cholesky vector change. This makes a Jacobi rotation scale as O(K N_L).
+     */
+    void rotate(const JacobiRotation& jacobi_rotation) { this->g.rotatePlane(jacobi_rotation.p(), jacobi_rotation.q(), jacobi_rotation.planeMatrix()); }
+};
+
+
+}  // namespace GQCP
@@ -173,8 +173,10 @@ public:
      */
     Self rotated(const JacobiRotation& jacobi_rotation, const Spin sigma) const {
 
-        const auto J = UTransformationComponent<Scalar>::FromJacobi(jacobi_rotation, this->numberOfOrbitals());
-        return this->transformed(J, sigma);
+        auto result = *this;
+        result.rotate(jacobi_rotation, sigma);
+
+        return result;
     }
 
 
@@ -188,8 +190,16 @@ public:
      */
     void rotate(const JacobiRotation& jacobi_rotation, const Spin sigma) {
 
-        auto result = this->rotated(jacobi_rotation, sigma);
-        *this = result;
+        // Only the slices whose index equals p or q change, which makes this update scale as O(K^3) (cfr. `SimpleSQTwoElectronOperator::rotate`).
+        const auto p = jacobi_rotation.p();
+        const auto q = jacobi_rotation.q();
+        const Eigen::Matrix2d G = jacobi_rotation.planeMatrix();
+
+        const size_t first_axis = (sigma == Spin::alpha) ? 0 : 2;
+        for (auto& component : this->allParameters()) {
+            component.rotateAxis(first_axis, p, q, G);
+            component.rotateAxis(first_axis + 1, p, q, G);
+        }
     }
 };
 
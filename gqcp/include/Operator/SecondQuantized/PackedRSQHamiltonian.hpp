@@ -0,0 +1,263 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/FCIDUMP.hpp"
+#include "Basis/Transformations/BasisTransformable.hpp"
+#include "Basis/Transformations/JacobiRotatable.hpp"
+#include "Basis/Transformations/RTransformation.hpp"
+#include "DensityMatrix/Orbital1DM.hpp"
+#include "DensityMatrix/Orbital2DM.hpp"
+#include "Operator/SecondQuantized/PackedRSQTwoElectronOperator.hpp"
+#include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
+#include "Operator/SecondQuantized/SQHamiltonian.hpp"
+
+#include <stdexcept>
+#include <string>
+
+
+namespace GQCP {
+
+
+// Forward declaration, since the traits have to be specialized before the class can conform to `BasisTransformable` and `JacobiRotatable`.
+class PackedRSQHamiltonian;
+
+
+/*
+ *  MARK: BasisTransformableTraits
+ */
+
+/**
+ *  A type that provides compile-time information related to the abstract interface `BasisTransformable`.
+ */
+template <>
+struct BasisTransformableTraits<PackedRSQHamiltonian> {
+
+    // The type of transformation that is naturally associated to a `PackedRSQHamiltonian`.
+    using Transformation = RTransformation<double>;
+};
+
+
+/*
+ *  MARK: JacobiRotatableTraits
+ */
+
+/**
+ *  A type that provides compile-time information related to the abstract interface `JacobiRotatable`.
+ */
+template <>
+struct JacobiRotatableTraits<PackedRSQHamiltonian> {
+
+    // The type of Jacobi rotation for which the Jacobi rotation should be defined.
+    using JacobiRotationType = JacobiRotation;
+};
+
+
+/**
+ *  A real restricted Hamiltonian whose two-electron part is stored in a packed way, by exploiting the 8-fold permutational symmetry of two-electron integrals over real orbitals.
+ *
+ *  It requires about 8 times less memory than an `RSQHamiltonian<double>`. ONV bases that only read single two-electron integrals (such as `SeniorityZeroONVBasis`) can evaluate it directly; other consumers can expand it through `dense()`.
+ */
+class PackedRSQHamiltonian:
+    public BasisTransformable<PackedRSQHamiltonian>,
+    public JacobiRotatable<PackedRSQHamiltonian> {
+public:
+    // The scalar type used for a single parameter/matrix element.
+    using Scalar = double;
+
+    // The type of 'this'.
+    using Self = PackedRSQHamiltonian;
+
+    // The type of transformation that is naturally associated to a restricted Hamiltonian.
+    using Transformation = RTransformation<double>;
+
+
+private:
+    // The core (i.e. one-electron) part of the Hamiltonian.
+    ScalarRSQOneElectronOperator<double> h;
+
+    // The packed two-electron part of the Hamiltonian.
+    PackedRSQTwoElectronOperator g;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param h            The core (i.e. one-electron) part of the Hamiltonian.
+     *  @param g            The packed two-electron part of the Hamiltonian.
+     */
+    PackedRSQHamiltonian(const ScalarRSQOneElectronOperator<double>& h, const PackedRSQTwoElectronOperator& g) :
+        h {h},
+        g {g} {
+
+        if (h.numberOfOrbitals() != g.numberOfOrbitals()) {
+            throw std::invalid_argument("PackedRSQHamiltonian::PackedRSQHamiltonian(const ScalarRSQOneElectronOperator<double>&, const PackedRSQTwoElectronOperator&): The dimensions of the one- and two-electron operators are incompatible.");
+        }
+    }
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Pack the two-electron part of a dense restricted Hamiltonian.
+     *
+     *  @param hamiltonian              The dense Hamiltonian, whose two-electron parameters should have the 8-fold permutational symmetry of two-electron integrals over real orbitals.
+     *
+     *  @return The packed Hamiltonian.
+     */
+    static Self FromDense(const RSQHamiltonian<double>& hamiltonian) { return Self {hamiltonian.core(), PackedRSQTwoElectronOperator::FromDense(hamiltonian.twoElectron())}; }
+
+    /**
+     *  Create the Hamiltonian that corresponds to the integrals of an FCIDUMP file, without unpacking its two-electron integrals.
+     *
+     *  @param fcidump                  The contents of an FCIDUMP file.
+     *
+     *  @return The Hamiltonian corresponding to the given integrals.
+     *
+     *  @note The core energy isn't part of the Hamiltonian.
+     */
+    static Self FromFCIDUMP(const FCIDUMP& fcidump) { return Self {ScalarRSQOneElectronOperator<double> {fcidump.oneElectronIntegrals()}, PackedRSQTwoElectronOperator {fcidump.twoElectronIntegrals()}}; }
+
+    /**
+     *  Parse an FCIDUMP file and read in its Hamiltonian. The two-electron integrals are parsed into packed storage and stay packed.
+     *
+     *  @param fcidump_filename         The name of the FCIDUMP file.
+     *  @param number_of_threads        The number of threads over which the parsing should be distributed.
+     *
+     *  @return The Hamiltonian corresponding to the contents of an FCIDUMP file.
+     *
+     *  @note The core energy isn't part of the Hamiltonian.
+     */
+    static Self FromFCIDUMP(const std::string& fcidump_filename, const size_t number_of_threads = 1) { return Self::FromFCIDUMP(FCIDUMP::Read(fcidump_filename, number_of_threads)); }
+
+    /**
+     *  Read in the Hamiltonian of a binary integral file that was written by `FCIDUMP::writeBinary`. The two-electron integrals are read straight into packed storage and stay packed.
+     *
+     *  @param filename                 The name of the binary integral file, with extension '.gqcpint'.
+     *
+     *  @return The Hamiltonian corresponding to the contents of the binary integral file.
+     *
+     *  @note The core energy isn't part of the Hamiltonian.
+     */
+    static Self FromBinary(const std::string& filename) { return Self::FromFCIDUMP(FCIDUMP::ReadBinary(filename)); }
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The core (i.e. one-electron) part of this Hamiltonian.
+     */
+    const ScalarRSQOneElectronOperator<double>& core() const { return this->h; }
+
+    /**
+     *  @return The packed two-electron part of this Hamiltonian.
+     */
+    const PackedRSQTwoElectronOperator& twoElectron() const { return this->g; }
+
+    /**
+     *  @return The dense Hamiltonian that this Hamiltonian represents.
+     */
+    RSQHamiltonian<double> dense() const { return RSQHamiltonian<double> {this->h, this->g.dense()}; }
+
+
+    /*
+     *  MARK: General information
+     */
+
+    /**
+     *  @return The number of orbitals this Hamiltonian is expressed with.
+     */
+    size_t numberOfOrbitals() const { return this->h.numberOfOrbitals(); }
+
+
+    /*
+     *  MARK: Calculations
+     */
+
+    /**
+     *  Calculate the expectation value of this Hamiltonian.
+     *
+     *  @param D            The 1-DM (that represents the wave function).
+     *  @param d            The 2-DM (that represents the wave function).
+     *
+     *  @return The expectation value of this Hamiltonian.
+     */
+    double calculateExpectationValue(const Orbital1DM<double>& D, const Orbital2DM<double>& d) const { return this->h.calculateExpectationValue(D)() + this->g.calculateExpectationValue(d)(); }
+
+
+    /*
+     *  MARK: Conforming to `BasisTransformable`
+     */
+
+    /**
+     *  Apply the basis transformation and return the resulting Hamiltonian.
+     *
+     *  @param T            The basis transformation.
+     *
+     *  @return The basis-transformed Hamiltonian.
+     */
+    Self transformed(const Transformation& T) const override { return Self {this->h.transformed(T), this->g.transformed(T)}; }
+
+    // Allow the `rotate` method from `BasisTransformable`, since there's also a `rotate` from `JacobiRotatable`.
+    using BasisTransformable<Self>::rotate;
+
+    // Allow the `rotated` method from `BasisTransformable`, since there's also a `rotated` from `JacobiRotatable`.
+    using BasisTransformable<Self>::rotated;
+
+
+    /*
+     *  MARK: Conforming to `JacobiRotatable`
+     */
+
+    /**
+     *  Apply the Jacobi rotation and return the result.
+     *
+     *  @param jacobi_rotation          The Jacobi rotation.
+     *
+     *  @return The Jacobi-transformed object.
+     */
+    Self rotated(const JacobiRotation& jacobi_rotation) const override {
+
+        auto result = *this;
+        result.rotate(jacobi_rotation);
+        return result;
+    }
+
+
+    /**
+     *  In-place apply the Jacobi rotation.
+     *
+     *  @param jacobi_rotation          The Jacobi rotation.
+     */
+    void rotate(const JacobiRotation& jacobi_rotation) {
+
+        this->h.rotate(jacobi_rotation);
+        this->g.rotate(jacobi_rotation);
+    }
+};
+
+
+}  // namespace GQCP
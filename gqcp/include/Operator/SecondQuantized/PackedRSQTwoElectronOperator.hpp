@@ -0,0 +1,249 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Transformations/BasisTransformable.hpp"
+#include "Basis/Transformations/JacobiRotatable.hpp"
+#include "Basis/Transformations/RTransformation.hpp"
+#include "DensityMatrix/Orbital2DM.hpp"
+#include "Mathematical/Representation/PackedSymmetricRankFourTensor.hpp"
+#include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
+#include "Operator/SecondQuantized/RSQTwoElectronOperator.hpp"
+#include "Utilities/threading.hpp"
+
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+// Forward declaration, since the traits have to be specialized before the class can conform to `BasisTransformable` and `JacobiRotatable`.
+class PackedRSQTwoElectronOperator;
+
+
+/*
+ *  MARK: BasisTransformableTraits
+ */
+
+/**
+ *  A type that provides compile-time information related to the abstract interface `BasisTransformable`.
+ */
+template <>
+struct BasisTransformableTraits<PackedRSQTwoElectronOperator> {
+
+    // The type of transformation that is naturally associated to a `PackedRSQTwoElectronOperator`.
+    using Transformation = RTransformation<double>;
+};
+
+
+/*
+ *  MARK: JacobiRotatableTraits
+ */
+
+/**
+ *  A type that provides compile-time information related to the abstract interface `JacobiRotatable`.
+ */
+template <>
+struct JacobiRotatableTraits<PackedRSQTwoElectronOperator> {
+
+    // The type of Jacobi rotation for which the Jacobi rotation should be defined.
+    using JacobiRotationType = JacobiRotation;
+};
+
+
+/**
+ *  A real, scalar restricted two-electron operator (in chemist's notation) whose parameters have the 8-fold permutational symmetry of two-electron integrals over real orbitals, and are stored in a packed way.
+ *
+ *  Only the about K^4/8 unique parameters are stored. Their elements can be accessed directly through `parameters()`, so that evaluations that only read single elements never need the dense parameters.
+ */
+class PackedRSQTwoElectronOperator:
+    public BasisTransformable<PackedRSQTwoElectronOperator>,
+    public JacobiRotatable<PackedRSQTwoElectronOperator> {
+public:
+    // The scalar type used for a single parameter/matrix element.
+    using Scalar = double;
+
+    // The type of 'this'.
+    using Self = PackedRSQTwoElectronOperator;
+
+    // The type of transformation that is naturally associated to a restricted two-electron operator.
+    using Transformation = RTransformation<double>;
+
+
+private:
+    // The packed parameters of this operator.
+    PackedSymmetricRankFourTensor g;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param g            The packed two-electron integrals over real orbitals, in chemist's notation.
+     */
+    PackedRSQTwoElectronOperator(const PackedSymmetricRankFourTensor& g) :
+        g {g} {}
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Pack the parameters of a dense two-electron operator.
+     *
+     *  @param g_op             The dense two-electron operator, whose parameters should have the 8-fold permutational symmetry of two-electron integrals over real orbitals.
+     *
+     *  @return The packed two-electron operator.
+     */
+    static Self FromDense(const ScalarRSQTwoElectronOperator<double>& g_op) { return Self {g_op.packed()}; }
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return A read-only reference to the packed parameters of this operator, whose elements can be accessed as g(p, q, r, s).
+     */
+    const PackedSymmetricRankFourTensor& parameters() const { return this->g; }
+
+    /**
+     *  @return The dense two-electron operator that this operator represents.
+     */
+    ScalarRSQTwoElectronOperator<double> dense() const { return ScalarRSQTwoElectronOperator<double>::FromPacked(this->g); }
+
+
+    /*
+     *  MARK: General information
+     */
+
+    /**
+     *  @return The number of orbitals this operator is expressed with.
+     */
+    size_t numberOfOrbitals() const { return this->g.dimension(); }
+
+
+    /*
+     *  MARK: Calculations
+     */
+
+    /**
+     *  Calculate the expectation value of this two-electron operator, given a two-electron density matrix. (This includes the prefactor 1/2.)
+     *
+     *  @param d            The 2-DM (that represents the wave function).
+     *
+     *  @return The expectation value of this two-electron operator, with the given 2-DM.
+     */
+    StorageArray<double, ScalarVectorizer> calculateExpectationValue(const Orbital2DM<double>& d) const {
+
+        if (this->numberOfOrbitals() != d.numberOfOrbitals()) {
+            throw std::invalid_argument("PackedRSQTwoElectronOperator::calculateExpectationValue(const Orbital2DM<double>&): The given 2-DM's dimension is not compatible with the two-electron operator.");
+        }
+
+        const auto K = this->numberOfOrbitals();
+        double expectation_value = 0.0;
+        for (size_t p = 0; p < K; p++) {
+            for (size_t q = 0; q < K; q++) {
+                for (size_t r = 0; r < K; r++) {
+                    for (size_t s = 0; s < K; s++) {
+                        expectation_value += this->g(p, q, r, s) * d(p, q, r, s);
+                    }
+                }
+            }
+        }
+
+        return StorageArray<double, ScalarVectorizer> {0.5 * expectation_value, ScalarVectorizer {}};
+    }
+
+
+    /**
+     *  @return The one-electron operator that is the difference between this two-electron operator (E_PQRS) and a product of one-electron operators (E_PQ E_RS), i.e. k_pq = -1/2 g_prrq.
+     */
+    ScalarRSQOneElectronOperator<double> effectiveOneElectronPartition() const {
+
+        const auto K = this->numberOfOrbitals();
+        SquareMatrix<double> k = SquareMatrix<double>::Zero(K);
+        for (size_t p = 0; p < K; p++) {
+            for (size_t q = 0; q < K; q++) {
+                for (size_t r = 0; r < K; r++) {
+                    k(p, q) -= 0.5 * this->g(p, r, r, q);
+                }
+            }
+        }
+
+        return ScalarRSQOneElectronOperator<double> {k};
+    }
+
+
+    /*
+     *  MARK: Conforming to `BasisTransformable`
+     */
+
+    /**
+     *  Apply the basis transformation and return the resulting two-electron operator.
+     *
+     *  @param T            The basis transformation.
+     *
+     *  @return The basis-transformed two-electron operator.
+     *
+     *  @note The packed transformation is distributed over the library-wide number of threads (see `setNumberOfThreads`).
+     */
+    Self transformed(const Transformation& T) const override { return Self {this->g.transformed(T.matrix(), numberOfThreads())}; }
+
+    // Allow the `rotate` method from `BasisTransformable`, since there's also a `rotate` from `JacobiRotatable`.
+    using BasisTransformable<Self>::rotate;
+
+    // Allow the `rotated` method from `BasisTransformable`, since there's also a `rotated` from `JacobiRotatable`.
+    using BasisTransformable<Self>::rotated;
+
+
+    /*
+     *  MARK: Conforming to `JacobiRotatable`
+     */
+
+    /**
+     *  Apply the Jacobi rotation and return the result.
+     *
+     *  @param jacobi_rotation          The Jacobi rotation.
+     *
+     *  @return The Jacobi-transformed object.
+     */
+    Self rotated(const JacobiRotation& jacobi_rotation) const override {
+
+        auto result = *this;
+        result.rotate(jacobi_rotation);
+        return result;
+    }
+
+
+    /**
+     *  In-place apply the Jacobi rotation.
+     *
+     *  @param jacobi_rotation          The Jacobi rotation.
+     *
+     *  @note Only the parameters with an index p or q change, which are updated in the packed storage in O(K^3).
+     */
+    void rotate(const JacobiRotation& jacobi_rotation) { this->g.rotatePlane(jacobi_rotation.p(), jacobi_rotation.q(), jacobi_rotation.planeMatrix()); }
+};
+
+
+}  // namespace GQCP
@@ -22,11 +22,13 @@
 #include "DensityMatrix/Orbital1DM.hpp"
 #include "DensityMatrix/Orbital2DM.hpp"
 #include "Mathematical/Representation/DenseVectorizer.hpp"
+#include "Mathematical/Representation/PackedSymmetricRankFourTensor.hpp"
 #include "Operator/SecondQuantized/MixedUSQTwoElectronOperatorComponent.hpp"
 #include "Operator/SecondQuantized/PureUSQTwoElectronOperatorComponent.hpp"
 #include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/SimpleSQTwoElectronOperator.hpp"
 #include "QuantumChemical/spinor_tags.hpp"
+#include "Utilities/type_traits.hpp"
 
 
 namespace GQCP {
@@ -61,6 +63,41 @@ public:
     using SimpleSQTwoElectronOperator<_Scalar, _Vectorizer, RSQTwoElectronOperator<_Scalar, _Vectorizer>>::SimpleSQTwoElectronOperator;
 
 
+    /*
+     *  MARK: Packed storage
+     */
+
+    /**
+     *  Create a scalar two-electron operator from two-electron integrals that are stored in a packed way.
+     *
+     *  @param g                The packed two-electron integrals over real orbitals, in chemist's notation.
+     *
+     *  @return The two-electron operator whose (dense) parameters are the unpacked integrals.
+     *
+     *  @note This named constructor is only available for real scalar operators. It unpacks the integrals; use `PackedRSQTwoElectronOperator` to keep them packed.
+     */
+    template <typename Z1 = Scalar, typename Z2 = Vectorizer>
+    static enable_if_t<std::is_same<Z1, double>::value && std::is_same<Z2, ScalarVectorizer>::value, RSQTwoElectronOperator<Scalar, Vectorizer>> FromPacked(const PackedSymmetricRankFourTensor& g) {
+        return RSQTwoElectronOperator<Scalar, Vectorizer> {g.full()};
+    }
+
+
+    /**
+     *  @return The parameters of this scalar two-electron operator, packed by exploiting the 8-fold permutational symmetry of two-electron integrals over real orbitals. This requires about 8 times less memory than the dense parameters.
+     *
+     *  @note This method is only available for real scalar operators. Only the elements g(p q r s) with p >= q, r >= s and pq >= rs are read, so the parameters should have the full 8-fold permutational symmetry.
+     */
+    template <typename Z1 = Scalar, typename Z2 = Vectorizer>
+    enable_if_t<std::is_same<Z1, double>::value && std::is_same<Z2, ScalarVectorizer>::value, PackedSymmetricRankFourTensor> packed() const {
+
+        if (this->isAntisymmetrized() || this->isExpressedUsingPhysicistsNotation()) {
+            throw std::invalid_argument("RSQTwoElectronOperator::packed(): Only non-antisymmetrized two-electron integrals in chemist's notation have the 8-fold permutational symmetry that is required for packing.");
+        }
+
+        return PackedSymmetricRankFourTensor::FromFull(this->parameters());
+    }
+
+
     /*
      *  MARK: Conversions to spin components
      */
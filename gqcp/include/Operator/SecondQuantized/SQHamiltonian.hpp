@@ -18,6 +18,7 @@
 #pragma once
 
 
+#include "Basis/Integrals/FCIDUMP.hpp"
 #include "Basis/SpinorBasis/GSpinorBasis.hpp"
 #include "Basis/SpinorBasis/OrbitalSpace.hpp"
 #include "Basis/SpinorBasis/RSpinOrbitalBasis.hpp"
@@ -261,102 +262,36 @@ public:
     }
 
 
+    /**
+     *  Create the Hamiltonian that corresponds to the integrals of an FCIDUMP file.
+     *
+     *  @param fcidump                  The contents of an FCIDUMP file.
+     *
+     *  @return The Hamiltonian corresponding to the given integrals.
+     *
+     *  @note This named constructor is only available in the real case. The core energy isn't part of the Hamiltonian. The two-electron integrals are unpacked; use `PackedRSQHamiltonian::FromFCIDUMP` to keep them packed.
+     */
+    template <typename Z1 = Scalar, typename Z2 = SpinorTag>
+    static enable_if_t<std::is_same<Z1, double>::value && std::is_same<Z2, RestrictedSpinOrbitalTag>::value, SQHamiltonian<ScalarSQOneElectronOperator, ScalarSQTwoElectronOperator>> FromFCIDUMP(const FCIDUMP& fcidump) {
+
+        return SQHamiltonian(ScalarSQOneElectronOperator(fcidump.oneElectronIntegrals()), ScalarSQTwoElectronOperator::FromPacked(fcidump.twoElectronIntegrals()));
+    }
+
+
     /**
      *  Parse an FCIDUMP file and read in its Hamiltonian.
      * 
      *  @param fcidump_filename         The name of the FCIDUMP file.
+     *  @param number_of_threads        The number of threads over which the parsing should be distributed.
      *
      *  @return The Hamiltonian corresponding to the contents of an FCIDUMP file.
      *
-     *  @note This named constructor is only available in the real case.
+     *  @note This named constructor is only available in the real case. The core energy isn't part of the Hamiltonian. The two-electron integrals are unpacked; use `PackedRSQHamiltonian::FromFCIDUMP` to keep them packed.
      */
     template <typename Z1 = Scalar, typename Z2 = SpinorTag>
-    static enable_if_t<std::is_same<Z1, double>::value && std::is_same<Z2, RestrictedSpinOrbitalTag>::value, SQHamiltonian<ScalarSQOneElectronOperator, ScalarSQTwoElectronOperator>> FromFCIDUMP(const std::string& fcidump_filename) {
-
-        std::ifstream input_file_stream = validateAndOpen(fcidump_filename, "FCIDUMP");
-
-
-        // Do the actual parsing
-
-        //  Get the number of orbitals to check if it's a valid FCIDUMP file
-        std::string start_line;  // first line contains orbitals and electron count
-        std::getline(input_file_stream, start_line);
-        std::stringstream linestream {start_line};
-
-        size_t K = 0;
-        char iter;
-
-        while (linestream >> iter) {
-            if (iter == '=') {
-                linestream >> K;  // right here we have the number of orbitals
-                break;            // we can finish reading the linestream after we found K
-            }
-        }
-
-        if (K == 0) {
-            throw std::invalid_argument("SQHamiltonian::FromFCIDUMP(std::string): The .FCIDUMP-file is invalid: could not read a number of orbitals.");
-        }
-
-
-        SquareMatrix<double> h_core = SquareMatrix<double>::Zero(K);
-        SquareRankFourTensor<double> g {K};
-        g.setZero();
-
-        //  Skip 3 lines
-        for (size_t counter = 0; counter < 3; counter++) {
-            std::getline(input_file_stream, start_line);
-        }
-
-
-        //  Start reading in the one- and two-electron integrals
-        double x;
-        size_t i, j, a, b;
+    static enable_if_t<std::is_same<Z1, double>::value && std::is_same<Z2, RestrictedSpinOrbitalTag>::value, SQHamiltonian<ScalarSQOneElectronOperator, ScalarSQTwoElectronOperator>> FromFCIDUMP(const std::string& fcidump_filename, const size_t number_of_threads = 1) {
 
-        std::string line;
-        while (std::getline(input_file_stream, line)) {
-            std::istringstream iss {line};
-
-            // Based on what the values of the indices are, we can read one-electron integrals, two-electron integrals and the internuclear repulsion energy
-            //  See also (http://hande.readthedocs.io/en/latest/manual/integrals.html)
-            //  I think the documentation is a bit unclear for the two-electron integrals, but we can rest assured that FCIDUMP files give the two-electron integrals in CHEMIST's notation.
-            iss >> x >> i >> a >> j >> b;
-
-            //  Single-particle eigenvalues (skipped)
-            if ((a == 0) && (j == 0) && (b == 0)) {
-            }
-
-            //  One-electron integrals (h_core)
-            else if ((j == 0) && (b == 0)) {
-                size_t p = i - 1;
-                size_t q = a - 1;
-                h_core(p, q) = x;
-
-                // Apply the permutational symmetry for real orbitals
-                h_core(q, p) = x;
-            }
-
-            //  Two-electron integrals are given in CHEMIST'S NOTATION, so just copy them over
-            else if ((i > 0) && (a > 0) && (j > 0) && (b > 0)) {
-                size_t p = i - 1;
-                size_t q = a - 1;
-                size_t r = j - 1;
-                size_t s = b - 1;
-                g(p, q, r, s) = x;
-
-                // Apply the permutational symmetries for real orbitals
-                g(p, q, s, r) = x;
-                g(q, p, r, s) = x;
-                g(q, p, s, r) = x;
-
-                g(r, s, p, q) = x;
-                g(s, r, p, q) = x;
-                g(r, s, q, p) = x;
-                g(s, r, q, p) = x;
-            }
-        }  // while loop
-
-
-        return SQHamiltonian(ScalarSQOneElectronOperator(h_core), ScalarSQTwoElectronOperator(g));
+        return SQHamiltonian::FromFCIDUMP(FCIDUMP::Read(fcidump_filename, number_of_threads));
     }
 
 
@@ -619,26 +554,35 @@ public:
     Self rotated(const JacobiRotationType& jacobi_rotation) const override {
 
         auto result = *this;
+        result.rotate(jacobi_rotation);
 
-        // Transform the one and two-electron contributions.
-        for (auto& h : result.coreContributions()) {
+        return result;
+    }
+
+
+    /**
+     *  In-place apply the Jacobi rotation.
+     * 
+     *  @param jacobi_rotation          The Jacobi rotation.
+     * 
+     *  @note Every one- and two-electron operator is rotated in-place, so that no copy of the (two-electron) parameters is made.
+     */
+    void rotate(const JacobiRotationType& jacobi_rotation) {
+
+        // Rotate the one and two-electron contributions.
+        for (auto& h : this->coreContributions()) {
             h.rotate(jacobi_rotation);
         }
 
-        for (auto& g : result.twoElectronContributions()) {
+        for (auto& g : this->twoElectronContributions()) {
             g.rotate(jacobi_rotation);
         }
 
-        // Transform the total one- and two-electron interactions.
-        result.core().rotate(jacobi_rotation);
-        result.twoElectron().rotate(jacobi_rotation);
-
-        return result;
+        // Rotate the total one- and two-electron interactions.
+        this->core().rotate(jacobi_rotation);
+        this->twoElectron().rotate(jacobi_rotation);
     }
 
-    // Allow the `rotate` method from `JacobiRotatable`, since there's also a `rotate` from `BasisTransformable`.
-    using JacobiRotatable<Self>::rotate;
-
 
     /*
      *  MARK: Operations related to one-electron operators
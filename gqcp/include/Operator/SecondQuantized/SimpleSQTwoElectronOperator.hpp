@@ -20,9 +20,11 @@
 
 #include "Basis/Transformations/BasisTransformable.hpp"
 #include "Basis/Transformations/JacobiRotatable.hpp"
+#include "Mathematical/Representation/FourIndexTransformation.hpp"
 #include "Mathematical/Representation/SquareRankFourTensor.hpp"
 #include "Mathematical/Representation/StorageArray.hpp"
 #include "Operator/SecondQuantized/SQOperatorStorage.hpp"
+#include "Utilities/threading.hpp"
 
 #include <string>
 
@@ -279,34 +281,17 @@ public:
      *  @param T            The basis transformation
      * 
      *  @return The basis-transformed one-electron integrals.
+     * 
+     *  @note The transformation is distributed over the library-wide number of threads, see `setNumberOfThreads`.
      */
     DerivedOperator transformed(const Transformation& T) const override {
 
-        // Since we're only getting T as a matrix, we should convert it to an appropriate tensor to perform contractions.
-        // Although not a necessity for the einsum implementation, it makes it a lot easier to follow the formulas.
-        const GQCP::Tensor<Scalar, 2> T_tensor = Eigen::TensorMap<Eigen::Tensor<const Scalar, 2>>(T.matrix().data(), T.matrix().rows(), T.matrix().cols());
-
-        // We calculate the conjugate as a tensor as well.
-        const GQCP::Tensor<Scalar, 2> T_conjugate = T_tensor.conjugate();
-
-        // Calculate the basis transformation for every component of the operator.
+        // Calculate the basis transformation for every component of the operator. Every component is transformed through four quarter-transformations, which avoid rank-four intermediates, on the library-wide number of threads.
         const auto& parameters = this->allParameters();
         auto result = this->allParameters();
 
         for (size_t i = 0; i < this->numberOfComponents(); i++) {
-
-            // We will have to do four single contractions
-            // g(T U V W)  T^*(V R) -> a(T U R W)
-            // a(T U R W)  T(W S) -> b(T U R S)
-            const auto temp_1 = parameters[i].template einsum<1>("TUVW,VR->TURW", T_conjugate).template einsum<1>("TURW,WS->TURS", T_tensor);
-
-            // T(U Q)  b(T U R S) -> c(T Q R S)
-            const auto temp_2 = T_tensor.template einsum<1>("UQ,TURS->TQRS", temp_1);
-
-            // T^*(T P)  c(T Q R S) -> g'(P Q R S)
-            const auto transformed_component = T_conjugate.template einsum<1>("TP,TQRS->PQRS", temp_2);
-
-            result[i] = transformed_component;
+            result[i] = fourIndexTransformed<Scalar>(parameters[i], T.matrix(), numberOfThreads());
         }
 
         return DerivedOperator {StorageArray<MatrixRepresentation, Vectorizer>(result, this->array.vectorizer())};
@@ -333,13 +318,32 @@ public:
      */
     DerivedOperator rotated(const JacobiRotation& jacobi_rotation) const override {
 
-        // While waiting for an analogous Eigen::Tensor Jacobi module, we implement this rotation by constructing a Jacobi rotation matrix and then simply doing a rotation with it.
-        const auto J = Transformation::FromJacobi(jacobi_rotation, this->numberOfOrbitals());
-        return this->rotated(J);
+        auto result = static_cast<const DerivedOperator&>(*this);
+        result.rotate(jacobi_rotation);
+
+        return result;
     }
 
-    // Allow the `rotate` method from `JacobiRotatable`, since there's also a `rotate` from `BasisTransformable`.
-    using JacobiRotatable<DerivedOperator>::rotate;
+
+    /**
+     *  In-place apply the Jacobi rotation.
+     * 
+     *  @param jacobi_rotation          The Jacobi rotation.
+     * 
+     *  @note Since the Jacobi rotation matrix only differs from the identity in the columns p and q, every one of the four quarter-transformations in `transformed` reduces to an update of the slices whose index equals p or q. This makes a Jacobi rotation scale as O(K^3) instead of O(K^5).
+     */
+    void rotate(const JacobiRotation& jacobi_rotation) {
+
+        const auto p = jacobi_rotation.p();
+        const auto q = jacobi_rotation.q();
+        const Eigen::Matrix2d G = jacobi_rotation.planeMatrix();  // Real-valued, so the complex conjugations on the first and third axes are trivial.
+
+        for (auto& component : this->allParameters()) {
+            for (size_t axis = 0; axis < 4; axis++) {
+                component.rotateAxis(axis, p, q, G);
+            }
+        }
+    }
 
 
     /*
@@ -73,20 +73,11 @@ public:
         const auto& orbital_space = t2.orbitalSpace();
 
 
-        // Update the T2-amplitudes.
-        auto t2_updated = t2;
-        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-
-                        // Determine the current value for the corresponding T2-amplitude equation, and use it to update the T2-amplitude.
-                        const auto f_ijab = QCModel::CCD<Scalar>::calculateT2AmplitudeEquation(i, j, a, b, f, V_A, t2, F1, F2, W1, W2, W3);
-                        t2_updated(i, j, a, b) += f_ijab / (f(i, i) + f(j, j) - f(a, a) - f(b, b));
-                    }
-                }
-            }
-        }
+        // Determine the current values for all the T2-amplitude equations at once, and use them to update the T2-amplitudes.
+        const auto f_T2 = QCModel::CCD<Scalar>::calculateT2AmplitudeEquations(f, V_A, t2, F1, F2, W1, W2, W3);
+
+        const Tensor<Scalar, 4> t2_updated_dense = t2.asImplicitRankFourTensorSlice().asTensor().Eigen() + f_T2.asTensor().Eigen() / T2Amplitudes<Scalar>::calculateEnergyDenominators(f, orbital_space).Eigen();
+        const T2Amplitudes<Scalar> t2_updated {orbital_space.createRepresentableObjectFor(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, t2_updated_dense), orbital_space};
 
         // Write the updated amplitudes back to the environment.
         environment.t2_amplitudes.push_back(t2_updated);
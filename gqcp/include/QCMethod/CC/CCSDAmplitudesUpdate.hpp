@@ -79,31 +79,15 @@ public:
         const auto& orbital_space = t1.orbitalSpace();  // assume the orbital spaces are equal for the T1- and T2-amplitudes.
 
 
-        // Update the T1-amplitudes.
-        auto t1_updated = t1;
-        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-
-                // Determine the current value for the corresponding T1-amplitude equation, and use it to update the T1-amplitude.
-                const auto f_ia = QCModel::CCSD<Scalar>::calculateT1AmplitudeEquation(i, a, f, V_A, t1, t2, F1, F2, F3);
-                t1_updated(i, a) += f_ia / (f(i, i) - f(a, a));
-            }
-        }
-
-        // Update the T2-amplitudes.
-        auto t2_updated = t2;
-        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-
-                        // Determine the current value for the corresponding T2-amplitude equation, and use it to update the T2-amplitude.
-                        const auto f_ijab = QCModel::CCSD<Scalar>::calculateT2AmplitudeEquation(i, j, a, b, f, V_A, t1, t2, tau2, F1, F2, F3, W1, W2, W3);
-                        t2_updated(i, j, a, b) += f_ijab / (f(i, i) + f(j, j) - f(a, a) - f(b, b));
-                    }
-                }
-            }
-        }
+        // Determine the current values for all the T1- and T2-amplitude equations at once, and use them to update the amplitudes.
+        const auto f_T1 = QCModel::CCSD<Scalar>::calculateT1AmplitudeEquations(f, V_A, t1, t2, F1, F2, F3);
+        const auto f_T2 = QCModel::CCSD<Scalar>::calculateT2AmplitudeEquations(f, V_A, t1, t2, tau2, F1, F2, F3, W1, W2, W3);
+
+        const MatrixX<Scalar> t1_updated_dense = t1.asImplicitMatrixSlice().asMatrix() + f_T1.asMatrix().cwiseQuotient(T1Amplitudes<Scalar>::calculateEnergyDenominators(f, orbital_space));
+        const T1Amplitudes<Scalar> t1_updated {orbital_space.createRepresentableObjectFor(OccupationType::k_occupied, OccupationType::k_virtual, t1_updated_dense), orbital_space};
+
+        const Tensor<Scalar, 4> t2_updated_dense = t2.asImplicitRankFourTensorSlice().asTensor().Eigen() + f_T2.asTensor().Eigen() / T2Amplitudes<Scalar>::calculateEnergyDenominators(f, orbital_space).Eigen();
+        const T2Amplitudes<Scalar> t2_updated {orbital_space.createRepresentableObjectFor(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, t2_updated_dense), orbital_space};
 
         // Write the updated amplitudes back to the environment.
         environment.t1_amplitudes.push_back(t1_updated);
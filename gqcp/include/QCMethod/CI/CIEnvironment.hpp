@@ -19,6 +19,11 @@
 
 
 #include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
+#include "ONVBasis/SeniorityZeroONVBasis.hpp"
+#include "ONVBasis/SpinResolvedMatrixVectorProductEngine.hpp"
+#include "ONVBasis/SpinUnresolvedONVBasis.hpp"
+
+#include <memory>
 
 
 namespace GQCP {
@@ -68,5 +73,140 @@ EigenproblemEnvironment Iterative(const Hamiltonian& hamiltonian, const ONVBasis
 }
 
 
+/**
+ *  Create an environment suitable for solving iterative CI eigenvalue problems for the given Hamiltonian and ONV basis, in which the matrix-vector products are calculated on multiple threads.
+ * 
+ *  @tparam Hamiltonian             The type of Hamiltonian whose eigenproblem is trying to be solved.
+ *  @tparam ONVBasis                The type of ONV basis in which the Hamiltonian should be represented. It should support multithreaded matrix-vector products.
+ * 
+ *  @param hamiltonian              A second-quantized Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param onv_basis                An ONV basis that spans a Fock (sub)space in which the Hamiltonian eigenproblem should be solved.
+ *  @param V                        A matrix of initial guess vectors, where each column of the matrix is an initial guess vector.
+ *  @param number_of_threads        The number of threads that should be used in calculating a matrix-vector product.
+ * 
+ *  @return An `EigenproblemEnvironment` initialized suitable for solving iterative CI eigenvalue problems for the given Hamiltonian and ONV basis.
+ */
+template <typename Hamiltonian, typename ONVBasis>
+EigenproblemEnvironment Iterative(const Hamiltonian& hamiltonian, const ONVBasis& onv_basis, const MatrixX<double>& V, const size_t number_of_threads) {
+
+    // Determine the diagonal of the Hamiltonian matrix representation, and supply a matrix-vector product function to the `EigenproblemEnvironment`.
+    const auto diagonal = onv_basis.evaluateOperatorDiagonal(hamiltonian);
+    const auto matvec_function = [&hamiltonian, &onv_basis, number_of_threads](const VectorX<double>& x) { return onv_basis.evaluateOperatorMatrixVectorProduct(hamiltonian, x, number_of_threads); };
+
+    return EigenproblemEnvironment::Iterative(matvec_function, diagonal, V);
+}
+
+
+/**
+ *  Create an environment suitable for solving iterative CI eigenvalue problems for the given restricted Hamiltonian in a full spin-resolved ONV basis.
+ * 
+ *  @param hamiltonian              A restricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param onv_basis                A full spin-resolved ONV basis that spans a Fock (sub)space in which the Hamiltonian eigenproblem should be solved.
+ *  @param V                        A matrix of initial guess vectors, where each column of the matrix is an initial guess vector.
+ *  @param number_of_threads        The number of threads that should be used in calculating a matrix-vector product.
+ * 
+ *  @return An `EigenproblemEnvironment` initialized suitable for solving iterative CI eigenvalue problems for the given Hamiltonian and ONV basis.
+ * 
+ *  @note The Hamiltonian-dependent intermediates of the matrix-vector product are calculated only once, upon construction of the environment, instead of in every iteration.
+ */
+inline EigenproblemEnvironment Iterative(const RSQHamiltonian<double>& hamiltonian, const SpinResolvedONVBasis& onv_basis, const MatrixX<double>& V, const size_t number_of_threads = 1) {
+
+    // Determine the diagonal of the Hamiltonian matrix representation, and supply (block) matrix-vector product functions, which use a precalculated matrix-vector product engine, to the `EigenproblemEnvironment`.
+    const auto diagonal = onv_basis.evaluateOperatorDiagonal(hamiltonian);
+    const auto engine = std::make_shared<const SpinResolvedMatrixVectorProductEngine>(onv_basis, hamiltonian, number_of_threads);
+    const auto matvec_function = [engine](const VectorX<double>& x) { return engine->evaluate(x); };
+    const auto block_matvec_function = [engine](const MatrixX<double>& X) { return engine->evaluateBlock(X); };
+
+    return EigenproblemEnvironment::Iterative(matvec_function, block_matvec_function, diagonal, V);
+}
+
+
+/**
+ *  Create an environment suitable for solving iterative CI eigenvalue problems for the given unrestricted Hamiltonian in a full spin-resolved ONV basis.
+ * 
+ *  @param hamiltonian              An unrestricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param onv_basis                A full spin-resolved ONV basis that spans a Fock (sub)space in which the Hamiltonian eigenproblem should be solved.
+ *  @param V                        A matrix of initial guess vectors, where each column of the matrix is an initial guess vector.
+ *  @param number_of_threads        The number of threads that should be used in calculating a matrix-vector product.
+ * 
+ *  @return An `EigenproblemEnvironment` initialized suitable for solving iterative CI eigenvalue problems for the given Hamiltonian and ONV basis.
+ * 
+ *  @note The Hamiltonian-dependent intermediates of the matrix-vector product are calculated only once, upon construction of the environment, instead of in every iteration.
+ */
+inline EigenproblemEnvironment Iterative(const USQHamiltonian<double>& hamiltonian, const SpinResolvedONVBasis& onv_basis, const MatrixX<double>& V, const size_t number_of_threads = 1) {
+
+    // Determine the diagonal of the Hamiltonian matrix representation, and supply (block) matrix-vector product functions, which use a precalculated matrix-vector product engine, to the `EigenproblemEnvironment`.
+    const auto diagonal = onv_basis.evaluateOperatorDiagonal(hamiltonian);
+    const auto engine = std::make_shared<const SpinResolvedMatrixVectorProductEngine>(onv_basis, hamiltonian, number_of_threads);
+    const auto matvec_function = [engine](const VectorX<double>& x) { return engine->evaluate(x); };
+    const auto block_matvec_function = [engine](const MatrixX<double>& X) { return engine->evaluateBlock(X); };
+
+    return EigenproblemEnvironment::Iterative(matvec_function, block_matvec_function, diagonal, V);
+}
+
+
+/**
+ *  Create an environment suitable for solving iterative CI eigenvalue problems for the given restricted Hamiltonian in a seniority-zero ONV basis.
+ * 
+ *  @param hamiltonian              A restricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param onv_basis                A seniority-zero ONV basis that spans a Fock (sub)space in which the Hamiltonian eigenproblem should be solved.
+ *  @param V                        A matrix of initial guess vectors, where each column of the matrix is an initial guess vector.
+ *  @param number_of_threads        The number of threads that should be used in calculating a matrix-vector product.
+ * 
+ *  @return An `EigenproblemEnvironment` initialized suitable for solving iterative CI eigenvalue problems for the given Hamiltonian and ONV basis.
+ */
+inline EigenproblemEnvironment Iterative(const RSQHamiltonian<double>& hamiltonian, const SeniorityZeroONVBasis& onv_basis, const MatrixX<double>& V, const size_t number_of_threads = 1) {
+
+    // Determine the diagonal of the Hamiltonian matrix representation, and supply (block) matrix-vector product functions to the `EigenproblemEnvironment`.
+    const auto diagonal = onv_basis.evaluateOperatorDiagonal(hamiltonian);
+    const auto matvec_function = [&hamiltonian, &onv_basis, number_of_threads](const VectorX<double>& x) { return onv_basis.evaluateOperatorMatrixVectorProduct(hamiltonian, x, number_of_threads); };
+    const auto block_matvec_function = [&hamiltonian, &onv_basis, number_of_threads](const MatrixX<double>& X) { return onv_basis.evaluateOperatorBlockMatrixVectorProduct(hamiltonian, X, number_of_threads); };
+
+    return EigenproblemEnvironment::Iterative(matvec_function, block_matvec_function, diagonal, V);
+}
+
+
+/**
+ *  Create an environment suitable for solving iterative CI eigenvalue problems for the given restricted Hamiltonian with packed two-electron integrals in a seniority-zero ONV basis.
+ * 
+ *  @param hamiltonian              A restricted Hamiltonian with packed two-electron integrals, expressed in an orthonormal orbital basis.
+ *  @param onv_basis                A seniority-zero ONV basis that spans a Fock (sub)space in which the Hamiltonian eigenproblem should be solved.
+ *  @param V                        A matrix of initial guess vectors, where each column of the matrix is an initial guess vector.
+ *  @param number_of_threads        The number of threads that should be used in calculating a matrix-vector product.
+ * 
+ *  @return An `EigenproblemEnvironment` initialized suitable for solving iterative CI eigenvalue problems for the given Hamiltonian and ONV basis.
+ */
+inline EigenproblemEnvironment Iterative(const PackedRSQHamiltonian& hamiltonian, const SeniorityZeroONVBasis& onv_basis, const MatrixX<double>& V, const size_t number_of_threads = 1) {
+
+    // Determine the diagonal of the Hamiltonian matrix representation, and supply (block) matrix-vector product functions to the `EigenproblemEnvironment`. The two-electron integrals are read from the packed storage.
+    const auto diagonal = onv_basis.evaluateOperatorDiagonal(hamiltonian);
+    const auto matvec_function = [&hamiltonian, &onv_basis, number_of_threads](const VectorX<double>& x) { return onv_basis.evaluateOperatorMatrixVectorProduct(hamiltonian, x, number_of_threads); };
+    const auto block_matvec_function = [&hamiltonian, &onv_basis, number_of_threads](const MatrixX<double>& X) { return onv_basis.evaluateOperatorBlockMatrixVectorProduct(hamiltonian, X, number_of_threads); };
+
+    return EigenproblemEnvironment::Iterative(matvec_function, block_matvec_function, diagonal, V);
+}
+
+
+/**
+ *  Create an environment suitable for solving iterative CI eigenvalue problems for the given generalized Hamiltonian in a full spin-unresolved ONV basis.
+ * 
+ *  @param hamiltonian              A generalized Hamiltonian expressed in an orthonormal spinor basis.
+ *  @param onv_basis                A full spin-unresolved ONV basis that spans a Fock (sub)space in which the Hamiltonian eigenproblem should be solved.
+ *  @param V                        A matrix of initial guess vectors, where each column of the matrix is an initial guess vector.
+ *  @param number_of_threads        The number of threads that should be used in calculating a matrix-vector product.
+ * 
+ *  @return An `EigenproblemEnvironment` initialized suitable for solving iterative CI eigenvalue problems for the given Hamiltonian and ONV basis.
+ */
+inline EigenproblemEnvironment Iterative(const GSQHamiltonian<double>& hamiltonian, const SpinUnresolvedONVBasis& onv_basis, const MatrixX<double>& V, const size_t number_of_threads = 1) {
+
+    // Determine the diagonal of the Hamiltonian matrix representation, and supply (block) matrix-vector product functions to the `EigenproblemEnvironment`.
+    const auto diagonal = onv_basis.evaluateOperatorDiagonal(hamiltonian);
+    const auto matvec_function = [&hamiltonian, &onv_basis, number_of_threads](const VectorX<double>& x) { return onv_basis.evaluateOperatorMatrixVectorProduct(hamiltonian, x, number_of_threads); };
+    const auto block_matvec_function = [&hamiltonian, &onv_basis, number_of_threads](const MatrixX<double>& X) { return onv_basis.evaluateOperatorBlockMatrixVectorProduct(hamiltonian, X, number_of_threads); };
+
+    return EigenproblemEnvironment::Iterative(matvec_function, block_matvec_function, diagonal, V);
+}
+
+
 }  // namespace CIEnvironment
 }  // namespace GQCP
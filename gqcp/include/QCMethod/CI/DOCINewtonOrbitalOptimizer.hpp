@@ -1,189 +1,345 @@
-// // This file is part of GQCG-GQCP.
-// //
-// // Copyright (C) 2017-2020  the GQCG developers
-// //
-// // GQCG-GQCP is free software: you can redistribute it and/or modify
-// // it under the terms of the GNU Lesser General Public License as published by
-// // the Free Software Foundation, either version 3 of the License, or
-// // (at your option) any later version.
-// //
-// // GQCG-GQCP is distributed in the hope that it will be useful,
-// // but WITHOUT ANY WARRANTY; without even the implied warranty of
-// // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-// // GNU Lesser General Public License for more details.
-// //
-// // You should have received a copy of the GNU Lesser General Public License
-// // along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
-
-// #pragma once
-
-
-// #include "Mathematical/Optimization/Eigenproblem/Eigenpair.hpp"
-// #include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
-// #include "ONVBasis/SeniorityZeroONVBasis.hpp"
-// #include "QCMethod/CI/CI.hpp"
-// #include "QCMethod/CI/CIEnvironment.hpp"
-// #include "QCMethod/OrbitalOptimization/QCMethodNewtonOrbitalOptimizer.hpp"
-// #include "QCModel/CI/LinearExpansion.hpp"
-
-// #include <memory>
-
-
-// namespace GQCP {
-
-
-// /**
-//  *  A class that performs gradient-and-Hessian-based orbital optimization for DOCI by sequentially
-//  *      - solving the DOCI eigenvalue problem
-//  *      - solving the Newton step to find the anti-Hermitian orbital rotation parameters
-//  *      - rotating the underlying spatial orbital basis
-//  *
-//  *  @tparam _EigenproblemSolver          the type of the eigenproblem solver that is used
-//  */
-// template <typename _EigenproblemSolver>
-// class DOCINewtonOrbitalOptimizer:
-//     public QCMethodNewtonOrbitalOptimizer {
-
-// public:
-//     using EigenproblemSolver = _EigenproblemSolver;
-
-
-// private:
-//     SeniorityZeroONVBasis onv_basis;  // the Fock subspace used for DOCI calculations
-
-//     EigenproblemEnvironment eigenproblem_environment;
-//     EigenproblemSolver eigenproblem_solver;
-
-//     LinearExpansion<SeniorityZeroONVBasis> ground_state_expansion;
-
-//     size_t number_of_requested_eigenpairs;
-//     std::vector<Eigenpair<double>> m_eigenpairs;  // eigenvalues and -vectors
-
-
-// public:
-//     // CONSTRUCTORS
-
-//     /**
-//      *  @param onv_basis                        the Fock subspace used for DOCI calculations
-//      *  @param eigenproblem_environment         the environments that acts as the calculation context for the eigenproblem solver
-//      *  @param eigenproblem_solver              the algorithm that tries to solve the DOCI eigenvalue problem
-//      *  @param hessian_modifier                 the modifier functor that should be used when an indefinite Hessian is encountered
-//      *  @param number_of_requested_eigenpairs   the number of m_eigenpairs that should be looked for
-//      *  @param convergence_threshold            the threshold used to check for convergence
-//      *  @param maximum_number_of_iterations     the maximum number of iterations that may be used to achieve convergence
-//      */
-//     DOCINewtonOrbitalOptimizer(const SeniorityZeroONVBasis& onv_basis, const EigenproblemSolver& eigenproblem_solver, const EigenproblemEnvironment& eigenproblem_environment, std::shared_ptr<BaseHessianModifier> hessian_modifier, const size_t number_of_requested_eigenpairs = 1, const double convergence_threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) :
-//         onv_basis {onv_basis},
-//         eigenproblem_solver {eigenproblem_solver},
-//         eigenproblem_environment {eigenproblem_environment},
-//         number_of_requested_eigenpairs {number_of_requested_eigenpairs},
-//         QCMethodNewtonOrbitalOptimizer(hessian_modifier, convergence_threshold, maximum_number_of_iterations) {}
-
-
-//     // PUBLIC OVERRIDDEN METHODS
-
-//     /**
-//      *  @return the current 1-DM
-//      */
-//     Orbital1DM<double> calculate1DM() const override {
-//         return this->ground_state_expansion.calculate1DM();
-//     }
-
-
-//     /**
-//      *  @return the current 2-DM
-//      */
-//     Orbital2DM<double> calculate2DM() const override {
-//         return this->ground_state_expansion.calculate2DM();
-//     }
-
-
-//     /**
-//      *  Use gradient and Hessian information to determine a new direction for the 'full' orbital rotation generators kappa. Note that a distinction is made between 'free' generators, i.e. those that are calculated from the gradient and Hessian information and the 'full' generators, which also include the redundant parameters (that can be set to zero). The 'full' generators are used to calculate the total rotation matrix using the matrix exponential
-//      *
-//      *  @param sq_hamiltonian      the current Hamiltonian
-//      *
-//      *  @return the new full set orbital generators, including the redundant parameters
-//      */
-//     OrbitalRotationGenerators calculateNewFullOrbitalGenerators(const RSQHamiltonian<double>& sq_hamiltonian) const override {
-//         return this->calculateNewFreeOrbitalGenerators(sq_hamiltonian);  // no extra step necessary
-//     }
-
-
-//     /**
-//      *  Prepare this object (i.e. the context for the orbital optimization algorithm) to be able to check for convergence in this Newton-based orbital optimizer
-//      *
-//      *  In the case of this uncoupled DOCI orbital optimizer, the DOCI eigenvalue problem is re-solved in every iteration using the current orbitals
-//      */
-//     void prepareDMCalculation(const RSQHamiltonian<double>& sq_hamiltonian) override {
-
-//         // (Re)create the eigenproblem environment in the current orbital basis.
-//         if (this->eigenproblem_environment.A.cols() != 0) {  // if the optimization environment is 'dense'
-//             this->eigenproblem_environment = CIEnvironment::Dense(sq_hamiltonian, this->onv_basis);
-//         } else {
-
-//             // Recreate the iterative eigenproblem environment with the previous guesses.
-//             if (this->number_of_iterations != 0) {  // not needed when we haven't done an OO iteration
-//                 const auto dim = this->onv_basis.dimension();
-//                 MatrixX<double> V = MatrixX<double>::Zero(dim, this->number_of_requested_eigenpairs);
-
-//                 const auto m_eigenpairs = this->eigenproblem_environment.eigenpairs(this->number_of_requested_eigenpairs);
-//                 for (size_t i = 0; i < this->number_of_requested_eigenpairs; i++) {
-//                     V.col(i) = m_eigenpairs[i].eigenvector();
-//                 }
-
-//                 this->eigenproblem_environment = CIEnvironment::Iterative(sq_hamiltonian, this->onv_basis, V);
-//             }
-//         }
-
-//         // Set the ground state expansion and the possibly requested excited states.
-//         this->ground_state_expansion = QCMethod::CI<SeniorityZeroONVBasis>(this->onv_basis, this->number_of_requested_eigenpairs).optimize(this->eigenproblem_solver, this->eigenproblem_environment).groundStateParameters();
-//         this->m_eigenpairs = eigenproblem_environment.eigenpairs(this->number_of_requested_eigenpairs);
-//     }
-
-
-//     // PUBLIC METHODS
-
-//     /**
-//      *  @param index                the index of a state
-//      *
-//      *  @return the eigenpair that is associated to the given index
-//      */
-//     const Eigenpair<double>& eigenpair(const size_t index = 0) const {
-
-//         if (this->is_converged) {
-//             return this->m_eigenpairs[index];
-//         } else {
-//             throw std::logic_error("DOCINewtonOrbitalOptimizer::eigenpair(const size_t): You are trying to get eigenpairs but the orbital optimization hasn't converged (yet).");
-//         }
-//     }
-
-//     /**
-//      *  @return all eigenpairs found by this orbital optimizer
-//      */
-//     const std::vector<Eigenpair<double>>& eigenpairs() const {
-
-//         if (this->is_converged) {
-//             return this->m_eigenpairs;
-//         } else {
-//             throw std::logic_error("DOCINewtonOrbitalOptimizer::eigenpairs(): You are trying to get eigenpairs but the orbital optimization hasn't converged (yet).");
-//         }
-//     }
-
-
-//     /**
-//      *  @param index        the index of the index-th excited state
-//      *
-//      *  @return the index-th excited state after doing the OO-DOCI calculation
-//      */
-//     LinearExpansion<SeniorityZeroONVBasis> makeLinearExpansion(size_t index = 0) const {
-//         if (index > this->m_eigenpairs.size()) {
-//             throw std::logic_error("DOCINewtonOrbitalOptimizer::makeLinearExpansion(size_t): Not enough requested m_eigenpairs for the given index.");
-//         }
-
-//         return LinearExpansion<SeniorityZeroONVBasis>(this->onv_basis, this->m_eigenpairs[index].eigenvector());
-//     }
-// };
-
-
-// }  // namespace GQCP
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Davidson/ResidualVectorConvergence.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Eigenpair.hpp"
+#include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
+#include "ONVBasis/SeniorityZeroONVBasis.hpp"
+#include "QCMethod/CI/CI.hpp"
+#include "QCMethod/CI/CIEnvironment.hpp"
+#include "QCMethod/OrbitalOptimization/QCMethodNewtonOrbitalOptimizer.hpp"
+#include "QCModel/CI/LinearExpansion.hpp"
+
+#include <algorithm>
+#include <memory>
+
+
+namespace GQCP {
+
+
+/**
+ *  A class that performs gradient-and-Hessian-based orbital optimization for DOCI by sequentially
+ *      - solving the DOCI eigenvalue problem
+ *      - solving the Newton step to find the anti-Hermitian orbital rotation parameters
+ *      - rotating the underlying spatial orbital basis
+ * 
+ *  With an iterative (Davidson) eigenproblem solver, the CI (micro-)iterations are coupled to the orbital (macro-)iterations:
+ *      - every DOCI eigenvalue problem is warm-started from the previous eigenvectors and (optionally) the most recent vectors of the previous Davidson subspace, which span a good subspace as long as the orbital rotations are small
+ *      - (optionally) the CI convergence threshold is tightened as the orbital gradient falls, so that no micro-iterations are spent on accurately converging CI vectors for orbitals that are far from optimal
+ *
+ *  @tparam _EigenproblemSolver          the type of the eigenproblem solver that is used
+ */
+template <typename _EigenproblemSolver>
+class DOCINewtonOrbitalOptimizer:
+    public QCMethodNewtonOrbitalOptimizer {
+
+public:
+    using EigenproblemSolver = _EigenproblemSolver;
+
+
+private:
+    SeniorityZeroONVBasis onv_basis;  // the Fock subspace used for DOCI calculations
+
+    EigenproblemEnvironment eigenproblem_environment;
+    EigenproblemSolver eigenproblem_solver;
+
+    LinearExpansion<SeniorityZeroONVBasis> ground_state_expansion;
+
+    size_t number_of_requested_eigenpairs;
+    std::vector<Eigenpair<double>> m_eigenpairs;  // eigenvalues and -vectors
+
+    size_t number_of_retained_subspace_vectors;  // the maximum number of (most recent) vectors of the previous Davidson subspace that are added to the guess vectors of the next DOCI eigenvalue problem
+    double ci_convergence_factor;                // the factor with which the orbital gradient norm is multiplied to find the CI convergence threshold; zero disables the adaptive CI convergence
+    double ci_convergence_threshold;             // the final (tightest) convergence threshold on the CI residual vectors
+    double current_ci_convergence_threshold;     // the convergence threshold on the CI residual vectors that is used in the current macro-iteration
+    size_t number_of_ci_iterations = 0;          // the total number of iterations the eigenproblem solver has performed
+
+
+public:
+    // CONSTRUCTORS
+
+    /**
+     *  @param onv_basis                                the Fock subspace used for DOCI calculations
+     *  @param eigenproblem_solver                      the algorithm that tries to solve the DOCI eigenvalue problem
+     *  @param eigenproblem_environment                 the environments that acts as the calculation context for the eigenproblem solver
+     *  @param hessian_modifier                         the modifier functor that should be used when an indefinite Hessian is encountered
+     *  @param number_of_requested_eigenpairs           the number of eigenpairs that should be looked for
+     *  @param convergence_threshold                    the threshold used to check for convergence
+     *  @param maximum_number_of_iterations             the maximum number of iterations that may be used to achieve convergence
+     *  @param number_of_retained_subspace_vectors      the maximum number of (most recent) vectors of the previous Davidson subspace that are added to the guess vectors of the next DOCI eigenvalue problem. Together with the requested eigenpairs, they should fit in the Davidson subspace
+     *  @param ci_convergence_factor                    the factor with which the orbital gradient norm is multiplied to find the CI convergence threshold of the next macro-iteration; zero disables the adaptive CI convergence
+     *  @param ci_convergence_threshold                 the final (tightest) convergence threshold on the CI residual vectors, which is only used if the CI convergence is adaptive
+     */
+    DOCINewtonOrbitalOptimizer(const SeniorityZeroONVBasis& onv_basis, const EigenproblemSolver& eigenproblem_solver, const EigenproblemEnvironment& eigenproblem_environment, std::shared_ptr<BaseHessianModifier> hessian_modifier, const size_t number_of_requested_eigenpairs = 1, const double convergence_threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_retained_subspace_vectors = 0, const double ci_convergence_factor = 0.0, const double ci_convergence_threshold = 1.0e-08) :
+        QCMethodNewtonOrbitalOptimizer(hessian_modifier, convergence_threshold, maximum_number_of_iterations),
+        onv_basis {onv_basis},
+        eigenproblem_environment {eigenproblem_environment},
+        eigenproblem_solver {eigenproblem_solver},
+        number_of_requested_eigenpairs {number_of_requested_eigenpairs},
+        number_of_retained_subspace_vectors {number_of_retained_subspace_vectors},
+        ci_convergence_factor {ci_convergence_factor},
+        ci_convergence_threshold {ci_convergence_threshold},
+        current_ci_convergence_threshold {(ci_convergence_factor > 0.0) ? std::max(ci_convergence_threshold, ci_convergence_factor) : ci_convergence_threshold} {}
+
+
+    /**
+     *  @param onv_basis                                the Fock subspace used for DOCI calculations
+     *  @param eigenproblem_solver                      the algorithm that tries to solve the DOCI eigenvalue problem
+     *  @param eigenproblem_environment                 the environments that acts as the calculation context for the eigenproblem solver
+     *  @param trust_region                             the augmented-Hessian trust region that is used to calculate the orbital steps, using only Hessian-vector products
+     *  @param number_of_requested_eigenpairs           the number of eigenpairs that should be looked for
+     *  @param convergence_threshold                    the threshold used to check for convergence
+     *  @param maximum_number_of_iterations             the maximum number of iterations that may be used to achieve convergence
+     *  @param number_of_retained_subspace_vectors      the maximum number of (most recent) vectors of the previous Davidson subspace that are added to the guess vectors of the next DOCI eigenvalue problem. Together with the requested eigenpairs, they should fit in the Davidson subspace
+     *  @param ci_convergence_factor                    the factor with which the orbital gradient norm is multiplied to find the CI convergence threshold of the next macro-iteration; zero disables the adaptive CI convergence
+     *  @param ci_convergence_threshold                 the final (tightest) convergence threshold on the CI residual vectors, which is only used if the CI convergence is adaptive
+     */
+    DOCINewtonOrbitalOptimizer(const SeniorityZeroONVBasis& onv_basis, const EigenproblemSolver& eigenproblem_solver, const EigenproblemEnvironment& eigenproblem_environment, const AugmentedHessianTrustRegion& trust_region, const size_t number_of_requested_eigenpairs = 1, const double convergence_threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const size_t number_of_retained_subspace_vectors = 0, const double ci_convergence_factor = 0.0, const double ci_convergence_threshold = 1.0e-08) :
+        QCMethodNewtonOrbitalOptimizer(trust_region, convergence_threshold, maximum_number_of_iterations),
+        onv_basis {onv_basis},
+        eigenproblem_environment {eigenproblem_environment},
+        eigenproblem_solver {eigenproblem_solver},
+        number_of_requested_eigenpairs {number_of_requested_eigenpairs},
+        number_of_retained_subspace_vectors {number_of_retained_subspace_vectors},
+        ci_convergence_factor {ci_convergence_factor},
+        ci_convergence_threshold {ci_convergence_threshold},
+        current_ci_convergence_threshold {(ci_convergence_factor > 0.0) ? std::max(ci_convergence_threshold, ci_convergence_factor) : ci_convergence_threshold} {}
+
+
+    // PUBLIC OVERRIDDEN METHODS
+
+    /**
+     *  @return the current 1-DM
+     */
+    Orbital1DM<double> calculate1DM() const override {
+        return this->ground_state_expansion.calculate1DM();
+    }
+
+
+    /**
+     *  @return the current 2-DM
+     */
+    Orbital2DM<double> calculate2DM() const override {
+        return this->ground_state_expansion.calculate2DM();
+    }
+
+
+    /**
+     *  Determine if the algorithm has converged or not. With an adaptive CI convergence, the orbital optimization can only be converged if the CI has been converged with the final threshold.
+     * 
+     *  @param sq_hamiltonian      the current Hamiltonian
+     * 
+     *  @return if the algorithm is considered to be converged
+     */
+    bool checkForConvergence(const RSQHamiltonian<double>& sq_hamiltonian) const override {
+
+        if (this->current_ci_convergence_threshold > this->ci_convergence_threshold) {
+            return false;
+        }
+
+        return QCMethodNewtonOrbitalOptimizer::checkForConvergence(sq_hamiltonian);
+    }
+
+
+    /**
+     *  Use gradient and Hessian information to determine a new direction for the 'full' orbital rotation generators kappa. Note that a distinction is made between 'free' generators, i.e. those that are calculated from the gradient and Hessian information and the 'full' generators, which also include the redundant parameters (that can be set to zero). The 'full' generators are used to calculate the total rotation matrix using the matrix exponential
+     *
+     *  @param sq_hamiltonian      the current Hamiltonian
+     *
+     *  @return the new full set orbital generators, including the redundant parameters
+     */
+    OrbitalRotationGenerators calculateNewFullOrbitalGenerators(const RSQHamiltonian<double>& sq_hamiltonian) const override {
+
+        // If the orbital gradient has converged with a CI that hasn't been converged tightly enough, the orbitals are kept fixed: only the CI has to be converged further.
+        if ((this->current_ci_convergence_threshold > this->ci_convergence_threshold) && (this->gradient.norm() < this->convergence_threshold)) {
+            const VectorX<double> zero_generators = VectorX<double>::Zero(this->gradient.size());
+            return OrbitalRotationGenerators(zero_generators);
+        }
+
+        return this->calculateNewFreeOrbitalGenerators(sq_hamiltonian);  // no extra step necessary
+    }
+
+
+    /**
+     *  Prepare this object (i.e. the context for the orbital optimization algorithm) to be able to check for convergence in this Newton-based orbital optimizer
+     *
+     *  In the case of this uncoupled DOCI orbital optimizer, the DOCI eigenvalue problem is re-solved in every iteration using the current orbitals. For an iterative eigenproblem solver, the previous eigenvectors (and possibly the most recent vectors of the previous subspace) are used as guess vectors.
+     */
+    void prepareDMCalculation(const RSQHamiltonian<double>& sq_hamiltonian) override {
+
+        // (Re)create the eigenproblem environment in the current orbital basis.
+        if (this->eigenproblem_environment.A.cols() != 0) {  // if the optimization environment is 'dense'
+            this->eigenproblem_environment = CIEnvironment::Dense(sq_hamiltonian, this->onv_basis);
+        } else {
+
+            // Recreate the iterative eigenproblem environment with the previous solution as guess vectors. This is not needed when we haven't solved the DOCI eigenvalue problem yet.
+            if (!this->m_eigenpairs.empty()) {
+                this->eigenproblem_environment = CIEnvironment::Iterative(sq_hamiltonian, this->onv_basis, this->warmStartGuessVectors());
+            }
+        }
+
+        // Tighten the CI convergence threshold according to the orbital gradient of the previous macro-iteration. Once the orbital gradient has converged, the final threshold is used.
+        if (this->ci_convergence_factor > 0.0) {
+            const double gradient_norm = (this->gradient.size() == 0) ? 1.0 : this->gradient.norm();
+            const double threshold = (gradient_norm < this->convergence_threshold) ? this->ci_convergence_threshold : this->ci_convergence_factor * std::min(gradient_norm, 1.0);
+
+            this->current_ci_convergence_threshold = std::max(this->ci_convergence_threshold, std::min(this->current_ci_convergence_threshold, threshold));
+            DOCINewtonOrbitalOptimizer<EigenproblemSolver>::updateConvergenceCriterion(this->eigenproblem_solver, this->current_ci_convergence_threshold, this->number_of_requested_eigenpairs);
+        }
+
+        // Set the ground state expansion and the possibly requested excited states.
+        this->ground_state_expansion = QCMethod::CI<SeniorityZeroONVBasis>(this->onv_basis, this->number_of_requested_eigenpairs).optimize(this->eigenproblem_solver, this->eigenproblem_environment).groundStateParameters();
+        this->m_eigenpairs = eigenproblem_environment.eigenpairs(this->number_of_requested_eigenpairs);
+        this->number_of_ci_iterations += DOCINewtonOrbitalOptimizer<EigenproblemSolver>::numberOfIterationsOf(this->eigenproblem_solver);
+    }
+
+
+    // PUBLIC METHODS
+
+    /**
+     *  @return the convergence threshold on the CI residual vectors that was used in the last macro-iteration
+     */
+    double currentCIConvergenceThreshold() const { return this->current_ci_convergence_threshold; }
+
+    /**
+     *  @param index                the index of a state
+     *
+     *  @return the eigenpair that is associated to the given index
+     */
+    const Eigenpair<double>& eigenpair(const size_t index = 0) const {
+
+        if (this->is_converged) {
+            return this->m_eigenpairs[index];
+        } else {
+            throw std::logic_error("DOCINewtonOrbitalOptimizer::eigenpair(const size_t): You are trying to get eigenpairs but the orbital optimization hasn't converged (yet).");
+        }
+    }
+
+    /**
+     *  @return all eigenpairs found by this orbital optimizer
+     */
+    const std::vector<Eigenpair<double>>& eigenpairs() const {
+
+        if (this->is_converged) {
+            return this->m_eigenpairs;
+        } else {
+            throw std::logic_error("DOCINewtonOrbitalOptimizer::eigenpairs(): You are trying to get eigenpairs but the orbital optimization hasn't converged (yet).");
+        }
+    }
+
+
+    /**
+     *  @param index        the index of the index-th excited state
+     *
+     *  @return the index-th excited state after doing the OO-DOCI calculation
+     */
+    LinearExpansion<SeniorityZeroONVBasis> makeLinearExpansion(size_t index = 0) const {
+        if (index >= this->m_eigenpairs.size()) {
+            throw std::logic_error("DOCINewtonOrbitalOptimizer::makeLinearExpansion(size_t): Not enough requested m_eigenpairs for the given index.");
+        }
+
+        return LinearExpansion<SeniorityZeroONVBasis>(this->onv_basis, this->m_eigenpairs[index].eigenvector());
+    }
+
+
+    /**
+     *  @return the total number of iterations that the (iterative) eigenproblem solver has performed over all macro-iterations
+     */
+    size_t numberOfCIIterations() const { return this->number_of_ci_iterations; }
+
+
+private:
+    // PRIVATE METHODS
+
+    /**
+     *  @return the guess vectors for the next iterative DOCI eigenvalue problem: an orthonormal basis for the previous eigenvectors and the most recent vectors of the previous Davidson subspace
+     */
+    MatrixX<double> warmStartGuessVectors() {
+
+        const auto dim = this->onv_basis.dimension();
+
+        // Collect the previous eigenvectors and the requested number of the most recent subspace vectors.
+        const auto V_previous = this->eigenproblem_environment.subspaceVectors();
+        const size_t subspace_dimension = (this->eigenproblem_environment.subspace_dimension > 0) ? this->eigenproblem_environment.subspace_dimension : V_previous.cols();
+        const size_t number_of_retained_vectors = (static_cast<size_t>(V_previous.rows()) == dim) ? std::min(this->number_of_retained_subspace_vectors, subspace_dimension) : 0;
+
+        MatrixX<double> candidates {dim, this->number_of_requested_eigenpairs + number_of_retained_vectors};
+        for (size_t i = 0; i < this->number_of_requested_eigenpairs; i++) {
+            candidates.col(i) = this->m_eigenpairs[i].eigenvector();
+        }
+        candidates.rightCols(number_of_retained_vectors) = V_previous.middleCols(subspace_dimension - number_of_retained_vectors, number_of_retained_vectors);
+
+        // Orthonormalize the candidates with a modified Gram-Schmidt procedure, discarding those that (numerically) lie in the span of the previous ones.
+        MatrixX<double> V {dim, candidates.cols()};
+        size_t number_of_guess_vectors = 0;
+        for (Eigen::Index j = 0; j < candidates.cols(); j++) {
+            VectorX<double> v = candidates.col(j);
+            for (size_t i = 0; i < number_of_guess_vectors; i++) {
+                v -= V.col(i).dot(v) * V.col(i);
+            }
+
+            const double norm = v.norm();
+            if (norm > 1.0e-03) {
+                V.col(number_of_guess_vectors) = v / norm;
+                number_of_guess_vectors++;
+            }
+        }
+
+        return V.leftCols(number_of_guess_vectors);
+    }
+
+
+    // PRIVATE STATIC METHODS
+
+    /**
+     *  Let an iterative eigenproblem solver use the given convergence threshold on the residual vectors.
+     * 
+     *  @param eigenproblem_solver                  the iterative eigenproblem solver
+     *  @param threshold                            the convergence threshold on the residual vectors
+     *  @param number_of_requested_eigenpairs       the number of residual vectors that should be converged
+     */
+    static void updateConvergenceCriterion(IterativeAlgorithm<EigenproblemEnvironment>& eigenproblem_solver, const double threshold, const size_t number_of_requested_eigenpairs) {
+        eigenproblem_solver.replaceConvergenceCriterion(ResidualVectorConvergence<EigenproblemEnvironment>(threshold, number_of_requested_eigenpairs));
+    }
+
+    /**
+     *  Don't change non-iterative eigenproblem solvers: they solve the eigenvalue problem exactly.
+     */
+    template <typename Solver>
+    static void updateConvergenceCriterion(Solver& eigenproblem_solver, const double threshold, const size_t number_of_requested_eigenpairs) {}
+
+
+    /**
+     *  @param eigenproblem_solver                  an iterative eigenproblem solver
+     * 
+     *  @return the number of iterations the eigenproblem solver has performed in its last run
+     */
+    static size_t numberOfIterationsOf(const IterativeAlgorithm<EigenproblemEnvironment>& eigenproblem_solver) { return eigenproblem_solver.numberOfIterations(); }
+
+    /**
+     *  @return zero, since non-iterative eigenproblem solvers don't perform any iterations
+     */
+    template <typename Solver>
+    static size_t numberOfIterationsOf(const Solver& eigenproblem_solver) { return 0; }
+};
+
+
+}  // namespace GQCP
@@ -0,0 +1,103 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "ONVBasis/SpinResolvedSelectedONVBasis.hpp"
+#include "Operator/SecondQuantized/SQHamiltonian.hpp"
+#include "QCMethod/QCStructure.hpp"
+#include "QCModel/CI/LinearExpansion.hpp"
+
+
+namespace GQCP {
+namespace QCMethod {
+
+
+/**
+ *  The heat-bath configuration interaction (HCI) quantum chemical method (Holmes, Tubman, Umrigar (2016)), which grows a selected ONV basis towards the important part of the full ONV basis.
+ *
+ *  Every iteration diagonalizes the Hamiltonian in the current selected ONV basis, after which the basis is expanded with every single and double excitation J of an ONV I for which |<J|H|I> c_I| exceeds the selection threshold. The double excitations are screened through two-electron integrals that are sorted by their magnitude, so that only the important excitations are ever generated. The iterations stop when no new ONVs are selected, or when the energy change drops below the convergence threshold.
+ */
+class HeatBathCI {
+private:
+    // The selection threshold (epsilon_1) on |<J|H|I> c_I|.
+    double selection_threshold;
+
+    // The number of states that are searched for (including the ground state).
+    size_t number_of_states;
+
+    // The maximum number of selection iterations.
+    size_t maximum_number_of_iterations;
+
+    // The threshold on the change in the ground state energy between two iterations.
+    double convergence_threshold;
+
+    // Selected ONV bases whose dimension does not exceed this number are diagonalized densely, larger ones through Davidson's algorithm.
+    size_t maximum_dense_dimension;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param selection_threshold              The selection threshold (epsilon_1) on |<J|H|I> c_I|.
+     *  @param number_of_states                 The number of states that are searched for (including the ground state). An ONV is selected if it is important for any of these states.
+     *  @param maximum_number_of_iterations     The maximum number of selection iterations.
+     *  @param convergence_threshold            The threshold on the change in the ground state energy between two iterations.
+     *  @param maximum_dense_dimension          Selected ONV bases whose dimension does not exceed this number are diagonalized densely, larger ones through Davidson's algorithm.
+     */
+    HeatBathCI(const double selection_threshold, const size_t number_of_states = 1, const size_t maximum_number_of_iterations = 32, const double convergence_threshold = 1.0e-08, const size_t maximum_dense_dimension = 500);
+
+
+    /*
+     *  MARK: Optimization
+     */
+
+    /**
+     *  Optimize the selected ONV basis and the expansion coefficients of the requested states.
+     *
+     *  @param hamiltonian                      A restricted Hamiltonian expressed in an orthonormal orbital basis.
+     *  @param initial_onv_basis                The selected ONV basis that the selection starts from, e.g. containing only the Hartree-Fock ONV.
+     *
+     *  @return The energies and linear expansions of the requested states, expressed in the final selected ONV basis.
+     */
+    QCStructure<LinearExpansion<SpinResolvedSelectedONVBasis>> optimize(const RSQHamiltonian<double>& hamiltonian, const SpinResolvedSelectedONVBasis& initial_onv_basis) const;
+
+
+    /*
+     *  MARK: Perturbative correction
+     */
+
+    /**
+     *  Calculate the Epstein-Nesbet second-order perturbative correction to the energy of a (heat-bath) selected CI state, in which the contributions of the external ONVs are screened with a threshold epsilon_2 that is smaller than the selection threshold.
+     *
+     *  @param hamiltonian                      The restricted Hamiltonian that was used in the selection.
+     *  @param linear_expansion                 The selected CI state.
+     *  @param energy                           The (variational) energy of the selected CI state.
+     *  @param perturbative_threshold           The screening threshold (epsilon_2) on |<A|H|I> c_I|, for external ONVs A.
+     *
+     *  @return The second-order perturbative energy correction.
+     */
+    double calculatePerturbativeCorrection(const RSQHamiltonian<double>& hamiltonian, const LinearExpansion<SpinResolvedSelectedONVBasis>& linear_expansion, const double energy, const double perturbative_threshold) const;
+};
+
+
+}  // namespace QCMethod
+}  // namespace GQCP
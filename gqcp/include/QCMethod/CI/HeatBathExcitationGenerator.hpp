@@ -0,0 +1,114 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/SquareMatrix.hpp"
+#include "Mathematical/Representation/SquareRankFourTensor.hpp"
+#include "Operator/SecondQuantized/SQHamiltonian.hpp"
+
+#include <functional>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A generator of the important single and double excitations of spin-resolved ONVs, for a restricted Hamiltonian. It is the work horse of the heat-bath configuration interaction method (Holmes, Tubman, Umrigar (2016)).
+ *
+ *  For every pair of annihilated spin-orbitals, the pairs of created spin-orbitals are stored together with the magnitude of the corresponding double excitation matrix element, sorted in descending order. The generation of double excitations can then stop as soon as the magnitude drops below the requested threshold.
+ *
+ *  The ONVs are handled through the unsigned representations of their alpha and beta strings, so that no intermediate ONV objects have to be created.
+ */
+class HeatBathExcitationGenerator {
+private:
+    // A pair of created orbitals (p, r), with the magnitude of the matrix element of the double excitation that creates them.
+    struct DoubleExcitation {
+        double magnitude;
+        size_t p;
+        size_t r;
+    };
+
+
+    // The number of spatial orbitals.
+    size_t K;
+
+    // The one-electron integrals.
+    SquareMatrix<double> h;
+
+    // The two-electron integrals, in chemist's notation.
+    SquareRankFourTensor<double> g;
+
+    // For every pair of annihilated orbitals q < s in the same spin string (stored at q * K + s), the pairs of created orbitals p < r in that spin string, sorted by descending magnitude.
+    std::vector<std::vector<DoubleExcitation>> same_spin_excitations;
+
+    // For every pair of an annihilated alpha orbital q and an annihilated beta orbital s (stored at q * K + s), the pairs of a created alpha orbital p and a created beta orbital r, sorted by descending magnitude.
+    std::vector<std::vector<DoubleExcitation>> opposite_spin_excitations;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param hamiltonian          A restricted Hamiltonian expressed in an orthonormal orbital basis. Its integrals should be real and have the full permutational symmetry.
+     */
+    HeatBathExcitationGenerator(const RSQHamiltonian<double>& hamiltonian);
+
+
+    /*
+     *  MARK: Matrix elements
+     */
+
+    /**
+     *  Calculate the matrix element <J|H|I> of the Hamiltonian between two spin-resolved ONVs.
+     *
+     *  @param alpha_J              The unsigned representation of the alpha string of the bra ONV.
+     *  @param beta_J               The unsigned representation of the beta string of the bra ONV.
+     *  @param alpha_I              The unsigned representation of the alpha string of the ket ONV.
+     *  @param beta_I               The unsigned representation of the beta string of the ket ONV.
+     *
+     *  @return The matrix element <J|H|I>.
+     */
+    double calculateMatrixElement(const size_t alpha_J, const size_t beta_J, const size_t alpha_I, const size_t beta_I) const;
+
+
+    /*
+     *  MARK: Excitations
+     */
+
+    /**
+     *  Apply the given callback to every single and double excitation J of the given ONV I whose matrix element |<J|H|I>| exceeds the given threshold.
+     *
+     *  @param alpha_I              The unsigned representation of the alpha string of the ONV.
+     *  @param beta_I               The unsigned representation of the beta string of the ONV.
+     *  @param threshold            The threshold on the magnitude of the matrix elements.
+     *  @param callback             The function that should be called for every important excitation. Its arguments are the unsigned representations of the alpha and beta strings of the excited ONV.
+     */
+    void forEachExcitation(const size_t alpha_I, const size_t beta_I, const double threshold, const std::function<void(const size_t, const size_t)>& callback) const;
+
+    /**
+     *  @return The number of spatial orbitals.
+     */
+    size_t numberOfOrbitals() const { return this->K; }
+};
+
+
+}  // namespace GQCP
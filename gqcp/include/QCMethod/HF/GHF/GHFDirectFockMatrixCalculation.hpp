@@ -0,0 +1,131 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/DirectJKCalculator.hpp"
+#include "Mathematical/Algorithm/Step.hpp"
+#include "QCMethod/HF/GHF/GHFSCFEnvironment.hpp"
+
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the current GHF Fock matrix (expressed in the scalar/AO basis) from the current density matrix, calculating the two-electron integrals on the fly instead of reading them from the Hamiltonian ('direct SCF').
+ * 
+ *  In terms of the spin blocks of the density matrix P, the spin blocks of the two-electron part G(P) of the Fock matrix are
+ *      G_{sigma sigma} = J(P_{alpha alpha}) + J(P_{beta beta}) - K(P_{sigma sigma}),
+ *      G_{alpha beta} = -K(P_{beta alpha}) = G_{beta alpha}^T,
+ *  which only require the Coulomb repulsion integrals over the (common) scalar basis of the alpha and beta components. G(P) is linear in the density matrix, so it is built incrementally from the changes in the density matrix. After a fixed number of incremental builds, it is rebuilt from the full density matrix. The state of the incremental builds is kept in the environment.
+ * 
+ *  @note The alpha and beta components of the spinors should be expanded in the same scalar basis, i.e. the one of the given calculator for the Coulomb and exchange matrices.
+ */
+class GHFDirectFockMatrixCalculation:
+    public Step<GHFSCFEnvironment<double>> {
+
+public:
+    using Scalar = double;
+    using Environment = GHFSCFEnvironment<Scalar>;
+
+
+private:
+    // The calculator for the Coulomb and exchange matrices.
+    DirectJKCalculator jk_calculator;
+
+    // The number of incremental builds after which the two-electron part of the Fock matrix is rebuilt from the full density matrix.
+    size_t rebuild_interval;
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param jk_calculator            The calculator for the Coulomb and exchange matrices, in the scalar basis of the alpha and beta components of the spinors.
+     *  @param rebuild_interval         The number of incremental builds after which the two-electron part of the Fock matrix is rebuilt from the full density matrix. If zero, every build is a full build.
+     */
+    GHFDirectFockMatrixCalculation(const DirectJKCalculator& jk_calculator, const size_t rebuild_interval = 8) :
+        jk_calculator {jk_calculator},
+        rebuild_interval {rebuild_interval} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return A textual description of this algorithmic step.
+     */
+    std::string description() const override {
+        return "Calculate the current GHF Fock matrix (expressed in the scalar/AO basis) with on-the-fly two-electron integrals and place it in the environment.";
+    }
+
+
+    /**
+     *  Calculate the current GHF Fock matrix (expressed in the scalar/AO basis) with on-the-fly two-electron integrals and place it in the environment.
+     * 
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void execute(Environment& environment) override {
+
+        const SquareMatrix<double> P = environment.density_matrices.back();  // The most recent density matrix.
+
+        const auto K = this->jk_calculator.numberOfBasisFunctions();
+        if (P.dimension() != 2 * K) {
+            throw std::invalid_argument("GHFDirectFockMatrixCalculation::execute(Environment&): The dimension of the density matrix is incompatible with the scalar basis of the calculator for the Coulomb and exchange matrices.");
+        }
+
+
+        // Decide if we can build the two-electron part incrementally, i.e. from the change in the density matrix.
+        const auto is_incremental = (environment.incremental_density_matrix.dimension() == P.dimension()) && (environment.number_of_incremental_builds < this->rebuild_interval);
+        const SquareMatrix<double> P_build = is_incremental ? SquareMatrix<double>(P - environment.incremental_density_matrix) : P;
+
+        const std::vector<SquareMatrix<double>> P_blocks {SquareMatrix<double>(P_build.topLeftCorner(K, K)),
+                                                          SquareMatrix<double>(P_build.bottomRightCorner(K, K)),
+                                                          SquareMatrix<double>(P_build.bottomLeftCorner(K, K))};
+        const auto JK = this->jk_calculator.calculate(P_blocks);
+        const SquareMatrix<double> J = JK.first[0] + JK.first[1];
+
+        SquareMatrix<double> G = SquareMatrix<double>::Zero(2 * K);
+        G.topLeftCorner(K, K) = J - JK.second[0];
+        G.bottomRightCorner(K, K) = J - JK.second[1];
+        G.topRightCorner(K, K) = -JK.second[2];
+        G.bottomLeftCorner(K, K) = -JK.second[2].transpose();
+
+        if (is_incremental) {
+            G += environment.incremental_G;
+            environment.number_of_incremental_builds++;
+        } else {
+            environment.number_of_incremental_builds = 0;
+        }
+
+        environment.incremental_density_matrix = P;
+        environment.incremental_G = G;
+
+
+        const auto& H_core = environment.H_core.parameters();
+        environment.fock_matrices.push_back(ScalarGSQOneElectronOperator<double> {H_core + G});
+    }
+};
+
+
+}  // namespace GQCP
@@ -62,7 +62,7 @@ public:
 
         const auto& P = environment.density_matrices.back();                              // The most recent density matrix.
         const ScalarGSQOneElectronOperator<Scalar> F {environment.fock_matrices.back()};  // The most recent Fock matrix.
-        const auto& H_core = environment.sq_hamiltonian.core();                           // The core Hamiltonian matrix.
+        const auto& H_core = environment.H_core;                                          // The core Hamiltonian matrix.
 
         const auto E_electronic = QCModel::GHF<Scalar>::calculateElectronicEnergy(P, H_core, F);
         environment.electronic_energies.push_back(E_electronic);
@@ -24,9 +24,9 @@
 #include "Operator/SecondQuantized/GSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 
-#include <Eigen/Dense>
+#include "Utilities/BoundedHistory.hpp"
 
-#include <deque>
+#include <Eigen/Dense>
 
 
 namespace GQCP {
@@ -37,6 +37,8 @@ namespace GQCP {
  * 
  *  We can basically view it as a compile-time type-safe std::map with all possible information that can be encountered in an GHF SCF algorithm.
  * 
+ *  Only the most recent iterates are kept: every quantity is stored in a bounded history, whose capacity should be at least the maximum subspace dimension of the DIIS steps that are used.
+ * 
  *  @tparam _Scalar             The scalar type that is used for the coefficient matrix/expansion coefficients: real or complex.
  */
 template <typename _Scalar>
@@ -48,18 +50,25 @@ public:
 public:
     size_t N;  // The total number of electrons.
 
-    std::deque<Scalar> electronic_energies;
+    BoundedHistory<Scalar> electronic_energies;
 
-    std::deque<VectorX<Scalar>> orbital_energies;
+    BoundedHistory<VectorX<Scalar>> orbital_energies;
 
     ScalarGSQOneElectronOperator<Scalar> S;  // The overlap operator (of both scalar (AO) bases), expressed in spin-blocked notation.
 
-    std::deque<GTransformation<Scalar>> coefficient_matrices;
-    std::deque<G1DM<Scalar>> density_matrices;                       // Expressed in the scalar (AO) basis.
-    std::deque<ScalarGSQOneElectronOperator<Scalar>> fock_matrices;  // Expressed in the scalar (AO) basis.
-    std::deque<VectorX<Scalar>> error_vectors;                       // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
+    BoundedHistory<GTransformation<Scalar>> coefficient_matrices;
+    BoundedHistory<G1DM<Scalar>> density_matrices;                       // Expressed in the scalar (AO) basis.
+    BoundedHistory<ScalarGSQOneElectronOperator<Scalar>> fock_matrices;  // Expressed in the scalar (AO) basis.
+    BoundedHistory<VectorX<Scalar>> error_vectors;                       // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
+
+    GSQHamiltonian<Scalar> sq_hamiltonian;  // The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a GSpinorBasis. It is empty if the environment was initialized from the core Hamiltonian only.
 
-    GSQHamiltonian<Scalar> sq_hamiltonian;  // The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a GSpinorBasis.
+    ScalarGSQOneElectronOperator<Scalar> H_core;  // The core Hamiltonian expressed in the scalar (AO) basis, in spin-blocked notation.
+
+    // The state of the incremental builds of the two-electron part of the Fock matrix, as used in direct SCF.
+    size_t number_of_incremental_builds = 0;          // The number of incremental builds since the last full build.
+    SquareMatrix<Scalar> incremental_density_matrix;  // The density matrix from which the most recent two-electron part of the Fock matrix was calculated.
+    SquareMatrix<Scalar> incremental_G;               // The most recent two-electron part of the Fock matrix, expressed in the scalar (AO) basis.
 
 
 public:
@@ -74,12 +83,38 @@ public:
      *  @param sq_hamiltonian       The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a GSpinorBasis.
      *  @param S                    The overlap operator (of both scalar (AO) bases), expressed in spin-blocked notation.
      *  @param C_initial            The initial coefficient matrix.
+     *  @param history_capacity     The number of iterations for which the iterates are kept.
+     */
+    GHFSCFEnvironment(const size_t N, const GSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarGSQOneElectronOperator<Scalar>& S, const GTransformation<Scalar>& C_initial, const size_t history_capacity = 8) :
+        GHFSCFEnvironment(N, sq_hamiltonian.core(), S, C_initial, history_capacity) {
+
+        this->sq_hamiltonian = sq_hamiltonian;
+    }
+
+
+    /**
+     *  A constructor that initializes the environment with an initial guess for the coefficient matrix, without requiring the two-electron integrals. Such an environment can only be used with SCF solvers that don't read the two-electron integrals from the Hamiltonian, i.e. the direct and density-fitted ones.
+     * 
+     *  @param N                    The total number of electrons.
+     *  @param H_core               The core Hamiltonian expressed in the scalar (AO) basis, in spin-blocked notation.
+     *  @param S                    The overlap operator (of both scalar (AO) bases), expressed in spin-blocked notation.
+     *  @param C_initial            The initial coefficient matrix.
+     *  @param history_capacity     The number of iterations for which the iterates are kept.
      */
-    GHFSCFEnvironment(const size_t N, const GSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarGSQOneElectronOperator<Scalar>& S, const GTransformation<Scalar>& C_initial) :
+    GHFSCFEnvironment(const size_t N, const ScalarGSQOneElectronOperator<Scalar>& H_core, const ScalarGSQOneElectronOperator<Scalar>& S, const GTransformation<Scalar>& C_initial, const size_t history_capacity = 8) :
         N {N},
+        electronic_energies {history_capacity},
+        orbital_energies {history_capacity},
         S {S},
-        sq_hamiltonian {sq_hamiltonian},
-        coefficient_matrices {C_initial} {}
+        coefficient_matrices {history_capacity},
+        density_matrices {history_capacity},
+        fock_matrices {history_capacity},
+        error_vectors {history_capacity},
+        sq_hamiltonian {ScalarGSQOneElectronOperator<Scalar>::Zero(0), ScalarGSQTwoElectronOperator<Scalar>::Zero(0)},
+        H_core {H_core} {
+
+        this->coefficient_matrices.push_back(C_initial);
+    }
 
 
     /*
@@ -92,8 +127,9 @@ public:
      *  @param N                    The total number of electrons.
      *  @param sq_hamiltonian       The Hamiltonian expressed in the scalar (AO) basis, resulting from a quantization using a GSpinorBasis.
      *  @param S                    The overlap operator (of both scalar (AO) bases), expressed in spin-blocked notation.
+     *  @param history_capacity     The number of iterations for which the iterates are kept.
      */
-    static GHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N, const GSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarGSQOneElectronOperator<Scalar>& S) {
+    static GHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N, const GSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarGSQOneElectronOperator<Scalar>& S, const size_t history_capacity = 8) {
 
         const auto& H_core = sq_hamiltonian.core().parameters();  // Spin-blocked, in AO basis.
 
@@ -101,7 +137,25 @@ public:
         Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver {H_core, S.parameters()};
         const GTransformation<Scalar> C_initial {generalized_eigensolver.eigenvectors()};
 
-        return GHFSCFEnvironment<Scalar>(N, sq_hamiltonian, S, C_initial);
+        return GHFSCFEnvironment<Scalar>(N, sq_hamiltonian, S, C_initial, history_capacity);
+    }
+
+
+    /**
+     *  Initialize an GHF SCF environment from the core Hamiltonian only, with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix. Such an environment can only be used with SCF solvers that don't read the two-electron integrals from the Hamiltonian, i.e. the direct and density-fitted ones.
+     * 
+     *  @param N                    The total number of electrons.
+     *  @param H_core               The core Hamiltonian expressed in the scalar (AO) basis, in spin-blocked notation.
+     *  @param S                    The overlap operator (of both scalar (AO) bases), expressed in spin-blocked notation.
+     *  @param history_capacity     The number of iterations for which the iterates are kept.
+     */
+    static GHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N, const ScalarGSQOneElectronOperator<Scalar>& H_core, const ScalarGSQOneElectronOperator<Scalar>& S, const size_t history_capacity = 8) {
+
+        using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver {H_core.parameters(), S.parameters()};
+        const GTransformation<Scalar> C_initial {generalized_eigensolver.eigenvectors()};
+
+        return GHFSCFEnvironment<Scalar>(N, H_core, S, C_initial, history_capacity);
     }
 };
 
@@ -20,7 +20,9 @@
 
 #include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
 #include "Mathematical/Optimization/ConsecutiveIteratesNormConvergence.hpp"
+#include "QCMethod/HF/GHF/GHFDensityFittedFockMatrixCalculation.hpp"
 #include "QCMethod/HF/GHF/GHFDensityMatrixCalculation.hpp"
+#include "QCMethod/HF/GHF/GHFDirectFockMatrixCalculation.hpp"
 #include "QCMethod/HF/GHF/GHFElectronicEnergyCalculation.hpp"
 #include "QCMethod/HF/GHF/GHFErrorCalculation.hpp"
 #include "QCMethod/HF/GHF/GHFFockMatrixCalculation.hpp"
@@ -65,9 +67,9 @@ public:
             .add(GHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const auto density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const auto density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) -> const BoundedHistory<G1DM<Scalar>>& { return environment.density_matrices; };
 
-        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>>;
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>, BoundedHistory<G1DM<Scalar>>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the GHF density matrix in AO basis"};
 
         return IterativeAlgorithm<GHFSCFEnvironment<Scalar>>(plain_ghf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
@@ -94,13 +96,73 @@ public:
             .add(GHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const std::function<std::deque<G1DM<Scalar>>(const GHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const auto density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) -> const BoundedHistory<G1DM<Scalar>>& { return environment.density_matrices; };
 
-        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>>;
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>, BoundedHistory<G1DM<Scalar>>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the GHF density matrix in AO basis"};
 
         return IterativeAlgorithm<GHFSCFEnvironment<Scalar>>(diis_ghf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
     }
+
+
+    /**
+     *  @param jk_calculator                        The calculator for the Coulomb and exchange matrices, which calculates the two-electron integrals on the fly.
+     *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A direct DIIS GHF SCF solver that calculates the two-electron integrals on the fly and uses the norm of the difference of two consecutive density matrices as a convergence criterion.
+     */
+    static IterativeAlgorithm<GHFSCFEnvironment<Scalar>> DirectDIIS(const DirectJKCalculator& jk_calculator, const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' a direct DIIS GHF SCF solver.
+        StepCollection<GHFSCFEnvironment<Scalar>> direct_diis_ghf_scf_cycle {};
+        direct_diis_ghf_scf_cycle
+            .add(GHFDensityMatrixCalculation<Scalar>())
+            .add(GHFDirectFockMatrixCalculation(jk_calculator))
+            .add(GHFErrorCalculation<Scalar>())
+            .add(GHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension))  // This also calculates the next coefficient matrix.
+            .add(GHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const auto density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) -> const BoundedHistory<G1DM<Scalar>>& { return environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>, BoundedHistory<G1DM<Scalar>>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the GHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<GHFSCFEnvironment<Scalar>>(direct_diis_ghf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
+    /**
+     *  @param jk_calculator                        The calculator for the Coulomb and exchange matrices, which uses density-fitted two-electron integrals.
+     *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A density-fitted DIIS GHF SCF solver that approximates the two-electron integrals through density fitting and uses the norm of the difference of two consecutive density matrices as a convergence criterion.
+     */
+    static IterativeAlgorithm<GHFSCFEnvironment<Scalar>> DensityFittedDIIS(const DensityFittedJKCalculator& jk_calculator, const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' a density-fitted DIIS GHF SCF solver.
+        StepCollection<GHFSCFEnvironment<Scalar>> density_fitted_diis_ghf_scf_cycle {};
+        density_fitted_diis_ghf_scf_cycle
+            .add(GHFDensityMatrixCalculation<Scalar>())
+            .add(GHFDensityFittedFockMatrixCalculation(jk_calculator))
+            .add(GHFErrorCalculation<Scalar>())
+            .add(GHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension))  // This also calculates the next coefficient matrix.
+            .add(GHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const auto density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) -> const BoundedHistory<G1DM<Scalar>>& { return environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>, BoundedHistory<G1DM<Scalar>>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the GHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<GHFSCFEnvironment<Scalar>>(density_fitted_diis_ghf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
 };
 
 
@@ -0,0 +1,94 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/DensityFittedJKCalculator.hpp"
+#include "Mathematical/Algorithm/Step.hpp"
+#include "QCMethod/HF/RHF/RHFSCFEnvironment.hpp"
+
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the current RHF Fock matrix (expressed in the scalar/AO basis) from the current density matrix, using density-fitted two-electron integrals instead of reading them from the Hamiltonian.
+ * 
+ *  The two-electron part of the Fock matrix is G(D) = J(D) - 1/2 K(D). Since the cost of a density-fitted build doesn't depend on the magnitude of the density matrix, it is rebuilt from the full density matrix in every iteration.
+ */
+class RHFDensityFittedFockMatrixCalculation:
+    public Step<RHFSCFEnvironment<double>> {
+
+public:
+    using Scalar = double;
+    using Environment = RHFSCFEnvironment<Scalar>;
+
+
+private:
+    // The calculator for the Coulomb and exchange matrices.
+    DensityFittedJKCalculator jk_calculator;
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param jk_calculator            The calculator for the Coulomb and exchange matrices, in the scalar basis of the SCF environment.
+     */
+    RHFDensityFittedFockMatrixCalculation(const DensityFittedJKCalculator& jk_calculator) :
+        jk_calculator {jk_calculator} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return A textual description of this algorithmic step.
+     */
+    std::string description() const override {
+        return "Calculate the current RHF Fock matrix (expressed in the scalar/AO basis) with density-fitted two-electron integrals and place it in the environment.";
+    }
+
+
+    /**
+     *  Calculate the current RHF Fock matrix (expressed in the scalar/AO basis) with density-fitted two-electron integrals and place it in the environment.
+     * 
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void execute(Environment& environment) override {
+
+        const SquareMatrix<double> D = environment.density_matrices.back();  // The most recent density matrix.
+        if (D.dimension() != this->jk_calculator.numberOfBasisFunctions()) {
+            throw std::invalid_argument("RHFDensityFittedFockMatrixCalculation::execute(Environment&): The dimension of the density matrix is incompatible with the scalar basis of the calculator for the Coulomb and exchange matrices.");
+        }
+
+        const auto JK = this->jk_calculator.calculate({D});
+        const SquareMatrix<double> G = JK.first[0] - 0.5 * JK.second[0];
+
+        const auto& H_core = environment.H_core.parameters();
+        environment.fock_matrices.push_back(ScalarRSQOneElectronOperator<double> {H_core + G});
+    }
+};
+
+
+}  // namespace GQCP
@@ -81,13 +81,11 @@ public:
         }
 
         // Get the two most recent density matrices and produce an accelerated density matrix.
-        const auto second_to_last_it = environment.density_matrices.end() - 2;
-        const auto& D_previous = *second_to_last_it;  // Dereference the iterator.
-        const auto D_current = environment.density_matrices.back();
+        const auto& D_previous = environment.density_matrices[environment.density_matrices.size() - 2];
+        auto& D_current = environment.density_matrices.back();
 
-        const auto D_accelerated = this->damper.accelerate(D_current, D_previous);
-        environment.density_matrices.pop_back();  // We will replace the most recent density matrix with the accelerated one, so remove the most recent one.
-        environment.density_matrices.push_back(D_accelerated);
+        // Replace the most recent density matrix with the accelerated one.
+        D_current = this->damper.accelerate(D_current, D_previous);
     }
 };
 
@@ -0,0 +1,109 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/DirectJKCalculator.hpp"
+#include "Mathematical/Algorithm/Step.hpp"
+#include "QCMethod/HF/RHF/RHFSCFEnvironment.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the current Fock matrix (expressed in the scalar/AO basis) from the current density matrix, calculating the two-electron integrals on the fly instead of reading them from the Hamiltonian ('direct SCF').
+ * 
+ *  The two-electron part G(D) = J(D) - 1/2 K(D) of the Fock matrix is linear in the density matrix, so it is built incrementally: G(D_n) = G(D_{n-1}) + G(D_n - D_{n-1}). Since the density-weighted integral screening becomes more effective as the density matrix changes less, later iterations are much cheaper. To avoid the accumulation of numerical noise, the two-electron part is rebuilt from the full density matrix after a fixed number of incremental builds. The state of the incremental builds is kept in the environment.
+ */
+class RHFDirectFockMatrixCalculation:
+    public Step<RHFSCFEnvironment<double>> {
+
+public:
+    using Scalar = double;
+    using Environment = RHFSCFEnvironment<Scalar>;
+
+
+private:
+    // The calculator for the Coulomb and exchange matrices.
+    DirectJKCalculator jk_calculator;
+
+    // The number of incremental builds after which the two-electron part of the Fock matrix is rebuilt from the full density matrix.
+    size_t rebuild_interval;
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param jk_calculator            The calculator for the Coulomb and exchange matrices, in the scalar basis of the SCF environment.
+     *  @param rebuild_interval         The number of incremental builds after which the two-electron part of the Fock matrix is rebuilt from the full density matrix. If zero, every build is a full build.
+     */
+    RHFDirectFockMatrixCalculation(const DirectJKCalculator& jk_calculator, const size_t rebuild_interval = 8) :
+        jk_calculator {jk_calculator},
+        rebuild_interval {rebuild_interval} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return A textual description of this algorithmic step.
+     */
+    std::string description() const override {
+        return "Calculate the current RHF Fock matrix (expressed in the scalar/AO basis) with on-the-fly two-electron integrals and place it in the environment.";
+    }
+
+
+    /**
+     *  Calculate the current RHF Fock matrix (expressed in the scalar/AO basis) with on-the-fly two-electron integrals and place it in the environment.
+     * 
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void execute(Environment& environment) override {
+
+        const SquareMatrix<double> D = environment.density_matrices.back();  // The most recent density matrix.
+
+        // Decide if we can build the two-electron part incrementally, i.e. from the change in the density matrix.
+        const auto is_incremental = (environment.incremental_density_matrix.dimension() == D.dimension()) && (environment.number_of_incremental_builds < this->rebuild_interval);
+        const SquareMatrix<double> D_build = is_incremental ? SquareMatrix<double>(D - environment.incremental_density_matrix) : D;
+
+        const auto JK = this->jk_calculator.calculate({D_build});
+        SquareMatrix<double> G = JK.first[0] - 0.5 * JK.second[0];
+
+        if (is_incremental) {
+            G += environment.incremental_G;
+            environment.number_of_incremental_builds++;
+        } else {
+            environment.number_of_incremental_builds = 0;
+        }
+
+        environment.incremental_density_matrix = D;
+        environment.incremental_G = G;
+
+
+        const auto& H_core = environment.H_core.parameters();
+        environment.fock_matrices.push_back(ScalarRSQOneElectronOperator<double> {H_core + G});
+    }
+};
+
+
+}  // namespace GQCP
@@ -25,6 +25,7 @@
 #include "QCModel/HF/RHF.hpp"
 
 #include <algorithm>
+#include <stdexcept>
 
 
 namespace GQCP {
@@ -84,6 +85,10 @@ public:
      */
     void execute(Environment& environment) override {
 
+        if (environment.error_vectors.capacity() < this->maximum_subspace_dimension) {
+            throw std::invalid_argument("RHFFockMatrixDIIS<Scalar>::execute(Environment&): The histories in the environment can't hold as many iterations as the maximum subspace dimension.");
+        }
+
         if (environment.error_vectors.size() < this->minimum_subspace_dimension) {
 
             // No acceleration is possible, so calculate the regular Fock matrix and diagonalize it.
@@ -92,17 +97,14 @@ public:
             return;
         }
 
-        // Convert the deques in the environment to vectors that can be accepted by the DIIS accelerator. The total number of elements we can use in DIIS is either the maximum subspace dimension or the number of available error matrices.
+        // The total number of elements we can use in DIIS is either the maximum subspace dimension or the number of available error matrices. The DIIS accelerator reads them directly from the environment's histories.
         const auto n = std::min(this->maximum_subspace_dimension, environment.error_vectors.size());
-        const std::vector<VectorX<Scalar>> error_vectors {environment.error_vectors.end() - n, environment.error_vectors.end()};                       // The n-th last error vectors.
-        const std::vector<ScalarRSQOneElectronOperator<Scalar>> fock_matrices {environment.fock_matrices.end() - n, environment.fock_matrices.end()};  // The n-th last Fock matrices.
+        const auto error_vectors = environment.error_vectors.latest(n);  // The n-th last error vectors.
+        const auto fock_matrices = environment.fock_matrices.latest(n);  // The n-th last Fock matrices.
 
-        // Calculate the accelerated Fock matrix and do a diagonalization step on it.
+        // Calculate the accelerated Fock matrix and do a diagonalization step on it. The accelerated/extrapolated Fock matrix is not stored in the environment, as it should not be used in further extrapolation steps: it is not created from a density matrix.
         const auto F_accelerated = this->diis.accelerate(fock_matrices, error_vectors);
-
-        environment.fock_matrices.push_back(F_accelerated);  // The diagonalization step can only read from the environment.
-        RHFFockMatrixDiagonalization<Scalar>().execute(environment);
-        environment.fock_matrices.pop_back();  // The accelerated/extrapolated Fock matrix should not be used in further extrapolation steps, as it is not created from a density matrix.
+        RHFFockMatrixDiagonalization<Scalar>().diagonalize(F_accelerated, environment);
     }
 };
 
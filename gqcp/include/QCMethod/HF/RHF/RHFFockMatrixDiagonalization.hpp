@@ -60,11 +60,24 @@ public:
      *  @param environment              The environment that acts as a sort of calculation space.
      */
     void execute(Environment& environment) override {
+        this->diagonalize(environment.fock_matrices.back(), environment);
+    }
+
+
+    /*
+     *  PUBLIC METHODS
+     */
 
-        const auto& F = environment.fock_matrices.back().parameters();  // The most recent scalar/AO basis Fock matrix.
+    /**
+     *  Solve the generalized eigenvalue problem for the given scalar/AO Fock matrix. Add the associated coefficient matrix and orbital energies to the environment.
+     * 
+     *  @param F                        The scalar/AO basis Fock matrix, which doesn't have to be stored in the environment (e.g. an extrapolated one).
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void diagonalize(const ScalarRSQOneElectronOperator<Scalar>& F, Environment& environment) const {
 
         using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
-        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver {F, environment.S.parameters()};
+        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver {F.parameters(), environment.S.parameters()};
         const RTransformation<Scalar>& C {generalized_eigensolver.eigenvectors()};
         const auto& orbital_energies = generalized_eigensolver.eigenvalues();
 
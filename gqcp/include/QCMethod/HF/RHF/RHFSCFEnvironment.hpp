@@ -24,9 +24,9 @@
 #include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 
-#include <Eigen/Dense>
+#include "Utilities/BoundedHistory.hpp"
 
-#include <deque>
+#include <Eigen/Dense>
 
 
 namespace GQCP {
@@ -37,6 +37,8 @@ namespace GQCP {
  * 
  *  We can basically view it as a compile-time type-safe std::map with all possible information that can be encountered in an RHF SCF algorithm.
  * 
+ *  Only the most recent iterates are kept: every quantity is stored in a bounded history, whose capacity should be at least the maximum subspace dimension of the DIIS steps that are used.
+ * 
  *  @tparam _Scalar             The scalar type that is used for the coefficient matrix/expansion coefficients: real or complex.
  */
 template <typename _Scalar>
@@ -48,18 +50,25 @@ public:
 public:
     size_t N;  // The total number of electrons.
 
-    std::deque<double> electronic_energies;
+    BoundedHistory<double> electronic_energies;
 
-    std::deque<VectorX<double>> orbital_energies;
+    BoundedHistory<VectorX<double>> orbital_energies;
 
     ScalarRSQOneElectronOperator<Scalar> S;  // The overlap matrix (of the scalar (AO) basis).
 
-    std::deque<RTransformation<Scalar>> coefficient_matrices;
-    std::deque<Orbital1DM<Scalar>> density_matrices;                 // Expressed in the scalar (AO) basis.
-    std::deque<ScalarRSQOneElectronOperator<Scalar>> fock_matrices;  // Expressed in the scalar (AO) basis.
-    std::deque<VectorX<Scalar>> error_vectors;                       // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
+    BoundedHistory<RTransformation<Scalar>> coefficient_matrices;
+    BoundedHistory<Orbital1DM<Scalar>> density_matrices;                 // Expressed in the scalar (AO) basis.
+    BoundedHistory<ScalarRSQOneElectronOperator<Scalar>> fock_matrices;  // Expressed in the scalar (AO) basis.
+    BoundedHistory<VectorX<Scalar>> error_vectors;                       // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
+
+    RSQHamiltonian<Scalar> sq_hamiltonian;  // The Hamiltonian expressed in the scalar (AO) basis. It is empty if the environment was initialized from the core Hamiltonian only.
 
-    RSQHamiltonian<Scalar> sq_hamiltonian;  // The Hamiltonian expressed in the scalar (AO) basis.
+    ScalarRSQOneElectronOperator<Scalar> H_core;  // The core Hamiltonian expressed in the scalar (AO) basis.
+
+    // The state of the incremental builds of the two-electron part of the Fock matrix, as used in direct SCF.
+    size_t number_of_incremental_builds = 0;          // The number of incremental builds since the last full build.
+    SquareMatrix<Scalar> incremental_density_matrix;  // The density matrix from which the most recent two-electron part of the Fock matrix was calculated.
+    SquareMatrix<Scalar> incremental_G;               // The most recent two-electron part of the Fock matrix, expressed in the scalar (AO) basis.
 
 
 public:
@@ -74,15 +83,40 @@ public:
      *  @param sq_hamiltonian       The Hamiltonian expressed in the scalar (AO) basis.
      *  @param S                    The overlap matrix (of the scalar (AO) basis).
      *  @param C_initial            The initial coefficient matrix.
+     *  @param history_capacity     The number of iterations for which the iterates are kept.
+     */
+    RHFSCFEnvironment(const size_t N, const RSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarRSQOneElectronOperator<Scalar>& S, const RTransformation<Scalar>& C_initial, const size_t history_capacity = 8) :
+        RHFSCFEnvironment(N, sq_hamiltonian.core(), S, C_initial, history_capacity) {
+
+        this->sq_hamiltonian = sq_hamiltonian;
+    }
+
+
+    /**
+     *  A constructor that initializes the environment with an initial guess for the coefficient matrix, without requiring the two-electron integrals. Such an environment can only be used with SCF solvers that don't read the two-electron integrals from the Hamiltonian, i.e. the direct and density-fitted ones.
+     * 
+     *  @param N                    The total number of electrons.
+     *  @param H_core               The core Hamiltonian expressed in the scalar (AO) basis.
+     *  @param S                    The overlap matrix (of the scalar (AO) basis).
+     *  @param C_initial            The initial coefficient matrix.
+     *  @param history_capacity     The number of iterations for which the iterates are kept.
      */
-    RHFSCFEnvironment(const size_t N, const RSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarRSQOneElectronOperator<Scalar>& S, const RTransformation<Scalar>& C_initial) :
+    RHFSCFEnvironment(const size_t N, const ScalarRSQOneElectronOperator<Scalar>& H_core, const ScalarRSQOneElectronOperator<Scalar>& S, const RTransformation<Scalar>& C_initial, const size_t history_capacity = 8) :
         N {N},
+        electronic_energies {history_capacity},
+        orbital_energies {history_capacity},
         S {S},
-        sq_hamiltonian {sq_hamiltonian},
-        coefficient_matrices {C_initial} {
+        coefficient_matrices {history_capacity},
+        density_matrices {history_capacity},
+        fock_matrices {history_capacity},
+        error_vectors {history_capacity},
+        sq_hamiltonian {ScalarRSQOneElectronOperator<Scalar>::Zero(0), ScalarRSQTwoElectronOperator<Scalar>::Zero(0)},
+        H_core {H_core} {
+
+        this->coefficient_matrices.push_back(C_initial);
 
         if (this->N % 2 != 0) {  // If the total number of electrons is odd.
-            throw std::invalid_argument("RHFSCFEnvironment::RHFSCFEnvironment(const size_t, const RSQHamiltonian<Scalar>&, const SquareMatrix<Scalar>&, const RTransformation<Scalar>&): You have given an odd number of electrons.");
+            throw std::invalid_argument("RHFSCFEnvironment::RHFSCFEnvironment(const size_t, const ScalarRSQOneElectronOperator<Scalar>&, const ScalarRSQOneElectronOperator<Scalar>&, const RTransformation<Scalar>&, const size_t): You have given an odd number of electrons.");
         }
     }
 
@@ -97,8 +131,9 @@ public:
      *  @param N                    The total number of electrons.
      *  @param sq_hamiltonian       The Hamiltonian expressed in the scalar (AO) basis.
      *  @param S                    The overlap operator (of the scalar (AO) basis).
+     *  @param history_capacity     The number of iterations for which the iterates are kept.
      */
-    static RHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N, const RSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarRSQOneElectronOperator<Scalar>& S) {
+    static RHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N, const RSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarRSQOneElectronOperator<Scalar>& S, const size_t history_capacity = 8) {
 
         const auto& H_core = sq_hamiltonian.core().parameters();  // In AO basis.
 
@@ -106,7 +141,25 @@ public:
         Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver {H_core, S.parameters()};
         const RTransformation<Scalar> C_initial {generalized_eigensolver.eigenvectors()};
 
-        return RHFSCFEnvironment<Scalar>(N, sq_hamiltonian, S, C_initial);
+        return RHFSCFEnvironment<Scalar>(N, sq_hamiltonian, S, C_initial, history_capacity);
+    }
+
+
+    /**
+     *  Initialize an RHF SCF environment from the core Hamiltonian only, with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix. Such an environment can only be used with SCF solvers that don't read the two-electron integrals from the Hamiltonian, i.e. the direct and density-fitted ones.
+     * 
+     *  @param N                    The total number of electrons.
+     *  @param H_core               The core Hamiltonian expressed in the scalar (AO) basis.
+     *  @param S                    The overlap operator (of the scalar (AO) basis).
+     *  @param history_capacity     The number of iterations for which the iterates are kept.
+     */
+    static RHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N, const ScalarRSQOneElectronOperator<Scalar>& H_core, const ScalarRSQOneElectronOperator<Scalar>& S, const size_t history_capacity = 8) {
+
+        using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver {H_core.parameters(), S.parameters()};
+        const RTransformation<Scalar> C_initial {generalized_eigensolver.eigenvectors()};
+
+        return RHFSCFEnvironment<Scalar>(N, H_core, S, C_initial, history_capacity);
     }
 };
 
@@ -20,8 +20,10 @@
 
 #include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
 #include "Mathematical/Optimization/ConsecutiveIteratesNormConvergence.hpp"
+#include "QCMethod/HF/RHF/RHFDensityFittedFockMatrixCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFDensityMatrixCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFDensityMatrixDamper.hpp"
+#include "QCMethod/HF/RHF/RHFDirectFockMatrixCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFElectronicEnergyCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFErrorCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFFockMatrixCalculation.hpp"
@@ -68,9 +70,9 @@ public:
             .add(RHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const std::function<std::deque<Orbital1DM<Scalar>>(const RHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const auto density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const BoundedHistory<Orbital1DM<Scalar>>& { return environment.density_matrices; };
 
-        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>>;
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>, BoundedHistory<Orbital1DM<Scalar>>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
 
         return IterativeAlgorithm<RHFSCFEnvironment<Scalar>>(damped_rhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
@@ -97,15 +99,75 @@ public:
             .add(RHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const std::function<std::deque<Orbital1DM<Scalar>>(const RHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const auto density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const BoundedHistory<Orbital1DM<Scalar>>& { return environment.density_matrices; };
 
-        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>>;
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>, BoundedHistory<Orbital1DM<Scalar>>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
 
         return IterativeAlgorithm<RHFSCFEnvironment<Scalar>>(diis_rhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
     }
 
 
+    /**
+     *  @param jk_calculator                        The calculator for the Coulomb and exchange matrices, which calculates the two-electron integrals on the fly.
+     *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A direct DIIS RHF SCF solver that calculates the two-electron integrals on the fly and uses the norm of the difference of two consecutive density matrices as a convergence criterion.
+     */
+    static IterativeAlgorithm<RHFSCFEnvironment<Scalar>> DirectDIIS(const DirectJKCalculator& jk_calculator, const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' a direct DIIS RHF SCF solver.
+        StepCollection<RHFSCFEnvironment<Scalar>> direct_diis_rhf_scf_cycle {};
+        direct_diis_rhf_scf_cycle
+            .add(RHFDensityMatrixCalculation<Scalar>())
+            .add(RHFDirectFockMatrixCalculation(jk_calculator))
+            .add(RHFErrorCalculation<Scalar>())
+            .add(RHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension))  // This also calculates the next coefficient matrix.
+            .add(RHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const auto density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const BoundedHistory<Orbital1DM<Scalar>>& { return environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>, BoundedHistory<Orbital1DM<Scalar>>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<RHFSCFEnvironment<Scalar>>(direct_diis_rhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
+    /**
+     *  @param jk_calculator                        The calculator for the Coulomb and exchange matrices, which uses density-fitted two-electron integrals.
+     *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A density-fitted DIIS RHF SCF solver that approximates the two-electron integrals through density fitting and uses the norm of the difference of two consecutive density matrices as a convergence criterion.
+     */
+    static IterativeAlgorithm<RHFSCFEnvironment<Scalar>> DensityFittedDIIS(const DensityFittedJKCalculator& jk_calculator, const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' a density-fitted DIIS RHF SCF solver.
+        StepCollection<RHFSCFEnvironment<Scalar>> density_fitted_diis_rhf_scf_cycle {};
+        density_fitted_diis_rhf_scf_cycle
+            .add(RHFDensityMatrixCalculation<Scalar>())
+            .add(RHFDensityFittedFockMatrixCalculation(jk_calculator))
+            .add(RHFErrorCalculation<Scalar>())
+            .add(RHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension))  // This also calculates the next coefficient matrix.
+            .add(RHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const auto density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const BoundedHistory<Orbital1DM<Scalar>>& { return environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>, BoundedHistory<Orbital1DM<Scalar>>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<RHFSCFEnvironment<Scalar>>(density_fitted_diis_rhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
     /**
      *  @param threshold                            The threshold that is used in comparing the density matrices.
      *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
@@ -123,9 +185,9 @@ public:
             .add(RHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const auto density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const auto density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const BoundedHistory<Orbital1DM<Scalar>>& { return environment.density_matrices; };
 
-        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>>;
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>, BoundedHistory<Orbital1DM<Scalar>>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
 
         return IterativeAlgorithm<RHFSCFEnvironment<Scalar>>(plain_rhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
@@ -0,0 +1,100 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/DensityFittedJKCalculator.hpp"
+#include "Mathematical/Algorithm/Step.hpp"
+#include "QCMethod/HF/UHF/UHFSCFEnvironment.hpp"
+
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the current UHF Fock matrices (expressed in the scalar/AO basis) from the current density matrices, using density-fitted two-electron integrals instead of reading them from the Hamiltonian.
+ * 
+ *  The two-electron parts of the Fock matrices are G_sigma(P) = J(P_alpha) + J(P_beta) - K(P_sigma). They are calculated in one pass over the fitted three-index quantities, and rebuilt from the full density matrices in every iteration.
+ * 
+ *  @note The alpha and beta Fock matrices are expressed in the same scalar basis, i.e. the one of the given calculator for the Coulomb and exchange matrices.
+ */
+class UHFDensityFittedFockMatrixCalculation:
+    public Step<UHFSCFEnvironment<double>> {
+
+public:
+    using Scalar = double;
+    using Environment = UHFSCFEnvironment<Scalar>;
+
+
+private:
+    // The calculator for the Coulomb and exchange matrices.
+    DensityFittedJKCalculator jk_calculator;
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param jk_calculator            The calculator for the Coulomb and exchange matrices, in the scalar basis of the SCF environment.
+     */
+    UHFDensityFittedFockMatrixCalculation(const DensityFittedJKCalculator& jk_calculator) :
+        jk_calculator {jk_calculator} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return A textual description of this algorithmic step.
+     */
+    std::string description() const override {
+        return "Calculate the current UHF Fock matrices (expressed in the scalar/AO basis) with density-fitted two-electron integrals and place them in the environment.";
+    }
+
+
+    /**
+     *  Calculate the current UHF Fock matrices (expressed in the scalar/AO basis) with density-fitted two-electron integrals and place them in the environment.
+     * 
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void execute(Environment& environment) override {
+
+        const auto& P = environment.density_matrices.back();  // The most recent alpha and beta density matrix.
+        const SquareMatrix<double> P_alpha = P.alpha();
+        const SquareMatrix<double> P_beta = P.beta();
+        if ((P_alpha.dimension() != this->jk_calculator.numberOfBasisFunctions()) || (P_beta.dimension() != this->jk_calculator.numberOfBasisFunctions())) {
+            throw std::invalid_argument("UHFDensityFittedFockMatrixCalculation::execute(Environment&): The dimension of the density matrices is incompatible with the scalar basis of the calculator for the Coulomb and exchange matrices.");
+        }
+
+        const auto JK = this->jk_calculator.calculate({P_alpha, P_beta});
+        const SquareMatrix<double> J = JK.first[0] + JK.first[1];
+
+        const auto& H_core = environment.H_core;
+        const SquareMatrix<double> F_alpha = H_core.alpha().parameters() + J - JK.second[0];
+        const SquareMatrix<double> F_beta = H_core.beta().parameters() + J - JK.second[1];
+        environment.fock_matrices.push_back(ScalarUSQOneElectronOperator<double> {F_alpha, F_beta});
+    }
+};
+
+
+}  // namespace GQCP
@@ -0,0 +1,125 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/DirectJKCalculator.hpp"
+#include "Mathematical/Algorithm/Step.hpp"
+#include "QCMethod/HF/UHF/UHFSCFEnvironment.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the current UHF Fock matrices (expressed in the scalar/AO basis) from the current density matrices, calculating the two-electron integrals on the fly instead of reading them from the Hamiltonian ('direct SCF').
+ * 
+ *  The two-electron parts G_sigma(P) = J(P_alpha) + J(P_beta) - K(P_sigma) of the Fock matrices are linear in the density matrices, so they are built incrementally from the changes in the density matrices. After a fixed number of incremental builds, they are rebuilt from the full density matrices. The state of the incremental builds is kept in the environment.
+ * 
+ *  @note The alpha and beta Fock matrices are expressed in the same scalar basis, i.e. the one of the given calculator for the Coulomb and exchange matrices.
+ */
+class UHFDirectFockMatrixCalculation:
+    public Step<UHFSCFEnvironment<double>> {
+
+public:
+    using Scalar = double;
+    using Environment = UHFSCFEnvironment<Scalar>;
+
+
+private:
+    // The calculator for the Coulomb and exchange matrices.
+    DirectJKCalculator jk_calculator;
+
+    // The number of incremental builds after which the two-electron parts of the Fock matrices are rebuilt from the full density matrices.
+    size_t rebuild_interval;
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param jk_calculator            The calculator for the Coulomb and exchange matrices, in the scalar basis of the SCF environment.
+     *  @param rebuild_interval         The number of incremental builds after which the two-electron parts of the Fock matrices are rebuilt from the full density matrices. If zero, every build is a full build.
+     */
+    UHFDirectFockMatrixCalculation(const DirectJKCalculator& jk_calculator, const size_t rebuild_interval = 8) :
+        jk_calculator {jk_calculator},
+        rebuild_interval {rebuild_interval} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return A textual description of this algorithmic step.
+     */
+    std::string description() const override {
+        return "Calculate the current UHF Fock matrices (expressed in the scalar/AO basis) with on-the-fly two-electron integrals and place them in the environment.";
+    }
+
+
+    /**
+     *  Calculate the current UHF Fock matrices (expressed in the scalar/AO basis) with on-the-fly two-electron integrals and place them in the environment.
+     * 
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void execute(Environment& environment) override {
+
+        const auto& P = environment.density_matrices.back();  // The most recent alpha and beta density matrix.
+        const SquareMatrix<double> P_alpha = P.alpha();
+        const SquareMatrix<double> P_beta = P.beta();
+
+        // Decide if we can build the two-electron parts incrementally, i.e. from the changes in the density matrices.
+        const auto is_incremental = (environment.incremental_density_matrices.alpha().dimension() == P_alpha.dimension()) && (environment.number_of_incremental_builds < this->rebuild_interval);
+
+        std::vector<SquareMatrix<double>> P_build {P_alpha, P_beta};
+        if (is_incremental) {
+            P_build[0] -= environment.incremental_density_matrices.alpha();
+            P_build[1] -= environment.incremental_density_matrices.beta();
+        }
+
+        const auto JK = this->jk_calculator.calculate(P_build);
+        const SquareMatrix<double> J = JK.first[0] + JK.first[1];
+        SquareMatrix<double> G_alpha = J - JK.second[0];
+        SquareMatrix<double> G_beta = J - JK.second[1];
+
+        if (is_incremental) {
+            G_alpha += environment.incremental_G.alpha();
+            G_beta += environment.incremental_G.beta();
+            environment.number_of_incremental_builds++;
+        } else {
+            environment.number_of_incremental_builds = 0;
+        }
+
+        environment.incremental_density_matrices.alpha() = P_alpha;
+        environment.incremental_density_matrices.beta() = P_beta;
+        environment.incremental_G.alpha() = G_alpha;
+        environment.incremental_G.beta() = G_beta;
+
+
+        const auto& H_core = environment.H_core;
+        const SquareMatrix<double> F_alpha = H_core.alpha().parameters() + G_alpha;
+        const SquareMatrix<double> F_beta = H_core.beta().parameters() + G_beta;
+        environment.fock_matrices.push_back(ScalarUSQOneElectronOperator<double> {F_alpha, F_beta});
+    }
+};
+
+
+}  // namespace GQCP
@@ -61,7 +61,7 @@ public:
      */
     void execute(Environment& environment) override {
 
-        const auto& H_core = environment.sq_hamiltonian.core();  // The core Hamiltonian matrix: in zero-field calculations, alpha and beta are equal.
+        const auto& H_core = environment.H_core;  // The core Hamiltonian matrix: in zero-field calculations, alpha and beta are equal.
 
         const auto& P = environment.density_matrices.back();  // The most recent alpha & beta density matrix.
 
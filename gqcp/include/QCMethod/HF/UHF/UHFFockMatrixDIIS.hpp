@@ -25,6 +25,7 @@
 #include "QCModel/HF/UHF.hpp"
 
 #include <algorithm>
+#include <stdexcept>
 
 
 namespace GQCP {
@@ -84,6 +85,10 @@ public:
      */
     void execute(Environment& environment) override {
 
+        if (environment.error_vectors.capacity() < this->maximum_subspace_dimension) {
+            throw std::invalid_argument("UHFFockMatrixDIIS<Scalar>::execute(Environment&): The histories in the environment can't hold as many iterations as the maximum subspace dimension.");
+        }
+
         if (environment.error_vectors.size() < this->minimum_subspace_dimension) {  // The beta dimension will be the same.
 
             // No acceleration is possible, so calculate the regular Fock matrices and diagonalize them.
@@ -92,40 +97,24 @@ public:
             return;
         }
 
-        // Convert the deques in the environment to vectors that can be accepted by the DIIS accelerator. The total number of elements we can use in DIIS is either the maximum subspace dimension or the number of available error matrices.
+        // The total number of elements we can use in DIIS is either the maximum subspace dimension or the number of available error matrices. The DIIS accelerator reads them directly from the environment's histories.
         const auto n = std::min(this->maximum_subspace_dimension, environment.error_vectors.size());
-        const std::vector<SpinResolved<VectorX<Scalar>>> error_vectors {environment.error_vectors.end() - n, environment.error_vectors.end()};  // The n-th last alpha error vectors.
-
-        const std::vector<ScalarUSQOneElectronOperator<Scalar>> fock_matrices {environment.fock_matrices.end() - n, environment.fock_matrices.end()};  // The n-th last Fock matrices.
-
-        std::vector<SquareMatrix<Scalar>> alpha_fock_matrices;
-        std::vector<SquareMatrix<Scalar>> beta_fock_matrices;
-
-        for (size_t i = 0; i < fock_matrices.size(); i++) {
-            alpha_fock_matrices.push_back(fock_matrices[i].alpha().parameters());
-            beta_fock_matrices.push_back(fock_matrices[i].beta().parameters());
-        }
-
-        std::vector<VectorX<Scalar>> alpha_error_vectors;
-        std::vector<VectorX<Scalar>> beta_error_vectors;
-
-        for (size_t i = 0; i < error_vectors.size(); i++) {
-            alpha_error_vectors.push_back(error_vectors[i].alpha());
-            beta_error_vectors.push_back(error_vectors[i].beta());
-        }
-
-        // Calculate the accelerated Fock matrices and do a diagonalization step on them.
-        const auto F_alpha_accelerated = this->diis.accelerate(alpha_fock_matrices, alpha_error_vectors);
-        const auto F_beta_accelerated = this->diis.accelerate(beta_fock_matrices, beta_error_vectors);
-
+        const auto error_vectors = environment.error_vectors.latest(n);  // The n-th last alpha & beta error vectors.
+        const auto fock_matrices = environment.fock_matrices.latest(n);  // The n-th last alpha & beta Fock matrices.
+
+        // Calculate the accelerated Fock matrices, separately for the alpha and beta components.
+        const auto F_alpha_accelerated = this->diis.accelerate(
+            fock_matrices, error_vectors,
+            [](const ScalarUSQOneElectronOperator<Scalar>& F) -> const SquareMatrix<Scalar>& { return F.alpha().parameters(); },
+            [](const SpinResolved<VectorX<Scalar>>& error_vector) -> const VectorX<Scalar>& { return error_vector.alpha(); });
+        const auto F_beta_accelerated = this->diis.accelerate(
+            fock_matrices, error_vectors,
+            [](const ScalarUSQOneElectronOperator<Scalar>& F) -> const SquareMatrix<Scalar>& { return F.beta().parameters(); },
+            [](const SpinResolved<VectorX<Scalar>>& error_vector) -> const VectorX<Scalar>& { return error_vector.beta(); });
+
+        // Do a diagonalization step on the accelerated Fock matrices. They are not stored in the environment, as they should not be used in further extrapolation steps: they are not created from a density matrix.
         const ScalarUSQOneElectronOperator<Scalar> F_accelerated {F_alpha_accelerated, F_beta_accelerated};
-
-        environment.fock_matrices.push_back(F_accelerated);  // The diagonalization step can only read from the environment.
-
-        UHFFockMatrixDiagonalization<Scalar>().execute(environment);
-
-        // The accelerated/extrapolated Fock matrices should not be used in further extrapolation steps, as they are not created from a density matrix.
-        environment.fock_matrices.pop_back();
+        UHFFockMatrixDiagonalization<Scalar>().diagonalize(F_accelerated, environment);
     }
 };
 
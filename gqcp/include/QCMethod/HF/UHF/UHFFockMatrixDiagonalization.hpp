@@ -60,8 +60,21 @@ public:
      *  @param environment              The environment that acts as a sort of calculation space.
      */
     void execute(Environment& environment) override {
+        this->diagonalize(environment.fock_matrices.back(), environment);
+    }
+
+
+    /*
+     *  PUBLIC METHODS
+     */
 
-        const auto& F = environment.fock_matrices.back();  // The most recent scalar/AO basis alpha & beta Fock matrix.
+    /**
+     *  Solve the generalized eigenvalue problems for the given scalar/AO Fock matrices. Add the associated coefficient matrices and orbital energies to the environment.
+     * 
+     *  @param F                        The scalar/AO basis alpha & beta Fock matrices, which don't have to be stored in the environment (e.g. extrapolated ones).
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void diagonalize(const ScalarUSQOneElectronOperator<Scalar>& F, Environment& environment) const {
 
         using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
 
@@ -26,9 +26,9 @@
 #include "Operator/SecondQuantized/USQOneElectronOperator.hpp"
 #include "QCModel/HF/RHF.hpp"
 
-#include <Eigen/Dense>
+#include "Utilities/BoundedHistory.hpp"
 
-#include <deque>
+#include <Eigen/Dense>
 
 
 namespace GQCP {
@@ -39,6 +39,8 @@ namespace GQCP {
  * 
  *  We can basically view it as a compile-time type-safe std::map with all possible information that can be encountered in an UHF SCF algorithm.
  * 
+ *  Only the most recent iterates are kept: every quantity is stored in a bounded history, whose capacity should be at least the maximum subspace dimension of the DIIS steps that are used.
+ * 
  *  @tparam _Scalar             The scalar type that is used for the coefficient matrix/expansion coefficients: real or complex.
  */
 template <typename _Scalar>
@@ -50,21 +52,32 @@ public:
 public:
     SpinResolved<size_t> N;  // The number of alpha and beta electrons (the number of occupied alpha-spin-orbitals).
 
-    std::deque<double> electronic_energies;
+    BoundedHistory<double> electronic_energies;
 
-    std::deque<SpinResolved<VectorX<double>>> orbital_energies;  // The alpha and beta MO energies.
+    BoundedHistory<SpinResolved<VectorX<double>>> orbital_energies;  // The alpha and beta MO energies.
 
     ScalarUSQOneElectronOperator<Scalar> S;  // The overlap operator (of the scalar (AO) basis).
 
-    std::deque<UTransformation<Scalar>> coefficient_matrices;  // The alpha and beta coefficient matrices.
+    BoundedHistory<UTransformation<Scalar>> coefficient_matrices;  // The alpha and beta coefficient matrices.
+
+    BoundedHistory<SpinResolved1DM<double>> density_matrices;  // Expressed in the scalar (AO) basis.
+
+    BoundedHistory<ScalarUSQOneElectronOperator<Scalar>> fock_matrices;  // Expressed in the scalar (AO) basis.
 
-    std::deque<SpinResolved1DM<double>> density_matrices;  // Expressed in the scalar (AO) basis.
+    BoundedHistory<SpinResolved<VectorX<Scalar>>> error_vectors;  // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
 
-    std::deque<ScalarUSQOneElectronOperator<Scalar>> fock_matrices;  // Expressed in the scalar (AO) basis.
+    USQHamiltonian<Scalar> sq_hamiltonian;  // The Hamiltonian expressed in the scalar (AO) basis. It is empty if the environment was initialized from the core Hamiltonian only.
 
-    std::deque<SpinResolved<VectorX<Scalar>>> error_vectors;  // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
+    ScalarUSQOneElectronOperator<Scalar> H_core;  // The alpha and beta core Hamiltonian expressed in the scalar (AO) basis.
 
-    USQHamiltonian<Scalar> sq_hamiltonian;  // The Hamiltonian expressed in the scalar (AO) basis.
+    // The number of incremental builds of the two-electron parts of the Fock matrices since the last full build, as used in direct SCF.
+    size_t number_of_incremental_builds = 0;
+
+    // The alpha and beta density matrices from which the most recent two-electron parts of the Fock matrices were calculated, as used in direct SCF.
+    SpinResolved<SquareMatrix<Scalar>> incremental_density_matrices {SquareMatrix<Scalar>(), SquareMatrix<Scalar>()};
+
+    // The most recent alpha and beta two-electron parts of the Fock matrices, expressed in the scalar (AO) basis, as used in direct SCF.
+    SpinResolved<SquareMatrix<Scalar>> incremental_G {SquareMatrix<Scalar>(), SquareMatrix<Scalar>()};
 
 
 public:
@@ -81,12 +94,39 @@ public:
      *  @param S                        The overlap matrix (of the scalar (AO) basis).
      *  @param C_alpha_initial          The initial coefficient matrix for the alpha spin-orbitals.
      *  @param C_beta_initial           The initial coefficient matrix for the beta spin-orbitals.
+     *  @param history_capacity         The number of iterations for which the iterates are kept.
+     */
+    UHFSCFEnvironment(const size_t N_alpha, const size_t N_beta, const USQHamiltonian<Scalar>& sq_hamiltonian, const ScalarUSQOneElectronOperator<Scalar>& S, const UTransformation<Scalar>& C_initial, const size_t history_capacity = 8) :
+        UHFSCFEnvironment(N_alpha, N_beta, sq_hamiltonian.core(), S, C_initial, history_capacity) {
+
+        this->sq_hamiltonian = sq_hamiltonian;
+    }
+
+
+    /**
+     *  A constructor that initializes the environment with initial guesses for the alpha and beta coefficient matrices, without requiring the two-electron integrals. Such an environment can only be used with SCF solvers that don't read the two-electron integrals from the Hamiltonian, i.e. the direct and density-fitted ones.
+     * 
+     *  @param N_alpha                  The number of alpha electrons (the number of occupied alpha-spin-orbitals).
+     *  @param N_beta                   The number of beta electrons (the number of occupied beta-spin-orbitals).
+     *  @param H_core                   The alpha and beta core Hamiltonian expressed in the scalar (AO) basis.
+     *  @param S                        The overlap matrix (of the scalar (AO) basis).
+     *  @param C_initial                The initial alpha and beta coefficient matrices.
+     *  @param history_capacity         The number of iterations for which the iterates are kept.
      */
-    UHFSCFEnvironment(const size_t N_alpha, const size_t N_beta, const USQHamiltonian<Scalar>& sq_hamiltonian, const ScalarUSQOneElectronOperator<Scalar>& S, const UTransformation<Scalar>& C_initial) :
+    UHFSCFEnvironment(const size_t N_alpha, const size_t N_beta, const ScalarUSQOneElectronOperator<Scalar>& H_core, const ScalarUSQOneElectronOperator<Scalar>& S, const UTransformation<Scalar>& C_initial, const size_t history_capacity = 8) :
         N {N_alpha, N_beta},
+        electronic_energies {history_capacity},
+        orbital_energies {history_capacity},
         S {S},
-        sq_hamiltonian {sq_hamiltonian},
-        coefficient_matrices {C_initial} {}
+        coefficient_matrices {history_capacity},
+        density_matrices {history_capacity},
+        fock_matrices {history_capacity},
+        error_vectors {history_capacity},
+        sq_hamiltonian {ScalarUSQOneElectronOperator<Scalar>::Zero(0), ScalarUSQTwoElectronOperator<Scalar>::Zero(0)},
+        H_core {H_core} {
+
+        this->coefficient_matrices.push_back(C_initial);
+    }
 
 
     /**
@@ -95,11 +135,12 @@ public:
      *  @param rhf_parameters           The converged RHF model parameters.
      *  @param sq_hamiltonian           The Hamiltonian expressed in the scalar (AO) basis.
      *  @param S                        The overlap operator (of the scalar (AO) basis).
+     *  @param history_capacity         The number of iterations for which the iterates are kept.
      */
-    UHFSCFEnvironment(const QCModel::RHF<Scalar>& rhf_parameters, const USQHamiltonian<Scalar>& sq_hamiltonian, const ScalarUSQOneElectronOperator<Scalar>& S) :
+    UHFSCFEnvironment(const QCModel::RHF<Scalar>& rhf_parameters, const USQHamiltonian<Scalar>& sq_hamiltonian, const ScalarUSQOneElectronOperator<Scalar>& S, const size_t history_capacity = 8) :
         UHFSCFEnvironment(rhf_parameters.numberOfElectrons(Spin::alpha), rhf_parameters.numberOfElectrons(Spin::beta),
                           sq_hamiltonian, S,
-                          UTransformation<Scalar>::FromEqual(rhf_parameters.expansion().matrix())) {}
+                          UTransformation<Scalar>::FromEqual(rhf_parameters.expansion().matrix()), history_capacity) {}
 
 
     /*
@@ -113,8 +154,9 @@ public:
      *  @param N_beta                   The number of beta electrons (the number of occupied beta-spin-orbitals).
      *  @param sq_hamiltonian           The Hamiltonian expressed in the scalar (AO) basis.
      *  @param S                        The overlap matrix (of the scalar (AO) basis).
+     *  @param history_capacity         The number of iterations for which the iterates are kept.
      */
-    static UHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N_alpha, const size_t N_beta, const USQHamiltonian<Scalar>& sq_hamiltonian, const ScalarUSQOneElectronOperator<Scalar>& S) {
+    static UHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N_alpha, const size_t N_beta, const USQHamiltonian<Scalar>& sq_hamiltonian, const ScalarUSQOneElectronOperator<Scalar>& S, const size_t history_capacity = 8) {
 
         const auto& H_core = sq_hamiltonian.core();  // In AO basis.
 
@@ -125,7 +167,29 @@ public:
         const UTransformationComponent<Scalar> C_initial_b {generalized_eigensolver_b.eigenvectors()};
         const UTransformation<Scalar> C_initial {C_initial_a, C_initial_b};
 
-        return UHFSCFEnvironment<Scalar>(N_alpha, N_beta, sq_hamiltonian, S, C_initial);
+        return UHFSCFEnvironment<Scalar>(N_alpha, N_beta, sq_hamiltonian, S, C_initial, history_capacity);
+    }
+
+
+    /**
+     *  Initialize an UHF SCF environment from the core Hamiltonian only, with initial coefficient matrices (equal for alpha and beta) that are obtained by diagonalizing the core Hamiltonian matrix. Such an environment can only be used with SCF solvers that don't read the two-electron integrals from the Hamiltonian, i.e. the direct and density-fitted ones.
+     * 
+     *  @param N_alpha                  The number of alpha electrons (the number of occupied alpha-spin-orbitals).
+     *  @param N_beta                   The number of beta electrons (the number of occupied beta-spin-orbitals).
+     *  @param H_core                   The alpha and beta core Hamiltonian expressed in the scalar (AO) basis.
+     *  @param S                        The overlap matrix (of the scalar (AO) basis).
+     *  @param history_capacity         The number of iterations for which the iterates are kept.
+     */
+    static UHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N_alpha, const size_t N_beta, const ScalarUSQOneElectronOperator<Scalar>& H_core, const ScalarUSQOneElectronOperator<Scalar>& S, const size_t history_capacity = 8) {
+
+        using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver_a {H_core.alpha().parameters(), S.alpha().parameters()};
+        Eigen::GeneralizedSelfAdjointEigenSolver<MatrixType> generalized_eigensolver_b {H_core.beta().parameters(), S.beta().parameters()};
+        const UTransformationComponent<Scalar> C_initial_a {generalized_eigensolver_a.eigenvectors()};
+        const UTransformationComponent<Scalar> C_initial_b {generalized_eigensolver_b.eigenvectors()};
+        const UTransformation<Scalar> C_initial {C_initial_a, C_initial_b};
+
+        return UHFSCFEnvironment<Scalar>(N_alpha, N_beta, H_core, S, C_initial, history_capacity);
     }
 };
 
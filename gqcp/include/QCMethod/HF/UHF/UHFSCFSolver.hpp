@@ -21,7 +21,9 @@
 #include "Mathematical/Algorithm/CompoundConvergenceCriterion.hpp"
 #include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
 #include "Mathematical/Optimization/ConsecutiveIteratesNormConvergence.hpp"
+#include "QCMethod/HF/UHF/UHFDensityFittedFockMatrixCalculation.hpp"
 #include "QCMethod/HF/UHF/UHFDensityMatrixCalculation.hpp"
+#include "QCMethod/HF/UHF/UHFDirectFockMatrixCalculation.hpp"
 #include "QCMethod/HF/UHF/UHFElectronicEnergyCalculation.hpp"
 #include "QCMethod/HF/UHF/UHFErrorCalculation.hpp"
 #include "QCMethod/HF/UHF/UHFFockMatrixCalculation.hpp"
@@ -69,15 +71,75 @@ public:
             .add(UHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const std::function<std::deque<SpinResolved1DM<Scalar>>(const UHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const auto density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) -> const BoundedHistory<SpinResolved1DM<Scalar>>& { return environment.density_matrices; };
 
-        using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<Scalar>, UHFSCFEnvironment<Scalar>>;
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<Scalar>, UHFSCFEnvironment<Scalar>, BoundedHistory<SpinResolved1DM<Scalar>>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the UHF spin resolved density matrix in AO basis"};
 
         return IterativeAlgorithm<UHFSCFEnvironment<Scalar>>(diis_uhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
     }
 
 
+    /**
+     *  @param jk_calculator                        The calculator for the Coulomb and exchange matrices, which calculates the two-electron integrals on the fly.
+     *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing both the alpha and beta density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A direct DIIS UHF SCF solver that calculates the two-electron integrals on the fly and uses the combination of norm of the difference of two consecutive alpha and beta density matrices as a convergence criterion.
+     */
+    static IterativeAlgorithm<UHFSCFEnvironment<Scalar>> DirectDIIS(const DirectJKCalculator& jk_calculator, const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' a direct DIIS UHF SCF solver.
+        StepCollection<UHFSCFEnvironment<Scalar>> direct_diis_uhf_scf_cycle {};
+        direct_diis_uhf_scf_cycle
+            .add(UHFDensityMatrixCalculation<Scalar>())
+            .add(UHFDirectFockMatrixCalculation(jk_calculator))
+            .add(UHFErrorCalculation<Scalar>())
+            .add(UHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension))  // This also calculates the next coefficient matrix.
+            .add(UHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const auto density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) -> const BoundedHistory<SpinResolved1DM<Scalar>>& { return environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<Scalar>, UHFSCFEnvironment<Scalar>, BoundedHistory<SpinResolved1DM<Scalar>>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the UHF spin resolved density matrix in AO basis"};
+
+        return IterativeAlgorithm<UHFSCFEnvironment<Scalar>>(direct_diis_uhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
+    /**
+     *  @param jk_calculator                        The calculator for the Coulomb and exchange matrices, which uses density-fitted two-electron integrals.
+     *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing both the alpha and beta density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A density-fitted DIIS UHF SCF solver that approximates the two-electron integrals through density fitting and uses the combination of norm of the difference of two consecutive alpha and beta density matrices as a convergence criterion.
+     */
+    static IterativeAlgorithm<UHFSCFEnvironment<Scalar>> DensityFittedDIIS(const DensityFittedJKCalculator& jk_calculator, const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' a density-fitted DIIS UHF SCF solver.
+        StepCollection<UHFSCFEnvironment<Scalar>> density_fitted_diis_uhf_scf_cycle {};
+        density_fitted_diis_uhf_scf_cycle
+            .add(UHFDensityMatrixCalculation<Scalar>())
+            .add(UHFDensityFittedFockMatrixCalculation(jk_calculator))
+            .add(UHFErrorCalculation<Scalar>())
+            .add(UHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension))  // This also calculates the next coefficient matrix.
+            .add(UHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const auto density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) -> const BoundedHistory<SpinResolved1DM<Scalar>>& { return environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<Scalar>, UHFSCFEnvironment<Scalar>, BoundedHistory<SpinResolved1DM<Scalar>>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the UHF spin resolved density matrix in AO basis"};
+
+        return IterativeAlgorithm<UHFSCFEnvironment<Scalar>>(density_fitted_diis_uhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
     /**
      *  @param threshold                            The threshold that is used in comparing both the alpha and beta density matrices.
      *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
@@ -95,9 +157,9 @@ public:
             .add(UHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const std::function<std::deque<SpinResolved1DM<Scalar>>(const UHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const auto density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) -> const BoundedHistory<SpinResolved1DM<Scalar>>& { return environment.density_matrices; };
 
-        using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<Scalar>, UHFSCFEnvironment<Scalar>>;
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<Scalar>, UHFSCFEnvironment<Scalar>, BoundedHistory<SpinResolved1DM<Scalar>>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the UHF spin resolved density matrix in AO basis"};
 
         return IterativeAlgorithm<UHFSCFEnvironment<Scalar>>(plain_uhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
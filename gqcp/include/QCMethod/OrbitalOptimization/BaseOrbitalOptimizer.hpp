@@ -73,6 +73,19 @@ public:
     virtual void prepareConvergenceChecking(const RSQHamiltonian<double>& sq_hamiltonian) = 0;
 
 
+    // PUBLIC VIRTUAL METHODS
+
+    /**
+     *  Rotate the spinor basis and the Hamiltonian into the next iteration.
+     * 
+     *  @param spinor_basis         the current spinor basis
+     *  @param sq_hamiltonian       the current Hamiltonian
+     * 
+     *  @note The default implementation rotates with the unitary transformation from calculateNewRotationMatrix(). Derived classes can override this method if they can rotate more efficiently.
+     */
+    virtual void rotateIntoNextIteration(RSpinOrbitalBasis<double, GTOShell>& spinor_basis, RSQHamiltonian<double>& sq_hamiltonian) const;
+
+
     // PUBLIC METHODS
 
     /**
@@ -83,7 +96,7 @@ public:
     /**
      *  Optimize the Hamiltonian by subsequently
      *      - checking for convergence (see checkForConvergence())
-     *      - rotating the Hamiltonian (and spinor basis) with a newly found rotation matrix (see calculateNewRotationMatrix())
+     *      - rotating the Hamiltonian (and spinor basis) with a newly found rotation (see rotateIntoNextIteration())
      * 
      *  @param spinor_basis         the initial spinor basis that contains the spinors to be optimized
      *  @param sq_hamiltonian       the initial (guess for the) Hamiltonian
@@ -109,6 +109,14 @@ public:
      */
     void prepareConvergenceChecking(const RSQHamiltonian<double>& sq_hamiltonian) override;
 
+    /**
+     *  Rotate the spinor basis and the Hamiltonian into the next iteration, using the optimal Jacobi rotation directly. For the Hamiltonian, this scales as O(K^3) instead of the O(K^5) of a general basis rotation.
+     * 
+     *  @param spinor_basis         the current spinor basis
+     *  @param sq_hamiltonian       the current Hamiltonian
+     */
+    void rotateIntoNextIteration(RSpinOrbitalBasis<double, GTOShell>& spinor_basis, RSQHamiltonian<double>& sq_hamiltonian) const override;
+
 
     // PUBLIC METHODS
 
@@ -20,6 +20,8 @@
 
 #include "Basis/Transformations/OrbitalRotationGenerators.hpp"
 #include "Basis/Transformations/RTransformation.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Eigenpair.hpp"
+#include "Mathematical/Optimization/Minimization/AugmentedHessianTrustRegion.hpp"
 #include "Mathematical/Optimization/Minimization/BaseHessianModifier.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
 #include "Mathematical/Representation/SquareRankFourTensor.hpp"
@@ -33,13 +35,19 @@ namespace GQCP {
 
 /**
  *  An intermediate abstract class that should be derived from to implement a Newton-step based orbital optimization: the orbital gradient and Hessian are calculated through the DMs
+ * 
+ *  When constructed with an augmented-Hessian trust region, the dense orbital Hessian is never formed: the steps and the check for negative curvature only use Hessian-vector products and the Hessian diagonal, through Davidson's algorithm.
  */
 class NewtonOrbitalOptimizer: public BaseOrbitalOptimizer {
 protected:
-    std::shared_ptr<BaseHessianModifier> hessian_modifier;  // the modifier functor that should be used when an indefinite Hessian is encountered
+    std::shared_ptr<BaseHessianModifier> hessian_modifier;      // the modifier functor that should be used when an indefinite Hessian is encountered
+    std::shared_ptr<AugmentedHessianTrustRegion> trust_region;  // if set, the steps are calculated with the augmented-Hessian method instead of with Newton steps on the dense Hessian
 
     VectorX<double> gradient;
-    SquareMatrix<double> hessian;
+    SquareMatrix<double> hessian;      // only calculated when no trust region is used
+    VectorX<double> hessian_diagonal;  // only calculated when a trust region is used
+
+    Eigenpair<double> lowest_hessian_eigenpair;  // only calculated when a trust region is used and the gradient has converged; shared by the convergence check and the step of the current iteration
 
 
 public:
@@ -52,6 +60,13 @@ public:
      */
     NewtonOrbitalOptimizer(std::shared_ptr<BaseHessianModifier> hessian_modifier, const double convergence_threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128);
 
+    /*
+     *  @param trust_region                     the augmented-Hessian trust region that is used to calculate the steps, using only Hessian-vector products
+     *  @param convergence_threshold            the threshold used to check for convergence
+     *  @param maximum_number_of_iterations     the maximum number of iterations that may be used to achieve convergence
+     */
+    NewtonOrbitalOptimizer(const AugmentedHessianTrustRegion& trust_region, const double convergence_threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128);
+
 
     // DESTRUCTOR
 
@@ -92,6 +107,28 @@ public:
     virtual void prepareOrbitalDerivativesCalculation(const RSQHamiltonian<double>& sq_hamiltonian) = 0;
 
 
+    // PUBLIC VIRTUAL METHODS
+
+    /**
+     *  @param sq_hamiltonian       the current Hamiltonian
+     * 
+     *  @return the diagonal of the current orbital Hessian matrix
+     * 
+     *  @note The default implementation sets up the dense Hessian matrix. Derived classes should override this method to profit from the augmented-Hessian trust region.
+     */
+    virtual VectorX<double> calculateHessianDiagonal(const RSQHamiltonian<double>& sq_hamiltonian) const;
+
+    /**
+     *  @param sq_hamiltonian       the current Hamiltonian
+     *  @param x                    a vector of free orbital rotation generators, in the convention that p>q
+     * 
+     *  @return the product of the current orbital Hessian matrix with the given vector
+     * 
+     *  @note The default implementation sets up the dense Hessian matrix. Derived classes should override this method to profit from the augmented-Hessian trust region.
+     */
+    virtual VectorX<double> calculateHessianVectorProduct(const RSQHamiltonian<double>& sq_hamiltonian, const VectorX<double>& x) const;
+
+
     // PUBLIC OVERRIDDEN METHODS
 
     /**
@@ -155,10 +192,22 @@ public:
      */
     VectorX<double> directionFromIndefiniteHessian() const;
 
+    /**
+     *  @param sq_hamiltonian      the current Hamiltonian
+     * 
+     *  @return a function that returns the product of the current orbital Hessian matrix with a vector
+     */
+    VectorFunction<double> hessianVectorProductFunction(const RSQHamiltonian<double>& sq_hamiltonian) const;
+
     /**
      *  @return if a Newton step would be well-defined, i.e. the Hessian is positive definite
      */
     bool newtonStepIsWellDefined() const;
+
+    /**
+     *  @return the augmented-Hessian trust region that is used to calculate the steps, or a null pointer if Newton steps on the dense Hessian are used
+     */
+    const std::shared_ptr<AugmentedHessianTrustRegion>& trustRegion() const { return this->trust_region; }
 };
 
 
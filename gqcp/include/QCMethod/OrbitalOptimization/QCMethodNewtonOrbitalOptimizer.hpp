@@ -35,6 +35,10 @@ protected:
     Orbital1DM<double> D;  // spin-summed 1-DM
     Orbital2DM<double> d;  // spin-summed 2-DM
 
+    // Intermediates for the matrix-free Hessian-vector products, which are only calculated when an augmented-Hessian trust region is used.
+    SquareMatrix<double> F;          // the (total) Fockian matrix
+    SquareRankFourTensor<double> S;  // the pair-symmetrized 2-DM S(p,q,r,s) = d(p,q,r,s) + d(q,p,s,r)
+
 
 public:
     // CONSTRUCTORS
@@ -83,6 +87,21 @@ public:
      */
     SquareRankFourTensor<double> calculateHessianTensor(const RSQHamiltonian<double>& sq_hamiltonian) const override;
 
+    /**
+     *  @param sq_hamiltonian      the current Hamiltonian
+     * 
+     *  @return the diagonal of the current orbital Hessian matrix, calculated directly from the DMs in O(K^4) time
+     */
+    VectorX<double> calculateHessianDiagonal(const RSQHamiltonian<double>& sq_hamiltonian) const override;
+
+    /**
+     *  @param sq_hamiltonian      the current Hamiltonian
+     *  @param x                   a vector of free orbital rotation generators, in the convention that p>q
+     * 
+     *  @return the product of the current orbital Hessian matrix with the given vector, calculated through contractions of the DMs with the antisymmetric generator matrix in O(K^5) time, without setting up the super-Fockian matrix
+     */
+    VectorX<double> calculateHessianVectorProduct(const RSQHamiltonian<double>& sq_hamiltonian, const VectorX<double>& x) const override;
+
     /**
      *  Prepare this object (i.e. the context for the orbital optimization algorithm) to be able to check for convergence in this Newton-based orbital optimizer for quantum chemical methods.
      */
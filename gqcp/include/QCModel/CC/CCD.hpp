@@ -70,24 +70,13 @@ public:
      *  @return the CCD correlation energy
      */
     static Scalar calculateCorrelationEnergy(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T2Amplitudes<Scalar>& t2) {
+        const auto& orbital_space = t2.orbitalSpace();
 
-        const auto orbital_space = t2.orbitalSpace();
-
-        // A KISS implementation of the CCD energy correction.
-        // The implementation is in line with Crawford2000 "Chapter 2: An Introduction to Coupled Cluster Theory for Computational Chemists", eq. [134].
-        double E = 0.0;
-
-        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                        E += 0.25 * V_A(i, j, a, b) * t2(i, j, a, b);
-                    }
-                }
-            }
-        }
+        // The implementation is in line with Crawford2000 "Chapter 2: An Introduction to Coupled Cluster Theory for Computational Chemists", eq. [134]. The contraction is performed on the dense occupied-virtual block.
+        const auto V_oovv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+        const Tensor<Scalar, 0> E = V_oovv.template einsum<4>("ijab,ijab->", t2.asImplicitRankFourTensorSlice().asTensor());
 
-        return E;
+        return 0.25 * E(0);
     }
 
 
@@ -164,6 +153,58 @@ public:
     }
 
 
+    /**
+     *  Calculate the values for all the CCD T2-amplitude equations at once, evaluated at the given T2-amplitudes (and itermediates).
+     *      f_{ij}^{ab} = <Phi_{ij}^{ab}| H |Phi_0>             with H the similarity-transformed normal-ordered Hamiltonian
+     * 
+     *  @param f                            the (inactive) Fock matrix
+     *  @param V_A                          the antisymmetrized two-electron integrals (in physicist's notation)
+     *  @param t2                           the T2-amplitudes
+     *  @param F1                           the F1-intermediate (equation (3) in Stanton1991)
+     *  @param F2                           the F2-intermediate (equation (4) in Stanton1991)
+     *  @param W1                           the W1-intermediate (equation (6) in Stanton1991)
+     *  @param W2                           the W2-intermediate (equation (7) in Stanton1991)
+     *  @param W3                           the W3-intermediate (equation (8) in Stantion1991)
+     * 
+     *  @return the values for all the CCD T2-amplitude equations, as an occupied-occupied-virtual-virtual object
+     * 
+     *  @note Every term is evaluated as a contraction of the dense occupied-virtual blocks, which is performed as a matrix-matrix multiplication. The permutation operators P(ij) and P(ab) are applied afterwards, as permutations of the axes of the contracted terms.
+     */
+    static ImplicitRankFourTensorSlice<Scalar> calculateT2AmplitudeEquations(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T2Amplitudes<Scalar>& t2, const ImplicitMatrixSlice<Scalar>& F1, const ImplicitMatrixSlice<Scalar>& F2, const ImplicitRankFourTensorSlice<Scalar>& W1, const ImplicitRankFourTensorSlice<Scalar>& W2, const ImplicitRankFourTensorSlice<Scalar>& W3) {
+
+        const auto& orbital_space = t2.orbitalSpace();
+        const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+
+        const Eigen::array<int, 4> ij_permutation {1, 0, 2, 3};
+        const Eigen::array<int, 4> ab_permutation {0, 1, 3, 2};
+        const Eigen::array<int, 4> ijab_permutation {1, 0, 3, 2};
+
+
+        // We will use equation (2) in Stanton1991 by putting the left-hand term (with the energy denominator) to the right.
+        Tensor<Scalar, 4> result = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);  // the contribution from the first term
+
+        // Calculate the contribution from the left-hand side.
+        result -= t2_dense.Eigen() * T2Amplitudes<Scalar>::calculateEnergyDenominators(f, orbital_space).Eigen();
+
+        // Calculate the contributions from the second and third term.
+        const auto second_term = t2_dense.template einsum<1>("ijae,be->ijab", F1.asMatrix());
+        result += second_term.Eigen() - second_term.shuffle(ab_permutation);  // P(ab) applied
+
+        const auto third_term = t2_dense.template einsum<1>("imab,mj->ijab", F2.asMatrix());
+        result -= third_term.Eigen() - third_term.shuffle(ij_permutation);  // P(ij) applied
+
+        // Calculate the contributions from the fourth and fifth term.
+        result += 0.5 * t2_dense.template einsum<2>("mnab,mnij->ijab", W1.asTensor()).Eigen();
+        result += 0.5 * t2_dense.template einsum<2>("ijef,abef->ijab", W2.asTensor()).Eigen();
+
+        // Calculate the contribution from the sixth term.
+        const auto sixth_term = t2_dense.template einsum<2>("imae,mbej->ijab", W3.asTensor());
+        result += sixth_term.Eigen() - sixth_term.shuffle(ij_permutation) - sixth_term.shuffle(ab_permutation) + sixth_term.shuffle(ijab_permutation);  // P(ij) P(ab) applied
+
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, result);
+    }
+
+
     /**
      *  @param f                    the (inactive) Fock matrix
      *  @param V_A                  the antisymmetrized two-electron integrals (in physicist's notation)
@@ -174,34 +215,16 @@ public:
      *  @note This is one of the intermediate quantities in the factorization of CCD. In particular, F1 represents equation (3) in Stanton1991.
      */
     static ImplicitMatrixSlice<Scalar> calculateF1(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T2Amplitudes<Scalar>& t2) {
-
         const auto& orbital_space = t2.orbitalSpace();
 
-        // Implement the formula for the F1-intermediate: equation (3) in Stanton1993.
-        auto F1 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_virtual, OccupationType::k_virtual);  // zero-initialize a virtual-virtual object
-        for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-            for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                // Calculate the contribution from the first term.
-                if (a != e) {  // (1 - delta_ae)
-                    value += f(a, e);
-                }
-
-                // Calculate the contribution from the fourth term.
-                for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                        for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                            value -= 0.5 * t2(m, n, a, f) * V_A(m, n, e, f);
-                        }
-                    }
-                }
-
-                F1(a, e) = value;
-            }
-        }
+        // Implement the formula for the F1-intermediate: equation (3) in Stanton1993, using a contraction of the dense occupied-virtual blocks.
+        MatrixX<Scalar> F1 = orbital_space.denseBlockOf(OccupationType::k_virtual, OccupationType::k_virtual, f);
+        F1.diagonal().setZero();  // (1 - delta_ae)
+
+        const auto V_oovv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+        F1 -= 0.5 * t2.asImplicitRankFourTensorSlice().asTensor().template einsum<3>("mnaf,mnef->ae", V_oovv).asMatrix();
 
-        return F1;
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_virtual, OccupationType::k_virtual, F1);
     }
 
 
@@ -215,34 +238,16 @@ public:
      *  @note This is one of the intermediate quantities in the factorization of CCD. In particular, F2 represents equation (4) in Stanton1991.
      */
     static ImplicitMatrixSlice<Scalar> calculateF2(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T2Amplitudes<Scalar>& t2) {
-
         const auto& orbital_space = t2.orbitalSpace();
 
-        // Implement the formula for F2 in equation (4) in Stanton1991.
-        auto F2 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_occupied);  // zero-initialize an occupied-occupied object
-        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-                Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                // Calculate the contribution from the first term.
-                if (m != i) {  // (1 - delta_mi)
-                    value += f(m, i);
-                }
-
-                // Calculate the contribution from the fourth term.
-                for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                        for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                            value += 0.5 * t2(i, n, e, f) * V_A(m, n, e, f);
-                        }
-                    }
-                }
-
-                F2(m, i) = value;
-            }
-        }
+        // Implement the formula for F2 in equation (4) in Stanton1991, using a contraction of the dense occupied-virtual blocks.
+        MatrixX<Scalar> F2 = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, f);
+        F2.diagonal().setZero();  // (1 - delta_mi)
+
+        const auto V_oovv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+        F2 += 0.5 * V_oovv.template einsum<3>("mnef,inef->mi", t2.asImplicitRankFourTensorSlice().asTensor()).asMatrix();
 
-        return F2;
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_occupied, OccupationType::k_occupied, F2);
     }
 
 
@@ -255,34 +260,15 @@ public:
      *  @note This is one of the intermediate quantities in the factorization of CCD. In particular, W1 represents equation (6) in Stanton1991.
      */
     static ImplicitRankFourTensorSlice<Scalar> calculateW1(const SquareRankFourTensor<Scalar>& V_A, const T2Amplitudes<Scalar>& t2) {
-
         const auto& orbital_space = t2.orbitalSpace();
 
-        // Implement the formula for W1 (equation 6).
-        auto W1 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied);  // zero-initialize an occupied-occupied-occupied-occupied object
-        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto j : orbital_space.indices(OccupationType::k_occupied)) {
-                        Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                        // Calculate the contribution from the first term.
-                        value += V_A(m, n, i, j);
-
-                        // Calculate the contribution from the third term.
-                        for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                            for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                                value += 0.25 * t2(i, j, e, f) * V_A(m, n, e, f);
-                            }
-                        }
-
-                        W1(m, n, i, j) = value;
-                    }
-                }
-            }
-        }
+        // Implement the formula for W1 (equation 6), using a contraction of the dense occupied-virtual blocks.
+        const auto V_oooo = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied, V_A);
+        const auto V_oovv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+
+        const Tensor<Scalar, 4> W1 = V_oooo.Eigen() + 0.25 * V_oovv.template einsum<2>("mnef,ijef->mnij", t2.asImplicitRankFourTensorSlice().asTensor()).Eigen();
 
-        return W1;
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied, W1);
     }
 
 
@@ -295,34 +281,15 @@ public:
      *  @note This is one of the intermediate quantities in the factorization of CCD. In particular, W2 represents equation (7) in Stanton1991.
      */
     static ImplicitRankFourTensorSlice<Scalar> calculateW2(const SquareRankFourTensor<Scalar>& V_A, const T2Amplitudes<Scalar>& t2) {
-
         const auto& orbital_space = t2.orbitalSpace();
 
-        // Implement the formula for W2 (equation 7).
-        auto W2 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual);  // zero-initialize a virtual-virtual-virtual-virtual object
-        for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-            for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto f : orbital_space.indices(OccupationType::k_virtual)) {
-                        Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                        // Calculate the contribution from the first term.
-                        value += V_A(a, b, e, f);
-
-                        // Calculate the contribution from the third term.
-                        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-                            for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                                value += 0.25 * t2(m, n, a, b) * V_A(m, n, e, f);
-                            }
-                        }
-
-                        W2(a, b, e, f) = value;
-                    }
-                }
-            }
-        }
+        // Implement the formula for W2 (equation 7), using a contraction of the dense occupied-virtual blocks.
+        const auto V_vvvv = orbital_space.denseBlockOf(OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+        const auto V_oovv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+
+        const Tensor<Scalar, 4> W2 = V_vvvv.Eigen() + 0.25 * t2.asImplicitRankFourTensorSlice().asTensor().template einsum<2>("mnab,mnef->abef", V_oovv).Eigen();
 
-        return W2;
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, W2);
     }
 
 
@@ -335,34 +302,15 @@ public:
      *  @note This is one of the intermediate quantities in the factorization of CCD. In particular, W3 represents equation (8) in Stanton1991.
      */
     static ImplicitRankFourTensorSlice<Scalar> calculateW3(const SquareRankFourTensor<Scalar>& V_A, const T2Amplitudes<Scalar>& t2) {
-
         const auto& orbital_space = t2.orbitalSpace();
 
-        // Implement the formula for W3 (equation 8).
-        auto W3 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_occupied);  // zero-initialize an occupied-virtual-virtual-occupied object
-        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                        Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                        // Calculate the contribution from the first term.
-                        value += V_A(m, b, e, j);
-
-                        // Calculate the contribution from the fourth term.
-                        for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                            for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                                value -= 0.5 * t2(j, n, f, b) * V_A(m, n, e, f);
-                            }
-                        }
-
-                        W3(m, b, e, j) = value;
-                    }
-                }
-            }
-        }
+        // Implement the formula for W3 (equation 8), using a contraction of the dense occupied-virtual blocks.
+        const auto V_ovvo = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_occupied, V_A);
+        const auto V_oovv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+
+        const Tensor<Scalar, 4> W3 = V_ovvo.Eigen() - 0.5 * t2.asImplicitRankFourTensorSlice().asTensor().template einsum<2>("jnfb,mnef->mbej", V_oovv).Eigen();
 
-        return W3;
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_occupied, W3);
     }
 
 
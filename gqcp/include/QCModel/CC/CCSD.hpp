@@ -75,29 +75,16 @@ public:
      *  @return the CCSD correlation energy
      */
     static Scalar calculateCorrelationEnergy(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
-        const auto orbital_space = t1.orbitalSpace();  // assume t1 and t2 have the same orbital space.
+        const auto& orbital_space = t1.orbitalSpace();  // assume t1 and t2 have the same orbital space.
 
-        // A KISS implementation of the CCSD energy correction.
-        // The implementation is in line with Crawford2000 "Chapter 2: An Introduction to Coupled Cluster Theory for Computational Chemists", eq. [134].
-        double E = 0.0;
-        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-                E += f(i, a) * t1(i, a);
-            }
-        }
+        // The implementation is in line with Crawford2000 "Chapter 2: An Introduction to Coupled Cluster Theory for Computational Chemists", eq. [134]. All contractions are performed on the dense occupied-virtual blocks.
+        const auto f_ov = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_virtual, f);
+        const auto V_oovv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
 
-        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                        E += 0.25 * V_A(i, j, a, b) * t2(i, j, a, b);
-                        E += 0.5 * V_A(i, j, a, b) * t1(i, a) * t1(j, b);
-                    }
-                }
-            }
-        }
+        const Tensor<Scalar, 4> t = 0.25 * t2.asImplicitRankFourTensorSlice().asTensor().Eigen() + 0.5 * CCSD<Scalar>::calculateT1OuterProduct(t1).Eigen();
+        const Tensor<Scalar, 0> E_doubles = V_oovv.template einsum<4>("ijab,ijab->", t);
 
-        return E;
+        return f_ov.cwiseProduct(t1.asImplicitMatrixSlice().asMatrix()).sum() + E_doubles(0);
     }
 
 
@@ -275,6 +262,131 @@ public:
     }
 
 
+    /**
+     *  Calculate the values for all the CCSD T1-amplitude equations at once, evaluated at the given T1- and T2-amplitudes (and itermediates).
+     *      f_i^a = <Phi_i^a| H |Phi_0>             with H the similarity-transformed normal-ordered Hamiltonian
+     * 
+     *  @param f                            the (inactive) Fock matrix
+     *  @param V_A                          the antisymmetrized two-electron integrals (in physicist's notation)
+     *  @param t1                           the T1-amplitudes
+     *  @param t2                           the T2-amplitudes
+     *  @param F1                           the F1-intermediate (equation (3) in Stanton1991)
+     *  @param F2                           the F2-intermediate (equation (4) in Stanton1991)
+     *  @param F3                           the F3-intermediate (equation (5) in Stantion1991)
+     * 
+     *  @return the values for all the CCSD T1-amplitude equations, as an occupied-virtual object
+     * 
+     *  @note Every term is evaluated as a contraction of the dense occupied-virtual blocks, which is performed as a matrix-matrix multiplication.
+     */
+    static ImplicitMatrixSlice<Scalar> calculateT1AmplitudeEquations(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2, const ImplicitMatrixSlice<Scalar>& F1, const ImplicitMatrixSlice<Scalar>& F2, const ImplicitMatrixSlice<Scalar>& F3) {
+
+        const auto& orbital_space = t1.orbitalSpace();  // assume t1 and t2 have the same orbital space.
+
+        // Prepare the dense blocks of the Fock matrix and the two-electron integrals.
+        const auto f_ov = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_virtual, f);
+
+        const auto V_ovov = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_occupied, OccupationType::k_virtual, V_A);
+        const auto V_ovvv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+        const auto V_oovo = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_occupied, V_A);
+
+        const auto& t1_dense = t1.asImplicitMatrixSlice().asMatrix();
+        const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+
+
+        // We will use equation (1) in Stanton1991 by putting the left-hand term (with the energy denominator) to the right.
+        MatrixX<Scalar> result = f_ov;  // the contribution from the first term
+
+        // Calculate the contribution from the left-hand side.
+        result -= t1_dense.cwiseProduct(T1Amplitudes<Scalar>::calculateEnergyDenominators(f, orbital_space));
+
+        // Calculate the contributions from the second, third and fourth term.
+        result += t1_dense * F1.asMatrix().transpose();
+        result -= F2.asMatrix().transpose() * t1_dense;
+        result += t2_dense.template einsum<2>("imae,me->ia", F3.asMatrix()).asMatrix();
+
+        // Calculate the contributions from the fifth, sixth and seventh term.
+        result -= V_ovov.template einsum<2>("naif,nf->ia", t1_dense).asMatrix();
+        result -= 0.5 * t2_dense.template einsum<3>("imef,maef->ia", V_ovvv).asMatrix();
+        result -= 0.5 * t2_dense.template einsum<3>("mnae,nmei->ia", V_oovo).asMatrix();
+
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_occupied, OccupationType::k_virtual, result);
+    }
+
+
+    /**
+     *  Calculate the values for all the CCSD T2-amplitude equations at once, evaluated at the given T1- and T2-amplitudes (and itermediates).
+     *      f_{ij}^{ab} = <Phi_{ij}^{ab}| H |Phi_0>             with H the similarity-transformed normal-ordered Hamiltonian
+     * 
+     *  @param f                            the (inactive) Fock matrix
+     *  @param V_A                          the antisymmetrized two-electron integrals (in physicist's notation)
+     *  @param t1                           the T1-amplitudes
+     *  @param t2                           the T2-amplitudes
+     *  @param tau2                         the tau2-intermediate (equation (10) in Stanton1991)
+     *  @param F1                           the F1-intermediate (equation (3) in Stanton1991)
+     *  @param F2                           the F2-intermediate (equation (4) in Stanton1991)
+     *  @param F3                           the F3-intermediate (equation (5) in Stantion1991)
+     *  @param W1                           the W1-intermediate (equation (6) in Stanton1991)
+     *  @param W2                           the W2-intermediate (equation (7) in Stanton1991)
+     *  @param W3                           the W3-intermediate (equation (8) in Stantion1991)
+     * 
+     *  @return the values for all the CCSD T2-amplitude equations, as an occupied-occupied-virtual-virtual object
+     * 
+     *  @note Every term is evaluated as a contraction of the dense occupied-virtual blocks, which is performed as a matrix-matrix multiplication. The permutation operators P(ij) and P(ab) are applied afterwards, as permutations of the axes of the contracted terms.
+     */
+    static ImplicitRankFourTensorSlice<Scalar> calculateT2AmplitudeEquations(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2, const ImplicitRankFourTensorSlice<Scalar>& tau2, const ImplicitMatrixSlice<Scalar>& F1, const ImplicitMatrixSlice<Scalar>& F2, const ImplicitMatrixSlice<Scalar>& F3, const ImplicitRankFourTensorSlice<Scalar>& W1, const ImplicitRankFourTensorSlice<Scalar>& W2, const ImplicitRankFourTensorSlice<Scalar>& W3) {
+
+        const auto& orbital_space = t1.orbitalSpace();  // assume t1 and t2 have the same orbital space.
+
+        // Prepare the dense blocks of the two-electron integrals.
+        const auto V_oovv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+        const auto V_ovvo = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_occupied, V_A);
+        const auto V_vvvo = orbital_space.denseBlockOf(OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_occupied, V_A);
+        const auto V_ovoo = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_occupied, OccupationType::k_occupied, V_A);
+
+        const auto& t1_dense = t1.asImplicitMatrixSlice().asMatrix();
+        const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+
+        const Eigen::array<int, 4> ij_permutation {1, 0, 2, 3};
+        const Eigen::array<int, 4> ab_permutation {0, 1, 3, 2};
+        const Eigen::array<int, 4> ijab_permutation {1, 0, 3, 2};
+
+
+        // We will use equation (2) in Stanton1991 by putting the left-hand term (with the energy denominator) to the right.
+        Tensor<Scalar, 4> result = V_oovv;  // the contribution from the first term
+
+        // Calculate the contribution from the left-hand side.
+        result -= t2_dense.Eigen() * T2Amplitudes<Scalar>::calculateEnergyDenominators(f, orbital_space).Eigen();
+
+        // Calculate the contribution from the second term, in which the F3-contribution is absorbed into the virtual-virtual intermediate.
+        const MatrixX<Scalar> F1_tilde = F1.asMatrix() - 0.5 * t1_dense.transpose() * F3.asMatrix();
+        const auto second_term = t2_dense.template einsum<1>("ijae,be->ijab", F1_tilde);
+        result += second_term.Eigen() - second_term.shuffle(ab_permutation);  // P(ab) applied
+
+        // Calculate the contribution from the third term, in which the F3-contribution is absorbed into the occupied-occupied intermediate.
+        const MatrixX<Scalar> F2_tilde = F2.asMatrix() + 0.5 * F3.asMatrix() * t1_dense.transpose();
+        const auto third_term = t2_dense.template einsum<1>("imab,mj->ijab", F2_tilde);
+        result -= third_term.Eigen() - third_term.shuffle(ij_permutation);  // P(ij) applied
+
+        // Calculate the contributions from the fourth and fifth term.
+        result += 0.5 * tau2.asTensor().template einsum<2>("mnab,mnij->ijab", W1.asTensor()).Eigen();
+        result += 0.5 * tau2.asTensor().template einsum<2>("ijef,abef->ijab", W2.asTensor()).Eigen();
+
+        // Calculate the contribution from the sixth term. The product of the T1-amplitudes is contracted with the integrals one amplitude at a time.
+        const auto t1_V = V_ovvo.template einsum<1>("mbej,ie->mbij", t1_dense);
+        const Tensor<Scalar, 4> sixth_term = t2_dense.template einsum<2>("imae,mbej->ijab", W3.asTensor()).Eigen() - t1_V.template einsum<1>("mbij,ma->ijab", t1_dense).Eigen();
+        result += sixth_term.Eigen() - sixth_term.shuffle(ij_permutation) - sixth_term.shuffle(ab_permutation) + sixth_term.shuffle(ijab_permutation);  // P(ij) P(ab) applied
+
+        // Calculate the contributions from the seventh and eighth term.
+        const auto seventh_term = V_vvvo.template einsum<1>("abej,ie->ijab", t1_dense);
+        result += seventh_term.Eigen() - seventh_term.shuffle(ij_permutation);  // P(ij) applied
+
+        const auto eighth_term = V_ovoo.template einsum<1>("mbij,ma->ijab", t1_dense);
+        result -= eighth_term.Eigen() - eighth_term.shuffle(ab_permutation);  // P(ab) applied
+
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, result);
+    }
+
+
     /**
      *  @param f                    the (inactive) Fock matrix
      *  @param V_A                  the antisymmetrized two-electron integrals (in physicist's notation)
@@ -286,46 +398,22 @@ public:
      *  @note This is one of the intermediate quantities in the factorization of CCSD. In particular, F1 represents equation (3) in Stanton1991.
      */
     static ImplicitMatrixSlice<Scalar> calculateF1(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const ImplicitRankFourTensorSlice<Scalar>& tau2_tilde) {
-
         const auto& orbital_space = t1.orbitalSpace();
 
-        // Implement the formula for the F1-intermediate: equation (3) in Stanton1993.
-        auto F1 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_virtual, OccupationType::k_virtual);  // zero-initialize a virtual-virtual object
-        for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-            for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                Scalar value {0.0};  // zero-initialize the scalar value to be added
+        // Implement the formula for the F1-intermediate: equation (3) in Stanton1993, using contractions of the dense occupied-virtual blocks.
+        MatrixX<Scalar> F1 = orbital_space.denseBlockOf(OccupationType::k_virtual, OccupationType::k_virtual, f);
+        F1.diagonal().setZero();  // (1 - delta_ae)
 
-                // Calculate the contribution from the first term.
-                if (a != e) {  // (1 - delta_ae)
-                    value += f(a, e);
-                }
+        const auto f_ov = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_virtual, f);
+        const auto V_ovvv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+        const auto V_oovv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+        const auto& t1_dense = t1.asImplicitMatrixSlice().asMatrix();
 
-                // Calculate the contribution from the second term.
-                for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-                    value -= 0.5 * f(m, e) * t1(m, a);
-                }
-
-                // Calculate the contribution from the third term.
-                for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto f : orbital_space.indices(OccupationType::k_virtual)) {
-                        value += t1(m, f) * V_A(m, a, f, e);
-                    }
-                }
+        F1 -= 0.5 * t1_dense.transpose() * f_ov;
+        F1 += V_ovvv.template einsum<2>("mafe,mf->ae", t1_dense).asMatrix();
+        F1 -= 0.5 * tau2_tilde.asTensor().template einsum<3>("mnaf,mnef->ae", V_oovv).asMatrix();
 
-                // Calculate the contribution from the fourth term.
-                for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                        for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                            value -= 0.5 * tau2_tilde(m, n, a, f) * V_A(m, n, e, f);
-                        }
-                    }
-                }
-
-                F1(a, e) = value;
-            }
-        }
-
-        return F1;
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_virtual, OccupationType::k_virtual, F1);
     }
 
 
@@ -340,46 +428,22 @@ public:
      *  @note This is one of the intermediate quantities in the factorization of CCSD. In particular, F2 represents equation (4) in Stanton1991.
      */
     static ImplicitMatrixSlice<Scalar> calculateF2(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const ImplicitRankFourTensorSlice<Scalar>& tau2_tilde) {
-
         const auto& orbital_space = t1.orbitalSpace();
 
-        // Implement the formula for F2 in equation (4) in Stanton1991.
-        auto F2 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_occupied);  // zero-initialize an occupied-occupied object
-        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-                Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                // Calculate the contribution from the first term.
-                if (m != i) {  // (1 - delta_mi)
-                    value += f(m, i);
-                }
-
-                // Calculate the contribution from the second term.
-                for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                    value += 0.5 * t1(i, e) * f(m, e);
-                }
+        // Implement the formula for F2 in equation (4) in Stanton1991, using contractions of the dense occupied-virtual blocks.
+        MatrixX<Scalar> F2 = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, f);
+        F2.diagonal().setZero();  // (1 - delta_mi)
 
-                // Calculate the contribution from the third term.
-                for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                        value += t1(n, e) * V_A(m, n, i, e);
-                    }
-                }
+        const auto f_ov = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_virtual, f);
+        const auto V_ooov = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, V_A);
+        const auto V_oovv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+        const auto& t1_dense = t1.asImplicitMatrixSlice().asMatrix();
 
-                // Calculate the contribution from the fourth term.
-                for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                        for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                            value += 0.5 * tau2_tilde(i, n, e, f) * V_A(m, n, e, f);
-                        }
-                    }
-                }
+        F2 += 0.5 * f_ov * t1_dense.transpose();
+        F2 += V_ooov.template einsum<2>("mnie,ne->mi", t1_dense).asMatrix();
+        F2 += 0.5 * V_oovv.template einsum<3>("mnef,inef->mi", tau2_tilde.asTensor()).asMatrix();
 
-                F2(m, i) = value;
-            }
-        }
-
-        return F2;
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_occupied, OccupationType::k_occupied, F2);
     }
 
 
@@ -393,30 +457,29 @@ public:
      *  @note This is one of the intermediate quantities in the factorization of CCSD. In particular, F3 represents equation (5) in Stanton1991.
      */
     static ImplicitMatrixSlice<Scalar> calculateF3(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1) {
-
         const auto& orbital_space = t1.orbitalSpace();
 
-        // Implement the formula for F3 in equation (5) in Stanton1991.
-        auto F3 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_virtual);  // zero-initialize an occupied-virtual object
-        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                Scalar value {0.0};  // zero-initialize the scalar value to be added
+        // Implement the formula for F3 in equation (5) in Stanton1991, using contractions of the dense occupied-virtual blocks.
+        MatrixX<Scalar> F3 = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_virtual, f);
 
-                // Calculate the contribution from the first term.
-                value += f(m, e);
+        const auto V_oovv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+        F3 += V_oovv.template einsum<2>("mnef,nf->me", t1.asImplicitMatrixSlice().asMatrix()).asMatrix();
 
-                // Calculate the contribution from the second term.
-                for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                        value += t1(n, f) * V_A(m, n, e, f);
-                    }
-                }
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_occupied, OccupationType::k_virtual, F3);
+    }
 
-                F3(m, e) = value;
-            }
-        }
 
-        return F3;
+    /**
+     *  @param t1                   the T1-amplitudes
+     * 
+     *  @return the dense outer product of the T1-amplitudes with themselves, i.e. the occupied-occupied-virtual-virtual tensor with elements t_i^a t_j^b
+     */
+    static Tensor<Scalar, 4> calculateT1OuterProduct(const T1Amplitudes<Scalar>& t1) {
+
+        const auto& t1_dense = t1.asImplicitMatrixSlice().asMatrix();
+        const Tensor<Scalar, 2> t1_tensor = Eigen::TensorMap<Eigen::Tensor<const Scalar, 2>>(t1_dense.data(), t1_dense.rows(), t1_dense.cols());
+
+        return t1_tensor.template einsum<0>("ia,jb->ijab", t1_tensor);
     }
 
 
@@ -429,23 +492,15 @@ public:
      *  @note This is one of the intermediate quantities in the factorization of CCSD. In particular, tau2 represents equation (10) in Stanton1991.
      */
     static ImplicitRankFourTensorSlice<Scalar> calculateTau2(const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
-
         const auto& orbital_space = t1.orbitalSpace();  // assume the orbital spaces for t1 and t2 are equal
 
-        // Implement the formula for tau2 (equation 10).
-        auto tau2 = t2.asImplicitRankFourTensorSlice();  // the contribution from the first term
+        // Implement the formula for tau2 (equation 10). The antisymmetrized product of the T1-amplitudes is formed as an outer product, followed by a permutation of the virtual axes.
+        const auto t1_t1 = CCSD<Scalar>::calculateT1OuterProduct(t1);
+        const Eigen::array<int, 4> ab_permutation {0, 1, 3, 2};
 
-        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                        tau2(i, j, a, b) += t1(i, a) * t1(j, b) - t1(i, b) * t1(j, a);
-                    }
-                }
-            }
-        }
+        const Tensor<Scalar, 4> tau2 = t2.asImplicitRankFourTensorSlice().asTensor().Eigen() + t1_t1.Eigen() - t1_t1.shuffle(ab_permutation);
 
-        return tau2;
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, tau2);
     }
 
 
@@ -458,23 +513,15 @@ public:
      *  @note This is one of the intermediate quantities in the factorization of CCSD. In particular, tau2_tilde represents equation (9) in Stanton1991.
      */
     static ImplicitRankFourTensorSlice<Scalar> calculateTau2Tilde(const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
-
         const auto& orbital_space = t1.orbitalSpace();  // assume the orbital spaces for t1 and t2 are equal
 
-        // Implement the formula for tau2_tilde (equation 9).
-        auto tau2_tilde = t2.asImplicitRankFourTensorSlice();  // the contribution from the first term
+        // Implement the formula for tau2_tilde (equation 9). The antisymmetrized product of the T1-amplitudes is formed as an outer product, followed by a permutation of the virtual axes.
+        const auto t1_t1 = CCSD<Scalar>::calculateT1OuterProduct(t1);
+        const Eigen::array<int, 4> ab_permutation {0, 1, 3, 2};
 
-        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                        tau2_tilde(i, j, a, b) += 0.5 * (t1(i, a) * t1(j, b) - t1(i, b) * t1(j, a));
-                    }
-                }
-            }
-        }
+        const Tensor<Scalar, 4> tau2_tilde = t2.asImplicitRankFourTensorSlice().asTensor().Eigen() + 0.5 * (t1_t1.Eigen() - t1_t1.shuffle(ab_permutation));
 
-        return tau2_tilde;
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, tau2_tilde);
     }
 
 
@@ -488,40 +535,19 @@ public:
      *  @note This is one of the intermediate quantities in the factorization of CCSD. In particular, W1 represents equation (6) in Stanton1991.
      */
     static ImplicitRankFourTensorSlice<Scalar> calculateW1(const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const ImplicitRankFourTensorSlice<Scalar>& tau2) {
-
         const auto& orbital_space = t1.orbitalSpace();
 
-        // Implement the formula for W1 (equation 6).
-        auto W1 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied);  // zero-initialize an occupied-occupied-occupied-occupied object
-        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto j : orbital_space.indices(OccupationType::k_occupied)) {
-                        Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                        // Calculate the contribution from the first term.
-                        value += V_A(m, n, i, j);
-
-                        // Calculate the contribution from the second term.
-                        for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                            value += t1(j, e) * V_A(m, n, i, e);
-                            value -= t1(i, e) * V_A(m, n, j, e);  // P(ij) applied
-                        }
-
-                        // Calculate the contribution from the third term.
-                        for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                            for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                                value += 0.25 * tau2(i, j, e, f) * V_A(m, n, e, f);
-                            }
-                        }
-
-                        W1(m, n, i, j) = value;
-                    }
-                }
-            }
-        }
+        // Implement the formula for W1 (equation 6), using contractions of the dense occupied-virtual blocks.
+        const auto V_oooo = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied, V_A);
+        const auto V_ooov = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, V_A);
+        const auto V_oovv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+
+        const auto second_term = V_ooov.template einsum<1>("mnie,je->mnij", t1.asImplicitMatrixSlice().asMatrix());
+        const Eigen::array<int, 4> ij_permutation {0, 1, 3, 2};
 
-        return W1;
+        const Tensor<Scalar, 4> W1 = V_oooo.Eigen() + second_term.Eigen() - second_term.shuffle(ij_permutation) + 0.25 * V_oovv.template einsum<2>("mnef,ijef->mnij", tau2.asTensor()).Eigen();  // P(ij) applied to the second term
+
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied, W1);
     }
 
 
@@ -535,40 +561,19 @@ public:
      *  @note This is one of the intermediate quantities in the factorization of CCSD. In particular, W2 represents equation (7) in Stanton1991.
      */
     static ImplicitRankFourTensorSlice<Scalar> calculateW2(const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const ImplicitRankFourTensorSlice<Scalar>& tau2) {
-
         const auto& orbital_space = t1.orbitalSpace();
 
-        // Implement the formula for W2 (equation 7).
-        auto W2 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual);  // zero-initialize a virtual-virtual-virtual-virtual object
-        for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-            for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto f : orbital_space.indices(OccupationType::k_virtual)) {
-                        Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                        // Calculate the contribution from the first term.
-                        value += V_A(a, b, e, f);
-
-                        // Calculate the contribution from the second term.
-                        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-                            value -= t1(m, b) * V_A(a, m, e, f);
-                            value += t1(m, a) * V_A(b, m, e, f);  // P(ab) applied
-                        }
-
-                        // Calculate the contribution from the third term.
-                        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-                            for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                                value += 0.25 * tau2(m, n, a, b) * V_A(m, n, e, f);
-                            }
-                        }
-
-                        W2(a, b, e, f) = value;
-                    }
-                }
-            }
-        }
+        // Implement the formula for W2 (equation 7), using contractions of the dense occupied-virtual blocks.
+        const auto V_vvvv = orbital_space.denseBlockOf(OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+        const auto V_vovv = orbital_space.denseBlockOf(OccupationType::k_virtual, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+        const auto V_oovv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+
+        const auto second_term = V_vovv.template einsum<1>("amef,mb->abef", t1.asImplicitMatrixSlice().asMatrix());
+        const Eigen::array<int, 4> ab_permutation {1, 0, 2, 3};
 
-        return W2;
+        const Tensor<Scalar, 4> W2 = V_vvvv.Eigen() - second_term.Eigen() + second_term.shuffle(ab_permutation) + 0.25 * tau2.asTensor().template einsum<2>("mnab,mnef->abef", V_oovv).Eigen();  // P(ab) applied to the second term
+
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, W2);
     }
 
 
@@ -582,44 +587,21 @@ public:
      *  @note This is one of the intermediate quantities in the factorization of CCSD. In particular, W3 represents equation (8) in Stanton1991.
      */
     static ImplicitRankFourTensorSlice<Scalar> calculateW3(const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
-
         const auto& orbital_space = t1.orbitalSpace();  // assume the orbital spaces for t1 and t2 are equal
 
-        // Implement the formula for W3 (equation 8).
-        auto W3 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_occupied);  // zero-initialize an occupied-virtual-virtual-occupied object
-        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                        Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                        // Calculate the contribution from the first term.
-                        value += V_A(m, b, e, j);
-
-                        // Calculate the contribution from the second term.
-                        for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                            value += t1(j, f) * V_A(m, b, e, f);
-                        }
-
-                        // Calculate the contribution from the third term.
-                        for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                            value -= t1(n, b) * V_A(m, n, e, j);
-                        }
-
-                        // Calculate the contribution from the fourth term.
-                        for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                            for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                                value -= (0.5 * t2(j, n, f, b) + t1(j, f) * t1(n, b)) * V_A(m, n, e, f);
-                            }
-                        }
-
-                        W3(m, b, e, j) = value;
-                    }
-                }
-            }
-        }
+        // Implement the formula for W3 (equation 8), using contractions of the dense occupied-virtual blocks.
+        const auto V_ovvo = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_occupied, V_A);
+        const auto V_ovvv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+        const auto V_oovo = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_occupied, V_A);
+        const auto V_oovv = orbital_space.denseBlockOf(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, V_A);
+        const auto& t1_dense = t1.asImplicitMatrixSlice().asMatrix();
+
+        // The amplitudes in the fourth term are gathered as 0.5 * t_{jn}^{fb} + t_j^f t_n^b.
+        const Tensor<Scalar, 4> t = 0.5 * t2.asImplicitRankFourTensorSlice().asTensor().Eigen() + CCSD<Scalar>::calculateT1OuterProduct(t1).Eigen();
+
+        const Tensor<Scalar, 4> W3 = V_ovvo.Eigen() + V_ovvv.template einsum<1>("mbef,jf->mbej", t1_dense).Eigen() - V_oovo.template einsum<1>("mnej,nb->mbej", t1_dense).Eigen() - t.template einsum<2>("jnfb,mnef->mbej", V_oovv).Eigen();
 
-        return W3;
+        return orbital_space.createRepresentableObjectFor(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_occupied, W3);
     }
 
 
@@ -121,6 +121,34 @@ public:
     }
 
 
+    /*
+     *  STATIC PUBLIC METHODS
+     */
+
+    /**
+     *  Calculate the energy denominators that appear in the update formula for the T1-amplitudes.
+     * 
+     *  @param f                            the (inactive) Fock matrix
+     *  @param orbital_space                the orbital space which covers the occupied-virtual separation
+     * 
+     *  @return the dense occupied-virtual matrix of the energy denominators D_i^a = f_ii - f_aa, laid out in the same way as the dense representation of the T1-amplitudes
+     */
+    static MatrixX<Scalar> calculateEnergyDenominators(const SquareMatrix<Scalar>& f, const OrbitalSpace& orbital_space) {
+
+        const auto& occupied_indices = orbital_space.indices(OccupationType::k_occupied);
+        const auto& virtual_indices = orbital_space.indices(OccupationType::k_virtual);
+
+        MatrixX<Scalar> D {static_cast<long>(occupied_indices.size()), static_cast<long>(virtual_indices.size())};  // need static_cast for Eigen
+        for (size_t a = 0; a < virtual_indices.size(); a++) {
+            for (size_t i = 0; i < occupied_indices.size(); i++) {
+                D(i, a) = f(occupied_indices[i], occupied_indices[i]) - f(virtual_indices[a], virtual_indices[a]);
+            }
+        }
+
+        return D;
+    }
+
+
     /*
      *  OPERATORS
      */
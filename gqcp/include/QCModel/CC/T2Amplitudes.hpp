@@ -125,6 +125,40 @@ public:
     }
 
 
+    /*
+     *  STATIC PUBLIC METHODS
+     */
+
+    /**
+     *  Calculate the energy denominators that appear in the update formula for the T2-amplitudes.
+     * 
+     *  @param f                            the (inactive) Fock matrix
+     *  @param orbital_space                the orbital space which covers the occupied-virtual separation
+     * 
+     *  @return the dense occupied-occupied-virtual-virtual tensor of the energy denominators D_{ij}^{ab} = f_ii + f_jj - f_aa - f_bb, laid out in the same way as the dense representation of the T2-amplitudes
+     */
+    static Tensor<Scalar, 4> calculateEnergyDenominators(const SquareMatrix<Scalar>& f, const OrbitalSpace& orbital_space) {
+
+        const auto& occupied_indices = orbital_space.indices(OccupationType::k_occupied);
+        const auto& virtual_indices = orbital_space.indices(OccupationType::k_virtual);
+        const auto o = static_cast<long>(occupied_indices.size());  // need static_cast for Tensor
+        const auto v = static_cast<long>(virtual_indices.size());
+
+        Tensor<Scalar, 4> D {o, o, v, v};
+        for (long b = 0; b < v; b++) {
+            for (long a = 0; a < v; a++) {
+                for (long j = 0; j < o; j++) {
+                    for (long i = 0; i < o; i++) {
+                        D(i, j, a, b) = f(occupied_indices[i], occupied_indices[i]) + f(occupied_indices[j], occupied_indices[j]) - f(virtual_indices[a], virtual_indices[a]) - f(virtual_indices[b], virtual_indices[b]);
+                    }
+                }
+            }
+        }
+
+        return D;
+    }
+
+
     /*
      *  OPERATORS
      */
@@ -0,0 +1,357 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A history of the most recent elements of an iterative algorithm, with a fixed capacity. It is implemented as a ring buffer: once the capacity is reached, pushing a new element overwrites the oldest one.
+ *
+ *  The storage of the overwritten elements is reused: copy-assigning an element into a slot that holds an element of the same size (e.g. an Eigen matrix of the same dimensions) doesn't allocate.
+ *
+ *  @tparam _Element            The type of the elements in the history.
+ */
+template <typename _Element>
+class BoundedHistory {
+public:
+    // The type of the elements in the history.
+    using Element = _Element;
+
+
+    /**
+     *  A read-only random-access iterator over the elements in a history, from the oldest to the most recent one.
+     */
+    class ConstIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Element;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Element*;
+        using reference = const Element&;
+
+    private:
+        // The history that is iterated over.
+        const BoundedHistory<Element>* history;
+
+        // The position of the current element, relative to the oldest element.
+        difference_type index;
+
+    public:
+        ConstIterator(const BoundedHistory<Element>* history, const difference_type index) :
+            history {history},
+            index {index} {}
+
+        reference operator*() const { return (*this->history)[this->index]; }
+        pointer operator->() const { return &(*this->history)[this->index]; }
+        reference operator[](const difference_type n) const { return (*this->history)[this->index + n]; }
+
+        ConstIterator& operator++() {
+            this->index++;
+            return *this;
+        }
+        ConstIterator operator++(int) {
+            ConstIterator copy = *this;
+            this->index++;
+            return copy;
+        }
+        ConstIterator& operator--() {
+            this->index--;
+            return *this;
+        }
+        ConstIterator operator--(int) {
+            ConstIterator copy = *this;
+            this->index--;
+            return copy;
+        }
+        ConstIterator& operator+=(const difference_type n) {
+            this->index += n;
+            return *this;
+        }
+        ConstIterator& operator-=(const difference_type n) {
+            this->index -= n;
+            return *this;
+        }
+
+        friend ConstIterator operator+(ConstIterator it, const difference_type n) { return it += n; }
+        friend ConstIterator operator+(const difference_type n, ConstIterator it) { return it += n; }
+        friend ConstIterator operator-(ConstIterator it, const difference_type n) { return it -= n; }
+        friend difference_type operator-(const ConstIterator& lhs, const ConstIterator& rhs) { return lhs.index - rhs.index; }
+
+        friend bool operator==(const ConstIterator& lhs, const ConstIterator& rhs) { return lhs.index == rhs.index; }
+        friend bool operator!=(const ConstIterator& lhs, const ConstIterator& rhs) { return lhs.index != rhs.index; }
+        friend bool operator<(const ConstIterator& lhs, const ConstIterator& rhs) { return lhs.index < rhs.index; }
+        friend bool operator>(const ConstIterator& lhs, const ConstIterator& rhs) { return lhs.index > rhs.index; }
+        friend bool operator<=(const ConstIterator& lhs, const ConstIterator& rhs) { return lhs.index <= rhs.index; }
+        friend bool operator>=(const ConstIterator& lhs, const ConstIterator& rhs) { return lhs.index >= rhs.index; }
+    };
+
+
+    /**
+     *  A read-only view on a number of consecutive elements of a history, which doesn't copy them.
+     */
+    class Window {
+    private:
+        // The history that is viewed.
+        const BoundedHistory<Element>* history;
+
+        // The position of the first element in the window, relative to the oldest element in the history.
+        size_t offset;
+
+        // The number of elements in the window.
+        size_t m_size;
+
+    public:
+        Window(const BoundedHistory<Element>* history, const size_t offset, const size_t size) :
+            history {history},
+            offset {offset},
+            m_size {size} {}
+
+        /**
+         *  @param i            The position of an element in this window, where 0 corresponds to the oldest element.
+         *
+         *  @return A read-only reference to that element.
+         */
+        const Element& operator[](const size_t i) const { return (*this->history)[this->offset + i]; }
+
+        /**
+         *  @return The number of elements in this window.
+         */
+        size_t size() const { return this->m_size; }
+
+        ConstIterator begin() const { return ConstIterator(this->history, this->offset); }
+        ConstIterator end() const { return ConstIterator(this->history, this->offset + this->m_size); }
+    };
+
+
+private:
+    // The maximum number of elements that can be stored.
+    size_t m_capacity;
+
+    // The storage for the elements. It grows until the capacity is reached, after which its slots are reused.
+    std::vector<Element> slots;
+
+    // The slot that holds the oldest element.
+    size_t first;
+
+    // The number of elements that are currently stored.
+    size_t m_size;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Create an empty history.
+     *
+     *  @param capacity             The maximum number of elements that can be stored. Once it is reached, the oldest element is discarded for every new element.
+     */
+    BoundedHistory(const size_t capacity) :
+        m_capacity {capacity},
+        first {0},
+        m_size {0} {
+
+        if (capacity == 0) {
+            throw std::invalid_argument("BoundedHistory::BoundedHistory(const size_t): The capacity should be at least 1.");
+        }
+
+        // The elements themselves (and their possibly large storage) are only created upon their first insertion.
+        this->slots.reserve(capacity);
+    }
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @param i            The position of an element in this history, where 0 corresponds to the oldest element and `size() - 1` to the most recent one.
+     *
+     *  @return A read-only reference to that element.
+     */
+    const Element& operator[](const size_t i) const { return this->slots[this->slotOf(i)]; }
+
+    /**
+     *  @param i            The position of an element in this history, where 0 corresponds to the oldest element and `size() - 1` to the most recent one.
+     *
+     *  @return A writable reference to that element.
+     */
+    Element& operator[](const size_t i) { return this->slots[this->slotOf(i)]; }
+
+    /**
+     *  @return A read-only reference to the most recent element.
+     */
+    const Element& back() const { return (*this)[this->checkedLast("back")]; }
+
+    /**
+     *  @return A writable reference to the most recent element.
+     */
+    Element& back() { return (*this)[this->checkedLast("back")]; }
+
+    /**
+     *  @return A read-only reference to the oldest element.
+     */
+    const Element& front() const {
+        this->checkedLast("front");
+        return (*this)[0];
+    }
+
+    /**
+     *  @param n            The number of requested elements.
+     *
+     *  @return A read-only view on the n most recent elements, ordered from the oldest to the most recent one.
+     */
+    Window latest(const size_t n) const {
+        if (n > this->size()) {
+            throw std::out_of_range("BoundedHistory::latest(const size_t): The history doesn't contain that many elements.");
+        }
+        return Window(this, this->size() - n, n);
+    }
+
+    /**
+     *  @return An iterator to the oldest element.
+     */
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+
+    /**
+     *  @return An iterator past the most recent element.
+     */
+    ConstIterator end() const { return ConstIterator(this, static_cast<typename ConstIterator::difference_type>(this->size())); }
+
+
+    /*
+     *  MARK: General information
+     */
+
+    /**
+     *  @return The maximum number of elements that can be stored.
+     */
+    size_t capacity() const { return this->m_capacity; }
+
+    /**
+     *  @return If this history doesn't contain any elements.
+     */
+    bool empty() const { return this->m_size == 0; }
+
+    /**
+     *  @return If this history is at its capacity, i.e. if a new element would discard the oldest one.
+     */
+    bool isFull() const { return this->m_size == this->m_capacity; }
+
+    /**
+     *  @return The number of elements that are currently stored.
+     */
+    size_t size() const { return this->m_size; }
+
+
+    /*
+     *  MARK: Modifiers
+     */
+
+    /**
+     *  Remove all elements from this history. The storage of the elements is kept, in order to be reused.
+     */
+    void clear() {
+        this->first = 0;
+        this->m_size = 0;
+    }
+
+    /**
+     *  Remove the most recent element from this history. Its storage is kept, in order to be reused by the next element.
+     */
+    void pop_back() {
+        this->checkedLast("pop_back");
+        this->m_size--;
+    }
+
+    /**
+     *  Append a new element to this history. If the history is at its capacity, the oldest element is discarded and its storage is reused by copy-assignment.
+     *
+     *  @param element              The new element.
+     */
+    void push_back(const Element& element) { this->insert(element); }
+
+    /**
+     *  Append a new element to this history. If the history is at its capacity, the oldest element is discarded.
+     *
+     *  @param element              The new element.
+     */
+    void push_back(Element&& element) { this->insert(std::move(element)); }
+
+
+private:
+    /*
+     *  MARK: Helpers
+     */
+
+    /**
+     *  @param caller           The name of the calling method, used in the error message.
+     *
+     *  @return The position of the most recent element, if this history isn't empty.
+     */
+    size_t checkedLast(const char* caller) const {
+        if (this->empty()) {
+            throw std::out_of_range(std::string("BoundedHistory::") + caller + "(): The history is empty.");
+        }
+        return this->m_size - 1;
+    }
+
+    /**
+     *  Store a new most recent element, discarding the oldest element if this history is at its capacity.
+     *
+     *  @param element              The new element.
+     */
+    template <typename E>
+    void insert(E&& element) {
+        if (this->isFull()) {
+            this->slots[this->first] = std::forward<E>(element);
+            this->first = (this->first + 1) % this->m_capacity;
+            return;
+        }
+
+        // A slot is only created if it has never been used before, i.e. as long as the capacity hasn't been reached.
+        const size_t slot = this->slotOf(this->m_size);
+        if (slot == this->slots.size()) {
+            this->slots.emplace_back(std::forward<E>(element));
+        } else {
+            this->slots[slot] = std::forward<E>(element);
+        }
+        this->m_size++;
+    }
+
+    /**
+     *  @param i            The position of an element in this history, relative to the oldest element.
+     *
+     *  @return The slot in which that element is stored.
+     */
+    size_t slotOf(const size_t i) const { return (this->first + i) % this->m_capacity; }
+};
+
+
+}  // namespace GQCP
@@ -0,0 +1,191 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Library-wide settings
+ */
+
+/**
+ *  @return The number of threads that is used by the multithreaded algorithms whose interface doesn't allow a number of threads to be passed, such as the basis transformation of a two-electron operator and the tensor contractions of `Tensor::einsum`. By default, a single thread is used.
+ */
+size_t numberOfThreads();
+
+/**
+ *  Set the number of threads that is used by the multithreaded algorithms whose interface doesn't allow a number of threads to be passed, such as the basis transformation of a two-electron operator and the tensor contractions of `Tensor::einsum`.
+ * 
+ *  @param number_of_threads        The number of threads. It should be at least 1.
+ */
+void setNumberOfThreads(const size_t number_of_threads);
+
+
+/*
+ *  MARK: Parallel loops
+ */
+
+/**
+ *  Split the index range [0, dimension) into contiguous chunks of (almost) equal size, and process every chunk on its own thread.
+ *
+ *  @tparam Callback                The type of the callback function. Its signature should be `void(size_t thread_index, size_t begin, size_t end)`.
+ *
+ *  @param number_of_threads        The requested number of threads. If the dimension is smaller, fewer threads are used.
+ *  @param dimension                The number of indices that should be processed.
+ *  @param callback                 The function to be applied to every chunk [begin, end). The thread index is equal to the index of the chunk, so it can be used to access thread-private buffers.
+ *
+ *  @return The number of chunks (i.e. threads) that were actually used.
+ *
+ *  @note The first chunk is processed on the calling thread. If any of the callbacks throws, the first exception (in the order of the chunks) is rethrown after all threads have been joined.
+ */
+template <typename Callback>
+size_t forEachChunkConcurrently(const size_t number_of_threads, const size_t dimension, const Callback& callback) {
+
+    if (number_of_threads == 0) {
+        throw std::invalid_argument("forEachChunkConcurrently(const size_t, const size_t, const Callback&): The number of threads should be at least 1.");
+    }
+
+    // Determine the actual number of chunks, and distribute the remainder of the division over the first chunks.
+    const size_t number_of_chunks = std::max<size_t>(std::min(number_of_threads, dimension), 1);
+    const size_t chunk_size = dimension / number_of_chunks;
+    const size_t remainder = dimension % number_of_chunks;
+
+    const auto begin_of = [chunk_size, remainder](const size_t chunk_index) { return chunk_index * chunk_size + std::min(chunk_index, remainder); };
+
+
+    // Run all but the first chunk on separate threads, catching any exceptions so that they can be rethrown on the calling thread.
+    std::vector<std::exception_ptr> exceptions(number_of_chunks);
+    std::vector<std::thread> threads;
+    threads.reserve(number_of_chunks - 1);
+
+    const auto process_chunk = [&](const size_t chunk_index) {
+        try {
+            callback(chunk_index, begin_of(chunk_index), begin_of(chunk_index + 1));
+        } catch (...) {
+            exceptions[chunk_index] = std::current_exception();
+        }
+    };
+
+    // If a thread can't be started, the threads that are already running should be joined before the exception leaves this function, since destroying a joinable thread terminates the program.
+    try {
+        for (size_t chunk_index = 1; chunk_index < number_of_chunks; chunk_index++) {
+            threads.emplace_back(process_chunk, chunk_index);
+        }
+    } catch (...) {
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        throw;
+    }
+    process_chunk(0);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    return number_of_chunks;
+}
+
+
+/**
+ *  Process every index in the range [0, dimension) on one of the given number of threads, where the indices are handed out one by one to the first thread that becomes available. In contrast to forEachChunkConcurrently, this balances the load dynamically, which is preferable when the cost of processing an index varies strongly.
+ *
+ *  @tparam Callback                The type of the callback function. Its signature should be `void(size_t thread_index, size_t index)`.
+ *
+ *  @param number_of_threads        The requested number of threads. If the dimension is smaller, fewer threads are used.
+ *  @param dimension                The number of indices that should be processed.
+ *  @param callback                 The function to be applied to every index. The thread index lies in [0, number_of_threads), so it can be used to access thread-private resources.
+ *
+ *  @return The number of threads that were actually used.
+ *
+ *  @note The indices are handed out in increasing order, so the most expensive work should be associated with the lowest indices. The thread with index 0 is the calling thread. If any of the callbacks throws, all threads stop processing new indices and the first exception (in the order of the threads) is rethrown after all threads have been joined.
+ */
+template <typename Callback>
+size_t forEachIndexDynamically(const size_t number_of_threads, const size_t dimension, const Callback& callback) {
+
+    if (number_of_threads == 0) {
+        throw std::invalid_argument("forEachIndexDynamically(const size_t, const size_t, const Callback&): The number of threads should be at least 1.");
+    }
+
+    const size_t number_of_workers = std::max<size_t>(std::min(number_of_threads, dimension), 1);
+
+
+    // Every worker repeatedly claims the next unprocessed index, until all indices have been claimed or a callback has failed.
+    std::atomic<size_t> next_index {0};
+    std::atomic<bool> has_failed {false};
+    std::vector<std::exception_ptr> exceptions(number_of_workers);
+
+    const auto work = [&](const size_t thread_index) {
+        try {
+            for (size_t index = next_index++; index < dimension && !has_failed; index = next_index++) {
+                callback(thread_index, index);
+            }
+        } catch (...) {
+            exceptions[thread_index] = std::current_exception();
+            has_failed = true;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(number_of_workers - 1);
+    // If a thread can't be started, the workers that are already running are stopped and joined before the exception leaves this function, since destroying a joinable thread terminates the program.
+    try {
+        for (size_t thread_index = 1; thread_index < number_of_workers; thread_index++) {
+            threads.emplace_back(work, thread_index);
+        }
+    } catch (...) {
+        has_failed = true;
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        throw;
+    }
+    work(0);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    return number_of_workers;
+}
+
+
+}  // namespace GQCP
@@ -22,6 +22,8 @@
 #include "Basis/Integrals/BaseOneElectronIntegralEngine.hpp"
 #include "Basis/Integrals/BaseTwoElectronIntegralBuffer.hpp"
 #include "Basis/Integrals/BaseTwoElectronIntegralEngine.hpp"
+#include "Basis/Integrals/DensityFittedJKCalculator.hpp"
+#include "Basis/Integrals/FCIDUMP.hpp"
 #include "Basis/Integrals/IntegralCalculator.hpp"
 #include "Basis/Integrals/IntegralEngine.hpp"
 #include "Basis/Integrals/Interfaces/LibcintInterfacer.hpp"
@@ -123,6 +125,7 @@
 #include "Mathematical/Optimization/LinearEquation/HouseholderQRSolution.hpp"
 #include "Mathematical/Optimization/LinearEquation/LinearEquationEnvironment.hpp"
 #include "Mathematical/Optimization/LinearEquation/LinearEquationSolver.hpp"
+#include "Mathematical/Optimization/Minimization/AugmentedHessianTrustRegion.hpp"
 #include "Mathematical/Optimization/Minimization/BaseHessianModifier.hpp"
 #include "Mathematical/Optimization/Minimization/IterativeIdentitiesHessianModifier.hpp"
 #include "Mathematical/Optimization/Minimization/MinimizationEnvironment.hpp"
@@ -135,15 +138,20 @@
 #include "Mathematical/Optimization/NonLinearEquation/step.hpp"
 #include "Mathematical/Optimization/OptimizationEnvironment.hpp"
 #include "Mathematical/Representation/Array.hpp"
+#include "Mathematical/Representation/CholeskyDecomposedRankFourTensor.hpp"
+#include "Mathematical/Representation/ContractionPlan.hpp"
 #include "Mathematical/Representation/DenseVectorizer.hpp"
+#include "Mathematical/Representation/FourIndexTransformation.hpp"
 #include "Mathematical/Representation/ImplicitMatrixSlice.hpp"
 #include "Mathematical/Representation/ImplicitRankFourTensorSlice.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
 #include "Mathematical/Representation/MatrixRepresentationEvaluationContainer.hpp"
+#include "Mathematical/Representation/PackedSymmetricRankFourTensor.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
 #include "Mathematical/Representation/SquareRankFourTensor.hpp"
 #include "Mathematical/Representation/StorageArray.hpp"
 #include "Mathematical/Representation/Tensor.hpp"
+#include "Mathematical/Representation/ThreadPoolTensorDevice.hpp"
 #include "Molecule/Molecule.hpp"
 #include "Molecule/NuclearFramework.hpp"
 #include "Molecule/Nucleus.hpp"
@@ -162,6 +170,7 @@
 #include "Operator/FirstQuantized/NuclearDipoleOperator.hpp"
 #include "Operator/FirstQuantized/Operator.hpp"
 #include "Operator/FirstQuantized/OverlapOperator.hpp"
+#include "Operator/SecondQuantized/CholeskyDecomposedRSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/EvaluatableScalarRSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/GSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/GSQTwoElectronOperator.hpp"
@@ -169,6 +178,8 @@
 #include "Operator/SecondQuantized/ModelHamiltonian/HoppingMatrix.hpp"
 #include "Operator/SecondQuantized/ModelHamiltonian/HubbardHamiltonian.hpp"
 #include "Operator/SecondQuantized/OperatorTraits.hpp"
+#include "Operator/SecondQuantized/PackedRSQHamiltonian.hpp"
+#include "Operator/SecondQuantized/PackedRSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/PureUSQTwoElectronOperatorComponent.hpp"
 #include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/RSQTwoElectronOperator.hpp"
@@ -201,6 +212,8 @@
 #include "QCMethod/CI/CI.hpp"
 #include "QCMethod/CI/CIEnvironment.hpp"
 #include "QCMethod/CI/DOCINewtonOrbitalOptimizer.hpp"
+#include "QCMethod/CI/HeatBathCI.hpp"
+#include "QCMethod/CI/HeatBathExcitationGenerator.hpp"
 #include "QCMethod/Geminals/AP1roG.hpp"
 #include "QCMethod/Geminals/AP1roGJacobiOrbitalOptimizer.hpp"
 #include "QCMethod/Geminals/AP1roGLagrangianNewtonOrbitalOptimizer.hpp"
@@ -263,6 +276,7 @@
 #include "QuantumChemical/SpinResolved.hpp"
 #include "QuantumChemical/SpinResolvedBase.hpp"
 #include "QuantumChemical/spinor_tags.hpp"
+#include "Utilities/BoundedHistory.hpp"
 #include "Utilities/CRTP.hpp"
 #include "Utilities/Eigen.hpp"
 #include "Utilities/aliases.hpp"
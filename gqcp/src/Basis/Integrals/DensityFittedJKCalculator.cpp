@@ -0,0 +1,325 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Basis/Integrals/DensityFittedJKCalculator.hpp"
+
+#include "Basis/Integrals/Interfaces/LibintInterfacer.hpp"
+#include "Operator/FirstQuantized/Operator.hpp"
+#include "Utilities/threading.hpp"
+
+#include <Eigen/Cholesky>
+#include <Eigen/Eigenvalues>
+#include <Eigen/SVD>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param three_center_integrals       The three-center Coulomb integrals (mu nu|P) as a K^2 x N_aux matrix, whose row index is mu + K nu.
+ *  @param metric                       The (positive definite) Coulomb metric V_{PQ} = (P|Q) of the auxiliary basis.
+ *  @param number_of_threads            The number of threads over which the auxiliary basis functions should be distributed.
+ */
+DensityFittedJKCalculator::DensityFittedJKCalculator(const MatrixX<double>& three_center_integrals, const SquareMatrix<double>& metric, const size_t number_of_threads) :
+    K {static_cast<size_t>(std::llround(std::sqrt(static_cast<double>(three_center_integrals.rows()))))},
+    B {three_center_integrals},
+    number_of_threads {number_of_threads} {
+
+    if (this->K * this->K != static_cast<size_t>(three_center_integrals.rows())) {
+        throw std::invalid_argument("DensityFittedJKCalculator::DensityFittedJKCalculator(const MatrixX<double>&, const SquareMatrix<double>&, const size_t): The number of rows of the three-center integrals should be the square of the number of basis functions.");
+    }
+
+    if (metric.dimension() != static_cast<size_t>(three_center_integrals.cols())) {
+        throw std::invalid_argument("DensityFittedJKCalculator::DensityFittedJKCalculator(const MatrixX<double>&, const SquareMatrix<double>&, const size_t): The dimension of the metric should be equal to the number of auxiliary basis functions.");
+    }
+
+    if (number_of_threads == 0) {
+        throw std::invalid_argument("DensityFittedJKCalculator::DensityFittedJKCalculator(const MatrixX<double>&, const SquareMatrix<double>&, const size_t): The number of threads should be at least 1.");
+    }
+
+
+    // Fit the three-center integrals with the Cholesky decomposition V = L L^T of the metric, i.e. solve B L^T = (mu nu|P) for B.
+    const Eigen::LLT<Eigen::MatrixXd> metric_decomposition {metric};
+    if (metric_decomposition.info() != Eigen::Success) {
+        throw std::invalid_argument("DensityFittedJKCalculator::DensityFittedJKCalculator(const MatrixX<double>&, const SquareMatrix<double>&, const size_t): The metric is not positive definite. Maybe the auxiliary basis is (nearly) linearly dependent?");
+    }
+    metric_decomposition.matrixU().solveInPlace<Eigen::OnTheRight>(this->B);
+}
+
+
+/*
+ *  MARK: Named constructors
+ */
+
+/**
+ *  Create a density-fitted J/K calculator that uses Libint2 to calculate the three- and two-center Coulomb integrals.
+ *
+ *  @param scalar_basis                 The scalar basis in which the Coulomb and exchange matrices should be expressed.
+ *  @param auxiliary_basis              The auxiliary basis in which the products of the basis functions are fitted, e.g. a JK-fitting basis.
+ *  @param number_of_threads            The number of threads over which the (auxiliary) shells should be distributed.
+ *
+ *  @return A density-fitted J/K calculator that uses Libint2.
+ */
+DensityFittedJKCalculator DensityFittedJKCalculator::Libint(const ScalarBasis<GTOShell>& scalar_basis, const ScalarBasis<GTOShell>& auxiliary_basis, const size_t number_of_threads) {
+
+    if (number_of_threads == 0) {
+        throw std::invalid_argument("DensityFittedJKCalculator::Libint(const ScalarBasis<GTOShell>&, const ScalarBasis<GTOShell>&, const size_t): The number of threads should be at least 1.");
+    }
+
+    const auto shell_set = scalar_basis.shellSet();
+    const auto auxiliary_shell_set = auxiliary_basis.shellSet();
+    const auto K = shell_set.numberOfBasisFunctions();
+    const auto N_aux = auxiliary_shell_set.numberOfBasisFunctions();
+
+
+    // Interface all shells to libint2 once, and determine the index of the first basis function of every shell.
+    const auto& libint_interfacer = LibintInterfacer::get();
+
+    const auto interface_shells = [&libint_interfacer](const ShellSet<GTOShell>& shells, std::vector<libint2::Shell>& libint_shells, std::vector<size_t>& basis_function_indices) {
+        size_t bf_index = 0;
+        for (const auto& shell : shells.asVector()) {
+            libint_shells.push_back(libint_interfacer.interface(shell));
+            basis_function_indices.push_back(bf_index);
+            bf_index += shell.numberOfBasisFunctions();
+        }
+    };
+
+    std::vector<libint2::Shell> shells, auxiliary_shells;
+    std::vector<size_t> bf_indices, auxiliary_bf_indices;
+    interface_shells(shell_set, shells, bf_indices);
+    interface_shells(auxiliary_shell_set, auxiliary_shells, auxiliary_bf_indices);
+
+    const auto max_nprim = std::max(shell_set.maximumNumberOfPrimitives(), auxiliary_shell_set.maximumNumberOfPrimitives());
+    const auto max_l = std::max(shell_set.maximumAngularMomentum(), auxiliary_shell_set.maximumAngularMomentum());
+    const auto& unit_shell = libint2::Shell::unit();
+
+
+    // Calculate the three-center integrals (P|mu nu) for every auxiliary shell P on its own thread, such that every thread writes to its own columns. Every thread uses its own engine.
+    std::vector<libint2::Engine> three_center_engines(std::max<size_t>(std::min(number_of_threads, auxiliary_shells.size()), 1), libint_interfacer.createEngine(Operator::Coulomb(), max_nprim, max_l, libint2::BraKet::xs_xx));
+
+    MatrixX<double> three_center_integrals = MatrixX<double>::Zero(K * K, N_aux);
+    forEachIndexDynamically(number_of_threads, auxiliary_shells.size(), [&](const size_t thread_index, const size_t P) {
+        auto& engine = three_center_engines[thread_index];
+        const auto& buffer = engine.results();
+
+        const auto n_P = auxiliary_shells[P].size();
+        for (size_t a = 0; a < shells.size(); a++) {
+            const auto n_a = shells[a].size();
+            for (size_t b = 0; b <= a; b++) {
+                const auto n_b = shells[b].size();
+
+                engine.compute(auxiliary_shells[P], unit_shell, shells[a], shells[b]);
+                if (buffer[0] == nullptr) {
+                    continue;  // All integrals have been screened out.
+                }
+
+                // The libint2 buffer is stored in row-major order.
+                for (size_t f_P = 0; f_P < n_P; f_P++) {
+                    const auto p = auxiliary_bf_indices[P] + f_P;
+                    for (size_t f_a = 0; f_a < n_a; f_a++) {
+                        const auto mu = bf_indices[a] + f_a;
+                        for (size_t f_b = 0; f_b < n_b; f_b++) {
+                            const auto nu = bf_indices[b] + f_b;
+
+                            const auto value = buffer[0][(f_P * n_a + f_a) * n_b + f_b];
+                            three_center_integrals(mu + K * nu, p) = value;
+                            three_center_integrals(nu + K * mu, p) = value;
+                        }
+                    }
+                }
+            }
+        }
+    });
+
+
+    // Calculate the lower triangle of the two-center metric (P|Q) with P >= Q, and symmetrize it afterwards.
+    std::vector<libint2::Engine> two_center_engines(three_center_engines.size(), libint_interfacer.createEngine(Operator::Coulomb(), max_nprim, max_l, libint2::BraKet::xs_xs));
+
+    SquareMatrix<double> metric = SquareMatrix<double>::Zero(N_aux);
+    forEachIndexDynamically(number_of_threads, auxiliary_shells.size(), [&](const size_t thread_index, const size_t P) {
+        auto& engine = two_center_engines[thread_index];
+        const auto& buffer = engine.results();
+
+        const auto n_P = auxiliary_shells[P].size();
+        for (size_t Q = 0; Q <= P; Q++) {
+            const auto n_Q = auxiliary_shells[Q].size();
+
+            engine.compute(auxiliary_shells[P], unit_shell, auxiliary_shells[Q], unit_shell);
+            if (buffer[0] == nullptr) {
+                continue;
+            }
+
+            for (size_t f_P = 0; f_P < n_P; f_P++) {
+                for (size_t f_Q = 0; f_Q < n_Q; f_Q++) {
+                    metric(auxiliary_bf_indices[P] + f_P, auxiliary_bf_indices[Q] + f_Q) = buffer[0][f_P * n_Q + f_Q];
+                }
+            }
+        }
+    });
+    metric.triangularView<Eigen::StrictlyUpper>() = metric.transpose();
+
+    return DensityFittedJKCalculator(three_center_integrals, metric, number_of_threads);
+}
+
+
+/*
+ *  MARK: Coulomb and exchange matrices
+ */
+
+/**
+ *  Calculate the Coulomb and exchange matrices of a number of density matrices.
+ *
+ *  @param density_matrices         The density matrices, expressed in the scalar basis of this calculator.
+ *
+ *  @return The Coulomb matrices (first) and the exchange matrices (second), in the order of the given density matrices.
+ *
+ *  @note Every density matrix is factorized through a singular value decomposition P = U S V^T, such that K(P) = sum_Q (B^Q V) S (B^Q U)^T only involves the non-zero singular values. For a density matrix of N_occ occupied orbitals, this reduces the cost of the exchange matrix from O(K^3 N_aux) to O(K^2 N_occ N_aux).
+ */
+std::pair<std::vector<SquareMatrix<double>>, std::vector<SquareMatrix<double>>> DensityFittedJKCalculator::calculate(const std::vector<SquareMatrix<double>>& density_matrices) const {
+
+    const auto K = this->K;
+    const auto N_aux = this->numberOfAuxiliaryBasisFunctions();
+    const auto number_of_densities = density_matrices.size();
+    for (const auto& P : density_matrices) {
+        if (P.dimension() != K) {
+            throw std::invalid_argument("DensityFittedJKCalculator::calculate(const std::vector<SquareMatrix<double>>&): The dimension of a density matrix is incompatible with the number of basis functions.");
+        }
+    }
+
+
+    // The Coulomb matrices only require two matrix-matrix products for all density matrices together:
+    //      gamma(Q) = B^Q_{kappa lambda} P_{kappa lambda},
+    //      J(P)_{mu nu} = B^Q_{mu nu} gamma(Q).
+    MatrixX<double> P_vectors {K * K, number_of_densities};
+    for (size_t n = 0; n < number_of_densities; n++) {
+        P_vectors.col(n) = Eigen::Map<const Eigen::VectorXd>(density_matrices[n].data(), K * K);
+    }
+    const MatrixX<double> gamma = this->B.transpose() * P_vectors;
+    const MatrixX<double> J_vectors = this->B * gamma;
+
+
+    // Factorize the transpose of every density matrix as P^T = Y diag(s) X^T, keeping only the non-negligible factors. For a symmetric density matrix, X = Y follows from its eigendecomposition, otherwise Y = V and X = U follow from its singular value decomposition P = U S V^T.
+    struct Factorization {
+        MatrixX<double> X;
+        MatrixX<double> Y;
+        Eigen::VectorXd s;
+        bool is_symmetric;
+    };
+
+    std::vector<Factorization> factorizations;
+    factorizations.reserve(number_of_densities);
+    for (const auto& P : density_matrices) {
+        Factorization factorization;
+        factorization.is_symmetric = (P == P.transpose());
+
+        Eigen::VectorXd values;
+        MatrixX<double> left;
+        MatrixX<double> right;
+        if (factorization.is_symmetric) {
+            const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {P};
+            values = eigensolver.eigenvalues();
+            left = eigensolver.eigenvectors();
+            right = left;
+        } else {
+            const Eigen::BDCSVD<Eigen::MatrixXd> svd {P, Eigen::ComputeThinU | Eigen::ComputeThinV};
+            values = svd.singularValues();
+            left = svd.matrixU();
+            right = svd.matrixV();
+        }
+
+        // Factors whose weight is negligible with respect to the largest one don't contribute in double precision.
+        const double threshold = std::numeric_limits<double>::epsilon() * K * (values.size() > 0 ? values.cwiseAbs().maxCoeff() : 0.0);
+        std::vector<Eigen::Index> kept;
+        for (Eigen::Index i = 0; i < values.size(); i++) {
+            if (std::abs(values(i)) > threshold) {
+                kept.push_back(i);
+            }
+        }
+
+        factorization.X = MatrixX<double>::Zero(K, kept.size());
+        factorization.Y = MatrixX<double>::Zero(K, kept.size());
+        factorization.s = Eigen::VectorXd::Zero(kept.size());
+        for (size_t i = 0; i < kept.size(); i++) {
+            factorization.X.col(i) = left.col(kept[i]);
+            factorization.Y.col(i) = right.col(kept[i]);
+            factorization.s(i) = values(kept[i]);
+        }
+
+        factorizations.push_back(std::move(factorization));
+    }
+
+
+    // The exchange matrices are accumulated over the auxiliary basis functions:
+    //      K(P) = sum_Q B^Q P^T B^Q = sum_Q (B^Q Y) diag(s) (B^Q^T X)^T.
+    // Every thread handles a contiguous range of auxiliary basis functions and accumulates its contributions in its own exchange matrices.
+    std::vector<std::vector<MatrixX<double>>> K_threads(this->number_of_threads, std::vector<MatrixX<double>>(number_of_densities, MatrixX<double>::Zero(K, K)));
+
+    const auto number_of_chunks = forEachChunkConcurrently(this->number_of_threads, N_aux, [&](const size_t thread_index, const size_t begin, const size_t end) {
+        auto& K_thread = K_threads[thread_index];
+
+        for (size_t Q = begin; Q < end; Q++) {
+            const Eigen::Map<const Eigen::MatrixXd> B_Q {this->B.col(Q).data(), static_cast<Eigen::Index>(K), static_cast<Eigen::Index>(K)};
+
+            for (size_t n = 0; n < number_of_densities; n++) {
+                const auto& factorization = factorizations[n];
+                if (factorization.s.size() == 0) {
+                    continue;
+                }
+
+                const MatrixX<double> BY = B_Q * factorization.Y;
+                const MatrixX<double> BY_weighted = BY * factorization.s.asDiagonal();
+                if (factorization.is_symmetric) {
+                    K_thread[n].noalias() += BY_weighted * BY.transpose();
+                } else {
+                    const MatrixX<double> BX = B_Q.transpose() * factorization.X;
+                    K_thread[n].noalias() += BY_weighted * BX.transpose();
+                }
+            }
+        }
+    });
+
+
+    // Reduce the contributions of all threads, in a fixed order.
+    std::vector<SquareMatrix<double>> J_matrices;
+    std::vector<SquareMatrix<double>> K_matrices;
+    J_matrices.reserve(number_of_densities);
+    K_matrices.reserve(number_of_densities);
+    for (size_t n = 0; n < number_of_densities; n++) {
+        const MatrixX<double> J = Eigen::Map<const Eigen::MatrixXd>(J_vectors.col(n).data(), K, K);
+        J_matrices.emplace_back(J);
+
+        MatrixX<double> K_matrix = K_threads[0][n];
+        for (size_t thread_index = 1; thread_index < number_of_chunks; thread_index++) {
+            K_matrix += K_threads[thread_index][n];
+        }
+        K_matrices.emplace_back(K_matrix);
+    }
+
+    return {J_matrices, K_matrices};
+}
+
+
+}  // namespace GQCP
@@ -0,0 +1,290 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Basis/Integrals/DirectJKCalculator.hpp"
+
+#include "Basis/Integrals/IntegralEngine.hpp"
+#include "Operator/FirstQuantized/Operator.hpp"
+#include "Utilities/threading.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <tuple>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param engine                   The engine that calculates the Coulomb repulsion integrals over shell quartets. It is cloned, so it may be discarded afterwards.
+ *  @param shell_set                The shells over which the two-electron integrals should be calculated.
+ *  @param screening_threshold      The threshold for the density-weighted Cauchy-Schwarz upper bound of a shell quartet, below which its contributions are neglected.
+ *  @param number_of_threads        The number of threads over which the shell quartets should be distributed.
+ */
+DirectJKCalculator::DirectJKCalculator(const BaseTwoElectronIntegralEngine<GTOShell, 1, double>& engine, const ShellSet<GTOShell>& shell_set, const double screening_threshold, const size_t number_of_threads) :
+    engine {engine.clone()},
+    shell_set {shell_set},
+    screening_threshold {screening_threshold},
+    number_of_threads {number_of_threads} {
+
+    if (screening_threshold < 0.0) {
+        throw std::invalid_argument("DirectJKCalculator::DirectJKCalculator(const BaseTwoElectronIntegralEngine<GTOShell, 1, double>&, const ShellSet<GTOShell>&, const double, const size_t): The screening threshold cannot be negative.");
+    }
+
+    if (number_of_threads == 0) {
+        throw std::invalid_argument("DirectJKCalculator::DirectJKCalculator(const BaseTwoElectronIntegralEngine<GTOShell, 1, double>&, const ShellSet<GTOShell>&, const double, const size_t): The number of threads should be at least 1.");
+    }
+
+
+    // Determine the index of the first basis function of every shell.
+    const auto shells = this->shell_set.asVector();
+    const auto nsh = shells.size();
+
+    size_t bf_index = 0;
+    this->basis_function_indices.reserve(nsh);
+    for (const auto& shell : shells) {
+        this->basis_function_indices.push_back(bf_index);
+        bf_index += shell.numberOfBasisFunctions();
+    }
+
+
+    // Calculate the Cauchy-Schwarz upper bounds sqrt(max |(ab|ab)|) for every pair of shells. Every shell a is handled by one thread, with its own clone of the engine.
+    this->schwarz_bounds = MatrixX<double>::Zero(nsh, nsh);
+
+    std::vector<std::unique_ptr<BaseTwoElectronIntegralEngine<GTOShell, 1, double>>> engines;
+    for (size_t thread_index = 0; thread_index < std::max<size_t>(std::min(number_of_threads, nsh), 1); thread_index++) {
+        engines.push_back(engine.clone());
+    }
+
+    forEachIndexDynamically(number_of_threads, nsh, [&](const size_t thread_index, const size_t a) {
+        for (size_t b = 0; b <= a; b++) {
+            const auto buffer = engines[thread_index]->calculate(shells[a], shells[b], shells[a], shells[b]);
+            if (!buffer->areIntegralsAllZero()) {
+                this->schwarz_bounds(a, b) = std::sqrt(buffer->maximumAbsoluteValue());
+                this->schwarz_bounds(b, a) = this->schwarz_bounds(a, b);
+            }
+        }
+    });
+}
+
+
+/*
+ *  MARK: Named constructors
+ */
+
+/**
+ *  Create a direct J/K calculator that uses Libint2 to calculate the Coulomb repulsion integrals.
+ * 
+ *  @param scalar_basis             The scalar basis in which the Coulomb and exchange matrices should be expressed.
+ *  @param screening_threshold      The threshold for the density-weighted Cauchy-Schwarz upper bound of a shell quartet, below which its contributions are neglected.
+ *  @param number_of_threads        The number of threads over which the shell quartets should be distributed.
+ * 
+ *  @return A direct J/K calculator that uses Libint2.
+ */
+DirectJKCalculator DirectJKCalculator::Libint(const ScalarBasis<GTOShell>& scalar_basis, const double screening_threshold, const size_t number_of_threads) {
+
+    const auto shell_set = scalar_basis.shellSet();
+    const auto engine = IntegralEngine::Libint(Operator::Coulomb(), shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum());
+
+    return DirectJKCalculator(engine, shell_set, screening_threshold, number_of_threads);
+}
+
+
+/*
+ *  MARK: Coulomb and exchange matrices
+ */
+
+/**
+ *  Calculate the Coulomb and exchange matrices of a number of density matrices, using only one pass over the two-electron integrals.
+ * 
+ *  @param density_matrices         The density matrices, expressed in the scalar basis of this calculator.
+ * 
+ *  @return The Coulomb matrices (first) and the exchange matrices (second), in the order of the given density matrices.
+ */
+std::pair<std::vector<SquareMatrix<double>>, std::vector<SquareMatrix<double>>> DirectJKCalculator::calculate(const std::vector<SquareMatrix<double>>& density_matrices) const {
+
+    const auto nbf = this->numberOfBasisFunctions();
+    const auto number_of_densities = density_matrices.size();
+    for (const auto& P : density_matrices) {
+        if (P.dimension() != nbf) {
+            throw std::invalid_argument("DirectJKCalculator::calculate(const std::vector<SquareMatrix<double>>&): The dimension of a density matrix is incompatible with the number of basis functions.");
+        }
+    }
+
+
+    // Determine the largest absolute density matrix element of every (symmetrized) pair of shells, which enters the density-weighted screening.
+    const auto shells = this->shell_set.asVector();
+    const auto nsh = shells.size();
+
+    MatrixX<double> P_max = MatrixX<double>::Zero(nsh, nsh);
+    for (size_t a = 0; a < nsh; a++) {
+        const auto nbf_a = static_cast<long>(shells[a].numberOfBasisFunctions());
+        for (size_t b = 0; b < nsh; b++) {
+            const auto nbf_b = static_cast<long>(shells[b].numberOfBasisFunctions());
+            for (const auto& P : density_matrices) {
+                const double block_max = P.block(this->basis_function_indices[a], this->basis_function_indices[b], nbf_a, nbf_b).cwiseAbs().maxCoeff();
+                P_max(a, b) = std::max(P_max(a, b), block_max);
+                P_max(b, a) = std::max(P_max(b, a), block_max);
+            }
+        }
+    }
+
+
+    // Enumerate the unique pairs of shells a >= b, such that the compound index ab = a * (a + 1) / 2 + b is their position in the enumeration.
+    std::vector<std::pair<size_t, size_t>> shell_pairs;
+    shell_pairs.reserve(nsh * (nsh + 1) / 2);
+    for (size_t a = 0; a < nsh; a++) {
+        for (size_t b = 0; b <= a; b++) {
+            shell_pairs.emplace_back(a, b);
+        }
+    }
+    const auto number_of_pairs = shell_pairs.size();
+
+
+    // Every thread accumulates its contributions in its own Coulomb and exchange matrices, using its own clone of the engine.
+    const auto number_of_workers = std::max<size_t>(std::min(this->number_of_threads, number_of_pairs), 1);
+
+    std::vector<std::unique_ptr<BaseTwoElectronIntegralEngine<GTOShell, 1, double>>> engines;
+    std::vector<std::vector<MatrixX<double>>> J_threads(number_of_workers, std::vector<MatrixX<double>>(number_of_densities, MatrixX<double>::Zero(nbf, nbf)));
+    std::vector<std::vector<MatrixX<double>>> K_threads = J_threads;
+    for (size_t thread_index = 0; thread_index < number_of_workers; thread_index++) {
+        engines.push_back(this->engine->clone());
+    }
+
+
+    // Loop over the unique shell quartets (ab|cd) with ab >= cd. The pairs with the most quartets are handed out first, to balance the load at the end.
+    forEachIndexDynamically(this->number_of_threads, number_of_pairs, [&](const size_t thread_index, const size_t task_index) {
+        auto& thread_engine = *engines[thread_index];
+        auto& J = J_threads[thread_index];
+        auto& K = K_threads[thread_index];
+
+        const auto ab = number_of_pairs - 1 - task_index;
+        size_t a, b;
+        std::tie(a, b) = shell_pairs[ab];
+
+        for (size_t cd = 0; cd <= ab; cd++) {
+            size_t c, d;
+            std::tie(c, d) = shell_pairs[cd];
+
+            // Screen the quartet with the largest density matrix element that it is contracted with, in any of its symmetry-related positions.
+            const auto P_quartet = std::max({P_max(a, b), P_max(c, d), P_max(a, c), P_max(a, d), P_max(b, c), P_max(b, d)});
+            if (this->schwarz_bounds(a, b) * this->schwarz_bounds(c, d) * P_quartet < this->screening_threshold) {
+                continue;
+            }
+
+            const auto buffer = thread_engine.calculate(shells[a], shells[b], shells[c], shells[d]);
+            if (buffer->areIntegralsAllZero()) {
+                continue;
+            }
+
+
+            // Every calculated integral (pq|rs) represents all its symmetry-related integrals. At the level of shells, only the permutations that lead to a different quartet should be taken into account, since the others are already part of the calculated buffer.
+            const bool is_bra_degenerate = (a == b);
+            const bool is_ket_degenerate = (c == d);
+            const bool is_braket_degenerate = (ab == cd);
+
+            const auto bf_a = this->basis_function_indices[a];
+            const auto bf_b = this->basis_function_indices[b];
+            const auto bf_c = this->basis_function_indices[c];
+            const auto bf_d = this->basis_function_indices[d];
+
+            std::array<std::array<size_t, 4>, 8> permutations;
+            for (size_t f1 = 0; f1 < buffer->numberOfBasisFunctionsInShell1(); f1++) {
+                const auto p = bf_a + f1;
+                for (size_t f2 = 0; f2 < buffer->numberOfBasisFunctionsInShell2(); f2++) {
+                    const auto q = bf_b + f2;
+                    for (size_t f3 = 0; f3 < buffer->numberOfBasisFunctionsInShell3(); f3++) {
+                        const auto r = bf_c + f3;
+                        for (size_t f4 = 0; f4 < buffer->numberOfBasisFunctionsInShell4(); f4++) {
+                            const auto s = bf_d + f4;
+
+                            const auto value = buffer->value(0, f1, f2, f3, f4);
+                            if (value == 0.0) {
+                                continue;
+                            }
+
+                            size_t number_of_permutations = 0;
+                            permutations[number_of_permutations++] = {p, q, r, s};
+                            if (!is_bra_degenerate) {
+                                permutations[number_of_permutations++] = {q, p, r, s};
+                            }
+                            if (!is_ket_degenerate) {
+                                permutations[number_of_permutations++] = {p, q, s, r};
+                            }
+                            if (!is_bra_degenerate && !is_ket_degenerate) {
+                                permutations[number_of_permutations++] = {q, p, s, r};
+                            }
+                            if (!is_braket_degenerate) {
+                                const auto number_of_bra_ket_permutations = number_of_permutations;
+                                for (size_t i = 0; i < number_of_bra_ket_permutations; i++) {
+                                    const auto& permutation = permutations[i];
+                                    permutations[number_of_permutations++] = {permutation[2], permutation[3], permutation[0], permutation[1]};
+                                }
+                            }
+
+
+                            // Contract every symmetry-related integral (mu nu|kappa lambda) with the density matrices:
+                            //      J(mu nu) += (mu nu|kappa lambda) P(kappa lambda),
+                            //      K(mu lambda) += (mu nu|kappa lambda) P(kappa nu).
+                            for (size_t i = 0; i < number_of_permutations; i++) {
+                                const auto mu = permutations[i][0];
+                                const auto nu = permutations[i][1];
+                                const auto kappa = permutations[i][2];
+                                const auto lambda = permutations[i][3];
+
+                                for (size_t n = 0; n < number_of_densities; n++) {
+                                    const auto& P = density_matrices[n];
+                                    J[n](mu, nu) += value * P(kappa, lambda);
+                                    K[n](mu, lambda) += value * P(kappa, nu);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    });
+
+
+    // Reduce the contributions of all threads, in a fixed order.
+    std::vector<SquareMatrix<double>> J_matrices;
+    std::vector<SquareMatrix<double>> K_matrices;
+    J_matrices.reserve(number_of_densities);
+    K_matrices.reserve(number_of_densities);
+    for (size_t n = 0; n < number_of_densities; n++) {
+        MatrixX<double> J = J_threads[0][n];
+        MatrixX<double> K = K_threads[0][n];
+        for (size_t thread_index = 1; thread_index < number_of_workers; thread_index++) {
+            J += J_threads[thread_index][n];
+            K += K_threads[thread_index][n];
+        }
+
+        J_matrices.emplace_back(J);
+        K_matrices.emplace_back(K);
+    }
+
+    return {J_matrices, K_matrices};
+}
+
+
+}  // namespace GQCP
@@ -0,0 +1,761 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Basis/Integrals/FCIDUMP.hpp"
+
+#include "Utilities/miscellaneous.hpp"
+#include "Utilities/threading.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <regex>
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+namespace {
+
+
+/*
+ *  MARK: Parsing helpers
+ */
+
+// The identification of the binary integral format and its current version.
+constexpr char binary_magic[8] = {'G', 'Q', 'C', 'P', 'I', 'N', 'T', '\0'};
+constexpr std::uint64_t binary_version = 1;
+
+
+/**
+ *  A line of the body of an FCIDUMP file: a value, followed by four (one-based) orbital indices.
+ */
+struct FCIDUMPEntry {
+    double value;
+    std::uint32_t i;
+    std::uint32_t a;
+    std::uint32_t j;
+    std::uint32_t b;
+};
+
+
+/**
+ *  @return If the given character separates two fields on a line.
+ */
+inline bool isBlank(const char c) { return (c == ' ') || (c == '\t') || (c == '\r'); }
+
+
+/**
+ *  @return If the given character is a decimal digit. In contrast to std::isdigit, this doesn't depend on the locale.
+ */
+inline bool isDigit(const char c) { return (c >= '0') && (c <= '9'); }
+
+
+/**
+ *  Advance the given position past any blank characters.
+ */
+inline void skipBlanks(const char*& position, const char* end) {
+    while ((position < end) && isBlank(*position)) {
+        position++;
+    }
+}
+
+
+/**
+ *  @return If the given position is at the end of a field, i.e. at a blank character, a newline or the end of the text.
+ */
+inline bool isEndOfField(const char* position, const char* end) { return (position == end) || isBlank(*position) || (*position == '\n'); }
+
+
+/**
+ *  Parse a floating point number in decimal notation, where the exponent may be introduced by 'e', 'E', 'd' or 'D'.
+ *
+ *  The (at most 19) leading significant digits are accumulated in an integer, which is scaled by exact powers of ten in extended precision. For the numbers that are typically found in FCIDUMP files (at most 17 significant digits and small decimal exponents), this gives a value that is accurate to within one ulp. Since the scaled value is rounded twice (once in extended precision and once to double), it isn't guaranteed to be the correctly rounded one.
+ *
+ *  @param position             The position of the first character of the number. It is advanced past the number.
+ *  @param end                  The end of the text.
+ *  @param value                The parsed number.
+ *
+ *  @return If a number could be parsed.
+ */
+bool parseReal(const char*& position, const char* end, double& value) {
+
+    static const long double powers_of_ten[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    const char* p = position;
+
+    bool is_negative = false;
+    if ((p < end) && ((*p == '+') || (*p == '-'))) {
+        is_negative = (*p == '-');
+        p++;
+    }
+
+
+    // Accumulate the significant digits of the integer and fractional parts.
+    std::uint64_t mantissa = 0;
+    int number_of_significant_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+
+    const auto accumulate = [&](const int digit, const bool is_fractional) {
+        if (number_of_significant_digits < 19) {
+            mantissa = 10 * mantissa + digit;
+            if (mantissa != 0) {
+                number_of_significant_digits++;
+            }
+            exponent -= is_fractional;
+        } else {
+            exponent += !is_fractional;  // Digits that don't fit in the mantissa only contribute to its magnitude.
+        }
+    };
+
+    for (; (p < end) && isDigit(*p); p++) {
+        accumulate(*p - '0', false);
+        has_digits = true;
+    }
+    if ((p < end) && (*p == '.')) {
+        for (p++; (p < end) && isDigit(*p); p++) {
+            accumulate(*p - '0', true);
+            has_digits = true;
+        }
+    }
+
+    if (!has_digits) {
+        return false;
+    }
+
+
+    // Read the (optional) explicit exponent.
+    if ((p < end) && ((*p == 'e') || (*p == 'E') || (*p == 'd') || (*p == 'D'))) {
+        p++;
+
+        bool is_negative_exponent = false;
+        if ((p < end) && ((*p == '+') || (*p == '-'))) {
+            is_negative_exponent = (*p == '-');
+            p++;
+        }
+
+        if ((p == end) || !isDigit(*p)) {
+            return false;
+        }
+
+        int explicit_exponent = 0;
+        for (; (p < end) && isDigit(*p); p++) {
+            explicit_exponent = std::min(10 * explicit_exponent + (*p - '0'), 100000);  // Such large exponents over- or underflow anyways.
+        }
+        exponent += is_negative_exponent ? -explicit_exponent : explicit_exponent;
+    }
+
+
+    // Scale the mantissa by the exact powers of ten. The extended precision of long double (where available) keeps the mantissa exact, so that only the final rounding to double remains.
+    long double result = static_cast<long double>(mantissa);
+    if (mantissa != 0) {
+        for (; exponent > 22; exponent -= 22) {
+            result *= powers_of_ten[22];
+        }
+        for (; exponent < -22; exponent += 22) {
+            result /= powers_of_ten[22];
+        }
+        result = (exponent >= 0) ? result * powers_of_ten[exponent] : result / powers_of_ten[-exponent];
+    }
+
+    value = static_cast<double>(is_negative ? -result : result);
+    position = p;
+    return true;
+}
+
+
+/**
+ *  Parse a non-negative integer.
+ *
+ *  @param position             The position of the first digit. It is advanced past the integer.
+ *  @param end                  The end of the text.
+ *  @param index                The parsed integer.
+ *
+ *  @return If an integer could be parsed.
+ */
+bool parseIndex(const char*& position, const char* end, std::uint32_t& index) {
+
+    const char* p = position;
+    if ((p == end) || !isDigit(*p)) {
+        return false;
+    }
+
+    std::uint64_t result = 0;
+    for (; (p < end) && isDigit(*p); p++) {
+        result = 10 * result + (*p - '0');
+        if (result > UINT32_MAX) {
+            return false;
+        }
+    }
+
+    index = static_cast<std::uint32_t>(result);
+    position = p;
+    return true;
+}
+
+
+/**
+ *  Parse the lines of the body of an FCIDUMP file. Empty lines are skipped.
+ *
+ *  @param begin                The start of the text, which should be the start of a line.
+ *  @param end                  The end of the text.
+ *  @param entries              The entries to which the parsed lines are appended.
+ */
+void parseBody(const char* begin, const char* end, std::vector<FCIDUMPEntry>& entries) {
+
+    const char* p = begin;
+    while (p < end) {
+        skipBlanks(p, end);
+        if (p == end) {
+            break;
+        }
+        if (*p == '\n') {
+            p++;
+            continue;
+        }
+
+        const char* line_begin = p;
+        FCIDUMPEntry entry;
+        bool is_valid = parseReal(p, end, entry.value) && isEndOfField(p, end);
+        for (auto* index : {&entry.i, &entry.a, &entry.j, &entry.b}) {
+            skipBlanks(p, end);
+            is_valid = is_valid && parseIndex(p, end, *index) && isEndOfField(p, end);
+        }
+
+        skipBlanks(p, end);
+        if (!is_valid || ((p < end) && (*p != '\n'))) {
+            const char* line_end = std::find(line_begin, end, '\n');
+            throw std::invalid_argument("FCIDUMP::Read(const std::string&, const size_t, const size_t): The .FCIDUMP-file contains a malformed line: '" + std::string(line_begin, std::min(line_end, line_begin + 80)) + "'.");
+        }
+
+        entries.push_back(entry);
+    }
+}
+
+
+/**
+ *  @param line                 A line of text.
+ *
+ *  @return If the given line terminates the header (namelist) of an FCIDUMP file, i.e. if it contains '&END' or starts or ends with '/'.
+ */
+bool isEndOfHeader(const std::string& line) {
+
+    std::string upper = line;
+    std::transform(upper.begin(), upper.end(), upper.begin(), [](const char c) { return static_cast<char>(std::toupper(static_cast<unsigned char>(c))); });
+
+    const auto first = upper.find_first_not_of(" \t\r\n");
+    const auto last = upper.find_last_not_of(" \t\r\n");
+    return (upper.find("&END") != std::string::npos) || ((first != std::string::npos) && ((upper[first] == '/') || (upper[last] == '/')));
+}
+
+
+/**
+ *  Parse the integer values of a key in the header of an FCIDUMP file, i.e. the comma- or blank-separated integers that follow 'KEY='. The values end at the first token that isn't an integer.
+ *
+ *  @param text                 The text that follows 'KEY='.
+ *
+ *  @return The integer values.
+ */
+std::vector<long> parseHeaderValues(const std::string& text) {
+
+    std::vector<long> values;
+
+    const char* p = text.data();
+    const char* end = p + text.size();
+    while (p < end) {
+        while ((p < end) && (isBlank(*p) || (*p == ',') || (*p == '\n'))) {
+            p++;
+        }
+
+        const char* start = p;
+        if ((p < end) && ((*p == '+') || (*p == '-'))) {
+            p++;
+        }
+        if ((p == end) || !isDigit(*p)) {
+            break;
+        }
+        for (; (p < end) && isDigit(*p); p++) {
+        }
+
+        values.push_back(std::stol(std::string(start, p)));
+    }
+
+    return values;
+}
+
+
+}  // namespace
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param h                            The (symmetric) one-electron integrals.
+ *  @param g                            The unique two-electron integrals, in chemist's notation.
+ *  @param N                            The number of electrons.
+ *  @param core_energy                  The core energy, e.g. the internuclear repulsion energy.
+ *  @param ms2                          Twice the spin projection, i.e. N_alpha - N_beta.
+ *  @param orbital_symmetries           The irreducible representation of every orbital. If empty, every orbital is assigned to the totally symmetric irreducible representation.
+ *  @param isym                         The irreducible representation of the wave function.
+ */
+FCIDUMP::FCIDUMP(const SquareMatrix<double>& h, const PackedSymmetricRankFourTensor& g, const size_t N, const double core_energy, const int ms2, const std::vector<int>& orbital_symmetries, const int isym) :
+    N {N},
+    ms2 {ms2},
+    isym {isym},
+    orbsym {orbital_symmetries},
+    core_energy {core_energy},
+    h {h},
+    g {g} {
+
+    const auto K = g.dimension();
+    if (h.dimension() != K) {
+        throw std::invalid_argument("FCIDUMP::FCIDUMP(const SquareMatrix<double>&, const PackedSymmetricRankFourTensor&, const size_t, const double, const int, const std::vector<int>&, const int): The dimensions of the one- and two-electron integrals are incompatible.");
+    }
+
+    if (this->orbsym.empty()) {
+        this->orbsym.assign(K, 1);
+    } else if (this->orbsym.size() != K) {
+        throw std::invalid_argument("FCIDUMP::FCIDUMP(const SquareMatrix<double>&, const PackedSymmetricRankFourTensor&, const size_t, const double, const int, const std::vector<int>&, const int): The number of orbital symmetries should be equal to the number of orbitals.");
+    }
+}
+
+
+/*
+ *  MARK: Named constructors
+ */
+
+/**
+ *  Parse an FCIDUMP file.
+ *
+ *  The file is read in large blocks. Every block is split at line boundaries into chunks that are parsed concurrently, with a locale-independent number parser. The parsed entries are stored in the order in which they appear in the file, so that the result doesn't depend on the number of threads.
+ *
+ *  @param filename                     The name of the FCIDUMP file.
+ *  @param number_of_threads            The number of threads over which the lines of every block should be distributed.
+ *  @param block_size                   The number of bytes that are read at once.
+ *
+ *  @return The contents of the given FCIDUMP file.
+ *
+ *  @note Lines with only a first index (orbital energies) are skipped.
+ */
+FCIDUMP FCIDUMP::Read(const std::string& filename, const size_t number_of_threads, const size_t block_size) {
+
+    if ((number_of_threads == 0) || (block_size == 0)) {
+        throw std::invalid_argument("FCIDUMP::Read(const std::string&, const size_t, const size_t): The number of threads and the block size should be at least 1.");
+    }
+
+    std::ifstream input_file_stream = validateAndOpen(filename, "FCIDUMP");
+
+
+    // The buffer holds the unparsed remainder of the previous block, followed by the newly read block.
+    std::vector<char> buffer;
+    size_t buffer_size = 0;
+    bool is_end_of_file = false;
+
+    const auto read_block = [&]() {
+        buffer.resize(buffer_size + block_size);
+        input_file_stream.read(buffer.data() + buffer_size, static_cast<std::streamsize>(block_size));
+        buffer_size += static_cast<size_t>(input_file_stream.gcount());
+        is_end_of_file = !input_file_stream;
+    };
+
+
+    // Collect the lines of the header (namelist) until its terminator, reading more blocks if necessary.
+    std::string header;
+    size_t body_begin = 0;
+    for (bool has_header_ended = false; !has_header_ended;) {
+        const auto line_end = std::find(buffer.begin() + body_begin, buffer.begin() + buffer_size, '\n');
+        if ((line_end == buffer.begin() + buffer_size) && !is_end_of_file) {
+            read_block();
+            continue;
+        }
+
+        const std::string line(buffer.begin() + body_begin, line_end);
+        header += line + '\n';
+        body_begin = std::min<size_t>(line_end - buffer.begin() + 1, buffer_size);
+        has_header_ended = isEndOfHeader(line);
+
+        if (!has_header_ended && (body_begin == buffer_size) && is_end_of_file) {
+            throw std::invalid_argument("FCIDUMP::Read(const std::string&, const size_t, const size_t): The .FCIDUMP-file is invalid: its header isn't terminated by '&END' or '/'.");
+        }
+    }
+
+
+    // Every 'KEY=' in the header is followed by its values, up to the next key.
+    size_t K = 0;
+    size_t N = 0;
+    int ms2 = 0;
+    int isym = 1;
+    std::vector<int> orbsym;
+
+    const std::regex key_regex {R"(([A-Za-z_][A-Za-z0-9_]*)\s*=)"};
+    const std::sregex_iterator keys_begin {header.begin(), header.end(), key_regex};
+    const std::vector<std::smatch> keys(keys_begin, std::sregex_iterator());
+    for (size_t k = 0; k < keys.size(); k++) {
+        std::string key = keys[k][1].str();
+        std::transform(key.begin(), key.end(), key.begin(), [](const char c) { return static_cast<char>(std::toupper(static_cast<unsigned char>(c))); });
+
+        const auto values_begin = keys[k][0].second;
+        const auto values_end = (k + 1 < keys.size()) ? keys[k + 1][0].first : header.cend();
+        const auto values = parseHeaderValues(std::string(values_begin, values_end));
+        if (values.empty()) {
+            continue;
+        }
+
+        if (key == "NORB") {
+            K = static_cast<size_t>(std::max<long>(values[0], 0));
+        } else if (key == "NELEC") {
+            N = static_cast<size_t>(std::max<long>(values[0], 0));
+        } else if (key == "MS2") {
+            ms2 = static_cast<int>(values[0]);
+        } else if (key == "ISYM") {
+            isym = static_cast<int>(values[0]);
+        } else if (key == "ORBSYM") {
+            orbsym.assign(values.begin(), values.end());
+        }
+    }
+
+    if (K == 0) {
+        throw std::invalid_argument("FCIDUMP::Read(const std::string&, const size_t, const size_t): The .FCIDUMP-file is invalid: could not read a number of orbitals.");
+    }
+    if (!orbsym.empty() && (orbsym.size() != K)) {
+        throw std::invalid_argument("FCIDUMP::Read(const std::string&, const size_t, const size_t): The .FCIDUMP-file is invalid: the number of orbital symmetries differs from the number of orbitals.");
+    }
+
+
+    // Parse the body block by block. Every chunk of a block is parsed into its own list of entries, which are applied in the order of the chunks afterwards.
+    SquareMatrix<double> h = SquareMatrix<double>::Zero(K);
+    PackedSymmetricRankFourTensor g {K};
+    double core_energy = 0.0;
+
+    const auto apply = [&](const FCIDUMPEntry& entry) {
+        if ((entry.i > K) || (entry.a > K) || (entry.j > K) || (entry.b > K)) {
+            throw std::invalid_argument("FCIDUMP::Read(const std::string&, const size_t, const size_t): The .FCIDUMP-file contains an orbital index that exceeds the number of orbitals.");
+        }
+
+        // See also (http://hande.readthedocs.io/en/latest/manual/integrals.html). The two-electron integrals are given in chemist's notation.
+        if ((entry.i > 0) && (entry.a > 0) && (entry.j > 0) && (entry.b > 0)) {
+            g(entry.i - 1, entry.a - 1, entry.j - 1, entry.b - 1) = entry.value;  // The packed storage applies the permutational symmetries for real orbitals.
+        } else if ((entry.j != 0) || (entry.b != 0)) {
+            throw std::invalid_argument("FCIDUMP::Read(const std::string&, const size_t, const size_t): The .FCIDUMP-file contains a two-electron integral with a zero index.");
+        } else if ((entry.i > 0) && (entry.a > 0)) {
+            h(entry.i - 1, entry.a - 1) = entry.value;
+            h(entry.a - 1, entry.i - 1) = entry.value;
+        } else if (entry.i == 0 && entry.a == 0) {
+            core_energy = entry.value;
+        } else if (entry.i == 0) {
+            throw std::invalid_argument("FCIDUMP::Read(const std::string&, const size_t, const size_t): The .FCIDUMP-file contains a one-electron integral with a zero index.");
+        }
+        // The remaining lines contain single-particle energies, which are skipped.
+    };
+
+    std::vector<std::vector<FCIDUMPEntry>> chunk_entries(number_of_threads);
+    std::vector<const char*> chunk_begins(number_of_threads + 1);
+    constexpr size_t minimal_chunk_size = 1 << 16;
+    while (true) {
+        if (!is_end_of_file) {
+            read_block();
+        }
+
+        // Only complete lines are parsed, unless the end of the file has been reached.
+        const char* begin = buffer.data() + body_begin;
+        const char* end = buffer.data() + buffer_size;
+        if (!is_end_of_file) {
+            const char* last_newline = end;
+            while ((last_newline > begin) && (*(last_newline - 1) != '\n')) {
+                last_newline--;
+            }
+            end = last_newline;
+        }
+
+        // Split the complete lines into chunks that start at the beginning of a line.
+        const size_t length = end - begin;
+        const size_t number_of_chunks = std::max<size_t>(std::min(number_of_threads, length / minimal_chunk_size), 1);
+        chunk_begins[0] = begin;
+        for (size_t c = 1; c < number_of_chunks; c++) {
+            const char* nominal_begin = std::max(begin + c * (length / number_of_chunks), chunk_begins[c - 1]);
+            const char* newline = std::find(nominal_begin, end, '\n');
+            chunk_begins[c] = (newline == end) ? end : newline + 1;
+        }
+        chunk_begins[number_of_chunks] = end;
+
+        forEachChunkConcurrently(number_of_chunks, number_of_chunks, [&](const size_t, const size_t chunk_begin, const size_t chunk_end) {
+            for (size_t c = chunk_begin; c < chunk_end; c++) {
+                chunk_entries[c].clear();
+                parseBody(chunk_begins[c], chunk_begins[c + 1], chunk_entries[c]);
+            }
+        });
+
+        for (size_t c = 0; c < number_of_chunks; c++) {
+            for (const auto& entry : chunk_entries[c]) {
+                apply(entry);
+            }
+        }
+
+        if (is_end_of_file) {
+            break;
+        }
+
+        // Move the incomplete last line to the front of the buffer.
+        std::copy(end, static_cast<const char*>(buffer.data() + buffer_size), buffer.data());
+        buffer_size = buffer.data() + buffer_size - end;
+        body_begin = 0;
+    }
+
+    return FCIDUMP(h, g, N, core_energy, ms2, orbsym, isym);
+}
+
+
+/**
+ *  Read a binary integral file that was written by `writeBinary`.
+ *
+ *  @param filename                     The name of the binary integral file, with extension '.gqcpint'.
+ *
+ *  @return The contents of the given binary integral file.
+ */
+FCIDUMP FCIDUMP::ReadBinary(const std::string& filename) {
+
+    std::ifstream input_file_stream = validateAndOpen(filename, "gqcpint");
+
+    const auto read = [&input_file_stream](void* destination, const size_t number_of_bytes) {
+        input_file_stream.read(static_cast<char*>(destination), static_cast<std::streamsize>(number_of_bytes));
+        if (static_cast<size_t>(input_file_stream.gcount()) != number_of_bytes) {
+            throw std::invalid_argument("FCIDUMP::ReadBinary(const std::string&): The binary integral file is truncated.");
+        }
+    };
+
+
+    // Read and check the header.
+    char magic[8];
+    std::uint64_t version, K, N;
+    std::int64_t ms2, isym;
+    double core_energy;
+
+    read(magic, sizeof(magic));
+    read(&version, sizeof(version));
+    if ((std::memcmp(magic, binary_magic, sizeof(magic)) != 0) || (version != binary_version)) {
+        throw std::invalid_argument("FCIDUMP::ReadBinary(const std::string&): The given file isn't a binary integral file of a supported version.");
+    }
+
+    read(&K, sizeof(K));
+    read(&N, sizeof(N));
+    read(&ms2, sizeof(ms2));
+    read(&isym, sizeof(isym));
+    read(&core_energy, sizeof(core_energy));
+
+    std::vector<std::int64_t> orbsym_words(K);
+    read(orbsym_words.data(), K * sizeof(std::int64_t));
+
+
+    // Read the packed integrals, where the two-electron integrals are read directly into their final storage.
+    std::vector<double> h_packed(K * (K + 1) / 2);
+    read(h_packed.data(), h_packed.size() * sizeof(double));
+
+    SquareMatrix<double> h {K};
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q <= p; q++) {
+            h(p, q) = h_packed[PackedSymmetricRankFourTensor::pairIndex(p, q)];
+            h(q, p) = h(p, q);
+        }
+    }
+
+    PackedSymmetricRankFourTensor g {K};
+    read(g.packedElements().data(), g.numberOfElements() * sizeof(double));
+
+    return FCIDUMP(h, g, N, core_energy, static_cast<int>(ms2), std::vector<int>(orbsym_words.begin(), orbsym_words.end()), static_cast<int>(isym));
+}
+
+
+/*
+ *  MARK: Writing
+ */
+
+/**
+ *  Write these integrals to an FCIDUMP file. The unique two-electron integrals (ij|kl) with i >= j, k >= l and ij >= kl are listed first, followed by the one-electron integrals with i >= j and the core energy.
+ *
+ *  @param filename                     The name of the FCIDUMP file.
+ *  @param threshold                    The threshold below which (in absolute value) integrals aren't written.
+ *  @param number_of_threads            The number of threads over which the formatting of the two-electron integrals should be distributed.
+ */
+void FCIDUMP::write(const std::string& filename, const double threshold, const size_t number_of_threads) const {
+
+    if (number_of_threads == 0) {
+        throw std::invalid_argument("FCIDUMP::write(const std::string&, const double, const size_t): The number of threads should be at least 1.");
+    }
+
+    std::ofstream output_file_stream {filename, std::ios::binary};
+    if (!output_file_stream.good()) {
+        throw std::invalid_argument("FCIDUMP::write(const std::string&, const double, const size_t): The file could not be opened for writing.");
+    }
+
+    // Every line is formatted with 17 significant digits, so that it can be read back without loss of precision. The formatting doesn't depend on the locale, unless a locale has been installed through std::setlocale.
+    const auto append_line = [](std::string& text, const double value, const size_t i, const size_t a, const size_t j, const size_t b) {
+        char line[128];
+        const int length = std::snprintf(line, sizeof(line), "%23.16E %4zu %4zu %4zu %4zu\n", value, i, a, j, b);
+        text.append(line, static_cast<size_t>(length));
+    };
+
+
+    // Write the header.
+    const auto K = this->numberOfOrbitals();
+    std::string header = " &FCI NORB=" + std::to_string(K) + ",NELEC=" + std::to_string(this->N) + ",MS2=" + std::to_string(this->ms2) + ",\n  ORBSYM=";
+    for (const auto irrep : this->orbsym) {
+        header += std::to_string(irrep) + ",";
+    }
+    header += "\n  ISYM=" + std::to_string(this->isym) + ",\n &END\n";
+    output_file_stream << header;
+
+
+    // Group the pair indices PQ into batches of about the same number of unique two-electron integrals, which are formatted concurrently and written in order.
+    const auto P = this->g.numberOfPairs();
+    constexpr size_t elements_per_batch = 1 << 18;
+
+    std::vector<size_t> batch_begins {0};
+    for (size_t PQ = 0, count = 0; PQ < P; PQ++) {
+        count += PQ + 1;
+        if ((count >= elements_per_batch) || (PQ + 1 == P)) {
+            batch_begins.push_back(PQ + 1);
+            count = 0;
+        }
+    }
+    const size_t number_of_batches = batch_begins.size() - 1;
+
+    const auto& elements = this->g.packedElements();
+    std::vector<std::string> texts(number_of_threads);
+    for (size_t round_begin = 0; round_begin < number_of_batches; round_begin += number_of_threads) {
+        const size_t round_size = std::min(number_of_threads, number_of_batches - round_begin);
+
+        forEachIndexDynamically(number_of_threads, round_size, [&](const size_t, const size_t i) {
+            auto& text = texts[i];
+            text.clear();
+
+            const size_t PQ_begin = batch_begins[round_begin + i];
+            const size_t PQ_end = batch_begins[round_begin + i + 1];
+
+            // Find the orbital pair (p, q) with p >= q that corresponds to the first pair index of the batch.
+            size_t p = static_cast<size_t>((std::sqrt(8.0 * PQ_begin + 1.0) - 1.0) / 2.0);
+            while (p * (p + 1) / 2 > PQ_begin) {
+                p--;
+            }
+            while ((p + 1) * (p + 2) / 2 <= PQ_begin) {
+                p++;
+            }
+            size_t q = PQ_begin - p * (p + 1) / 2;
+
+            for (size_t PQ = PQ_begin; PQ < PQ_end; PQ++) {
+                const auto* row = elements.data() + PQ * (PQ + 1) / 2;  // The elements g(pq, rs) with rs <= pq are contiguous.
+
+                size_t RS = 0;
+                for (size_t r = 0; (r <= p) && (RS <= PQ); r++) {
+                    for (size_t s = 0; (s <= r) && (RS <= PQ); s++, RS++) {
+                        if (std::abs(row[RS]) >= threshold) {
+                            append_line(text, row[RS], p + 1, q + 1, r + 1, s + 1);
+                        }
+                    }
+                }
+
+                if (q == p) {
+                    p++;
+                    q = 0;
+                } else {
+                    q++;
+                }
+            }
+        });
+
+        for (size_t i = 0; i < round_size; i++) {
+            output_file_stream << texts[i];
+        }
+    }
+
+
+    // Write the one-electron integrals and the core energy.
+    std::string text;
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q <= p; q++) {
+            if (std::abs(this->h(p, q)) >= threshold) {
+                append_line(text, this->h(p, q), p + 1, q + 1, 0, 0);
+            }
+        }
+    }
+    append_line(text, this->core_energy, 0, 0, 0, 0);
+    output_file_stream << text;
+
+    if (!output_file_stream.good()) {
+        throw std::runtime_error("FCIDUMP::write(const std::string&, const double, const size_t): The FCIDUMP file could not be written.");
+    }
+}
+
+
+/**
+ *  Write these integrals to a binary integral file, whose layout is described in the class documentation.
+ *
+ *  @param filename                     The name of the binary integral file, with extension '.gqcpint'.
+ */
+void FCIDUMP::writeBinary(const std::string& filename) const {
+
+    std::ofstream output_file_stream {filename, std::ios::binary};
+    if (!output_file_stream.good()) {
+        throw std::invalid_argument("FCIDUMP::writeBinary(const std::string&): The file could not be opened for writing.");
+    }
+
+    const auto write = [&output_file_stream](const void* source, const size_t number_of_bytes) {
+        output_file_stream.write(static_cast<const char*>(source), static_cast<std::streamsize>(number_of_bytes));
+    };
+
+
+    // Write the header, in which every field occupies 8 bytes.
+    const std::uint64_t K = this->numberOfOrbitals();
+    const std::uint64_t N = this->N;
+    const std::int64_t ms2 = this->ms2;
+    const std::int64_t isym = this->isym;
+    const std::vector<std::int64_t> orbsym_words(this->orbsym.begin(), this->orbsym.end());
+
+    write(binary_magic, sizeof(binary_magic));
+    write(&binary_version, sizeof(binary_version));
+    write(&K, sizeof(K));
+    write(&N, sizeof(N));
+    write(&ms2, sizeof(ms2));
+    write(&isym, sizeof(isym));
+    write(&this->core_energy, sizeof(this->core_energy));
+    write(orbsym_words.data(), K * sizeof(std::int64_t));
+
+
+    // Write the packed integrals.
+    std::vector<double> h_packed(K * (K + 1) / 2);
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q <= p; q++) {
+            h_packed[PackedSymmetricRankFourTensor::pairIndex(p, q)] = this->h(p, q);
+        }
+    }
+    write(h_packed.data(), h_packed.size() * sizeof(double));
+    write(this->g.packedElements().data(), this->g.numberOfElements() * sizeof(double));
+
+    if (!output_file_stream.good()) {
+        throw std::runtime_error("FCIDUMP::writeBinary(const std::string&): The binary integral file could not be written.");
+    }
+}
+
+
+}  // namespace GQCP
@@ -268,6 +268,24 @@ libint2::Engine LibintInterfacer::createEngine(const CoulombRepulsionOperator& o
 }
 
 
+/**
+ *  Construct a libint2 engine that calculates Coulomb repulsion integrals over fewer than four shells, such as the three- and two-center integrals that are needed for density fitting. The missing shells should be passed as libint2::Shell::unit()
+ * 
+ *  @param op               the Coulomb repulsion operator
+ *  @param max_nprim        the maximum number of primitives per contracted Gaussian shell
+ *  @param max_l            the maximum angular momentum of Gaussian shell
+ *  @param braket           the type of the bra and ket: libint2::BraKet::xs_xx for three-center integrals (P|ab) and libint2::BraKet::xs_xs for two-center integrals (P|Q)
+ * 
+ *  @return the proper libint2 engine
+ */
+libint2::Engine LibintInterfacer::createEngine(const CoulombRepulsionOperator& op, const size_t max_nprim, const size_t max_l, const libint2::BraKet braket) const {
+
+    auto engine = libint2::Engine(libint2::Operator::coulomb, max_nprim, static_cast<int>(max_l));
+    engine.set(braket);
+    return engine;
+}
+
+
 /**
  *  Construct a libint2 engine that corresponds to the given operator
  * 
@@ -17,6 +17,9 @@
 
 #include "Basis/Integrals/McMurchieDavidsonCoefficient.hpp"
 
+#include <cmath>
+#include <stdexcept>
+
 
 namespace GQCP {
 
@@ -28,14 +31,62 @@ namespace GQCP {
 /**
  *  @param K                one of the components of the center of the left Cartesian GTO
  *  @param alpha            the Gaussian exponent of the left Cartesian GTO
- *  @param L                one of the components of the center of the left Cartesian GTO
+ *  @param L                one of the components of the center of the right Cartesian GTO
  *  @param beta             the Gaussian exponent of the right Cartesian GTO
+ *  @param i_max            the largest Cartesian exponent of the left Cartesian GTO for which the coefficients should be tabulated
+ *  @param j_max            the largest Cartesian exponent of the right Cartesian GTO for which the coefficients should be tabulated
  */
-McMurchieDavidsonCoefficient::McMurchieDavidsonCoefficient(const double K, const double alpha, const double L, const double beta) :
+McMurchieDavidsonCoefficient::McMurchieDavidsonCoefficient(const double K, const double alpha, const double L, const double beta, const int i_max, const int j_max) :
     K {K},
     L {L},
     alpha {alpha},
-    beta {beta} {}
+    beta {beta},
+    i_max {i_max},
+    j_max {j_max} {
+
+    if ((i_max < 0) || (j_max < 0)) {
+        throw std::invalid_argument("McMurchieDavidsonCoefficient::McMurchieDavidsonCoefficient(const double, const double, const double, const double, const int, const int): The maximum Cartesian exponents cannot be negative.");
+    }
+
+
+    // Every coefficient E^{i,j}_t with t > i + j vanishes, so the degree of the Hermite Gaussians runs over [0, i_max + j_max]. The zero-initialization takes care of the vanishing coefficients.
+    const auto t_dim = i_max + j_max + 1;
+    this->coefficients = std::vector<double>((i_max + 1) * (j_max + 1) * t_dim, 0.0);
+
+    const auto index = [j_max, t_dim](const int i, const int j, const int t) { return (i * (j_max + 1) + j) * t_dim + t; };
+
+
+    // The recurrence relations only differ in the distance between the center of mass and the center of the left (PA) or right (PB) Cartesian GTO.
+    const auto p = this->totalExponent();
+    const auto one_over_2p = 1.0 / (2 * p);
+    const auto X_PA = -this->beta / p * this->distance();
+    const auto X_PB = this->alpha / p * this->distance();
+
+    auto& E = this->coefficients;
+    E[index(0, 0, 0)] = std::exp(-this->reducedExponent() * std::pow(this->distance(), 2));
+
+    // Fill the coefficients E^{i,0}_t by raising i, and then fill every E^{i,j}_t by raising j, starting from E^{i,0}_t.
+    for (int i = 0; i <= i_max; i++) {
+        if (i > 0) {
+            for (int t = 0; t <= i; t++) {
+                const auto lower = (t > 0) ? E[index(i - 1, 0, t - 1)] : 0.0;
+                const auto upper = (t + 1 <= i - 1) ? E[index(i - 1, 0, t + 1)] : 0.0;
+
+                E[index(i, 0, t)] = one_over_2p * lower + X_PA * E[index(i - 1, 0, t)] + (t + 1) * upper;
+            }
+        }
+
+        for (int j = 1; j <= j_max; j++) {
+            for (int t = 0; t <= i + j; t++) {
+                const auto lower = (t > 0) ? E[index(i, j - 1, t - 1)] : 0.0;
+                const auto middle = (t <= i + j - 1) ? E[index(i, j - 1, t)] : 0.0;
+                const auto upper = (t + 1 <= i + j - 1) ? E[index(i, j - 1, t + 1)] : 0.0;
+
+                E[index(i, j, t)] = one_over_2p * lower + X_PB * middle + (t + 1) * upper;
+            }
+        }
+    }
+}
 
 
 /*
@@ -52,29 +103,17 @@ McMurchieDavidsonCoefficient::McMurchieDavidsonCoefficient(const double K, const
  */
 double McMurchieDavidsonCoefficient::operator()(const int i, const int j, const int t) const {
 
+    if ((i < 0) || (j < 0) || (i > this->i_max) || (j > this->j_max)) {
+        throw std::invalid_argument("McMurchieDavidsonCoefficient::operator()(const int, const int, const int): The given Cartesian exponents are not tabulated.");
+    }
+
     // Check if t is out of bounds: 0 <= t <= i+j.
     if ((t < 0) || (t > (i + j))) {
         return 0.0;
     }
 
-
-    // Provide the base recurrence case.
-    else if ((t == 0) && (i == 0) && (j == 0)) {
-        return std::exp(-this->reducedExponent() * std::pow(this->distance(), 2));
-    }
-
-    // Do the recurrence for E^{i+1, j}_t.
-    else if (j == 0) {
-        return 1.0 / (2 * this->totalExponent()) * this->operator()(i - 1, j, t - 1) +
-               (t + 1) * this->operator()(i - 1, j, t + 1) -
-               this->beta / this->totalExponent() * this->distance() * this->operator()(i - 1, j, t);
-    }
-
-    else {  // do the recurrence for E^{i, j+1}_t
-        return 1.0 / (2 * this->totalExponent()) * this->operator()(i, j - 1, t - 1) +
-               (t + 1) * this->operator()(i, j - 1, t + 1) +
-               this->alpha / this->totalExponent() * this->distance() * this->operator()(i, j - 1, t);
-    }
+    const auto t_dim = this->i_max + this->j_max + 1;
+    return this->coefficients[(i * (this->j_max + 1) + j) * t_dim + t];
 }
 
 
@@ -72,6 +72,11 @@ PrimitiveAngularMomentumIntegralEngine::IntegralScalar PrimitiveAngularMomentumI
     const auto L_y = right.center()(CartesianDirection::y);
     const auto L_z = right.center()(CartesianDirection::z);
 
+    // All 1-D integrals over the same pair of primitives can share the same table of McMurchie-Davidson coefficients.
+    const McMurchieDavidsonCoefficient E_x {K_x, alpha, L_x, beta, i, j + 1};
+    const McMurchieDavidsonCoefficient E_y {K_y, alpha, L_y, beta, k, l + 1};
+    const McMurchieDavidsonCoefficient E_z {K_z, alpha, L_z, beta, m, n + 1};
+
 
     // For each component of the angular momentum operator, the integrals can be calculated through overlap integrals, linear momentum integrals and position/dipole integrals.
     PrimitiveOverlapIntegralEngine overlap_engine;
@@ -84,39 +89,39 @@ PrimitiveAngularMomentumIntegralEngine::IntegralScalar PrimitiveAngularMomentumI
     case CartesianDirection::x: {
         dipole_engine.prepareStateForComponent(CartesianDirection::y);
         linear_momentum_engine.prepareStateForComponent(CartesianDirection::z);
-        const IntegralScalar term1 = -dipole_engine.calculate1D(alpha, K_y, k, beta, L_y, l) * linear_momentum_engine.calculate1D(alpha, K_z, m, beta, L_z, n);  // incorporate the sign
+        const IntegralScalar term1 = -dipole_engine.calculate1D(E_y, k, l) * linear_momentum_engine.calculate1D(E_z, m, n);  // incorporate the sign
 
         linear_momentum_engine.prepareStateForComponent(CartesianDirection::y);
         dipole_engine.prepareStateForComponent(CartesianDirection::z);
-        const IntegralScalar term2 = -linear_momentum_engine.calculate1D(alpha, K_y, k, beta, L_y, l) * dipole_engine.calculate1D(alpha, K_z, m, beta, L_z, n);  // incorporate the sign
+        const IntegralScalar term2 = -linear_momentum_engine.calculate1D(E_y, k, l) * dipole_engine.calculate1D(E_z, m, n);  // incorporate the sign
 
-        return overlap_engine.calculate1D(alpha, K_x, i, beta, L_x, j) * (term1 - term2);  // the cross product
+        return overlap_engine.calculate1D(E_x, i, j) * (term1 - term2);  // the cross product
         break;
     }
 
     case CartesianDirection::y: {
         dipole_engine.prepareStateForComponent(CartesianDirection::z);
         linear_momentum_engine.prepareStateForComponent(CartesianDirection::x);
-        const IntegralScalar term1 = -dipole_engine.calculate1D(alpha, K_z, m, beta, L_z, n) * linear_momentum_engine.calculate1D(alpha, K_x, i, beta, L_x, j);  // incorporate the sign
+        const IntegralScalar term1 = -dipole_engine.calculate1D(E_z, m, n) * linear_momentum_engine.calculate1D(E_x, i, j);  // incorporate the sign
 
         linear_momentum_engine.prepareStateForComponent(CartesianDirection::z);
         dipole_engine.prepareStateForComponent(CartesianDirection::x);
-        const IntegralScalar term2 = -linear_momentum_engine.calculate1D(alpha, K_z, m, beta, L_z, n) * dipole_engine.calculate1D(alpha, K_x, i, beta, L_x, j);  // incorporate the sign
+        const IntegralScalar term2 = -linear_momentum_engine.calculate1D(E_z, m, n) * dipole_engine.calculate1D(E_x, i, j);  // incorporate the sign
 
-        return overlap_engine.calculate1D(alpha, K_y, k, beta, L_y, l) * (term1 - term2);  // the cross product
+        return overlap_engine.calculate1D(E_y, k, l) * (term1 - term2);  // the cross product
         break;
     }
 
     case CartesianDirection::z: {
         dipole_engine.prepareStateForComponent(CartesianDirection::x);
         linear_momentum_engine.prepareStateForComponent(CartesianDirection::y);
-        const IntegralScalar term1 = -dipole_engine.calculate1D(alpha, K_x, i, beta, L_x, j) * linear_momentum_engine.calculate1D(alpha, K_y, k, beta, L_y, l);  // incorporate the sign
+        const IntegralScalar term1 = -dipole_engine.calculate1D(E_x, i, j) * linear_momentum_engine.calculate1D(E_y, k, l);  // incorporate the sign
 
         linear_momentum_engine.prepareStateForComponent(CartesianDirection::x);
         dipole_engine.prepareStateForComponent(CartesianDirection::y);
-        const IntegralScalar term2 = -linear_momentum_engine.calculate1D(alpha, K_x, i, beta, L_x, j) * dipole_engine.calculate1D(alpha, K_y, k, beta, L_y, l);  // incorporate the sign
+        const IntegralScalar term2 = -linear_momentum_engine.calculate1D(E_x, i, j) * dipole_engine.calculate1D(E_y, k, l);  // incorporate the sign
 
-        return overlap_engine.calculate1D(alpha, K_z, m, beta, L_z, n) * (term1 - term2);  // the cross product
+        return overlap_engine.calculate1D(E_z, m, n) * (term1 - term2);  // the cross product
         break;
     }
     }
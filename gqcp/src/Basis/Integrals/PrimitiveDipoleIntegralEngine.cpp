@@ -67,23 +67,28 @@ PrimitiveDipoleIntegralEngine::IntegralScalar PrimitiveDipoleIntegralEngine::cal
     const auto L_y = right.center()(CartesianDirection::y);
     const auto L_z = right.center()(CartesianDirection::z);
 
+    // All 1-D integrals over the same pair of primitives can share the same table of McMurchie-Davidson coefficients.
+    const McMurchieDavidsonCoefficient E_x {K_x, alpha, L_x, beta, i, j};
+    const McMurchieDavidsonCoefficient E_y {K_y, alpha, L_y, beta, k, l};
+    const McMurchieDavidsonCoefficient E_z {K_z, alpha, L_z, beta, m, n};
+
     PrimitiveOverlapIntegralEngine overlap_engine;
 
 
     // For the current component, the integral can be calculated as a product of three contributions.
     switch (this->component) {
     case CartesianDirection::x: {
-        return this->calculate1D(alpha, K_x, i, beta, L_x, j) * overlap_engine.calculate1D(alpha, K_y, k, beta, L_y, l) * overlap_engine.calculate1D(alpha, K_z, m, beta, L_z, n);
+        return this->calculate1D(E_x, i, j) * overlap_engine.calculate1D(E_y, k, l) * overlap_engine.calculate1D(E_z, m, n);
         break;
     }
 
     case CartesianDirection::y: {
-        return overlap_engine.calculate1D(alpha, K_x, i, beta, L_x, j) * this->calculate1D(alpha, K_y, k, beta, L_y, l) * overlap_engine.calculate1D(alpha, K_z, m, beta, L_z, n);
+        return overlap_engine.calculate1D(E_x, i, j) * this->calculate1D(E_y, k, l) * overlap_engine.calculate1D(E_z, m, n);
         break;
     }
 
     case CartesianDirection::z: {
-        return overlap_engine.calculate1D(alpha, K_x, i, beta, L_x, j) * overlap_engine.calculate1D(alpha, K_y, k, beta, L_y, l) * this->calculate1D(alpha, K_z, m, beta, L_z, n);
+        return overlap_engine.calculate1D(E_x, i, j) * overlap_engine.calculate1D(E_y, k, l) * this->calculate1D(E_z, m, n);
         break;
     }
     }
@@ -101,14 +106,27 @@ PrimitiveDipoleIntegralEngine::IntegralScalar PrimitiveDipoleIntegralEngine::cal
  */
 PrimitiveDipoleIntegralEngine::IntegralScalar PrimitiveDipoleIntegralEngine::calculate1D(const double alpha, const double K, const int i, const double beta, const double L, const int j) {
 
+    const McMurchieDavidsonCoefficient E {K, alpha, L, beta, i, j};
+    return this->calculate1D(E, i, j);
+}
+
+
+/**
+ *  @param E                the tabulated McMurchie-Davidson coefficients of the two 1-D primitives, which should contain the coefficients up to (i, j)
+ *  @param i                the Cartesian exponent of the left 1-D primitive
+ *  @param j                the Cartesian exponent of the right 1-D primitive
+ * 
+ *  @return the dipole integral over the two given 1-D primitives
+ */
+PrimitiveDipoleIntegralEngine::IntegralScalar PrimitiveDipoleIntegralEngine::calculate1D(const McMurchieDavidsonCoefficient& E, const int i, const int j) {
+
     // Prepare some variables.
-    const auto p = alpha + beta;
-    const auto P = (alpha * K + beta * L) / p;  // one of the components of the center of mass of the Gaussian overlap distribution
+    const auto p = E.totalExponent();
+    const auto P = E.centerOfMass();  // one of the components of the center of mass of the Gaussian overlap distribution
 
     const auto Delta_PO = P - this->dipole_operator.reference()(this->component);  // one of the components of the distance of P and the origin of the dipole operator
 
     // Calculate the dipole integral over the current component.
-    const McMurchieDavidsonCoefficient E {K, alpha, L, beta};
     return -std::pow(boost::math::constants::pi<IntegralScalar>() / p, 0.5) * (E(i, j, 1) + Delta_PO * E(i, j, 0));  // the minus sign comes from the electronic dipole operator
 }
 
@@ -51,14 +51,19 @@ PrimitiveKineticEnergyIntegralEngine::IntegralScalar PrimitiveKineticEnergyInteg
     const auto L_y = right.center()(CartesianDirection::y);
     const auto L_z = right.center()(CartesianDirection::z);
 
+    // All 1-D integrals over the same pair of primitives can share the same table of McMurchie-Davidson coefficients.
+    const McMurchieDavidsonCoefficient E_x {K_x, alpha, L_x, beta, i, j + 2};
+    const McMurchieDavidsonCoefficient E_y {K_y, alpha, L_y, beta, k, l + 2};
+    const McMurchieDavidsonCoefficient E_z {K_z, alpha, L_z, beta, m, n + 2};
+
 
     // The 3D kinetic energy integral is a sum of three contributions (dx^2, dy^2, dz^2).
     PrimitiveOverlapIntegralEngine primitive_overlap_engine;
 
     IntegralScalar primitive_integral = 1.0;
-    return this->calculate1D(alpha, K_x, i, beta, L_x, j) * primitive_overlap_engine.calculate1D(alpha, K_y, k, beta, L_y, l) * primitive_overlap_engine.calculate1D(alpha, K_z, m, beta, L_z, n) +
-           primitive_overlap_engine.calculate1D(alpha, K_x, i, beta, L_x, j) * this->calculate1D(alpha, K_y, k, beta, L_y, l) * primitive_overlap_engine.calculate1D(alpha, K_z, m, beta, L_z, n) +
-           primitive_overlap_engine.calculate1D(alpha, K_x, i, beta, L_x, j) * primitive_overlap_engine.calculate1D(alpha, K_y, k, beta, L_y, l) * this->calculate1D(alpha, K_z, m, beta, L_z, n);
+    return this->calculate1D(E_x, i, j) * primitive_overlap_engine.calculate1D(E_y, k, l) * primitive_overlap_engine.calculate1D(E_z, m, n) +
+           primitive_overlap_engine.calculate1D(E_x, i, j) * this->calculate1D(E_y, k, l) * primitive_overlap_engine.calculate1D(E_z, m, n) +
+           primitive_overlap_engine.calculate1D(E_x, i, j) * primitive_overlap_engine.calculate1D(E_y, k, l) * this->calculate1D(E_z, m, n);
 }
 
 /**
@@ -73,12 +78,27 @@ PrimitiveKineticEnergyIntegralEngine::IntegralScalar PrimitiveKineticEnergyInteg
  */
 PrimitiveKineticEnergyIntegralEngine::IntegralScalar PrimitiveKineticEnergyIntegralEngine::calculate1D(const double alpha, const double K, const int i, const double beta, const double L, const int j) {
 
-    // The kinetic 1D integral is a sum of three 1D overlap integrals.
+    const McMurchieDavidsonCoefficient E {K, alpha, L, beta, i, j + 2};
+    return this->calculate1D(E, i, j);
+}
+
+
+/**
+ *  @param E                the tabulated McMurchie-Davidson coefficients of the two 1-D primitives, which should contain the coefficients up to (i, j + 2)
+ *  @param i                the Cartesian exponent of the left 1-D primitive
+ *  @param j                the Cartesian exponent of the right 1-D primitive
+ * 
+ *  @return the kinetic energy integral over the two given 1-D primitives
+ */
+PrimitiveKineticEnergyIntegralEngine::IntegralScalar PrimitiveKineticEnergyIntegralEngine::calculate1D(const McMurchieDavidsonCoefficient& E, const int i, const int j) {
+
+    // The kinetic 1D integral is a sum of three 1D overlap integrals, which can all be calculated from the same table of McMurchie-Davidson coefficients.
     PrimitiveOverlapIntegralEngine primitive_overlap_engine;
+    const auto beta = E.rightGaussianExponent();
 
-    return -2 * std::pow(beta, 2) * primitive_overlap_engine.calculate1D(alpha, K, i, beta, L, j + 2) +
-           beta * (2 * j + 1) * primitive_overlap_engine.calculate1D(alpha, K, i, beta, L, j) -
-           0.5 * j * (j - 1) * primitive_overlap_engine.calculate1D(alpha, K, i, beta, L, j - 2);
+    return -2 * std::pow(beta, 2) * primitive_overlap_engine.calculate1D(E, i, j + 2) +
+           beta * (2 * j + 1) * primitive_overlap_engine.calculate1D(E, i, j) -
+           0.5 * j * (j - 1) * primitive_overlap_engine.calculate1D(E, i, j - 2);
 }
 
 
@@ -55,23 +55,28 @@ PrimitiveLinearMomentumIntegralEngine::IntegralScalar PrimitiveLinearMomentumInt
     const auto L_y = right.center()(CartesianDirection::y);
     const auto L_z = right.center()(CartesianDirection::z);
 
+    // All 1-D integrals over the same pair of primitives can share the same table of McMurchie-Davidson coefficients.
+    const McMurchieDavidsonCoefficient E_x {K_x, alpha, L_x, beta, i, j + 1};
+    const McMurchieDavidsonCoefficient E_y {K_y, alpha, L_y, beta, k, l + 1};
+    const McMurchieDavidsonCoefficient E_z {K_z, alpha, L_z, beta, m, n + 1};
+
     PrimitiveOverlapIntegralEngine overlap_engine;
 
 
     // For the current component, the integral can be calculated as a product of three contributions.
     switch (this->component) {
     case CartesianDirection::x: {
-        return this->calculate1D(alpha, K_x, i, beta, L_x, j) * overlap_engine.calculate1D(alpha, K_y, k, beta, L_y, l) * overlap_engine.calculate1D(alpha, K_z, m, beta, L_z, n);
+        return this->calculate1D(E_x, i, j) * overlap_engine.calculate1D(E_y, k, l) * overlap_engine.calculate1D(E_z, m, n);
         break;
     }
 
     case CartesianDirection::y: {
-        return overlap_engine.calculate1D(alpha, K_x, i, beta, L_x, j) * this->calculate1D(alpha, K_y, k, beta, L_y, l) * overlap_engine.calculate1D(alpha, K_z, m, beta, L_z, n);
+        return overlap_engine.calculate1D(E_x, i, j) * this->calculate1D(E_y, k, l) * overlap_engine.calculate1D(E_z, m, n);
         break;
     }
 
     case CartesianDirection::z: {
-        return overlap_engine.calculate1D(alpha, K_x, i, beta, L_x, j) * overlap_engine.calculate1D(alpha, K_y, k, beta, L_y, l) * this->calculate1D(alpha, K_z, m, beta, L_z, n);
+        return overlap_engine.calculate1D(E_x, i, j) * overlap_engine.calculate1D(E_y, k, l) * this->calculate1D(E_z, m, n);
         break;
     }
     }
@@ -90,11 +95,26 @@ PrimitiveLinearMomentumIntegralEngine::IntegralScalar PrimitiveLinearMomentumInt
  */
 PrimitiveLinearMomentumIntegralEngine::IntegralScalar PrimitiveLinearMomentumIntegralEngine::calculate1D(const double alpha, const double K, const int i, const double beta, const double L, const int j) {
 
+    const McMurchieDavidsonCoefficient E {K, alpha, L, beta, i, j + 1};
+    return this->calculate1D(E, i, j);
+}
+
+
+/**
+ *  @param E                the tabulated McMurchie-Davidson coefficients of the two 1-D primitives, which should contain the coefficients up to (i, j + 1)
+ *  @param i                the Cartesian exponent of the left 1-D primitive
+ *  @param j                the Cartesian exponent of the right 1-D primitive
+ * 
+ *  @return the linear momentum integral over the two given 1-D primitives
+ */
+PrimitiveLinearMomentumIntegralEngine::IntegralScalar PrimitiveLinearMomentumIntegralEngine::calculate1D(const McMurchieDavidsonCoefficient& E, const int i, const int j) {
+
     PrimitiveOverlapIntegralEngine overlap_engine;
+    const auto beta = E.rightGaussianExponent();
 
     using namespace GQCP::literals;
-    return 2.0 * 1.0_ii * beta * overlap_engine.calculate1D(alpha, K, i, beta, L, j + 1) -
-           1.0_ii * static_cast<double>(j) * overlap_engine.calculate1D(alpha, K, i, beta, L, j - 1);
+    return 2.0 * 1.0_ii * beta * overlap_engine.calculate1D(E, i, j + 1) -
+           1.0_ii * static_cast<double>(j) * overlap_engine.calculate1D(E, i, j - 1);
 }
 
 
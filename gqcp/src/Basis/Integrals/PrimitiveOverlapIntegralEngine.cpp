@@ -17,8 +17,6 @@
 
 #include "Basis/Integrals/PrimitiveOverlapIntegralEngine.hpp"
 
-#include "Basis/Integrals/McMurchieDavidsonCoefficient.hpp"
-
 #include <boost/math/constants/constants.hpp>
 
 
@@ -40,10 +38,11 @@ PrimitiveOverlapIntegralEngine::IntegralScalar PrimitiveOverlapIntegralEngine::c
     // The 3D integral is separable in three 1D integrals.
     IntegralScalar primitive_integral = 1.0;
     for (const auto& direction : {GQCP::CartesianDirection::x, GQCP::CartesianDirection::y, GQCP::CartesianDirection::z}) {
-        const auto i = left.cartesianExponents().value(direction);
-        const auto j = right.cartesianExponents().value(direction);
+        const auto i = static_cast<int>(left.cartesianExponents().value(direction));
+        const auto j = static_cast<int>(right.cartesianExponents().value(direction));
 
-        primitive_integral *= this->calculate1D(left.gaussianExponent(), left.center()(direction), i, right.gaussianExponent(), right.center()(direction), j);
+        const McMurchieDavidsonCoefficient E {left.center()(direction), left.gaussianExponent(), right.center()(direction), right.gaussianExponent(), i, j};
+        primitive_integral *= this->calculate1D(E, i, j);
     }
 
     return primitive_integral;
@@ -67,10 +66,27 @@ PrimitiveOverlapIntegralEngine::IntegralScalar PrimitiveOverlapIntegralEngine::c
         return 0.0;
     }
 
-    // Use the McMurchie-Davidson recursion to calculate the overlap integral.
-    const auto p = alpha + beta;
-    const McMurchieDavidsonCoefficient E {K, alpha, L, beta};
+    const McMurchieDavidsonCoefficient E {K, alpha, L, beta, i, j};
+    return this->calculate1D(E, i, j);
+}
+
+
+/**
+ *  @param E                the tabulated McMurchie-Davidson coefficients of the two 1-D primitives, which should contain the coefficients up to (i, j)
+ *  @param i                the Cartesian exponent of the left 1-D primitive
+ *  @param j                the Cartesian exponent of the right 1-D primitive
+ * 
+ *  @return the overlap integral over the two given 1-D primitives
+ */
+PrimitiveOverlapIntegralEngine::IntegralScalar PrimitiveOverlapIntegralEngine::calculate1D(const McMurchieDavidsonCoefficient& E, const int i, const int j) {
+
+    // Negative Cartesian exponents should be ignored: the correct value for the corresponding integral is 0.
+    if ((i < 0) || (j < 0)) {
+        return 0.0;
+    }
 
+    // Use the McMurchie-Davidson expansion coefficients to calculate the overlap integral.
+    const auto p = E.totalExponent();
     return std::pow(boost::math::constants::pi<IntegralScalar>() / p, 0.5) * E(i, j, 0);
 }
 
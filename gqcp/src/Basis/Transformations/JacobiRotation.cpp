@@ -68,4 +68,21 @@ std::ostream& operator<<(std::ostream& os, const JacobiRotation& jacobi_rotation
 }
 
 
+/*
+ *  MARK: Conversions
+ */
+
+/**
+ *  @return The 2x2 block of the Jacobi rotation matrix (cfr. `Transformation::FromJacobi`) that lives in the (p,q)-plane, where the first row and column correspond to p and the second row and column correspond to q.
+ */
+Eigen::Matrix2d JacobiRotation::planeMatrix() const {
+
+    // Apply the rotation to the columns of a 2x2 identity matrix, exactly like it is applied to the columns p and q of a full identity matrix.
+    Eigen::Matrix2d G = Eigen::Matrix2d::Identity();
+    G.applyOnTheRight(0, 1, this->Eigen());
+
+    return G;
+}
+
+
 }  // namespace GQCP
@@ -0,0 +1,173 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Mathematical/Optimization/Minimization/AugmentedHessianTrustRegion.hpp"
+
+#include "Mathematical/Optimization/Eigenproblem/Davidson/DavidsonSolver.hpp"
+#include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+
+#include <Eigen/Eigenvalues>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+namespace {
+
+
+/**
+ *  @param matrix_vector_product_function       a function that returns the product of a self-adjoint matrix with a vector
+ *  @param diagonal                             the diagonal of the matrix
+ *  @param guess                                an initial guess for the lowest eigenvector
+ *  @param maximum_subspace_dimension           the maximum dimension of the Davidson subspace before collapsing
+ *  @param convergence_threshold                the threshold on the norm of the Davidson residual vector
+ *  @param maximum_number_of_iterations         the maximum number of Davidson iterations
+ * 
+ *  @return the lowest eigenpair of the matrix, found with Davidson's algorithm or, for matrices whose dimension doesn't exceed the maximum subspace dimension, with a dense diagonalization of the matrix that is set up through matrix-vector products
+ */
+Eigenpair<double> lowestEigenpair(const VectorFunction<double>& matrix_vector_product_function, const VectorX<double>& diagonal, const VectorX<double>& guess, const size_t maximum_subspace_dimension, const double convergence_threshold, const size_t maximum_number_of_iterations) {
+
+    const auto dim = diagonal.size();
+
+    if (dim <= maximum_subspace_dimension) {
+        SquareMatrix<double> M = SquareMatrix<double>::Zero(dim);
+        for (size_t i = 0; i < dim; i++) {
+            M.col(i) = matrix_vector_product_function(VectorX<double>::Unit(dim, i));
+        }
+
+        Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> diagonalizer {0.5 * (M + M.transpose())};
+        return Eigenpair<double>(diagonalizer.eigenvalues()(0), diagonalizer.eigenvectors().col(0));
+    }
+
+    auto environment = EigenproblemEnvironment::Iterative(matrix_vector_product_function, diagonal, guess.normalized());
+    auto solver = EigenproblemSolver::Davidson(1, maximum_subspace_dimension, convergence_threshold, 1.0e-12, maximum_number_of_iterations);
+    solver.perform(environment);
+
+    return environment.eigenpairs(1)[0];
+}
+
+
+}  // namespace
+
+
+/*
+ *  CONSTRUCTORS
+ */
+
+/**
+ *  @param trust_radius                         the maximum norm of a step
+ *  @param maximum_subspace_dimension           the maximum dimension of the Davidson subspace before collapsing
+ *  @param convergence_threshold                the threshold on the norm of the Davidson residual vector
+ *  @param maximum_number_of_iterations         the maximum number of Davidson iterations
+ */
+AugmentedHessianTrustRegion::AugmentedHessianTrustRegion(const double trust_radius, const size_t maximum_subspace_dimension, const double convergence_threshold, const size_t maximum_number_of_iterations) :
+    trust_radius {trust_radius},
+    maximum_subspace_dimension {maximum_subspace_dimension},
+    convergence_threshold {convergence_threshold},
+    maximum_number_of_iterations {maximum_number_of_iterations} {
+
+    if (trust_radius <= 0.0) {
+        throw std::invalid_argument("AugmentedHessianTrustRegion::AugmentedHessianTrustRegion(const double, const size_t, const double, const size_t): The trust radius should be positive.");
+    }
+}
+
+
+/*
+ *  PUBLIC METHODS
+ */
+
+/**
+ *  @param gradient                     the gradient at the current point
+ *  @param hessian_vector_product       a function that returns the product of the Hessian at the current point with a vector
+ *  @param hessian_diagonal             the diagonal of the Hessian at the current point
+ * 
+ *  @return the augmented-Hessian step, whose norm is at most the trust radius
+ * 
+ *  @note If the dimension of the augmented Hessian doesn't exceed the maximum Davidson subspace dimension, it is set up through Hessian-vector products and diagonalized densely.
+ */
+VectorX<double> AugmentedHessianTrustRegion::calculateStep(const VectorX<double>& gradient, const VectorFunction<double>& hessian_vector_product, const VectorX<double>& hessian_diagonal) const {
+
+    const auto dim = gradient.size();
+
+    if (hessian_diagonal.size() != dim) {
+        throw std::invalid_argument("AugmentedHessianTrustRegion::calculateStep(const VectorX<double>&, const VectorFunction<double>&, const VectorX<double>&): The dimensions of the gradient and the Hessian diagonal are not compatible.");
+    }
+
+
+    // The augmented Hessian has the 'energy' direction as its first axis.
+    const VectorFunction<double> augmented_hessian_vector_product = [&gradient, &hessian_vector_product, dim](const VectorX<double>& v) {
+        VectorX<double> result {dim + 1};
+        result(0) = gradient.dot(v.tail(dim));
+        result.tail(dim) = v(0) * gradient + hessian_vector_product(v.tail(dim));
+        return result;
+    };
+
+    // The first diagonal element of the augmented Hessian is zero. Since the lowest eigenvalue approaches zero close to convergence, the Davidson corrections would then be dominated by their first element, which is already spanned by the guess. That element is therefore damped by using the largest Hessian diagonal element in absolute value instead.
+    VectorX<double> augmented_diagonal {dim + 1};
+    augmented_diagonal << std::max(1.0, hessian_diagonal.cwiseAbs().maxCoeff()), hessian_diagonal;
+
+    // Use a diagonal Newton step as the guess for the lowest eigenvector (1, x).
+    VectorX<double> guess {dim + 1};
+    guess(0) = 1.0;
+    for (size_t i = 0; i < dim; i++) {
+        guess(i + 1) = (std::abs(hessian_diagonal(i)) > 1.0e-08) ? -gradient(i) / std::abs(hessian_diagonal(i)) : -gradient(i);
+    }
+
+    const auto eigenpair = lowestEigenpair(augmented_hessian_vector_product, augmented_diagonal, guess, this->maximum_subspace_dimension, this->convergence_threshold, this->maximum_number_of_iterations);
+
+
+    // The step is x = z / z_0. Since g^T x equals the (negative) lowest eigenvalue of the augmented Hessian, it is a descent direction. If that step would leave the trust region, it is scaled back onto it, which also avoids dividing by a (nearly) vanishing z_0.
+    const double z_0 = eigenpair.eigenvector()(0);
+    const VectorX<double> z = eigenpair.eigenvector().tail(dim);
+
+    if (z.norm() <= this->trust_radius * std::abs(z_0)) {
+        return z / z_0;
+    }
+
+    double sign = (z_0 < 0.0) ? -1.0 : 1.0;
+    if ((z_0 == 0.0) && (gradient.dot(z) > 0.0)) {
+        sign = -1.0;
+    }
+    return sign * this->trust_radius * z.normalized();
+}
+
+
+/**
+ *  @param hessian_vector_product       a function that returns the product of the Hessian with a vector
+ *  @param hessian_diagonal             the diagonal of the Hessian
+ * 
+ *  @return the lowest eigenpair of the Hessian
+ * 
+ *  @note If the dimension of the Hessian doesn't exceed the maximum Davidson subspace dimension, it is set up through Hessian-vector products and diagonalized densely.
+ */
+Eigenpair<double> AugmentedHessianTrustRegion::calculateLowestHessianEigenpair(const VectorFunction<double>& hessian_vector_product, const VectorX<double>& hessian_diagonal) const {
+
+    // Use the unit vector that corresponds to the lowest diagonal element as the guess.
+    Eigen::Index lowest_index;
+    hessian_diagonal.minCoeff(&lowest_index);
+    const VectorX<double> guess = VectorX<double>::Unit(hessian_diagonal.size(), lowest_index);
+
+    return lowestEigenpair(hessian_vector_product, hessian_diagonal, guess, this->maximum_subspace_dimension, this->convergence_threshold, this->maximum_number_of_iterations);
+}
+
+
+}  // namespace GQCP
@@ -0,0 +1,411 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Mathematical/Representation/CholeskyDecomposedRankFourTensor.hpp"
+
+#include "Mathematical/Representation/PackedSymmetricRankFourTensor.hpp"
+#include "Utilities/threading.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  Create a tensor without any Cholesky vectors, i.e. a zero tensor.
+ *
+ *  @param dim              The dimension of every axis of the tensor.
+ */
+CholeskyDecomposedRankFourTensor::CholeskyDecomposedRankFourTensor(const size_t dim) :
+    CholeskyDecomposedRankFourTensor(dim, MatrixX<double>::Zero(dim * dim, 0)) {}
+
+
+/**
+ *  @param dim                  The dimension of every axis of the tensor.
+ *  @param cholesky_vectors     The Cholesky vectors as a K^2 x N_L matrix, whose element (p + K q, L) is L^L(p q).
+ */
+CholeskyDecomposedRankFourTensor::CholeskyDecomposedRankFourTensor(const size_t dim, const MatrixX<double>& cholesky_vectors) :
+    dim {dim},
+    L {cholesky_vectors} {
+
+    if (static_cast<size_t>(cholesky_vectors.rows()) != dim * dim) {
+        throw std::invalid_argument("CholeskyDecomposedRankFourTensor::CholeskyDecomposedRankFourTensor(const size_t, const MatrixX<double>&): The number of rows of the Cholesky vectors should be the square of the dimension.");
+    }
+}
+
+
+/*
+ *  MARK: Named constructors
+ */
+
+/**
+ *  Decompose a dense square rank-4 tensor.
+ *
+ *  @param tensor           A dense square rank-4 tensor that has the 8-fold permutational symmetry of two-electron integrals over real orbitals, and whose pair matrix is positive semi-definite.
+ *  @param threshold        The threshold for the largest remaining diagonal element, below which the decomposition is stopped.
+ *
+ *  @return The Cholesky decomposition of the given tensor.
+ */
+CholeskyDecomposedRankFourTensor CholeskyDecomposedRankFourTensor::FromFull(const SquareRankFourTensor<double>& tensor, const double threshold) {
+
+    const auto K = tensor.dimension();
+    const auto number_of_pairs = K * (K + 1) / 2;
+
+    // Every pair forms its own group, since the columns of a dense tensor are readily available.
+    VectorX<double> diagonal {number_of_pairs};
+    std::vector<std::vector<size_t>> pair_groups;
+    pair_groups.reserve(number_of_pairs);
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q <= p; q++) {
+            const auto pq = PackedSymmetricRankFourTensor::pairIndex(p, q);
+            diagonal(pq) = tensor(p, q, p, q);
+            pair_groups.push_back({pq});
+        }
+    }
+
+    const auto calculate_columns = [&tensor, K, number_of_pairs](const size_t rs) {
+        const auto r = static_cast<size_t>((std::sqrt(8.0 * rs + 1.0) - 1.0) / 2.0);  // The inverse of the lower-triangular compound index.
+        const auto s = rs - r * (r + 1) / 2;
+
+        MatrixX<double> column {number_of_pairs, 1};
+        for (size_t p = 0; p < K; p++) {
+            for (size_t q = 0; q <= p; q++) {
+                column(PackedSymmetricRankFourTensor::pairIndex(p, q), 0) = tensor(p, q, r, s);
+            }
+        }
+        return column;
+    };
+
+    return CholeskyDecomposedRankFourTensor::FromPairColumns(K, diagonal, pair_groups, calculate_columns, threshold);
+}
+
+
+/**
+ *  Perform a pivoted Cholesky decomposition of a pair matrix M(pq, rs) = g(p q r s), of which the columns are only calculated when they are needed.
+ *
+ *  The unique pairs (p >= q) are divided into groups, of which all columns are calculated at once. When the largest remaining diagonal element is found, the columns of its group are calculated and as many pivots as possible are taken from that group: the pivots in the group are chosen in order of decreasing remaining diagonal, as long as their remaining diagonal is larger than the threshold and larger than a fraction 1e-2 of the largest remaining diagonal. This amortizes the calculation of the columns of, e.g., a pair of shells over multiple Cholesky vectors.
+ *
+ *  @param dim                  The dimension K of every axis of the tensor.
+ *  @param diagonal             The diagonal elements M(pq, pq) of the pair matrix, for all unique pairs p >= q in the order of `PackedSymmetricRankFourTensor::pairIndex`.
+ *  @param pair_groups          The groups of (compound) pair indices, that together contain every unique pair once.
+ *  @param calculate_columns    A function that calculates the columns M(:, rs) of the pair matrix for all pairs rs in the group with the given index, as a K(K+1)/2 x (group size) matrix whose rows are in the order of `PackedSymmetricRankFourTensor::pairIndex`.
+ *  @param threshold            The threshold for the largest remaining diagonal element, below which the decomposition is stopped.
+ *
+ *  @return The Cholesky decomposition of the pair matrix.
+ */
+CholeskyDecomposedRankFourTensor CholeskyDecomposedRankFourTensor::FromPairColumns(const size_t dim, const VectorX<double>& diagonal, const std::vector<std::vector<size_t>>& pair_groups, const std::function<MatrixX<double>(const size_t)>& calculate_columns, const double threshold) {
+
+    const auto number_of_pairs = dim * (dim + 1) / 2;
+    if (static_cast<size_t>(diagonal.size()) != number_of_pairs) {
+        throw std::invalid_argument("CholeskyDecomposedRankFourTensor::FromPairColumns(const size_t, const VectorX<double>&, const std::vector<std::vector<size_t>>&, const std::function<MatrixX<double>(const size_t)>&, const double): The number of diagonal elements should be equal to the number of unique pairs.");
+    }
+
+    if (threshold < 0.0) {
+        throw std::invalid_argument("CholeskyDecomposedRankFourTensor::FromPairColumns(const size_t, const VectorX<double>&, const std::vector<std::vector<size_t>>&, const std::function<MatrixX<double>(const size_t)>&, const double): The threshold cannot be negative.");
+    }
+
+    std::vector<size_t> group_of_pair(number_of_pairs, pair_groups.size());
+    for (size_t group_index = 0; group_index < pair_groups.size(); group_index++) {
+        for (const auto pq : pair_groups[group_index]) {
+            group_of_pair.at(pq) = group_index;
+        }
+    }
+    if (std::find(group_of_pair.begin(), group_of_pair.end(), pair_groups.size()) != group_of_pair.end()) {
+        throw std::invalid_argument("CholeskyDecomposedRankFourTensor::FromPairColumns(const size_t, const VectorX<double>&, const std::vector<std::vector<size_t>>&, const std::function<MatrixX<double>(const size_t)>&, const double): Every unique pair should be part of a group.");
+    }
+
+
+    // The Cholesky vectors are built up over the unique pairs, with a capacity that is doubled whenever it is exhausted.
+    const double span_factor = 1.0e-02;
+    VectorX<double> D = diagonal;
+    MatrixX<double> L_packed = MatrixX<double>::Zero(number_of_pairs, std::min<size_t>(number_of_pairs, std::max<size_t>(2 * dim, 1)));
+    size_t number_of_vectors = 0;
+
+    while (number_of_vectors < number_of_pairs) {
+        Eigen::Index max_index = 0;
+        const double D_max = D.maxCoeff(&max_index);
+        if (D_max <= threshold) {
+            break;
+        }
+
+        // Calculate the columns of the group of the largest diagonal element, and subtract the contributions of the current Cholesky vectors to obtain the remaining columns.
+        const auto& group = pair_groups[group_of_pair[max_index]];
+        const auto group_size = group.size();
+
+        MatrixX<double> R = calculate_columns(group_of_pair[max_index]);
+        if (static_cast<size_t>(R.rows()) != number_of_pairs || static_cast<size_t>(R.cols()) != group_size) {
+            throw std::invalid_argument("CholeskyDecomposedRankFourTensor::FromPairColumns(const size_t, const VectorX<double>&, const std::vector<std::vector<size_t>>&, const std::function<MatrixX<double>(const size_t)>&, const double): The calculated columns have incompatible dimensions.");
+        }
+
+        if (number_of_vectors > 0) {
+            MatrixX<double> L_group {group_size, number_of_vectors};
+            for (size_t j = 0; j < group_size; j++) {
+                L_group.row(j) = L_packed.row(group[j]).head(number_of_vectors);
+            }
+            R.noalias() -= L_packed.leftCols(number_of_vectors) * L_group.transpose();
+        }
+
+
+        // Take as many pivots from this group as possible. The first pivot is the largest diagonal element itself.
+        const double D_min = std::max(threshold, span_factor * D_max);
+        while (number_of_vectors < number_of_pairs) {
+            size_t j_max = 0;
+            for (size_t j = 1; j < group_size; j++) {
+                if (D(group[j]) > D(group[j_max])) {
+                    j_max = j;
+                }
+            }
+
+            const double D_pivot = D(group[j_max]);
+            if (D_pivot <= D_min) {
+                break;
+            }
+
+            if (number_of_vectors == static_cast<size_t>(L_packed.cols())) {
+                L_packed.conservativeResize(Eigen::NoChange, std::min<size_t>(number_of_pairs, 2 * number_of_vectors));
+            }
+
+            const VectorX<double> l = R.col(j_max) / std::sqrt(D_pivot);
+            L_packed.col(number_of_vectors) = l;
+            number_of_vectors++;
+
+            // Update the remaining diagonal and the remaining columns of this group. Negative remaining diagonal elements can only be due to round-off errors.
+            D = (D - l.cwiseAbs2()).cwiseMax(0.0);
+            D(group[j_max]) = 0.0;
+
+            for (size_t j = 0; j < group_size; j++) {
+                R.col(j) -= l(group[j]) * l;
+            }
+        }
+    }
+
+
+    // Unpack the Cholesky vectors to all (ordered) pairs.
+    MatrixX<double> L_full {dim * dim, number_of_vectors};
+    for (size_t p = 0; p < dim; p++) {
+        for (size_t q = 0; q < dim; q++) {
+            L_full.row(p + dim * q) = L_packed.row(PackedSymmetricRankFourTensor::pairIndex(p, q)).head(number_of_vectors);
+        }
+    }
+
+    return CholeskyDecomposedRankFourTensor {dim, L_full};
+}
+
+
+/*
+ *  MARK: Access
+ */
+
+/**
+ *  @param index        The index of a Cholesky vector.
+ *
+ *  @return The Cholesky vector with the given index, as a K x K matrix.
+ */
+SquareMatrix<double> CholeskyDecomposedRankFourTensor::choleskyVector(const size_t index) const {
+
+    if (index >= this->numberOfCholeskyVectors()) {
+        throw std::invalid_argument("CholeskyDecomposedRankFourTensor::choleskyVector(const size_t): The given index is out of bounds.");
+    }
+
+    const auto K = this->dim;
+    return SquareMatrix<double>(Eigen::Map<const Eigen::MatrixXd>(this->L.col(index).data(), K, K));
+}
+
+
+/*
+ *  MARK: Conversions
+ */
+
+/**
+ *  @return The dense square rank-4 tensor that these Cholesky vectors represent.
+ */
+SquareRankFourTensor<double> CholeskyDecomposedRankFourTensor::full() const {
+
+    // In the column-major storage of a rank-4 tensor, g(p q r s) is the element (p + K q, r + K s) of a K^2 x K^2 matrix.
+    const auto K2 = this->dim * this->dim;
+
+    SquareRankFourTensor<double> g {this->dim};
+    Eigen::Map<Eigen::MatrixXd> g_matrix {g.data(), static_cast<Eigen::Index>(K2), static_cast<Eigen::Index>(K2)};
+    g_matrix.noalias() = this->L * this->L.transpose();
+
+    return g;
+}
+
+
+/*
+ *  MARK: Contractions
+ */
+
+/**
+ *  @param D            A K x K matrix.
+ *
+ *  @return The matrix J(p q) = g(p q r s) D(r s).
+ */
+SquareMatrix<double> CholeskyDecomposedRankFourTensor::contractWithLastPair(const SquareMatrix<double>& D) const {
+
+    const auto K = this->dim;
+    if (D.dimension() != K) {
+        throw std::invalid_argument("CholeskyDecomposedRankFourTensor::contractWithLastPair(const SquareMatrix<double>&): The dimension of the given matrix is incompatible with this tensor.");
+    }
+
+    const Eigen::Map<const Eigen::VectorXd> D_vector {D.data(), static_cast<Eigen::Index>(K * K)};
+    const Eigen::VectorXd gamma = this->L.transpose() * D_vector;
+    const Eigen::VectorXd J_vector = this->L * gamma;
+
+    return SquareMatrix<double>(Eigen::Map<const Eigen::MatrixXd>(J_vector.data(), K, K));
+}
+
+
+/**
+ *  @param D            A K x K matrix.
+ *
+ *  @return The matrix K(p s) = g(p q r s) D(q r).
+ */
+SquareMatrix<double> CholeskyDecomposedRankFourTensor::contractWithInnerPair(const SquareMatrix<double>& D) const {
+
+    const auto K = this->dim;
+    if (D.dimension() != K) {
+        throw std::invalid_argument("CholeskyDecomposedRankFourTensor::contractWithInnerPair(const SquareMatrix<double>&): The dimension of the given matrix is incompatible with this tensor.");
+    }
+
+    // K = sum_L L^L D L^L. Since every Cholesky vector is symmetric, the first product can be done for all Cholesky vectors at once: X(r, pL) = D(q r) L^L(q p) = (L^L D)(p r).
+    const auto N_L = this->numberOfCholeskyVectors();
+    const Eigen::Map<const Eigen::MatrixXd> L_view {this->L.data(), static_cast<Eigen::Index>(K), static_cast<Eigen::Index>(K * N_L)};
+    const Eigen::MatrixXd X = D.transpose() * L_view;
+
+    Eigen::MatrixXd result = Eigen::MatrixXd::Zero(K, K);
+    for (size_t l = 0; l < N_L; l++) {
+        const Eigen::Map<const Eigen::MatrixXd> X_l {X.data() + l * K * K, static_cast<Eigen::Index>(K), static_cast<Eigen::Index>(K)};
+        const Eigen::Map<const Eigen::MatrixXd> L_l {this->L.col(l).data(), static_cast<Eigen::Index>(K), static_cast<Eigen::Index>(K)};
+        result.noalias() += X_l.transpose() * L_l;
+    }
+
+    return SquareMatrix<double>(result);
+}
+
+
+/**
+ *  @param d            A dense square rank-4 tensor.
+ *
+ *  @return The full contraction g(p q r s) d(p q r s).
+ */
+double CholeskyDecomposedRankFourTensor::contractFully(const SquareRankFourTensor<double>& d) const {
+
+    if (d.dimension() != this->dim) {
+        throw std::invalid_argument("CholeskyDecomposedRankFourTensor::contractFully(const SquareRankFourTensor<double>&): The dimension of the given tensor is incompatible with this tensor.");
+    }
+
+    // g(p q r s) d(p q r s) = sum_L L^L(p q) d(pq, rs) L^L(r s), with d viewed as a K^2 x K^2 matrix.
+    const auto K2 = this->dim * this->dim;
+    const Eigen::Map<const Eigen::MatrixXd> d_matrix {d.data(), static_cast<Eigen::Index>(K2), static_cast<Eigen::Index>(K2)};
+
+    return this->L.cwiseProduct(d_matrix * this->L).sum();
+}
+
+
+/*
+ *  MARK: Basis transformations
+ */
+
+/**
+ *  Transform this tensor to another (real) orbital basis, i.e. calculate
+ *      g'(P Q R S) = C(p P) C(q Q) C(r R) C(s S) g(p q r s),
+ *  by transforming every Cholesky vector as L'^L = C^T L^L C. This scales as O(K^3 N_L) instead of O(K^5).
+ *
+ *  @param C                    The (real) K x k transformation matrix, whose columns are the expansion coefficients of the new orbitals in terms of the old ones. Using fewer columns than rows transforms directly to a subset of orbitals, such as an active space.
+ *  @param number_of_threads    The number of threads over which the Cholesky vectors should be distributed.
+ *
+ *  @return The transformed tensor with dimension k.
+ */
+CholeskyDecomposedRankFourTensor CholeskyDecomposedRankFourTensor::transformed(const MatrixX<double>& C, const size_t number_of_threads) const {
+
+    const auto K = this->dim;
+    if (static_cast<size_t>(C.rows()) != K) {
+        throw std::invalid_argument("CholeskyDecomposedRankFourTensor::transformed(const MatrixX<double>&, const size_t): The number of rows of the transformation matrix should be equal to the dimension of the tensor.");
+    }
+    const size_t k = C.cols();
+    const auto N_L = this->numberOfCholeskyVectors();
+
+    MatrixX<double> L_transformed {k * k, N_L};
+    const Eigen::MatrixXd C_transpose = C.transpose();
+
+    forEachChunkConcurrently(number_of_threads, N_L, [&](const size_t, const size_t begin, const size_t end) {
+        if (begin == end) {
+            return;
+        }
+
+        // The first half-transformation is done for the whole chunk at once: X(P, qL) = C(p P) L^L(p q).
+        const Eigen::Map<const Eigen::MatrixXd> L_chunk {this->L.col(begin).data(), static_cast<Eigen::Index>(K), static_cast<Eigen::Index>(K * (end - begin))};
+        const Eigen::MatrixXd X = C_transpose * L_chunk;
+
+        // The second half-transformation is done for every Cholesky vector: L'^L(P Q) = X^L(P q) C(q Q).
+        for (size_t l = begin; l < end; l++) {
+            const Eigen::Map<const Eigen::MatrixXd> X_l {X.data() + (l - begin) * k * K, static_cast<Eigen::Index>(k), static_cast<Eigen::Index>(K)};
+            Eigen::Map<Eigen::MatrixXd> L_l {L_transformed.col(l).data(), static_cast<Eigen::Index>(k), static_cast<Eigen::Index>(k)};
+            L_l.noalias() = X_l * C;
+        }
+    });
+
+    return CholeskyDecomposedRankFourTensor {k, L_transformed};
+}
+
+
+/**
+ *  In-place apply a plane rotation to both indices of every Cholesky vector. Only the rows and columns p and q are updated:
+ *      L'(p, :) = G(0,0) L(p, :) + G(1,0) L(q, :)
+ *      L'(q, :) = G(0,1) L(p, :) + G(1,1) L(q, :),
+ *  and similarly for the columns.
+ *
+ *  @param p            The first index that is rotated.
+ *  @param q            The second index that is rotated.
+ *  @param G            The 2x2 matrix that is applied, whose first row and column correspond to p and whose second row and column correspond to q.
+ *
+ *  @note This update scales as O(K N_L).
+ */
+void CholeskyDecomposedRankFourTensor::rotatePlane(const size_t p, const size_t q, const Eigen::Matrix2d& G) {
+
+    const auto K = this->dim;
+    if (p >= K || q >= K) {
+        throw std::invalid_argument("CholeskyDecomposedRankFourTensor::rotatePlane(const size_t, const size_t, const Eigen::Matrix2d&): The given indices are out of bounds.");
+    }
+
+    // View all Cholesky vectors as a K x (K N_L) matrix, whose rows correspond to the first index and whose columns (q + K L) correspond to the second index of every vector.
+    const auto N_L = this->numberOfCholeskyVectors();
+    Eigen::Map<Eigen::MatrixXd> L_view {this->L.data(), static_cast<Eigen::Index>(K), static_cast<Eigen::Index>(K * N_L)};
+
+    const Eigen::RowVectorXd row_p = L_view.row(p);
+    const Eigen::RowVectorXd row_q = L_view.row(q);
+    L_view.row(p) = G(0, 0) * row_p + G(1, 0) * row_q;
+    L_view.row(q) = G(0, 1) * row_p + G(1, 1) * row_q;
+
+    for (size_t l = 0; l < N_L; l++) {
+        const Eigen::VectorXd column_p = L_view.col(p + K * l);
+        const Eigen::VectorXd column_q = L_view.col(q + K * l);
+        L_view.col(p + K * l) = G(0, 0) * column_p + G(1, 0) * column_q;
+        L_view.col(q + K * l) = G(0, 1) * column_p + G(1, 1) * column_q;
+    }
+}
+
+
+}  // namespace GQCP
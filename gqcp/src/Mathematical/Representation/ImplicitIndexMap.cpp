@@ -0,0 +1,64 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Mathematical/Representation/ImplicitIndexMap.hpp"
+
+
+namespace GQCP {
+
+
+constexpr size_t ImplicitIndexMap::absent;
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  Create an index map from an ordered map between implicit and dense indices.
+ *
+ *  @param implicit_to_dense            Maps the implicit indices to the indices of the dense representation.
+ */
+ImplicitIndexMap::ImplicitIndexMap(const std::map<size_t, size_t>& implicit_to_dense) :
+    dim {implicit_to_dense.size()},
+    offset {implicit_to_dense.empty() ? 0 : implicit_to_dense.begin()->first},
+    is_contiguous {true} {
+
+    // Since a std::map is ordered by its keys, the implicit indices are contiguous if the n-th entry is (offset + n, n).
+    size_t n = 0;
+    for (const auto& entry : implicit_to_dense) {
+        if ((entry.first != this->offset + n) || (entry.second != n)) {
+            this->is_contiguous = false;
+            break;
+        }
+        n++;
+    }
+
+
+    // Otherwise, tabulate the dense index of every implicit index up to the largest one.
+    if (!this->is_contiguous) {
+        const auto largest_index = implicit_to_dense.rbegin()->first;
+        this->dense_indices = std::vector<size_t>(largest_index + 1, ImplicitIndexMap::absent);
+
+        for (const auto& entry : implicit_to_dense) {
+            this->dense_indices[entry.first] = entry.second;
+        }
+    }
+}
+
+
+}  // namespace GQCP
@@ -0,0 +1,95 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Mathematical/Representation/MemoryMappedMatrix.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <stdexcept>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  Create a zero-initialized matrix in a new memory-mapped file.
+ *
+ *  @param rows             The number of rows of the matrix.
+ *  @param cols             The number of columns of the matrix.
+ *  @param directory        The directory in which the backing file should be created. Preferably, this is a directory on a local disk.
+ */
+MemoryMappedMatrix::MemoryMappedMatrix(const size_t rows, const size_t cols, const std::string& directory) :
+    number_of_rows {static_cast<long>(rows)},  // Casting is required because of Eigen.
+    number_of_columns {static_cast<long>(cols)},
+    file_descriptor {-1},
+    mapped_data {nullptr} {
+
+    if ((rows == 0) || (cols == 0)) {
+        throw std::invalid_argument("MemoryMappedMatrix(const size_t, const size_t, const std::string&): A memory-mapped matrix should have at least one row and one column.");
+    }
+
+
+    // Create a unique file in the given directory, and unlink it immediately: its disk space is then released as soon as it is closed.
+    const std::string path_template = directory + "/gqcp_mapped_matrix_XXXXXX";
+    std::vector<char> path {path_template.begin(), path_template.end()};
+    path.push_back('\0');
+
+    this->file_descriptor = ::mkstemp(path.data());
+    if (this->file_descriptor == -1) {
+        throw std::runtime_error("MemoryMappedMatrix(const size_t, const size_t, const std::string&): Cannot create a file in the given directory. Maybe you specified a wrong path?");
+    }
+    ::unlink(path.data());
+
+
+    // Resize the (sparse) file to the size of the matrix and map it. Newly extended files read as zeros.
+    const auto size = rows * cols * sizeof(double);
+    if (::ftruncate(this->file_descriptor, static_cast<off_t>(size)) != 0) {
+        ::close(this->file_descriptor);
+        throw std::runtime_error("MemoryMappedMatrix(const size_t, const size_t, const std::string&): Cannot resize the backing file. Maybe the disk is full?");
+    }
+
+    void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, this->file_descriptor, 0);
+    if (address == MAP_FAILED) {
+        ::close(this->file_descriptor);
+        throw std::runtime_error("MemoryMappedMatrix(const size_t, const size_t, const std::string&): Cannot map the backing file into memory.");
+    }
+    this->mapped_data = static_cast<double*>(address);
+}
+
+
+/*
+ *  MARK: Destructor
+ */
+
+/**
+ *  Unmap and close the backing file, which releases its disk space.
+ */
+MemoryMappedMatrix::~MemoryMappedMatrix() {
+
+    ::munmap(this->mapped_data, this->rows() * this->cols() * sizeof(double));
+    ::close(this->file_descriptor);
+}
+
+
+}  // namespace GQCP
@@ -0,0 +1,384 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Mathematical/Representation/PackedSymmetricRankFourTensor.hpp"
+
+#include "Utilities/threading.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  Create a zero-initialized packed tensor.
+ *
+ *  @param dim              The dimension of every axis of the tensor.
+ */
+PackedSymmetricRankFourTensor::PackedSymmetricRankFourTensor(const size_t dim) :
+    dim {dim} {
+
+    const auto number_of_pairs = this->numberOfPairs();
+    this->elements = VectorX<double>::Zero(number_of_pairs * (number_of_pairs + 1) / 2);
+}
+
+
+/*
+ *  MARK: Named constructors
+ */
+
+/**
+ *  Pack a dense square rank-4 tensor.
+ *
+ *  @param tensor           A dense square rank-4 tensor that has the 8-fold permutational symmetry of two-electron integrals over real orbitals.
+ *
+ *  @return The packed representation of the given tensor.
+ *
+ *  @note Only the elements g(p q r s) with p >= q, r >= s and pq >= rs are read, so the symmetry of the given tensor isn't checked.
+ */
+PackedSymmetricRankFourTensor PackedSymmetricRankFourTensor::FromFull(const SquareRankFourTensor<double>& tensor) {
+
+    const auto K = tensor.dimension();
+    PackedSymmetricRankFourTensor packed {K};
+
+    // Walk through the packed storage in its natural order.
+    size_t index = 0;
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q <= p; q++) {
+            for (size_t r = 0; r <= p; r++) {
+                const auto s_max = (r == p) ? q : r;  // restrict to pq >= rs
+                for (size_t s = 0; s <= s_max; s++) {
+                    packed.elements(index) = tensor(p, q, r, s);
+                    index++;
+                }
+            }
+        }
+    }
+
+    return packed;
+}
+
+
+/**
+ *  Create a random packed tensor, with values uniformly distributed between [-1,1].
+ *
+ *  @param dim              The dimension of every axis of the tensor.
+ *
+ *  @return A random packed tensor.
+ */
+PackedSymmetricRankFourTensor PackedSymmetricRankFourTensor::Random(const size_t dim) {
+
+    PackedSymmetricRankFourTensor packed {dim};
+    packed.elements = VectorX<double>::Random(packed.numberOfElements());  // Eigen's `Random` is already uniformly distributed between [-1, 1].
+    return packed;
+}
+
+
+/*
+ *  MARK: Conversions
+ */
+
+/**
+ *  @return The dense square rank-4 tensor that this packed tensor represents.
+ */
+SquareRankFourTensor<double> PackedSymmetricRankFourTensor::full() const {
+
+    const auto K = this->dim;
+    SquareRankFourTensor<double> tensor {K};
+
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q < K; q++) {
+            const auto pq = pairIndex(p, q);
+
+            for (size_t r = 0; r < K; r++) {
+                for (size_t s = 0; s < K; s++) {
+                    tensor(p, q, r, s) = this->elements(pairIndex(pq, pairIndex(r, s)));
+                }
+            }
+        }
+    }
+
+    return tensor;
+}
+
+
+/**
+ *  @return The pair matrix M(pq, rs) = g(p q r s) for p >= q and r >= s, i.e. the symmetric matrix whose lower triangle is stored.
+ */
+SquareMatrix<double> PackedSymmetricRankFourTensor::pairMatrix() const {
+
+    const auto number_of_pairs = this->numberOfPairs();
+    SquareMatrix<double> M = SquareMatrix<double>::Zero(number_of_pairs);
+
+    size_t index = 0;
+    for (size_t pq = 0; pq < number_of_pairs; pq++) {
+        for (size_t rs = 0; rs <= pq; rs++) {
+            M(pq, rs) = this->elements(index);
+            M(rs, pq) = this->elements(index);
+            index++;
+        }
+    }
+
+    return M;
+}
+
+
+/*
+ *  MARK: Comparing
+ */
+
+/**
+ *  @param other            The other packed tensor.
+ *  @param tolerance        The tolerance for the comparison.
+ *
+ *  @return If this packed tensor is approximately equal to the other one.
+ */
+bool PackedSymmetricRankFourTensor::isApprox(const PackedSymmetricRankFourTensor& other, const double tolerance) const {
+
+    return (this->dim == other.dim) && this->elements.isApprox(other.elements, tolerance);
+}
+
+
+/*
+ *  MARK: Basis transformations
+ */
+
+/**
+ *  Transform this tensor to another (real) orbital basis, i.e. calculate
+ *      g'(P Q R S) = C(p P) C(q Q) C(r R) C(s S) g(p q r s).
+ *
+ *  @param C                    The (real) K x k transformation matrix, whose columns are the expansion coefficients of the new orbitals in terms of the old ones. Using fewer columns than rows transforms directly to a subset of orbitals, such as an active space.
+ *  @param number_of_threads    The number of threads over which the batches of orbital pairs should be distributed.
+ *
+ *  @return The transformed tensor with dimension k, in packed storage.
+ *
+ *  @note The transformation is done in two half-transformations of symmetric matrices, so that no dense rank-4 intermediates are needed: apart from batch buffers, the only intermediate is the half-transformed pair matrix, which has about K^2 k^2 / 4 elements. The second half-transformation writes directly into the packed storage of the result. Every half-transformation unpacks a batch of orbital pairs at once, so that the first quarter-transformation of the whole batch is a single matrix-matrix product.
+ */
+PackedSymmetricRankFourTensor PackedSymmetricRankFourTensor::transformed(const MatrixX<double>& C, const size_t number_of_threads) const {
+
+    const auto K = this->dim;
+    if (static_cast<size_t>(C.rows()) != K) {
+        throw std::invalid_argument("PackedSymmetricRankFourTensor::transformed(const MatrixX<double>&, const size_t): The number of rows of the transformation matrix is incompatible with this tensor.");
+    }
+
+    const size_t k = C.cols();
+    PackedSymmetricRankFourTensor result {k};
+
+    const auto number_of_pairs = this->numberOfPairs();
+    const auto number_of_new_pairs = result.numberOfPairs();
+    const size_t batch_size = 32;
+
+    const MatrixX<double> C_transpose = C.transpose();
+
+
+    // Apply T' M T to a batch of symmetric K x K matrices that are stored next to each other, and hand every transformed k x k matrix to the given storage function.
+    const auto transform_batch = [&](const MatrixX<double>& M_batch, const size_t current_batch_size, const auto& store) {
+        const MatrixX<double> TM = C_transpose * M_batch.leftCols(K * current_batch_size);  // Transform the first index of every matrix in the batch at once.
+
+        for (size_t b = 0; b < current_batch_size; b++) {
+            const MatrixX<double> M_transformed = TM.middleCols(b * K, K) * C;
+            store(b, M_transformed);
+        }
+    };
+
+
+    // The first half-transformation acts on the first two indices, for every (old) pair rs: H(PQ, rs) = C(p P) C(q Q) g(p q r s).
+    MatrixX<double> H = MatrixX<double>::Zero(number_of_new_pairs, number_of_pairs);
+    forEachChunkConcurrently(number_of_threads, number_of_pairs, [&](const size_t, const size_t begin, const size_t end) {
+        MatrixX<double> M_batch {K, K * batch_size};
+
+        for (size_t batch_begin = begin; batch_begin < end; batch_begin += batch_size) {
+            const size_t current_batch_size = std::min(batch_size, end - batch_begin);
+
+            for (size_t b = 0; b < current_batch_size; b++) {
+                const auto rs = batch_begin + b;
+                for (size_t p = 0; p < K; p++) {
+                    for (size_t q = 0; q <= p; q++) {
+                        M_batch(p, b * K + q) = M_batch(q, b * K + p) = this->elements(pairIndex(pairIndex(p, q), rs));
+                    }
+                }
+            }
+
+            transform_batch(M_batch, current_batch_size, [&](const size_t b, const MatrixX<double>& M_transformed) {
+                const auto rs = batch_begin + b;
+                for (size_t P = 0; P < k; P++) {
+                    for (size_t Q = 0; Q <= P; Q++) {
+                        H(pairIndex(P, Q), rs) = M_transformed(P, Q);
+                    }
+                }
+            });
+        }
+    });
+
+
+    // The second half-transformation acts on the last two indices, for every (new) pair PQ: g'(P Q R S) = C(r R) C(s S) H(PQ, rs). Because of the pair symmetry, only the elements with PQ >= RS have to be stored, and they are written directly into the packed storage of the result.
+    forEachChunkConcurrently(number_of_threads, number_of_new_pairs, [&](const size_t, const size_t begin, const size_t end) {
+        MatrixX<double> M_batch {K, K * batch_size};
+
+        for (size_t batch_begin = begin; batch_begin < end; batch_begin += batch_size) {
+            const size_t current_batch_size = std::min(batch_size, end - batch_begin);
+
+            for (size_t b = 0; b < current_batch_size; b++) {
+                const auto PQ = batch_begin + b;
+                for (size_t r = 0; r < K; r++) {
+                    for (size_t s = 0; s <= r; s++) {
+                        M_batch(r, b * K + s) = M_batch(s, b * K + r) = H(PQ, pairIndex(r, s));
+                    }
+                }
+            }
+
+            transform_batch(M_batch, current_batch_size, [&](const size_t b, const MatrixX<double>& M_transformed) {
+                const auto PQ = batch_begin + b;
+                const auto PQ_offset = PQ * (PQ + 1) / 2;  // The position of the element (PQ, 0) in the packed storage.
+
+                size_t RS = 0;
+                for (size_t R = 0; (R < k) && (RS <= PQ); R++) {
+                    for (size_t S = 0; (S <= R) && (RS <= PQ); S++, RS++) {
+                        result.elements(PQ_offset + RS) = M_transformed(R, S);
+                    }
+                }
+            });
+        }
+    });
+
+    return result;
+}
+
+
+/**
+ *  In-place apply a plane rotation to all four indices of this tensor. Only the orbitals p and q change:
+ *      phi'_p = G(0,0) phi_p + G(1,0) phi_q
+ *      phi'_q = G(0,1) phi_p + G(1,1) phi_q.
+ *
+ *  @param p            The first index that is rotated.
+ *  @param q            The second index that is rotated.
+ *  @param G            The 2x2 matrix that is applied, whose first row and column correspond to p and whose second row and column correspond to q.
+ *
+ *  @note Only the 2K-1 orbital pairs that contain p or q change, and every one of them mixes with at most three others. Updating the affected part of the pair matrix therefore scales as O(K^3), without unpacking the tensor.
+ */
+void PackedSymmetricRankFourTensor::rotatePlane(const size_t p, const size_t q, const Eigen::Matrix2d& G) {
+
+    const auto K = this->dim;
+    if (p >= K || q >= K || p == q) {
+        throw std::invalid_argument("PackedSymmetricRankFourTensor::rotatePlane(const size_t, const size_t, const Eigen::Matrix2d&): The given indices should be different and within bounds.");
+    }
+
+
+    // The expansion of a rotated orbital in terms of the original orbitals, as (orbital index, coefficient)-pairs.
+    const auto orbital_expansion = [p, q, &G](const size_t a) -> std::vector<std::pair<size_t, double>> {
+        if (a == p) {
+            return {{p, G(0, 0)}, {q, G(1, 0)}};
+        } else if (a == q) {
+            return {{p, G(0, 1)}, {q, G(1, 1)}};
+        } else {
+            return {{a, 1.0}};
+        }
+    };
+
+
+    // Collect the orbital pairs that contain p or q, which are the only ones that change. Every affected pair gets a position, which is used to address the affected part of the pair matrix.
+    const auto number_of_pairs = this->numberOfPairs();
+    const auto unaffected = number_of_pairs;  // The position of a pair that doesn't change.
+
+    std::vector<size_t> affected_pairs;
+    std::vector<size_t> positions(number_of_pairs, unaffected);
+    for (size_t a = 0; a < K; a++) {
+        for (size_t b = 0; b <= a; b++) {
+            if (a == p || a == q || b == p || b == q) {
+                positions[pairIndex(a, b)] = affected_pairs.size();
+                affected_pairs.push_back(pairIndex(a, b));
+            }
+        }
+    }
+    const auto number_of_affected_pairs = affected_pairs.size();
+
+
+    // Expand every rotated pair in terms of the original affected pairs, as (position, coefficient)-pairs. Since the pair indices are unordered, both orderings of every pair of original orbitals contribute.
+    std::vector<std::vector<std::pair<size_t, double>>> pair_expansions(number_of_affected_pairs);
+    for (size_t a = 0; a < K; a++) {
+        for (size_t b = 0; b <= a; b++) {
+            const auto AB = pairIndex(a, b);
+            if (positions[AB] == unaffected) {
+                continue;
+            }
+
+            for (const auto& i_term : orbital_expansion(a)) {
+                for (const auto& j_term : orbital_expansion(b)) {
+                    pair_expansions[positions[AB]].emplace_back(positions[pairIndex(i_term.first, j_term.first)], i_term.second * j_term.second);
+                }
+            }
+        }
+    }
+
+
+    // Rotate the ket pairs of the elements whose bra pair doesn't change: g'(RS|AB) = sum_IJ g(RS|IJ) U(IJ, AB).
+    VectorX<double> row {static_cast<Eigen::Index>(number_of_affected_pairs)};
+    for (size_t RS = 0; RS < number_of_pairs; RS++) {
+        if (positions[RS] != unaffected) {
+            continue;
+        }
+
+        for (size_t position = 0; position < number_of_affected_pairs; position++) {
+            row(position) = this->elements(pairIndex(RS, affected_pairs[position]));
+        }
+
+        for (size_t position = 0; position < number_of_affected_pairs; position++) {
+            double value = 0.0;
+            for (const auto& term : pair_expansions[position]) {
+                value += term.second * row(term.first);
+            }
+            this->elements(pairIndex(RS, affected_pairs[position])) = value;
+        }
+    }
+
+
+    // Rotate both the bra and ket pairs of the block in which both pairs change: g'(AB|CD) = sum_IJ sum_KL U(IJ, AB) g(IJ|KL) U(KL, CD).
+    MatrixX<double> block {static_cast<Eigen::Index>(number_of_affected_pairs), static_cast<Eigen::Index>(number_of_affected_pairs)};
+    for (size_t position1 = 0; position1 < number_of_affected_pairs; position1++) {
+        for (size_t position2 = 0; position2 < number_of_affected_pairs; position2++) {
+            block(position1, position2) = this->elements(pairIndex(affected_pairs[position1], affected_pairs[position2]));
+        }
+    }
+
+    MatrixX<double> half_rotated_block = MatrixX<double>::Zero(number_of_affected_pairs, number_of_affected_pairs);
+    for (size_t position2 = 0; position2 < number_of_affected_pairs; position2++) {
+        for (const auto& term : pair_expansions[position2]) {
+            half_rotated_block.col(position2) += term.second * block.col(term.first);
+        }
+    }
+
+    for (size_t position1 = 0; position1 < number_of_affected_pairs; position1++) {
+        for (size_t position2 = 0; position2 <= position1; position2++) {
+            double value = 0.0;
+            for (const auto& term : pair_expansions[position1]) {
+                value += term.second * half_rotated_block(term.first, position2);
+            }
+            this->elements(pairIndex(affected_pairs[position1], affected_pairs[position2])) = value;
+        }
+    }
+}
+
+
+}  // namespace GQCP
@@ -0,0 +1,61 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Mathematical/Representation/ThreadPoolTensorDevice.hpp"
+
+#include "Utilities/threading.hpp"
+
+#include <mutex>
+
+
+namespace GQCP {
+
+
+namespace {
+
+// The library-wide device, which is created on first use.
+std::shared_ptr<const ThreadPoolTensorDevice> library_tensor_device;
+
+// The mutex that guards the creation and replacement of the library-wide device.
+std::mutex library_tensor_device_mutex;
+
+}  // namespace
+
+
+/*
+ *  MARK: Library-wide device
+ */
+
+/**
+ *  @return The library-wide device on which tensor contractions are evaluated if no device is given explicitly, e.g. by `Tensor::einsum`. It has as many threads as the library-wide number of threads (see `setNumberOfThreads`), and is recreated when that number changes.
+ *
+ *  @note The returned pointer keeps the device alive while it is used, even if the library-wide number of threads is changed in the meantime.
+ */
+std::shared_ptr<const ThreadPoolTensorDevice> libraryTensorDevice() {
+
+    const auto number_of_threads = numberOfThreads();
+
+    std::lock_guard<std::mutex> lock {library_tensor_device_mutex};
+    if (!library_tensor_device || (library_tensor_device->numberOfThreads() != number_of_threads)) {
+        library_tensor_device = std::make_shared<const ThreadPoolTensorDevice>(number_of_threads);
+    }
+
+    return library_tensor_device;
+}
+
+
+}  // namespace GQCP
@@ -19,6 +19,7 @@
 
 #include "ONVBasis/SpinResolvedSelectedONVBasis.hpp"
 #include "ONVBasis/SpinUnresolvedONVBasis.hpp"
+#include "Utilities/threading.hpp"
 
 
 namespace GQCP {
@@ -83,30 +84,26 @@ void SeniorityZeroONVBasis::forEach(const std::function<void(const SpinUnresolve
 
 
 /*
- *  MARK: Dense restricted operator evaluations
+ *  MARK: Restricted Hamiltonian evaluations
  */
 
 /**
- *  Calculate the dense matrix representation of a Hubbard Hamiltonian in this ONV basis.
+ *  Calculate the dense matrix representation of a restricted Hamiltonian in this ONV basis.
  *
- *  @param hamiltonian      A Hubbard Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param h                The parameters of the core (i.e. one-electron) part of the Hamiltonian.
+ *  @param g                The parameters of the two-electron part of the Hamiltonian, whose elements can be accessed as g(p, q, r, s). They can be dense or packed.
  *
  *  @return A dense matrix represention of the Hamiltonian.
  */
-SquareMatrix<double> SeniorityZeroONVBasis::evaluateOperatorDense(const RSQHamiltonian<double>& hamiltonian) const {
-
-    if (hamiltonian.numberOfOrbitals() != this->numberOfSpatialOrbitals()) {
-        throw std::invalid_argument("SeniorityZeroONVBasis::evaluateOperatorDense(const RSQHamiltonian<double>&): The number of spatial orbitals for the ONV basis and Hamiltonian are incompatible.");
-    }
-
+template <typename TwoElectronParameters>
+SquareMatrix<double> SeniorityZeroONVBasis::evaluateHamiltonianDense(const SquareMatrix<double>& h, const TwoElectronParameters& g) const {
 
     // Prepare some variables to be used in the algorithm.
     const size_t N_P = this->numberOfElectronPairs();
     const size_t dim = this->dimension();
 
     SquareMatrix<double> H = SquareMatrix<double>::Zero(dim);  // The matrix representation of the Hamiltonian.
-    const auto diagonal = this->evaluateOperatorDiagonal(hamiltonian);
-    const auto& g = hamiltonian.twoElectron().parameters();
+    const auto diagonal = this->evaluateHamiltonianDiagonal(h, g);
 
 
     // Use a proxy ONV basis to treat alpha- and beta- ONVs as equal and multiply all contributions by 2.
@@ -152,6 +149,251 @@ SquareMatrix<double> SeniorityZeroONVBasis::evaluateOperatorDense(const RSQHamil
 }
 
 
+/**
+ *  Calculate the diagonal of the dense matrix representation of a restricted Hamiltonian in this ONV basis.
+ *
+ *  @param h                The parameters of the core (i.e. one-electron) part of the Hamiltonian.
+ *  @param g                The parameters of the two-electron part of the Hamiltonian, whose elements can be accessed as g(p, q, r, s). They can be dense or packed.
+ *
+ *  @return The diagonal of the dense matrix represention of the Hamiltonian.
+ *
+ *  @note We don't just use the sum of the one- and two-electron operator's diagonal representation because that would mean 2 iterations over the dimension of the ONV basis.
+ */
+template <typename TwoElectronParameters>
+VectorX<double> SeniorityZeroONVBasis::evaluateHamiltonianDiagonal(const SquareMatrix<double>& h, const TwoElectronParameters& g) const {
+
+    // Prepare some variables to be used in the algorithm.
+    const auto dim = this->dimension();
+
+    VectorX<double> diagonal = VectorX<double>::Zero(dim);
+
+
+    // Iterate over every proxy doubly-occupied ONV. Since we are actually using spin-unresolved ONVs, we should multiply contributions by 2.
+    this->forEach([&diagonal, &h, &g](const SpinUnresolvedONV& onv, const size_t I) {
+        double value = 0;  // to be added to the diagonal
+
+        // Loop over every occupied spinor index and add the contributions.
+        onv.forEach([&value, &h, &g](const size_t p) {
+            value += 2 * h(p, p);    // Factor *2 because of seniority zero.
+            value += g(p, p, p, p);  // Factor 1/2*2 because of seniority zero.
+        });
+
+        // Loop over every pair of occupied spinor indices and add the contributions.
+        onv.forEach([&value, &g](const size_t p, const size_t q) {
+            // Since we are doing a restricted summation (p > q), we should multiply by 2 since the summand argument is symmetric upon interchanging p and q.
+            value += 2 * (2 * g(p, p, q, q) - g(p, q, q, p));
+        });
+
+        diagonal(I) += value;
+    });
+
+    return diagonal;
+}
+
+
+/**
+ *  Calculate the matrix-vector product of (the matrix representation of) a restricted Hamiltonian with the given coefficient vector.
+ *
+ *  @param h                The parameters of the core (i.e. one-electron) part of the Hamiltonian.
+ *  @param g                The parameters of the two-electron part of the Hamiltonian, whose elements can be accessed as g(p, q, r, s). They can be dense or packed.
+ *  @param x                The coefficient vector of a linear expansion.
+ *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector product.
+ *
+ *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
+ */
+template <typename TwoElectronParameters>
+VectorX<double> SeniorityZeroONVBasis::evaluateHamiltonianMatrixVectorProduct(const SquareMatrix<double>& h, const TwoElectronParameters& g, const VectorX<double>& x, const size_t number_of_threads) const {
+
+    // Prepare some variables to be used in the algorithm.
+    const size_t N_P = this->numberOfElectronPairs();
+    const size_t dim = this->dimension();
+
+
+    // Every thread iterates over a contiguous range of addresses I, and accumulates its off-diagonal contributions in a private vector, since they also contribute to elements outside of that range.
+    const auto proxy_onv_basis = this->proxy();
+    std::vector<VectorX<double>> matvecs(number_of_threads);
+    const auto number_of_chunks = forEachChunkConcurrently(number_of_threads, dim, [&](const size_t thread_index, const size_t begin, const size_t end) {
+        VectorX<double> matvec = VectorX<double>::Zero(dim);
+
+        // Create the first doubly-occupied ONV of this range. Since in DOCI, alpha == beta, we can use the proxy ONV basis to treat them as one and multiply all contributions by 2.
+        auto onv = proxy_onv_basis.constructONVFromAddress(begin);
+        for (size_t I = begin; I < end; I++) {  // I loops over all the addresses of the ONV.
+
+            // Using container values of type double reduce the number of times a vector has to be read from/written to.
+            double value = 0;
+            const double x_I = x(I);
+
+            for (size_t e1 = 0; e1 < N_P; e1++) {            // E1 (electron 1) loops over the (number of) electrons.
+                const size_t p = onv.occupationIndexOf(e1);  // Retrieve the index of a given electron.
+
+                // Remove the weight from the initial address I, because we annihilate.
+                size_t address = I - proxy_onv_basis.vertexWeight(p, e1 + 1);
+
+                // The e2 iteration counts the number of encountered electrons for the creation operator.
+                // We only consider greater addresses than the initial one (because of symmetry), hence we only count electron after the annihilated electron (e1).
+                size_t e2 = e1 + 1;
+                size_t q = p + 1;
+
+                // Skip the occupied orbitals after p. The electrons that are passed move down one electron index because of the annihilation, so their vertex weights in the address are corrected.
+                proxy_onv_basis.shiftUntilNextUnoccupiedOrbital<1>(onv, address, q, e2);
+
+                while (q < K) {
+                    const size_t J = address + proxy_onv_basis.vertexWeight(q, e2);
+
+                    value += g(p, q, p, q) * x(J);
+                    matvec(J) += g(p, q, p, q) * x_I;
+
+                    q++;  // Go to the next orbital.
+
+                    // Skip to the next unoccupied orbital, correcting the vertex weights of the passed electrons in the address.
+                    proxy_onv_basis.shiftUntilNextUnoccupiedOrbital<1>(onv, address, q, e2);
+                }  // Creation.
+            }      // E1 loop (annihilation).
+
+            if (I < dim - 1) {  // Prevent the last permutation.
+                proxy_onv_basis.transformONVToNextPermutation(onv);
+            }
+
+            matvec(I) += value;
+        }  // Address (I) loop.
+
+        matvecs[thread_index] = std::move(matvec);
+    });
+
+
+    // Initialize the resulting matrix-vector product from the diagonal contributions, and add the thread-private contributions in a fixed order, so that the result is deterministic.
+    VectorX<double> matvec = this->evaluateHamiltonianDiagonal(h, g).cwiseProduct(x);
+    for (size_t i = 0; i < number_of_chunks; i++) {
+        matvec += matvecs[i];
+    }
+
+    return matvec;
+}
+
+
+/**
+ *  Calculate the matrix-vector products of (the matrix representation of) a restricted Hamiltonian with a block of coefficient vectors.
+ *
+ *  @param h                The parameters of the core (i.e. one-electron) part of the Hamiltonian.
+ *  @param g                The parameters of the two-electron part of the Hamiltonian, whose elements can be accessed as g(p, q, r, s). They can be dense or packed.
+ *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+ *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector products.
+ *
+ *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+ */
+template <typename TwoElectronParameters>
+MatrixX<double> SeniorityZeroONVBasis::evaluateHamiltonianBlockMatrixVectorProduct(const SquareMatrix<double>& h, const TwoElectronParameters& g, const MatrixX<double>& X, const size_t number_of_threads) const {
+
+    // Prepare some variables to be used in the algorithm.
+    const size_t N_P = this->numberOfElectronPairs();
+    const size_t dim = this->dimension();
+    const auto number_of_vectors = X.cols();
+
+    // We work with the transposed block, in which the coefficients of all vectors for one address are contiguous. Every pair excitation I -> J can then read its integral once and update all vectors at once, so that the integrals and the ONV addressing are only traversed once for the whole block.
+    const MatrixX<double> X_t = X.transpose();
+
+
+    // Every thread iterates over a contiguous range of addresses I, and accumulates its off-diagonal contributions in a private (transposed) block, since they also contribute to elements outside of that range.
+    const auto proxy_onv_basis = this->proxy();
+    std::vector<MatrixX<double>> matvecs_t(number_of_threads);
+    const auto number_of_chunks = forEachChunkConcurrently(number_of_threads, dim, [&](const size_t thread_index, const size_t begin, const size_t end) {
+        MatrixX<double> matvec_t = MatrixX<double>::Zero(number_of_vectors, dim);
+        VectorX<double> values {number_of_vectors};
+
+        // Create the first doubly-occupied ONV of this range. Since in DOCI, alpha == beta, we can use the proxy ONV basis to treat them as one and multiply all contributions by 2.
+        auto onv = proxy_onv_basis.constructONVFromAddress(begin);
+        for (size_t I = begin; I < end; I++) {  // I loops over all the addresses of the ONV.
+
+            // Using a container for the values of all vectors reduces the number of times the block has to be read from/written to.
+            values.setZero();
+
+            for (size_t e1 = 0; e1 < N_P; e1++) {            // E1 (electron 1) loops over the (number of) electrons.
+                const size_t p = onv.occupationIndexOf(e1);  // Retrieve the index of a given electron.
+
+                // Remove the weight from the initial address I, because we annihilate.
+                size_t address = I - proxy_onv_basis.vertexWeight(p, e1 + 1);
+
+                // The e2 iteration counts the number of encountered electrons for the creation operator.
+                // We only consider greater addresses than the initial one (because of symmetry), hence we only count electron after the annihilated electron (e1).
+                size_t e2 = e1 + 1;
+                size_t q = p + 1;
+
+                // Skip the occupied orbitals after p. The electrons that are passed move down one electron index because of the annihilation, so their vertex weights in the address are corrected.
+                proxy_onv_basis.shiftUntilNextUnoccupiedOrbital<1>(onv, address, q, e2);
+
+                while (q < K) {
+                    const size_t J = address + proxy_onv_basis.vertexWeight(q, e2);
+                    const double g_pqpq = g(p, q, p, q);
+
+                    values += g_pqpq * X_t.col(J);
+                    matvec_t.col(J) += g_pqpq * X_t.col(I);
+
+                    q++;  // Go to the next orbital.
+
+                    // Skip to the next unoccupied orbital, correcting the vertex weights of the passed electrons in the address.
+                    proxy_onv_basis.shiftUntilNextUnoccupiedOrbital<1>(onv, address, q, e2);
+                }  // Creation.
+            }      // E1 loop (annihilation).
+
+            if (I < dim - 1) {  // Prevent the last permutation.
+                proxy_onv_basis.transformONVToNextPermutation(onv);
+            }
+
+            matvec_t.col(I) += values;
+        }  // Address (I) loop.
+
+        matvecs_t[thread_index] = std::move(matvec_t);
+    });
+
+
+    // Initialize the resulting matrix-vector products from the diagonal contributions, and add the thread-private contributions in a fixed order, so that the result is deterministic.
+    MatrixX<double> matvec_block = this->evaluateHamiltonianDiagonal(h, g).asDiagonal() * X;
+    for (size_t i = 0; i < number_of_chunks; i++) {
+        matvec_block += matvecs_t[i].transpose();
+    }
+
+    return matvec_block;
+}
+
+
+/*
+ *  MARK: Dense restricted operator evaluations
+ */
+
+/**
+ *  Calculate the dense matrix representation of a Hubbard Hamiltonian in this ONV basis.
+ *
+ *  @param hamiltonian      A Hubbard Hamiltonian expressed in an orthonormal orbital basis.
+ *
+ *  @return A dense matrix represention of the Hamiltonian.
+ */
+SquareMatrix<double> SeniorityZeroONVBasis::evaluateOperatorDense(const RSQHamiltonian<double>& hamiltonian) const {
+
+    if (hamiltonian.numberOfOrbitals() != this->numberOfSpatialOrbitals()) {
+        throw std::invalid_argument("SeniorityZeroONVBasis::evaluateOperatorDense(const RSQHamiltonian<double>&): The number of spatial orbitals for the ONV basis and Hamiltonian are incompatible.");
+    }
+
+    return this->evaluateHamiltonianDense(hamiltonian.core().parameters(), hamiltonian.twoElectron().parameters());
+}
+
+
+/**
+ *  Calculate the dense matrix representation of a restricted Hamiltonian with packed two-electron integrals in this ONV basis.
+ *
+ *  @param hamiltonian      A restricted Hamiltonian with packed two-electron integrals, expressed in an orthonormal orbital basis.
+ *
+ *  @return A dense matrix represention of the Hamiltonian.
+ */
+SquareMatrix<double> SeniorityZeroONVBasis::evaluateOperatorDense(const PackedRSQHamiltonian& hamiltonian) const {
+
+    if (hamiltonian.numberOfOrbitals() != this->numberOfSpatialOrbitals()) {
+        throw std::invalid_argument("SeniorityZeroONVBasis::evaluateOperatorDense(const PackedRSQHamiltonian&): The number of spatial orbitals for the ONV basis and Hamiltonian are incompatible.");
+    }
+
+    return this->evaluateHamiltonianDense(hamiltonian.core().parameters(), hamiltonian.twoElectron().parameters());
+}
+
+
 /*
  *  MARK: Diagonal restricted operator evaluations
  */
@@ -245,45 +487,29 @@ VectorX<double> SeniorityZeroONVBasis::evaluateOperatorDiagonal(const ScalarRSQT
  */
 VectorX<double> SeniorityZeroONVBasis::evaluateOperatorDiagonal(const RSQHamiltonian<double>& hamiltonian) const {
 
-    // We don't just use the sum of the one- and two-electron operator's diagonal representation because that would mean 2 iterations over the dimension of the ONV basis.
-
-
     // Check if the argument is compatible.
-    const auto K = hamiltonian.numberOfOrbitals();  // The number of spatial orbitals.
-
-    if (K != this->numberOfSpatialOrbitals()) {
+    if (hamiltonian.numberOfOrbitals() != this->numberOfSpatialOrbitals()) {
         throw std::invalid_argument("SeniorityZeroONVBasis::evaluateOperatorDiagonal(const RSQHamiltonian<double>&): The number of spatial orbitals for the ONV basis and one-electron operator are incompatible.");
     }
 
-    // Prepare some variables to be used in the algorithm.
-    const auto dim = this->dimension();
-
-    const auto& h = hamiltonian.core().parameters();
-    const auto& g = hamiltonian.twoElectron().parameters();
-
-    VectorX<double> diagonal = VectorX<double>::Zero(dim);
-
-
-    // Iterate over every proxy doubly-occupied ONV. Since we are actually using spin-unresolved ONVs, we should multiply contributions by 2.
-    this->forEach([&diagonal, &h, &g](const SpinUnresolvedONV& onv, const size_t I) {
-        double value = 0;  // to be added to the diagonal
+    return this->evaluateHamiltonianDiagonal(hamiltonian.core().parameters(), hamiltonian.twoElectron().parameters());
+}
 
-        // Loop over every occupied spinor index and add the contributions.
-        onv.forEach([&value, &h, &g](const size_t p) {
-            value += 2 * h(p, p);    // Factor *2 because of seniority zero.
-            value += g(p, p, p, p);  // Factor 1/2*2 because of seniority zero.
-        });
 
-        // Loop over every pair of occupied spinor indices and add the contributions.
-        onv.forEach([&value, &g](const size_t p, const size_t q) {
-            // Since we are doing a restricted summation (p > q), we should multiply by 2 since the summand argument is symmetric upon interchanging p and q.
-            value += 2 * (2 * g(p, p, q, q) - g(p, q, q, p));
-        });
+/**
+ *  Calculate the diagonal of the dense matrix representation of a restricted Hamiltonian with packed two-electron integrals in this ONV basis.
+ *
+ *  @param hamiltonian      A restricted Hamiltonian with packed two-electron integrals, expressed in an orthonormal orbital basis.
+ *
+ *  @return The diagonal of the dense matrix represention of the Hamiltonian.
+ */
+VectorX<double> SeniorityZeroONVBasis::evaluateOperatorDiagonal(const PackedRSQHamiltonian& hamiltonian) const {
 
-        diagonal(I) += value;
-    });
+    if (hamiltonian.numberOfOrbitals() != this->numberOfSpatialOrbitals()) {
+        throw std::invalid_argument("SeniorityZeroONVBasis::evaluateOperatorDiagonal(const PackedRSQHamiltonian&): The number of spatial orbitals for the ONV basis and Hamiltonian are incompatible.");
+    }
 
-    return diagonal;
+    return this->evaluateHamiltonianDiagonal(hamiltonian.core().parameters(), hamiltonian.twoElectron().parameters());
 }
 
 
@@ -311,69 +537,82 @@ VectorX<double> SeniorityZeroONVBasis::evaluateOperatorMatrixVectorProduct(const
  *
  *  @param hamiltonian      A restricted Hamiltonian expressed in an orthonormal orbital basis.
  *  @param x                The coefficient vector of a linear expansion.
+ *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector product.
  *
  *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
  */
-VectorX<double> SeniorityZeroONVBasis::evaluateOperatorMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const VectorX<double>& x) const {
+VectorX<double> SeniorityZeroONVBasis::evaluateOperatorMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const VectorX<double>& x, const size_t number_of_threads) const {
 
     if (hamiltonian.numberOfOrbitals() != this->numberOfSpatialOrbitals()) {
         throw std::invalid_argument("DOCI::matrixVectorProduct(const RSQHamiltonian<double>&, const VectorX<double>&, const VectorX<double>&): The number of spatial orbitals for the ONV basis and Hamiltonian are incompatible.");
     }
 
-    // Prepare some variables to be used in the algorithm.
-    const size_t N_P = this->numberOfElectronPairs();
-    const size_t dim = this->dimension();
-
-    const auto& g = hamiltonian.twoElectron().parameters();
-
+    return this->evaluateHamiltonianMatrixVectorProduct(hamiltonian.core().parameters(), hamiltonian.twoElectron().parameters(), x, number_of_threads);
+}
 
-    // Initialize the resulting matrix-vector product from the diagonal contributions.
-    VectorX<double> matvec = this->evaluateOperatorDiagonal(hamiltonian).cwiseProduct(x);
 
-    // Create the first doubly-occupied ONV basis. Since in DOCI, alpha == beta, we can use the proxy ONV basis to treat them as one and multiply all contributions by 2.
-    const auto proxy_onv_basis = this->proxy();
-    auto onv = proxy_onv_basis.constructONVFromAddress(0);  // ONV with address 0.
-    for (size_t I = 0; I < dim; I++) {                      // I loops over all the addresses of the ONV.
+/**
+ *  Calculate the matrix-vector product of (the matrix representation of) a restricted Hamiltonian with packed two-electron integrals with the given coefficient vector.
+ *
+ *  @param hamiltonian      A restricted Hamiltonian with packed two-electron integrals, expressed in an orthonormal orbital basis.
+ *  @param x                The coefficient vector of a linear expansion.
+ *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector product.
+ *
+ *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
+ */
+VectorX<double> SeniorityZeroONVBasis::evaluateOperatorMatrixVectorProduct(const PackedRSQHamiltonian& hamiltonian, const VectorX<double>& x, const size_t number_of_threads) const {
 
-        // Using container values of type double reduce the number of times a vector has to be read from/written to.
-        double value = 0;
-        const double x_I = x(I);
+    if (hamiltonian.numberOfOrbitals() != this->numberOfSpatialOrbitals()) {
+        throw std::invalid_argument("SeniorityZeroONVBasis::evaluateOperatorMatrixVectorProduct(const PackedRSQHamiltonian&, const VectorX<double>&, const size_t): The number of spatial orbitals for the ONV basis and Hamiltonian are incompatible.");
+    }
 
-        for (size_t e1 = 0; e1 < N_P; e1++) {            // E1 (electron 1) loops over the (number of) electrons.
-            const size_t p = onv.occupationIndexOf(e1);  // Retrieve the index of a given electron.
+    return this->evaluateHamiltonianMatrixVectorProduct(hamiltonian.core().parameters(), hamiltonian.twoElectron().parameters(), x, number_of_threads);
+}
 
-            // Remove the weight from the initial address I, because we annihilate.
-            size_t address = I - proxy_onv_basis.vertexWeight(p, e1 + 1);
 
-            // The e2 iteration counts the number of encountered electrons for the creation operator.
-            // We only consider greater addresses than the initial one (because of symmetry), hence we only count electron after the annihilated electron (e1).
-            size_t e2 = e1 + 1;
-            size_t q = p + 1;
+/**
+ *  Calculate the matrix-vector products of (the matrix representation of) a restricted Hamiltonian with a block of coefficient vectors.
+ *
+ *  @param hamiltonian      A restricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+ *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector products.
+ *
+ *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+ */
+MatrixX<double> SeniorityZeroONVBasis::evaluateOperatorBlockMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const MatrixX<double>& X, const size_t number_of_threads) const {
 
-            // Perform a shift.  TODO: clarify what shift.
-            proxy_onv_basis.shiftUntilNextUnoccupiedOrbital<1>(onv, address, q, e2);
+    if (hamiltonian.numberOfOrbitals() != this->numberOfSpatialOrbitals()) {
+        throw std::invalid_argument("SeniorityZeroONVBasis::evaluateOperatorBlockMatrixVectorProduct(const RSQHamiltonian<double>&, const MatrixX<double>&, const size_t): The number of spatial orbitals for the ONV basis and Hamiltonian are incompatible.");
+    }
 
-            while (q < K) {
-                const size_t J = address + proxy_onv_basis.vertexWeight(q, e2);
+    if (static_cast<size_t>(X.rows()) != this->dimension()) {
+        throw std::invalid_argument("SeniorityZeroONVBasis::evaluateOperatorBlockMatrixVectorProduct(const RSQHamiltonian<double>&, const MatrixX<double>&, const size_t): The dimension of the coefficient vectors and the ONV basis are incompatible.");
+    }
 
-                value += g(p, q, p, q) * x(J);
-                matvec(J) += g(p, q, p, q) * x_I;
+    return this->evaluateHamiltonianBlockMatrixVectorProduct(hamiltonian.core().parameters(), hamiltonian.twoElectron().parameters(), X, number_of_threads);
+}
 
-                q++;  // Go to the next orbital.
 
-                // Perform a shift.  TODO: clarify what shift.
-                proxy_onv_basis.shiftUntilNextUnoccupiedOrbital<1>(onv, address, q, e2);
-            }  // Creation.
-        }      // E1 loop (annihilation).
+/**
+ *  Calculate the matrix-vector products of (the matrix representation of) a restricted Hamiltonian with packed two-electron integrals with a block of coefficient vectors.
+ *
+ *  @param hamiltonian      A restricted Hamiltonian with packed two-electron integrals, expressed in an orthonormal orbital basis.
+ *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+ *  @param number_of_threads    The number of threads that should be used in calculating the matrix-vector products.
+ *
+ *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+ */
+MatrixX<double> SeniorityZeroONVBasis::evaluateOperatorBlockMatrixVectorProduct(const PackedRSQHamiltonian& hamiltonian, const MatrixX<double>& X, const size_t number_of_threads) const {
 
-        if (I < dim - 1) {  // Prevent the last permutation.
-            proxy_onv_basis.transformONVToNextPermutation(onv);
-        }
+    if (hamiltonian.numberOfOrbitals() != this->numberOfSpatialOrbitals()) {
+        throw std::invalid_argument("SeniorityZeroONVBasis::evaluateOperatorBlockMatrixVectorProduct(const PackedRSQHamiltonian&, const MatrixX<double>&, const size_t): The number of spatial orbitals for the ONV basis and Hamiltonian are incompatible.");
+    }
 
-        matvec(I) += value;
-    }  // Address (I) loop.
+    if (static_cast<size_t>(X.rows()) != this->dimension()) {
+        throw std::invalid_argument("SeniorityZeroONVBasis::evaluateOperatorBlockMatrixVectorProduct(const PackedRSQHamiltonian&, const MatrixX<double>&, const size_t): The dimension of the coefficient vectors and the ONV basis are incompatible.");
+    }
 
-    return matvec;
+    return this->evaluateHamiltonianBlockMatrixVectorProduct(hamiltonian.core().parameters(), hamiltonian.twoElectron().parameters(), X, number_of_threads);
 }
 
 
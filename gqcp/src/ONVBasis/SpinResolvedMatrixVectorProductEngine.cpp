@@ -0,0 +1,164 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "ONVBasis/SpinResolvedMatrixVectorProductEngine.hpp"
+
+#include "Utilities/threading.hpp"
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param onv_basis            The full spin-resolved ONV basis in which the Hamiltonian should be represented.
+ *  @param hamiltonian          An unrestricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param number_of_threads    The number of threads that should be used in calculating a matrix-vector product.
+ */
+SpinResolvedMatrixVectorProductEngine::SpinResolvedMatrixVectorProductEngine(const SpinResolvedONVBasis& onv_basis, const USQHamiltonian<double>& hamiltonian, const size_t number_of_threads) :
+    dim_alpha {static_cast<long>(onv_basis.alpha().dimension())},  // Casting is required because of Eigen.
+    dim_beta {static_cast<long>(onv_basis.beta().dimension())},
+    alpha_couplings {onv_basis.alphaCouplings()},
+    number_of_threads {number_of_threads} {
+
+    if (number_of_threads == 0) {
+        throw std::invalid_argument("SpinResolvedMatrixVectorProductEngine(const SpinResolvedONVBasis&, const USQHamiltonian<double>&, const size_t): The number of threads should be at least 1.");
+    }
+
+    if (hamiltonian.numberOfOrbitals() != onv_basis.numberOfOrbitals()) {
+        throw std::invalid_argument("SpinResolvedMatrixVectorProductEngine(const SpinResolvedONVBasis&, const USQHamiltonian<double>&, const size_t): The number of orbitals of the spin-resolved ONV basis and the Hamiltonian are incompatible.");
+    }
+
+
+    // In order to call the semantically correct APIs, we'll have to convert the pure alpha and pure beta part of the unrestricted Hamiltonian into a generalized representation.
+    const auto& h_a = ScalarGSQOneElectronOperator<double>::FromUnrestrictedComponent(hamiltonian.core().alpha());
+    const auto& g_aa = ScalarGSQTwoElectronOperator<double>::FromUnrestrictedComponent(hamiltonian.twoElectron().alphaAlpha());
+    const GSQHamiltonian<double> alpha_hamiltonian {h_a, g_aa};
+
+    const auto& h_b = ScalarGSQOneElectronOperator<double>::FromUnrestrictedComponent(hamiltonian.core().beta());
+    const auto& g_bb = ScalarGSQTwoElectronOperator<double>::FromUnrestrictedComponent(hamiltonian.twoElectron().betaBeta());
+    const GSQHamiltonian<double> beta_hamiltonian {h_b, g_bb};
+
+    this->H_a = onv_basis.alpha().evaluateOperatorSparse(alpha_hamiltonian);
+    this->H_b = onv_basis.beta().evaluateOperatorSparse(beta_hamiltonian);
+
+
+    // The 'theta(pq)' intermediates are one-electron operators in the beta ONV basis, so their matrix representations are sparse as well. We store them in the same (p <= q) order as the alpha couplings.
+    const auto K = onv_basis.numberOfOrbitals();
+    const auto& g_mixed = hamiltonian.twoElectron().alphaBeta();
+
+    this->beta_intermediates.reserve(this->alpha_couplings.size());
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = p; q < K; q++) {
+            const auto P = onv_basis.calculateOneElectronPartition(p, q, g_mixed);
+            this->beta_intermediates.push_back(onv_basis.beta().evaluateOperatorSparse(P));
+        }
+    }
+}
+
+
+/**
+ *  @param onv_basis            The full spin-resolved ONV basis in which the Hamiltonian should be represented.
+ *  @param hamiltonian          A restricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param number_of_threads    The number of threads that should be used in calculating a matrix-vector product.
+ */
+SpinResolvedMatrixVectorProductEngine::SpinResolvedMatrixVectorProductEngine(const SpinResolvedONVBasis& onv_basis, const RSQHamiltonian<double>& hamiltonian, const size_t number_of_threads) :
+    SpinResolvedMatrixVectorProductEngine(onv_basis,
+                                          USQHamiltonian<double> {ScalarUSQOneElectronOperator<double>::FromRestricted(hamiltonian.core()),
+                                                                  ScalarUSQTwoElectronOperator<double>::FromRestricted(hamiltonian.twoElectron())},
+                                          number_of_threads) {}
+
+
+/*
+ *  MARK: Matrix-vector products
+ */
+
+/**
+ *  Calculate the matrix-vector product of (the matrix representation of) the Hamiltonian with the given coefficient vector.
+ *
+ *  @param x                The coefficient vector of a linear expansion.
+ *
+ *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
+ */
+VectorX<double> SpinResolvedMatrixVectorProductEngine::evaluate(const VectorX<double>& x) const {
+
+    if (static_cast<size_t>(x.size()) != this->dimension()) {
+        throw std::invalid_argument("SpinResolvedMatrixVectorProductEngine::evaluate(const VectorX<double>&): The dimension of the coefficient vector and the ONV basis are incompatible.");
+    }
+
+    // A single coefficient vector is just a block that consists of one vector.
+    const MatrixX<double> matvec = this->evaluateBlock(x);
+    return matvec.col(0);
+}
+
+
+/**
+ *  Calculate the matrix-vector products of (the matrix representation of) the Hamiltonian with a block of coefficient vectors.
+ *
+ *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+ *
+ *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+ */
+MatrixX<double> SpinResolvedMatrixVectorProductEngine::evaluateBlock(const MatrixX<double>& X) const {
+
+    if (static_cast<size_t>(X.rows()) != this->dimension()) {
+        throw std::invalid_argument("SpinResolvedMatrixVectorProductEngine::evaluateBlock(const MatrixX<double>&): The dimension of the coefficient vectors and the ONV basis are incompatible.");
+    }
+
+
+    // We can calculate the 'pure spin evaluations' using the re-mapped approach. Every coefficient vector is mapped as a dense (dim_beta x dim_alpha) matrix, and since Eigen stores matrices column-major, the whole block is mapped as these matrices next to each other.
+    const auto number_of_vectors = X.cols();
+    Eigen::Map<const Eigen::MatrixXd> X_map {X.data(), this->dim_beta, this->dim_alpha * number_of_vectors};
+    MatrixX<double> matvecs = MatrixX<double>::Zero(X.rows(), number_of_vectors);
+    Eigen::Map<Eigen::MatrixXd> matvecs_map {matvecs.data(), this->dim_beta, this->dim_alpha * number_of_vectors};
+
+    // Every column of the re-mapped result only depends on the corresponding columns of the (sparse) matrices that act on X from the right, so we can divide the alpha-string columns over the threads without any need for a reduction.
+    forEachChunkConcurrently(this->number_of_threads, static_cast<size_t>(this->dim_alpha), [this, number_of_vectors, &X_map, &matvecs_map](const size_t, const size_t begin, const size_t end) {
+        const auto start = static_cast<long>(begin);
+        const auto columns = static_cast<long>(end - begin);
+
+        // The 'pure spin contributions' can be written very simply as matrix-matrix multiplications.
+        for (long k = 0; k < number_of_vectors; k++) {
+            const auto X_k = X_map.middleCols(k * this->dim_alpha, this->dim_alpha);
+            matvecs_map.middleCols(k * this->dim_alpha + start, columns) += this->H_b * X_k.middleCols(start, columns) + X_k * this->H_a.middleCols(start, columns);
+        }
+
+        // For the 'mixed spin contributions', we use the precalculated intermediates: every pair (p <= q) contributes theta(pq) * X * sigma(pq). By placing X * sigma(pq) for all vectors next to each other, every sparse intermediate theta(pq) only has to be traversed once for the whole block.
+        MatrixX<double> coupled_block(this->dim_beta, columns * number_of_vectors);
+        MatrixX<double> contribution_block(this->dim_beta, columns * number_of_vectors);
+        for (size_t pq = 0; pq < this->alpha_couplings.size(); pq++) {
+            const auto sigma_pq = this->alpha_couplings[pq].middleCols(start, columns);
+
+            for (long k = 0; k < number_of_vectors; k++) {
+                coupled_block.middleCols(k * columns, columns).noalias() = X_map.middleCols(k * this->dim_alpha, this->dim_alpha) * sigma_pq;
+            }
+            contribution_block.noalias() = this->beta_intermediates[pq] * coupled_block;
+
+            for (long k = 0; k < number_of_vectors; k++) {
+                matvecs_map.middleCols(k * this->dim_alpha + start, columns) += contribution_block.middleCols(k * columns, columns);
+            }
+        }
+    });
+
+    // We can safely return the matrix representation of the matrix-vector products, because we have used Eigen's mapped representation to emplace its elements.
+    return matvecs;
+}
+
+}  // namespace GQCP
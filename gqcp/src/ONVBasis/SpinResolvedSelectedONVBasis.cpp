@@ -39,7 +39,8 @@ namespace GQCP {
 SpinResolvedSelectedONVBasis::SpinResolvedSelectedONVBasis(const size_t K, const size_t N_alpha, const size_t N_beta) :
     K {K},
     N_alpha {N_alpha},
-    N_beta {N_beta} {}
+    N_beta {N_beta},
+    connections {K} {}
 
 
 /**
@@ -66,7 +67,7 @@ SpinResolvedSelectedONVBasis::SpinResolvedSelectedONVBasis(const SeniorityZeroON
         }
     }
 
-    this->onvs = onvs;
+    this->expandWith(onvs);
 }
 
 
@@ -102,7 +103,7 @@ SpinResolvedSelectedONVBasis::SpinResolvedSelectedONVBasis(const SpinResolvedONV
             onv_basis_alpha.transformONVToNextPermutation(alpha);
         }
     }
-    this->onvs = onvs;
+    this->expandWith(onvs);
 }
 
 
@@ -126,6 +127,7 @@ void SpinResolvedSelectedONVBasis::expandWith(const SpinResolvedONV& onv) {
     }
 
     this->onvs.push_back(onv);
+    this->connections.expandWith(onv);
 }
 
 
@@ -156,7 +158,7 @@ void SpinResolvedSelectedONVBasis::expandWith(const std::vector<SpinResolvedONV>
 SquareMatrix<double> SpinResolvedSelectedONVBasis::evaluateOperatorDense(const ScalarRSQOneElectronOperator<double>& f) const {
 
     // By delegating the actual implementation of this method to its unrestricted counterpart, we avoid code duplication for the restricted part.
-    // This does not affect performance significantly, because the bottleneck will always be the double iteration over the whole ONV basis.
+    // This does not affect performance significantly, because the bottleneck will always be the iteration over all connected pairs of ONVs.
     const auto f_unrestricted = ScalarUSQOneElectronOperator<double>::FromRestricted(f);
     return this->evaluateOperatorDense(f_unrestricted);
 }
@@ -172,8 +174,8 @@ SquareMatrix<double> SpinResolvedSelectedONVBasis::evaluateOperatorDense(const S
 SquareMatrix<double> SpinResolvedSelectedONVBasis::evaluateOperatorDense(const ScalarRSQTwoElectronOperator<double>& g) const {
 
     // By delegating the actual implementation of this method to its unrestricted counterpart, we avoid code duplication for the restricted part.
-    // This does not affect performance significantly, because the bottleneck will always be the double iteration over the whole ONV basis.
-    // Furthermore, we can use the `USQHamiltonian`'s general evaluation function, because even adding zero-valued one-electron operators won't have an impact. This would be different if we would split up the evaluation in one- and two-electron operator evaluations, which would require two times the double iterations over the whole ONV basis.
+    // This does not affect performance significantly, because the bottleneck will always be the iteration over all connected pairs of ONVs.
+    // Furthermore, we can use the `USQHamiltonian`'s general evaluation function, because even adding zero-valued one-electron operators won't have an impact. This would be different if we would split up the evaluation in one- and two-electron operator evaluations, which would require two times the iteration over all connected pairs of ONVs.
     const auto zero = ScalarUSQOneElectronOperator<double>::Zero(g.numberOfOrbitals());
     const auto g_unrestricted = ScalarUSQTwoElectronOperator<double>::FromRestricted(g);
     const USQHamiltonian<double> hamiltonian {zero, g_unrestricted};
@@ -192,7 +194,7 @@ SquareMatrix<double> SpinResolvedSelectedONVBasis::evaluateOperatorDense(const S
 SquareMatrix<double> SpinResolvedSelectedONVBasis::evaluateOperatorDense(const RSQHamiltonian<double>& hamiltonian) const {
 
     // By delegating the actual implementation of this method to its unrestricted counterpart, we avoid code duplication for the restricted part.
-    // This does not affect performance significantly, because the bottleneck will always be the double iteration over the whole ONV basis.
+    // This does not affect performance significantly, because the bottleneck will always be the iteration over all connected pairs of ONVs.
     const auto h_unrestricted = ScalarUSQOneElectronOperator<double>::FromRestricted(hamiltonian.core());
     const auto g_unrestricted = ScalarUSQTwoElectronOperator<double>::FromRestricted(hamiltonian.twoElectron());
     const USQHamiltonian<double> unrestricted_hamiltonian {h_unrestricted, g_unrestricted};
@@ -252,7 +254,7 @@ Eigen::SparseMatrix<double> SpinResolvedSelectedONVBasis::evaluateOperatorSparse
     size_t memory = this->dimension() + this->dimension() * this->K * this->K * (this->N_alpha + this->N_beta) * (this->N_alpha + this->N_beta);
     container.reserve(memory);
 
-    // Use the `USQHamiltonian`'s general evaluation function, because even adding zero-valued one-electron operators won't have an impact. This would be different if we would split up the evaluation in one- and two-electron operator evaluations, which would require two times the double iterations over the whole ONV basis.
+    // Use the `USQHamiltonian`'s general evaluation function, because even adding zero-valued one-electron operators won't have an impact. This would be different if we would split up the evaluation in one- and two-electron operator evaluations, which would require two times the iteration over all connected pairs of ONVs.
     const auto zero = ScalarUSQOneElectronOperator<double>::Zero(g.numberOfOrbitals());
     const auto g_unrestricted = ScalarUSQTwoElectronOperator<double>::FromRestricted(g);
     const USQHamiltonian<double> hamiltonian {zero, g_unrestricted};
@@ -574,7 +576,7 @@ VectorX<double> SpinResolvedSelectedONVBasis::evaluateOperatorMatrixVectorProduc
         throw std::invalid_argument("SpinResolvedSelectedONVBasis::evaluateOperatorMatrixVectorProduct(const ScalarRSQTwoElectronOperator<double>&, const VectorX<double>&): The number of orbitals of this ONV basis and the operator are incompatible.");
     }
 
-    // Use the `USQHamiltonian`'s general evaluation function, because even adding zero-valued one-electron operators won't have an impact. This would be different if we would split up the evaluation in one- and two-electron operator evaluations, which would require two times the double iterations over the whole ONV basis.
+    // Use the `USQHamiltonian`'s general evaluation function, because even adding zero-valued one-electron operators won't have an impact. This would be different if we would split up the evaluation in one- and two-electron operator evaluations, which would require two times the iteration over all connected pairs of ONVs.
     const auto zero = ScalarUSQOneElectronOperator<double>::Zero(g.numberOfOrbitals());
     const auto g_unrestricted = ScalarUSQTwoElectronOperator<double>::FromRestricted(g);
     const USQHamiltonian<double> hamiltonian {zero, g_unrestricted};
@@ -598,7 +600,7 @@ VectorX<double> SpinResolvedSelectedONVBasis::evaluateOperatorMatrixVectorProduc
 VectorX<double> SpinResolvedSelectedONVBasis::evaluateOperatorMatrixVectorProduct(const RSQHamiltonian<double>& hamiltonian, const VectorX<double>& x) const {
 
     // By delegating the actual implementation of this method to its unrestricted counterpart, we avoid code duplication for the restricted part.
-    // This does not affect performance significantly, because the bottleneck will always be the double iteration over the whole ONV basis.
+    // This does not affect performance significantly, because the bottleneck will always be the iteration over all connected pairs of ONVs.
     const auto h_unrestricted = ScalarUSQOneElectronOperator<double>::FromRestricted(hamiltonian.core());
     const auto g_unrestricted = ScalarUSQTwoElectronOperator<double>::FromRestricted(hamiltonian.twoElectron());
     const USQHamiltonian<double> unrestricted_hamiltonian {h_unrestricted, g_unrestricted};
@@ -17,6 +17,8 @@
 
 #include "ONVBasis/SpinUnresolvedONVBasis.hpp"
 
+#include "Utilities/threading.hpp"
+
 #include <boost/math/special_functions.hpp>
 #include <boost/numeric/conversion/converter.hpp>
 
@@ -193,7 +195,7 @@ size_t SpinUnresolvedONVBasis::representationOf(size_t address) const {
 
             if (weight <= address) {  // the algorithm can move diagonally, so we found an occupied orbital
                 address -= weight;
-                representation |= ((1) << (p - 1));  // set the (p-1)th bit: see (https://stackoverflow.com/a/47990)
+                representation |= (size_t {1} << (p - 1));  // set the (p-1)th bit: see (https://stackoverflow.com/a/47990)
 
                 m--;  // since we found an occupied orbital, we have one electron less
                 if (m == 0) {
@@ -449,7 +451,9 @@ SquareMatrix<double> SpinUnresolvedONVBasis::evaluateOperatorDense(const ScalarG
 
     // Initialize a container for the dense matrix representation, and fill it with the general evaluation function.
     MatrixRepresentationEvaluationContainer<SquareMatrix<double>> container {this->dimension()};
-    this->evaluate<SquareMatrix<double>>(f, container);
+    this->forNarrowestRepresentation([this, &f, &container](auto representation) {
+        this->evaluate<SquareMatrix<double>, decltype(representation)>(f, container);
+    });
 
     return container.evaluation();
 }
@@ -487,7 +491,9 @@ SquareMatrix<double> SpinUnresolvedONVBasis::evaluateOperatorDense(const GSQHami
 
     // Initialize a container for the dense matrix representation, and fill it with the general evaluation function.
     MatrixRepresentationEvaluationContainer<SquareMatrix<double>> container {this->dimension()};
-    this->evaluate<SquareMatrix<double>>(hamiltonian, container);
+    this->forNarrowestRepresentation([this, &hamiltonian, &container](auto representation) {
+        this->evaluate<SquareMatrix<double>, decltype(representation)>(hamiltonian, container);
+    });
 
     return container.evaluation();
 }
@@ -555,18 +561,22 @@ VectorX<double> SpinUnresolvedONVBasis::evaluateOperatorDiagonal(const ScalarGSQ
 
     VectorX<double> diagonal = VectorX<double>::Zero(dim);
 
-    SpinUnresolvedONV onv = this->constructONVFromAddress(0);  // onv with address 0
-    for (size_t I = 0; I < dim; I++) {                         // I loops over all addresses in this ONV basis
+    this->forNarrowestRepresentation([this, N, dim, &f, &diagonal](auto representation) {
+        BasicSpinUnresolvedONV<decltype(representation)> onv {this->numberOfOrbitals(), N};
+        this->transformONVCorrespondingToAddress(onv, 0);  // onv with address 0
 
-        if (I > 0) {
-            this->transformONVToNextPermutation(onv);
-        }
+        for (size_t I = 0; I < dim; I++) {  // I loops over all addresses in this ONV basis
+
+            if (I > 0) {
+                this->transformONVToNextPermutation(onv);
+            }
 
-        for (size_t e1 = 0; e1 < N; e1++) {  // A1 (annihilation 1)
-            size_t p = onv.occupationIndexOf(e1);
-            diagonal(I) += f(p, p);
+            for (size_t e1 = 0; e1 < N; e1++) {  // A1 (annihilation 1)
+                size_t p = onv.occupationIndexOf(e1);
+                diagonal(I) += f(p, p);
+            }
         }
-    }
+    });
 
     return diagonal;
 };
@@ -594,26 +604,30 @@ VectorX<double> SpinUnresolvedONVBasis::evaluateOperatorDiagonal(const ScalarGSQ
     const auto k = g_op.effectiveOneElectronPartition().parameters();
     const auto& g = g_op.parameters();
 
-    SpinUnresolvedONV onv = this->constructONVFromAddress(0);  // onv with address 0
-    for (size_t I = 0; I < dim; I++) {                         // I loops over all addresses in this ONV basis
+    this->forNarrowestRepresentation([this, K, N, dim, &k, &g, &diagonal](auto representation) {
+        BasicSpinUnresolvedONV<decltype(representation)> onv {K, N};
+        this->transformONVCorrespondingToAddress(onv, 0);  // onv with address 0
 
-        if (I > 0) {
-            this->transformONVToNextPermutation(onv);
-        }
+        for (size_t I = 0; I < dim; I++) {  // I loops over all addresses in this ONV basis
+
+            if (I > 0) {
+                this->transformONVToNextPermutation(onv);
+            }
 
-        for (size_t e1 = 0; e1 < N; e1++) {  // A1 (annihilation 1)
-            size_t p = onv.occupationIndexOf(e1);
-            diagonal(I) += k(p, p);
+            for (size_t e1 = 0; e1 < N; e1++) {  // A1 (annihilation 1)
+                size_t p = onv.occupationIndexOf(e1);
+                diagonal(I) += k(p, p);
 
-            for (size_t q = 0; q < K; q++) {  // q loops over SOs
-                if (onv.isOccupied(q)) {
-                    diagonal(I) += 0.5 * g(p, p, q, q);
-                } else {
-                    diagonal(I) += 0.5 * g(p, q, q, p);
+                for (size_t q = 0; q < K; q++) {  // q loops over SOs
+                    if (onv.isOccupied(q)) {
+                        diagonal(I) += 0.5 * g(p, p, q, q);
+                    } else {
+                        diagonal(I) += 0.5 * g(p, q, q, p);
+                    }
                 }
             }
         }
-    }
+    });
 
     return diagonal;
 };
@@ -655,7 +669,9 @@ Eigen::SparseMatrix<double> SpinUnresolvedONVBasis::evaluateOperatorSparse(const
     container.reserve(memory);
 
     // Evaluate the one-electron operator and add the evaluations to the sparse matrix representation.
-    this->evaluate<Eigen::SparseMatrix<double>>(f, container);
+    this->forNarrowestRepresentation([this, &f, &container](auto representation) {
+        this->evaluate<Eigen::SparseMatrix<double>, decltype(representation)>(f, container);
+    });
 
     // Finalize the creation of the sparse matrix and return the result.
     container.addToMatrix();
@@ -699,7 +715,9 @@ Eigen::SparseMatrix<double> SpinUnresolvedONVBasis::evaluateOperatorSparse(const
     container.reserve(memory);
 
     // Evaluate the Hamiltonian and add the evaluations to the sparse matrix representation.
-    this->evaluate<Eigen::SparseMatrix<double>>(hamiltonian, container);
+    this->forNarrowestRepresentation([this, &hamiltonian, &container](auto representation) {
+        this->evaluate<Eigen::SparseMatrix<double>, decltype(representation)>(hamiltonian, container);
+    });
 
     // Finalize the creation of the sparse matrix and return the result.
     container.addToMatrix();
@@ -750,20 +768,33 @@ Eigen::SparseMatrix<double> SpinUnresolvedONVBasis::evaluateOperatorSparse(const
  *
  *  @param f                A generalized one-electron operator expressed in an orthonormal orbital basis.
  *  @param x                The coefficient vector of a linear expansion.
+ *  @param number_of_threads    The number of threads that should be used. Every thread iterates over a contiguous part of the ONV basis.
  *
  *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the one-electron operator.
  */
-VectorX<double> SpinUnresolvedONVBasis::evaluateOperatorMatrixVectorProduct(const ScalarGSQOneElectronOperator<double>& f, const VectorX<double>& x) const {
+VectorX<double> SpinUnresolvedONVBasis::evaluateOperatorMatrixVectorProduct(const ScalarGSQOneElectronOperator<double>& f, const VectorX<double>& x, const size_t number_of_threads) const {
 
     if (f.numberOfOrbitals() != this->numberOfOrbitals()) {
         throw std::invalid_argument("SpinUnresolvedONVBasis::evaluateOperatorMatrixVectorProduct(const ScalarGSQOneElectronOperator<double>&, const VectorX<double>&): The number of orbitals of this ONV basis and the operator are incompatible.");
     }
 
-    // Initialize a container for the matrix-vector product, and fill it with the general evaluation function.
-    MatrixRepresentationEvaluationContainer<VectorX<double>> container {x};
-    this->evaluate<VectorX<double>>(f, container);
+    // Every thread iterates over a contiguous range of addresses and fills its own container for the matrix-vector product with the general evaluation function.
+    std::vector<VectorX<double>> matvecs(number_of_threads);
+    const auto number_of_chunks = forEachChunkConcurrently(number_of_threads, this->dimension(), [this, &f, &x, &matvecs](const size_t thread_index, const size_t begin, const size_t end) {
+        MatrixRepresentationEvaluationContainer<VectorX<double>> container {x, begin, end};
+        this->forNarrowestRepresentation([this, &f, &container](auto representation) {
+            this->evaluate<VectorX<double>, decltype(representation)>(f, container);
+        });
 
-    return container.evaluation();
+        matvecs[thread_index] = std::move(container.matvec);
+    });
+
+    // The thread-private contributions are summed in a fixed order, so that the result is deterministic.
+    for (size_t i = 1; i < number_of_chunks; i++) {
+        matvecs[0] += matvecs[i];
+    }
+
+    return matvecs[0];
 }
 
 
@@ -772,16 +803,17 @@ VectorX<double> SpinUnresolvedONVBasis::evaluateOperatorMatrixVectorProduct(cons
  *
  *  @param g                A generalized two-electron operator expressed in an orthonormal orbital basis.
  *  @param x                The coefficient vector of a linear expansion.
+ *  @param number_of_threads    The number of threads that should be used. Every thread iterates over a contiguous part of the ONV basis.
  *
  *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the two-electron operator.
  */
-VectorX<double> SpinUnresolvedONVBasis::evaluateOperatorMatrixVectorProduct(const ScalarGSQTwoElectronOperator<double>& g, const VectorX<double>& x) const {
+VectorX<double> SpinUnresolvedONVBasis::evaluateOperatorMatrixVectorProduct(const ScalarGSQTwoElectronOperator<double>& g, const VectorX<double>& x, const size_t number_of_threads) const {
 
     // In order to avoid duplicate code, we choose to delegate this method to the evaluation of a `GSQHamiltonian` that contains no core contributions. This does not affect performance significantly, because the bottleneck will always be the iteration over the whole ONV basis.
     const auto zero = ScalarGSQOneElectronOperator<double>::Zero(g.numberOfOrbitals());
     const GSQHamiltonian<double> hamiltonian {zero, g};
 
-    return this->evaluateOperatorMatrixVectorProduct(hamiltonian, x);
+    return this->evaluateOperatorMatrixVectorProduct(hamiltonian, x, number_of_threads);
 }
 
 
@@ -790,20 +822,72 @@ VectorX<double> SpinUnresolvedONVBasis::evaluateOperatorMatrixVectorProduct(cons
  *
  *  @param hamiltonian      A generalized Hamiltonian expressed in an orthonormal orbital basis.
  *  @param x                The coefficient vector of a linear expansion.
+ *  @param number_of_threads    The number of threads that should be used. Every thread iterates over a contiguous part of the ONV basis.
  *
  *  @return The coefficient vector of the linear expansion after being acted on with the given (matrix representation of) the Hamiltonian.
  */
-VectorX<double> SpinUnresolvedONVBasis::evaluateOperatorMatrixVectorProduct(const GSQHamiltonian<double>& hamiltonian, const VectorX<double>& x) const {
+VectorX<double> SpinUnresolvedONVBasis::evaluateOperatorMatrixVectorProduct(const GSQHamiltonian<double>& hamiltonian, const VectorX<double>& x, const size_t number_of_threads) const {
 
     if (hamiltonian.numberOfOrbitals() != this->numberOfOrbitals()) {
         throw std::invalid_argument("SpinUnresolvedONVBasis::evaluateOperatorMatrixVectorProduct(const USQHamiltonian<double>&, const VectorX<double>& x): The number of orbitals of this ONV basis and the given Hamiltonian are incompatible.");
     }
 
-    // Initialize a container for the matrix-vector product, and fill it with the general evaluation function.
-    MatrixRepresentationEvaluationContainer<VectorX<double>> container {x};
-    this->evaluate<VectorX<double>>(hamiltonian, container);
+    // Every thread iterates over a contiguous range of addresses and fills its own container for the matrix-vector product with the general evaluation function.
+    std::vector<VectorX<double>> matvecs(number_of_threads);
+    const auto number_of_chunks = forEachChunkConcurrently(number_of_threads, this->dimension(), [this, &hamiltonian, &x, &matvecs](const size_t thread_index, const size_t begin, const size_t end) {
+        MatrixRepresentationEvaluationContainer<VectorX<double>> container {x, begin, end};
+        this->forNarrowestRepresentation([this, &hamiltonian, &container](auto representation) {
+            this->evaluate<VectorX<double>, decltype(representation)>(hamiltonian, container);
+        });
 
-    return container.evaluation();
+        matvecs[thread_index] = std::move(container.matvec);
+    });
+
+    // The thread-private contributions are summed in a fixed order, so that the result is deterministic.
+    for (size_t i = 1; i < number_of_chunks; i++) {
+        matvecs[0] += matvecs[i];
+    }
+
+    return matvecs[0];
+}
+
+
+/**
+ *  Calculate the matrix-vector products of (the matrix representation of) a generalized Hamiltonian with a block of coefficient vectors. The matrix elements are evaluated only once for the whole block.
+ *
+ *  @param hamiltonian      A generalized Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param X                The coefficient vectors of linear expansions, as the columns of a matrix.
+ *  @param number_of_threads    The number of threads that should be used. Every thread iterates over a contiguous part of the ONV basis.
+ *
+ *  @return The coefficient vectors of the linear expansions after being acted on with the given (matrix representation of) the Hamiltonian, as the columns of a matrix.
+ */
+MatrixX<double> SpinUnresolvedONVBasis::evaluateOperatorBlockMatrixVectorProduct(const GSQHamiltonian<double>& hamiltonian, const MatrixX<double>& X, const size_t number_of_threads) const {
+
+    if (hamiltonian.numberOfOrbitals() != this->numberOfOrbitals()) {
+        throw std::invalid_argument("SpinUnresolvedONVBasis::evaluateOperatorBlockMatrixVectorProduct(const GSQHamiltonian<double>&, const MatrixX<double>&, const size_t): The number of orbitals of this ONV basis and the given Hamiltonian are incompatible.");
+    }
+
+    if (static_cast<size_t>(X.rows()) != this->dimension()) {
+        throw std::invalid_argument("SpinUnresolvedONVBasis::evaluateOperatorBlockMatrixVectorProduct(const GSQHamiltonian<double>&, const MatrixX<double>&, const size_t): The dimension of the coefficient vectors and the ONV basis are incompatible.");
+    }
+
+    // Every thread iterates over a contiguous range of addresses and fills its own block container with the general evaluation function.
+    std::vector<MatrixX<double>> matvecs(number_of_threads);
+    const auto number_of_chunks = forEachChunkConcurrently(number_of_threads, this->dimension(), [this, &hamiltonian, &X, &matvecs](const size_t thread_index, const size_t begin, const size_t end) {
+        MatrixRepresentationEvaluationContainer<MatrixX<double>> container {X, begin, end};
+        this->forNarrowestRepresentation([this, &hamiltonian, &container](auto representation) {
+            this->evaluate<MatrixX<double>, decltype(representation)>(hamiltonian, container);
+        });
+
+        matvecs[thread_index] = std::move(container.matvecs_transposed);
+    });
+
+    // The thread-private contributions are summed in a fixed order, so that the result is deterministic.
+    for (size_t i = 1; i < number_of_chunks; i++) {
+        matvecs[0] += matvecs[i];
+    }
+
+    return matvecs[0].transpose();
 }
 
 
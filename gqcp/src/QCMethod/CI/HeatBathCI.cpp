@@ -0,0 +1,249 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "QCMethod/CI/HeatBathCI.hpp"
+
+#include "Mathematical/Optimization/Eigenproblem/Davidson/DavidsonSolver.hpp"
+#include "Mathematical/Optimization/Eigenproblem/EigenproblemSolver.hpp"
+#include "QCMethod/CI/CI.hpp"
+#include "QCMethod/CI/HeatBathExcitationGenerator.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+
+namespace GQCP {
+namespace QCMethod {
+
+
+namespace {
+
+
+// The pair of unsigned representations of the alpha and beta strings of a spin-resolved ONV.
+using RepresentationPair = std::pair<size_t, size_t>;
+
+
+/**
+ *  @param onv_basis            A selected ONV basis.
+ *
+ *  @return The set of the pairs of unsigned representations of the ONVs in the given ONV basis.
+ */
+std::unordered_set<RepresentationPair, boost::hash<RepresentationPair>> representationsOf(const SpinResolvedSelectedONVBasis& onv_basis) {
+
+    std::unordered_set<RepresentationPair, boost::hash<RepresentationPair>> representations;
+    representations.reserve(onv_basis.dimension());
+    for (size_t I = 0; I < onv_basis.dimension(); I++) {
+        const auto& onv = onv_basis.onvWithIndex(I);
+        representations.emplace(onv.onv(Spin::alpha).unsignedRepresentation(), onv.onv(Spin::beta).unsignedRepresentation());
+    }
+
+    return representations;
+}
+
+
+}  // namespace
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param selection_threshold              The selection threshold (epsilon_1) on |<J|H|I> c_I|.
+ *  @param number_of_states                 The number of states that are searched for (including the ground state). An ONV is selected if it is important for any of these states.
+ *  @param maximum_number_of_iterations     The maximum number of selection iterations.
+ *  @param convergence_threshold            The threshold on the change in the ground state energy between two iterations.
+ *  @param maximum_dense_dimension          Selected ONV bases whose dimension does not exceed this number are diagonalized densely, larger ones through Davidson's algorithm.
+ */
+HeatBathCI::HeatBathCI(const double selection_threshold, const size_t number_of_states, const size_t maximum_number_of_iterations, const double convergence_threshold, const size_t maximum_dense_dimension) :
+    selection_threshold {selection_threshold},
+    number_of_states {number_of_states},
+    maximum_number_of_iterations {maximum_number_of_iterations},
+    convergence_threshold {convergence_threshold},
+    maximum_dense_dimension {maximum_dense_dimension} {}
+
+
+/*
+ *  MARK: Optimization
+ */
+
+/**
+ *  Optimize the selected ONV basis and the expansion coefficients of the requested states.
+ *
+ *  @param hamiltonian                      A restricted Hamiltonian expressed in an orthonormal orbital basis.
+ *  @param initial_onv_basis                The selected ONV basis that the selection starts from, e.g. containing only the Hartree-Fock ONV.
+ *
+ *  @return The energies and linear expansions of the requested states, expressed in the final selected ONV basis.
+ */
+QCStructure<LinearExpansion<SpinResolvedSelectedONVBasis>> HeatBathCI::optimize(const RSQHamiltonian<double>& hamiltonian, const SpinResolvedSelectedONVBasis& initial_onv_basis) const {
+
+    if (hamiltonian.numberOfOrbitals() != initial_onv_basis.numberOfOrbitals()) {
+        throw std::invalid_argument("HeatBathCI::optimize(const RSQHamiltonian<double>&, const SpinResolvedSelectedONVBasis&): The number of orbitals of the Hamiltonian and the ONV basis are incompatible.");
+    }
+
+    if (initial_onv_basis.dimension() < this->number_of_states) {
+        throw std::invalid_argument("HeatBathCI::optimize(const RSQHamiltonian<double>&, const SpinResolvedSelectedONVBasis&): The initial ONV basis should contain at least as many ONVs as the number of requested states.");
+    }
+
+    // Prepare some variables.
+    const auto K = initial_onv_basis.numberOfOrbitals();
+    const auto N_alpha = initial_onv_basis.numberOfAlphaElectrons();
+    const auto N_beta = initial_onv_basis.numberOfBetaElectrons();
+
+    const HeatBathExcitationGenerator generator {hamiltonian};
+
+    auto onv_basis = initial_onv_basis;
+    auto included_onvs = representationsOf(onv_basis);
+
+    MatrixX<double> previous_eigenvectors;  // used as the initial guesses for Davidson's algorithm
+    double previous_energy = std::numeric_limits<double>::max();
+    for (size_t iteration = 0; iteration < this->maximum_number_of_iterations; iteration++) {
+
+        // Diagonalize the Hamiltonian in the current selected ONV basis. Its sparse matrix representation is calculated once, so that every matrix-vector product in Davidson's algorithm is a sparse multiplication.
+        const auto dim = onv_basis.dimension();
+        const CI<SpinResolvedSelectedONVBasis> ci {onv_basis, this->number_of_states};
+        const Eigen::SparseMatrix<double> H = onv_basis.evaluateOperatorSparse(hamiltonian);
+
+        QCStructure<LinearExpansion<SpinResolvedSelectedONVBasis>> structure = [&]() {
+            if (dim <= this->maximum_dense_dimension) {
+                auto environment = EigenproblemEnvironment::Dense(SquareMatrix<double> {MatrixX<double> {H}});
+                auto solver = EigenproblemSolver::Dense();
+                return ci.optimize(solver, environment);
+            }
+
+            // The eigenvectors of the previous iteration are good initial guesses, since the new ONVs are appended to the ONV basis.
+            MatrixX<double> V = MatrixX<double>::Zero(dim, this->number_of_states);
+            if (previous_eigenvectors.rows() > 0) {
+                V.topRows(previous_eigenvectors.rows()) = previous_eigenvectors;
+            } else {
+                for (size_t i = 0; i < this->number_of_states; i++) {
+                    V(i, i) = 1.0;
+                }
+            }
+
+            const VectorFunction<double> matrix_vector_product_function = [&H](const VectorX<double>& x) { return VectorX<double> {H * x}; };
+            const VectorX<double> diagonal = H.diagonal();
+
+            auto environment = EigenproblemEnvironment::Iterative(matrix_vector_product_function, diagonal, V);
+            auto solver = EigenproblemSolver::Davidson(this->number_of_states, std::max<size_t>(15, 2 * this->number_of_states));
+            return ci.optimize(solver, environment);
+        }();
+
+        const auto energy = structure.groundStateEnergy();
+
+
+        // Determine the importance of every ONV, as the largest magnitude of its coefficients in the requested states.
+        previous_eigenvectors = MatrixX<double>::Zero(dim, this->number_of_states);
+        for (size_t i = 0; i < this->number_of_states; i++) {
+            previous_eigenvectors.col(i) = structure.parameters(i).coefficients();
+        }
+        const VectorX<double> weights = previous_eigenvectors.cwiseAbs().rowwise().maxCoeff();
+
+
+        // Select the single and double excitations of every ONV whose weighted coupling exceeds the selection threshold.
+        std::vector<SpinResolvedONV> selected_onvs;
+        for (size_t I = 0; I < dim; I++) {
+            if (weights(I) == 0.0) {
+                continue;  // no excitation can be important
+            }
+
+            const auto& onv_I = onv_basis.onvWithIndex(I);
+            const auto alpha_I = onv_I.onv(Spin::alpha).unsignedRepresentation();
+            const auto beta_I = onv_I.onv(Spin::beta).unsignedRepresentation();
+
+            generator.forEachExcitation(alpha_I, beta_I, this->selection_threshold / weights(I), [&](const size_t alpha_J, const size_t beta_J) {
+                if (included_onvs.emplace(alpha_J, beta_J).second) {  // only new ONVs are inserted
+                    selected_onvs.emplace_back(SpinUnresolvedONV {K, N_alpha, alpha_J}, SpinUnresolvedONV {K, N_beta, beta_J});
+                }
+            });
+        }
+
+
+        // Check for convergence, or expand the ONV basis with the selected ONVs.
+        if (selected_onvs.empty() || (std::abs(energy - previous_energy) < this->convergence_threshold)) {
+            return structure;
+        }
+
+        onv_basis.expandWith(selected_onvs);
+        previous_energy = energy;
+    }
+
+    throw std::runtime_error("HeatBathCI::optimize(const RSQHamiltonian<double>&, const SpinResolvedSelectedONVBasis&): The selection didn't converge within the maximum number of iterations.");
+}
+
+
+/*
+ *  MARK: Perturbative correction
+ */
+
+/**
+ *  Calculate the Epstein-Nesbet second-order perturbative correction to the energy of a (heat-bath) selected CI state, in which the contributions of the external ONVs are screened with a threshold epsilon_2 that is smaller than the selection threshold.
+ *
+ *  @param hamiltonian                      The restricted Hamiltonian that was used in the selection.
+ *  @param linear_expansion                 The selected CI state.
+ *  @param energy                           The (variational) energy of the selected CI state.
+ *  @param perturbative_threshold           The screening threshold (epsilon_2) on |<A|H|I> c_I|, for external ONVs A.
+ *
+ *  @return The second-order perturbative energy correction.
+ */
+double HeatBathCI::calculatePerturbativeCorrection(const RSQHamiltonian<double>& hamiltonian, const LinearExpansion<SpinResolvedSelectedONVBasis>& linear_expansion, const double energy, const double perturbative_threshold) const {
+
+    const HeatBathExcitationGenerator generator {hamiltonian};
+
+    const auto& onv_basis = linear_expansion.onvBasis();
+    const auto variational_onvs = representationsOf(onv_basis);
+
+
+    // Accumulate the numerators sum_I <A|H|I> c_I for every external ONV A.
+    std::unordered_map<RepresentationPair, double, boost::hash<RepresentationPair>> numerators;
+    for (size_t I = 0; I < onv_basis.dimension(); I++) {
+        const auto c_I = linear_expansion.coefficient(I);
+        if (c_I == 0.0) {
+            continue;
+        }
+
+        const auto& onv_I = onv_basis.onvWithIndex(I);
+        const auto alpha_I = onv_I.onv(Spin::alpha).unsignedRepresentation();
+        const auto beta_I = onv_I.onv(Spin::beta).unsignedRepresentation();
+
+        generator.forEachExcitation(alpha_I, beta_I, perturbative_threshold / std::abs(c_I), [&](const size_t alpha_A, const size_t beta_A) {
+            if (variational_onvs.count({alpha_A, beta_A}) == 0) {
+                numerators[{alpha_A, beta_A}] += generator.calculateMatrixElement(alpha_A, beta_A, alpha_I, beta_I) * c_I;
+            }
+        });
+    }
+
+
+    // The Epstein-Nesbet correction uses the diagonal elements <A|H|A> in the denominators.
+    double correction = 0.0;
+    for (const auto& numerator : numerators) {
+        const auto alpha_A = numerator.first.first;
+        const auto beta_A = numerator.first.second;
+
+        correction += numerator.second * numerator.second / (energy - generator.calculateMatrixElement(alpha_A, beta_A, alpha_A, beta_A));
+    }
+
+    return correction;
+}
+
+
+}  // namespace QCMethod
+}  // namespace GQCP
@@ -0,0 +1,306 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "QCMethod/CI/HeatBathExcitationGenerator.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace GQCP {
+
+
+namespace {
+
+
+/**
+ *  @param representation       The unsigned representation of a spin string.
+ *  @param p                    An orbital index.
+ *
+ *  @return The phase factor (+1 or -1) that arises by applying an annihilation or creation operator on orbital p.
+ */
+inline int phaseFactor(const size_t representation, const size_t p) {
+
+    const auto m = __builtin_popcountll(representation & ((size_t {1} << p) - 1));  // the number of electrons in the orbitals up to p (not included)
+    return (m % 2 == 0) ? 1 : -1;
+}
+
+
+/**
+ *  @param representation       The unsigned representation of a spin string.
+ *
+ *  @return The indices of the occupied orbitals, in ascending order.
+ */
+inline std::vector<size_t> occupiedIndicesOf(size_t representation) {
+
+    std::vector<size_t> indices;
+    while (representation != 0) {
+        indices.push_back(__builtin_ctzll(representation));
+        representation &= representation - 1;  // remove the least significant set bit
+    }
+    return indices;
+}
+
+
+}  // namespace
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param hamiltonian          A restricted Hamiltonian expressed in an orthonormal orbital basis. Its integrals should be real and have the full permutational symmetry.
+ */
+HeatBathExcitationGenerator::HeatBathExcitationGenerator(const RSQHamiltonian<double>& hamiltonian) :
+    K {hamiltonian.numberOfOrbitals()},
+    h {hamiltonian.core().parameters()},
+    g {hamiltonian.twoElectron().parameters()},
+    same_spin_excitations(K * K),
+    opposite_spin_excitations(K * K) {
+
+    if (this->K > 64) {
+        throw std::invalid_argument("HeatBathExcitationGenerator(const RSQHamiltonian<double>&): The number of orbitals cannot exceed the number of bits in the unsigned representation of a spin string.");
+    }
+
+    const auto by_descending_magnitude = [](const DoubleExcitation& lhs, const DoubleExcitation& rhs) { return lhs.magnitude > rhs.magnitude; };
+
+    for (size_t q = 0; q < this->K; q++) {
+        for (size_t s = 0; s < this->K; s++) {
+
+            // Annihilating q and s and creating p and r in the same spin string couples through g(qpsr) - g(qrsp).
+            if (q < s) {
+                auto& excitations = this->same_spin_excitations[q * this->K + s];
+                for (size_t p = 0; p < this->K; p++) {
+                    for (size_t r = p + 1; r < this->K; r++) {
+                        excitations.push_back({std::abs(this->g(q, p, s, r) - this->g(q, r, s, p)), p, r});
+                    }
+                }
+                std::sort(excitations.begin(), excitations.end(), by_descending_magnitude);
+            }
+
+            // Annihilating alpha q and beta s and creating alpha p and beta r couples through g(qpsr).
+            auto& excitations = this->opposite_spin_excitations[q * this->K + s];
+            for (size_t p = 0; p < this->K; p++) {
+                for (size_t r = 0; r < this->K; r++) {
+                    excitations.push_back({std::abs(this->g(q, p, s, r)), p, r});
+                }
+            }
+            std::sort(excitations.begin(), excitations.end(), by_descending_magnitude);
+        }
+    }
+}
+
+
+/*
+ *  MARK: Matrix elements
+ */
+
+/**
+ *  Calculate the matrix element <J|H|I> of the Hamiltonian between two spin-resolved ONVs.
+ *
+ *  @param alpha_J              The unsigned representation of the alpha string of the bra ONV.
+ *  @param beta_J               The unsigned representation of the beta string of the bra ONV.
+ *  @param alpha_I              The unsigned representation of the alpha string of the ket ONV.
+ *  @param beta_I               The unsigned representation of the beta string of the ket ONV.
+ *
+ *  @return The matrix element <J|H|I>.
+ */
+double HeatBathExcitationGenerator::calculateMatrixElement(const size_t alpha_J, const size_t beta_J, const size_t alpha_I, const size_t beta_I) const {
+
+    const auto& h = this->h;
+    const auto& g = this->g;
+
+    const size_t alpha_differences = __builtin_popcountll(alpha_I ^ alpha_J);
+    const size_t beta_differences = __builtin_popcountll(beta_I ^ beta_J);
+    if (alpha_differences + beta_differences > 4) {
+        return 0.0;
+    }
+
+    const auto occupied_alpha = occupiedIndicesOf(alpha_I);
+    const auto occupied_beta = occupiedIndicesOf(beta_I);
+
+    // The diagonal elements.
+    if (alpha_differences + beta_differences == 0) {
+        double value = 0.0;
+        for (const auto& p : occupied_alpha) {
+            value += h(p, p);
+            for (const auto& q : occupied_alpha) {
+                value += 0.5 * (g(p, p, q, q) - g(p, q, q, p));  // the terms with p == q cancel
+            }
+            for (const auto& q : occupied_beta) {
+                value += g(p, p, q, q);
+            }
+        }
+        for (const auto& p : occupied_beta) {
+            value += h(p, p);
+            for (const auto& q : occupied_beta) {
+                value += 0.5 * (g(p, p, q, q) - g(p, q, q, p));
+            }
+        }
+        return value;
+    }
+
+    // A single excitation in one of the spin strings. 'I_sigma' and 'J_sigma' are the excited strings, and 'I_other' is the spectator string.
+    const auto single_excitation = [this, &h, &g](const size_t I_sigma, const size_t J_sigma, const size_t I_other) {
+        const auto p = static_cast<size_t>(__builtin_ctzll(I_sigma & ~J_sigma));  // occupied in I, unoccupied in J
+        const auto q = static_cast<size_t>(__builtin_ctzll(J_sigma & ~I_sigma));  // occupied in J, unoccupied in I
+        const auto sign = phaseFactor(I_sigma, p) * phaseFactor(J_sigma, q);
+
+        double value = h(p, q);
+        for (size_t r = 0; r < this->K; r++) {
+            if (((I_sigma & J_sigma) >> r) & 1) {  // r is occupied in both strings, so r != p and r != q
+                value += g(p, q, r, r) - g(p, r, r, q);
+            }
+            if ((I_other >> r) & 1) {
+                value += g(p, q, r, r);
+            }
+        }
+        return sign * value;
+    };
+
+    // A double excitation in one of the spin strings.
+    const auto same_spin_double_excitation = [&g](const size_t I_sigma, const size_t J_sigma) {
+        const auto occupied_I = occupiedIndicesOf(I_sigma & ~J_sigma);
+        const auto occupied_J = occupiedIndicesOf(J_sigma & ~I_sigma);
+        const auto p = occupied_I[0];
+        const auto r = occupied_I[1];
+        const auto q = occupied_J[0];
+        const auto s = occupied_J[1];
+
+        const auto sign = phaseFactor(I_sigma, p) * phaseFactor(I_sigma, r) * phaseFactor(J_sigma, q) * phaseFactor(J_sigma, s);
+        return sign * (g(p, q, r, s) - g(p, s, r, q));
+    };
+
+
+    if ((alpha_differences == 2) && (beta_differences == 0)) {
+        return single_excitation(alpha_I, alpha_J, beta_I);
+    }
+
+    if ((alpha_differences == 0) && (beta_differences == 2)) {
+        return single_excitation(beta_I, beta_J, alpha_I);
+    }
+
+    if ((alpha_differences == 4) && (beta_differences == 0)) {
+        return same_spin_double_excitation(alpha_I, alpha_J);
+    }
+
+    if ((alpha_differences == 0) && (beta_differences == 4)) {
+        return same_spin_double_excitation(beta_I, beta_J);
+    }
+
+    // The remaining case is a single excitation in both spin strings.
+    const auto p = static_cast<size_t>(__builtin_ctzll(alpha_I & ~alpha_J));
+    const auto q = static_cast<size_t>(__builtin_ctzll(alpha_J & ~alpha_I));
+    const auto r = static_cast<size_t>(__builtin_ctzll(beta_I & ~beta_J));
+    const auto s = static_cast<size_t>(__builtin_ctzll(beta_J & ~beta_I));
+
+    const auto sign = phaseFactor(alpha_I, p) * phaseFactor(alpha_J, q) * phaseFactor(beta_I, r) * phaseFactor(beta_J, s);
+    return sign * g(p, q, r, s);
+}
+
+
+/*
+ *  MARK: Excitations
+ */
+
+/**
+ *  Apply the given callback to every single and double excitation J of the given ONV I whose matrix element |<J|H|I>| exceeds the given threshold.
+ *
+ *  @param alpha_I              The unsigned representation of the alpha string of the ONV.
+ *  @param beta_I               The unsigned representation of the beta string of the ONV.
+ *  @param threshold            The threshold on the magnitude of the matrix elements.
+ *  @param callback             The function that should be called for every important excitation. Its arguments are the unsigned representations of the alpha and beta strings of the excited ONV.
+ */
+void HeatBathExcitationGenerator::forEachExcitation(const size_t alpha_I, const size_t beta_I, const double threshold, const std::function<void(const size_t, const size_t)>& callback) const {
+
+    const auto occupied_alpha = occupiedIndicesOf(alpha_I);
+    const auto occupied_beta = occupiedIndicesOf(beta_I);
+
+
+    // The single excitations have no simple bound, so their matrix elements are calculated explicitly.
+    for (const auto& q : occupied_alpha) {
+        for (size_t p = 0; p < this->K; p++) {
+            if ((alpha_I >> p) & 1) {
+                continue;  // p should be unoccupied
+            }
+
+            const auto alpha_J = alpha_I ^ (size_t {1} << q) ^ (size_t {1} << p);
+            if (std::abs(this->calculateMatrixElement(alpha_J, beta_I, alpha_I, beta_I)) > threshold) {
+                callback(alpha_J, beta_I);
+            }
+        }
+    }
+
+    for (const auto& q : occupied_beta) {
+        for (size_t p = 0; p < this->K; p++) {
+            if ((beta_I >> p) & 1) {
+                continue;  // p should be unoccupied
+            }
+
+            const auto beta_J = beta_I ^ (size_t {1} << q) ^ (size_t {1} << p);
+            if (std::abs(this->calculateMatrixElement(alpha_I, beta_J, alpha_I, beta_I)) > threshold) {
+                callback(alpha_I, beta_J);
+            }
+        }
+    }
+
+
+    // The double excitations are read from the sorted lists, until their magnitude drops below the threshold. Created orbitals that are already occupied (including the annihilated ones) don't lead to a double excitation.
+    const auto same_spin_double_excitations = [this, threshold](const size_t I_sigma, const std::vector<size_t>& occupied_indices, const std::function<void(const size_t)>& callback_sigma) {
+        for (size_t i = 0; i < occupied_indices.size(); i++) {
+            for (size_t j = i + 1; j < occupied_indices.size(); j++) {
+                const auto q = occupied_indices[i];
+                const auto s = occupied_indices[j];
+
+                for (const auto& excitation : this->same_spin_excitations[q * this->K + s]) {
+                    if (excitation.magnitude <= threshold) {
+                        break;
+                    }
+
+                    if (((I_sigma >> excitation.p) & 1) || ((I_sigma >> excitation.r) & 1)) {
+                        continue;
+                    }
+
+                    callback_sigma(I_sigma ^ (size_t {1} << q) ^ (size_t {1} << s) ^ (size_t {1} << excitation.p) ^ (size_t {1} << excitation.r));
+                }
+            }
+        }
+    };
+
+    same_spin_double_excitations(alpha_I, occupied_alpha, [beta_I, &callback](const size_t alpha_J) { callback(alpha_J, beta_I); });
+    same_spin_double_excitations(beta_I, occupied_beta, [alpha_I, &callback](const size_t beta_J) { callback(alpha_I, beta_J); });
+
+    for (const auto& q : occupied_alpha) {
+        for (const auto& s : occupied_beta) {
+            for (const auto& excitation : this->opposite_spin_excitations[q * this->K + s]) {
+                if (excitation.magnitude <= threshold) {
+                    break;
+                }
+
+                if (((alpha_I >> excitation.p) & 1) || ((beta_I >> excitation.r) & 1)) {
+                    continue;
+                }
+
+                callback(alpha_I ^ (size_t {1} << q) ^ (size_t {1} << excitation.p), beta_I ^ (size_t {1} << s) ^ (size_t {1} << excitation.r));
+            }
+        }
+    }
+}
+
+
+}  // namespace GQCP
@@ -36,6 +36,25 @@ BaseOrbitalOptimizer::BaseOrbitalOptimizer(const double convergence_threshold, c
     maximum_number_of_iterations {maximum_number_of_iterations} {}
 
 
+/*
+ *  PUBLIC VIRTUAL METHODS
+ */
+
+/**
+ *  Rotate the spinor basis and the Hamiltonian into the next iteration.
+ * 
+ *  @param spinor_basis         the current spinor basis
+ *  @param sq_hamiltonian       the current Hamiltonian
+ * 
+ *  @note The default implementation rotates with the unitary transformation from calculateNewRotationMatrix(). Derived classes can override this method if they can rotate more efficiently.
+ */
+void BaseOrbitalOptimizer::rotateIntoNextIteration(RSpinOrbitalBasis<double, GTOShell>& spinor_basis, RSQHamiltonian<double>& sq_hamiltonian) const {
+
+    const auto U = this->calculateNewRotationMatrix(sq_hamiltonian);
+    rotate(U, spinor_basis, sq_hamiltonian);
+}
+
+
 /*
  *  PUBLIC METHODS
  */
@@ -43,7 +62,7 @@ BaseOrbitalOptimizer::BaseOrbitalOptimizer(const double convergence_threshold, c
 /**
  *  Optimize the Hamiltonian by subsequently
  *      - checking for convergence (see checkForConvergence())
- *      - rotating the Hamiltonian (and spinor basis) with a newly found rotation matrix (see calculateNewRotationMatrix())
+ *      - rotating the Hamiltonian (and spinor basis) with a newly found rotation (see rotateIntoNextIteration())
  * 
  *  @param spinor_basis         the initial spinor basis that contains the spinors to be optimized
  *  @param sq_hamiltonian       the initial (guess for the) Hamiltonian
@@ -55,8 +74,7 @@ void BaseOrbitalOptimizer::optimize(RSpinOrbitalBasis<double, GTOShell>& spinor_
     }
 
     while (this->prepareConvergenceChecking(sq_hamiltonian), !this->checkForConvergence(sq_hamiltonian)) {  // result of the comma operator is the second operand, so this expression effectively means "if not converged"
-        const auto U = this->calculateNewRotationMatrix(sq_hamiltonian);
-        rotate(U, spinor_basis, sq_hamiltonian);
+        this->rotateIntoNextIteration(spinor_basis, sq_hamiltonian);
 
         this->number_of_iterations++;
         if (this->number_of_iterations > this->maximum_number_of_iterations) {
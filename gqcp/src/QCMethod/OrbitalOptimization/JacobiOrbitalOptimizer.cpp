@@ -81,6 +81,21 @@ void JacobiOrbitalOptimizer::prepareConvergenceChecking(const RSQHamiltonian<dou
 }
 
 
+/**
+ *  Rotate the spinor basis and the Hamiltonian into the next iteration, using the optimal Jacobi rotation directly. For the Hamiltonian, this scales as O(K^3) instead of the O(K^5) of a general basis rotation.
+ * 
+ *  @param spinor_basis         the current spinor basis
+ *  @param sq_hamiltonian       the current Hamiltonian
+ */
+void JacobiOrbitalOptimizer::rotateIntoNextIteration(RSpinOrbitalBasis<double, GTOShell>& spinor_basis, RSQHamiltonian<double>& sq_hamiltonian) const {
+
+    const auto& jacobi_rotation = this->optimal_jacobi_with_scalar.first;
+
+    spinor_basis.rotate(jacobi_rotation);
+    sq_hamiltonian.rotate(jacobi_rotation);
+}
+
+
 /*
  *  PUBLIC METHODS
  */
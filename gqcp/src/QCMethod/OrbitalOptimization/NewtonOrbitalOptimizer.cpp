@@ -40,6 +40,16 @@ NewtonOrbitalOptimizer::NewtonOrbitalOptimizer(std::shared_ptr<BaseHessianModifi
     BaseOrbitalOptimizer(convergence_threshold, maximum_number_of_iterations) {}
 
 
+/*
+ *  @param trust_region                     the augmented-Hessian trust region that is used to calculate the steps, using only Hessian-vector products
+ *  @param convergence_threshold            the threshold used to check for convergence
+ *  @param maximum_number_of_iterations     the maximum number of iterations that may be used to achieve convergence
+ */
+NewtonOrbitalOptimizer::NewtonOrbitalOptimizer(const AugmentedHessianTrustRegion& trust_region, const double convergence_threshold, const size_t maximum_number_of_iterations) :
+    BaseOrbitalOptimizer(convergence_threshold, maximum_number_of_iterations),
+    trust_region {std::make_shared<AugmentedHessianTrustRegion>(trust_region)} {}
+
+
 /*
  *  PUBLIC OVERRIDDEN METHODS
  */
@@ -80,6 +90,12 @@ bool NewtonOrbitalOptimizer::checkForConvergence(const RSQHamiltonian<double>& s
 
     // Check for convergence on the norm
     if (this->gradient.norm() < this->convergence_threshold) {
+
+        // With a trust region, the positive definiteness of the Hessian is checked through its lowest eigenvalue, using only Hessian-vector products.
+        if (this->trust_region) {
+            return this->lowest_hessian_eigenpair.eigenvalue() >= -1.0e-04;  // use the same threshold as newtonStepIsWellDefined()
+        }
+
         if (this->newtonStepIsWellDefined()) {  // needs this->hessian
             return true;
         } else {
@@ -100,9 +116,47 @@ void NewtonOrbitalOptimizer::prepareConvergenceChecking(const RSQHamiltonian<dou
 
     this->prepareOrbitalDerivativesCalculation(sq_hamiltonian);
 
-    // All Newton-based orbital optimizers need to calculate a gradient and Hessian
+    // All Newton-based orbital optimizers need to calculate a gradient and Hessian. With a trust region, only the diagonal of the Hessian is needed: the other Hessian information is accessed through Hessian-vector products.
     this->gradient = this->calculateGradientVector(sq_hamiltonian);
-    this->hessian = this->calculateHessianMatrix(sq_hamiltonian);
+    if (this->trust_region) {
+        this->hessian_diagonal = this->calculateHessianDiagonal(sq_hamiltonian);
+
+        // The lowest eigenpair of the Hessian is needed both for the convergence check and for the step along negative curvature. Since it requires a Davidson solve, it is calculated only once per iteration.
+        if (this->gradient.norm() <= this->convergence_threshold) {
+            this->lowest_hessian_eigenpair = this->trust_region->calculateLowestHessianEigenpair(this->hessianVectorProductFunction(sq_hamiltonian), this->hessian_diagonal);
+        }
+    } else {
+        this->hessian = this->calculateHessianMatrix(sq_hamiltonian);
+    }
+}
+
+
+/*
+ *  PUBLIC VIRTUAL METHODS
+ */
+
+/**
+ *  @param sq_hamiltonian           the current Hamiltonian
+ * 
+ *  @return the diagonal of the current orbital Hessian matrix
+ * 
+ *  @note The default implementation sets up the dense Hessian matrix. Derived classes should override this method to profit from the augmented-Hessian trust region.
+ */
+VectorX<double> NewtonOrbitalOptimizer::calculateHessianDiagonal(const RSQHamiltonian<double>& sq_hamiltonian) const {
+    return this->calculateHessianMatrix(sq_hamiltonian).diagonal();
+}
+
+
+/**
+ *  @param sq_hamiltonian           the current Hamiltonian
+ *  @param x                        a vector of free orbital rotation generators, in the convention that p>q
+ * 
+ *  @return the product of the current orbital Hessian matrix with the given vector
+ * 
+ *  @note The default implementation sets up the dense Hessian matrix. Derived classes should override this method to profit from the augmented-Hessian trust region.
+ */
+VectorX<double> NewtonOrbitalOptimizer::calculateHessianVectorProduct(const RSQHamiltonian<double>& sq_hamiltonian, const VectorX<double>& x) const {
+    return this->calculateHessianMatrix(sq_hamiltonian) * x;
 }
 
 
@@ -139,6 +193,17 @@ SquareMatrix<double> NewtonOrbitalOptimizer::calculateHessianMatrix(const RSQHam
  */
 OrbitalRotationGenerators NewtonOrbitalOptimizer::calculateNewFreeOrbitalGenerators(const RSQHamiltonian<double>& sq_hamiltonian) const {
 
+    // With a trust region, use the augmented-Hessian step or, if the gradient has converged but the Hessian is indefinite, a step of the size of the trust radius along the lowest eigenvector of the Hessian.
+    if (this->trust_region) {
+        if (this->gradient.norm() > this->convergence_threshold) {
+            return OrbitalRotationGenerators(this->trust_region->calculateStep(this->gradient, this->hessianVectorProductFunction(sq_hamiltonian), this->hessian_diagonal));
+        }
+
+        // The lowest eigenpair of the Hessian has already been calculated in prepareConvergenceChecking().
+        const VectorX<double> direction = this->trust_region->trustRadius() * this->lowest_hessian_eigenpair.eigenvector();
+        return OrbitalRotationGenerators(direction);
+    }
+
     // If the norm hasn't converged, use the Newton step
     if (this->gradient.norm() > this->convergence_threshold) {
 
@@ -173,6 +238,16 @@ VectorX<double> NewtonOrbitalOptimizer::directionFromIndefiniteHessian() const {
 }
 
 
+/**
+ *  @param sq_hamiltonian           the current Hamiltonian
+ * 
+ *  @return a function that returns the product of the current orbital Hessian matrix with a vector
+ */
+VectorFunction<double> NewtonOrbitalOptimizer::hessianVectorProductFunction(const RSQHamiltonian<double>& sq_hamiltonian) const {
+    return [this, &sq_hamiltonian](const VectorX<double>& x) { return this->calculateHessianVectorProduct(sq_hamiltonian, x); };
+}
+
+
 /**
  *  @return if a Newton step would be well-defined, i.e. the Hessian is positive definite
  */
@@ -17,6 +17,8 @@
 
 #include "QCMethod/OrbitalOptimization/QCMethodNewtonOrbitalOptimizer.hpp"
 
+#include "Basis/Transformations/OrbitalRotationGenerators.hpp"
+
 
 namespace GQCP {
 
@@ -69,6 +71,82 @@ SquareRankFourTensor<double> QCMethodNewtonOrbitalOptimizer::calculateHessianTen
 }
 
 
+/**
+ *  @param sq_hamiltonian           the current Hamiltonian
+ * 
+ *  @return the diagonal of the current orbital Hessian matrix, calculated directly from the DMs in O(K^4) time
+ */
+VectorX<double> QCMethodNewtonOrbitalOptimizer::calculateHessianDiagonal(const RSQHamiltonian<double>& sq_hamiltonian) const {
+
+    const auto K = sq_hamiltonian.numberOfOrbitals();
+    const auto& f = sq_hamiltonian.core().parameters();
+    const auto& g = sq_hamiltonian.twoElectron().parameters();
+    const SquareMatrix<double> D_symmetrized = 0.5 * (this->D + this->D.transpose());
+
+
+    // The diagonal Hessian elements H(pq,pq) = 2 (G(p,q,p,q) - G(p,q,q,p) + G(q,p,q,p) - G(q,p,p,q)) only need the super-Fockian elements T(p,q) = G(p,q,p,q) and U(p,q) = G(p,q,q,p).
+    SquareMatrix<double> T = SquareMatrix<double>::Zero(K);
+    SquareMatrix<double> U = SquareMatrix<double>::Zero(K);
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q < K; q++) {
+            if (p == q) {
+                T(p, q) += this->F(p, q);
+            }
+            T(p, q) -= f(q, p) * D_symmetrized(q, p);
+
+            U(p, q) += this->F(p, p) - f(p, p) * D_symmetrized(q, q);
+
+            for (size_t t = 0; t < K; t++) {
+                for (size_t u = 0; u < K; u++) {
+                    T(p, q) += 0.5 * (g(q, t, q, u) * this->S(p, t, p, u) - g(q, t, u, p) * this->S(p, t, u, q) - g(q, p, t, u) * this->S(p, q, t, u));
+                    U(p, q) += 0.5 * (g(p, t, q, u) * this->S(q, t, p, u) - g(p, t, u, p) * this->S(q, t, u, q) - g(p, p, t, u) * this->S(q, q, t, u));
+                }
+            }
+        }
+    }
+
+    const SquareMatrix<double> diagonal = 2 * (T - U + T.transpose() - U.transpose());
+    return diagonal.pairWiseStrictReduced();
+}
+
+
+/**
+ *  @param sq_hamiltonian           the current Hamiltonian
+ *  @param x                        a vector of free orbital rotation generators, in the convention that p>q
+ * 
+ *  @return the product of the current orbital Hessian matrix with the given vector, calculated through contractions of the DMs with the antisymmetric generator matrix in O(K^5) time, without setting up the super-Fockian matrix
+ */
+VectorX<double> QCMethodNewtonOrbitalOptimizer::calculateHessianVectorProduct(const RSQHamiltonian<double>& sq_hamiltonian, const VectorX<double>& x) const {
+
+    // Since the Hessian tensor is antisymmetric in its last two indices, its product with x is
+    //      sigma(pq) = X(p,q) + Y(p,q) - X(q,p) - Y(q,p),
+    // in which X(p,q) = G(p,q,r,s) kappa(r,s) and Y(p,q) = G(r,s,p,q) kappa(r,s) are contractions of the super-Fockian matrix with the antisymmetric generator matrix kappa.
+    const auto& f = sq_hamiltonian.core().parameters();
+    const auto& g = sq_hamiltonian.twoElectron().parameters();
+    const SquareMatrix<double> D_symmetrized = 0.5 * (this->D + this->D.transpose());
+    const SquareMatrix<double> kappa = OrbitalRotationGenerators(x).asMatrix();
+
+
+    // The one-electron contributions.
+    SquareMatrix<double> X = this->F * kappa.transpose() - f.transpose() * kappa.transpose() * D_symmetrized;
+    SquareMatrix<double> Y = kappa.transpose() * this->F - D_symmetrized * kappa.transpose() * f.transpose();
+
+
+    // The two-electron contributions, of which every term first contracts one index of the two-electron integrals with kappa.
+    const auto g_kappa_first = g.einsum<1>("stqu,rs->rtqu", kappa);
+    X += 0.5 * (g_kappa_first.einsum<3>("rtqu,rtpu->pq", this->S).asMatrix() - g_kappa_first.einsum<3>("rtup,rtuq->pq", this->S).asMatrix() - g_kappa_first.einsum<3>("rptu,rqtu->pq", this->S).asMatrix());
+
+    const auto g_kappa_second = g.einsum<1>("qrtu,rs->qstu", kappa);
+    const auto g_kappa_third = g.einsum<1>("qtsu,rs->qtru", kappa);
+    const auto g_kappa_fourth = g.einsum<1>("qtur,rs->qtus", kappa);
+    Y += 0.5 * (g_kappa_third.einsum<3>("qtru,ptru->pq", this->S).asMatrix() - g_kappa_fourth.einsum<3>("qtus,ptus->pq", this->S).asMatrix() - g_kappa_second.einsum<3>("qstu,pstu->pq", this->S).asMatrix());
+
+
+    const SquareMatrix<double> sigma = X + Y - X.transpose() - Y.transpose();
+    return sigma.pairWiseStrictReduced();
+}
+
+
 /**
  *  Prepare this object (i.e. the context for the orbital optimization algorithm) to be able to check for convergence in this Newton-based orbital optimizer for quantum chemical methods.
  */
@@ -78,6 +156,12 @@ void QCMethodNewtonOrbitalOptimizer::prepareOrbitalDerivativesCalculation(const
 
     this->D = this->calculate1DM();
     this->d = this->calculate2DM();
+
+    // Only the matrix-free Hessian-vector products need these intermediates.
+    if (this->trust_region) {
+        this->F = sq_hamiltonian.calculateFockianMatrix(this->D, this->d);
+        this->S = SquareRankFourTensor<double>(this->d.Eigen() + this->d.Eigen().shuffle(Eigen::array<int, 4> {1, 0, 3, 2}));
+    }
 }
 
 
@@ -0,0 +1,60 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Utilities/threading.hpp"
+
+
+namespace GQCP {
+
+
+namespace {
+
+// The library-wide number of threads. It is atomic, so that it can be read while another thread changes it.
+std::atomic<size_t> library_number_of_threads {1};
+
+}  // namespace
+
+
+/*
+ *  MARK: Library-wide settings
+ */
+
+/**
+ *  @return The number of threads that is used by the multithreaded algorithms whose interface doesn't allow a number of threads to be passed, such as the basis transformation of a two-electron operator and the tensor contractions of `Tensor::einsum`. By default, a single thread is used.
+ */
+size_t numberOfThreads() {
+
+    return library_number_of_threads.load();
+}
+
+
+/**
+ *  Set the number of threads that is used by the multithreaded algorithms whose interface doesn't allow a number of threads to be passed, such as the basis transformation of a two-electron operator and the tensor contractions of `Tensor::einsum`.
+ * 
+ *  @param number_of_threads        The number of threads. It should be at least 1.
+ */
+void setNumberOfThreads(const size_t number_of_threads) {
+
+    if (number_of_threads == 0) {
+        throw std::invalid_argument("setNumberOfThreads(const size_t): The number of threads should be at least 1.");
+    }
+
+    library_number_of_threads.store(number_of_threads);
+}
+
+
+}  // namespace GQCP
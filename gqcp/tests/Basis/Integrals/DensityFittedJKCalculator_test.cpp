@@ -0,0 +1,126 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "DensityFittedJKCalculator"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/DensityFittedJKCalculator.hpp"
+#include "Basis/Integrals/DirectJKCalculator.hpp"
+#include "Mathematical/Representation/PackedSymmetricRankFourTensor.hpp"
+#include "Molecule/Molecule.hpp"
+
+
+/**
+ *  Check if density fitting is exact when the auxiliary basis consists of all unique products of the basis functions.
+ *
+ *  For a (positive definite) pair matrix M(pq, rs) = (pq|rs), choosing the auxiliary functions as the pairs P = (rs) with r >= s gives the three-center integrals (mu nu|P) = M(mu nu, P) and the metric V = M. The fitted integrals then reproduce the original ones, so the Coulomb and exchange matrices should match the contractions of the full tensor. The density matrices are random, so they are not symmetric, and their symmetrized versions are checked as well.
+ */
+BOOST_AUTO_TEST_CASE(product_basis_is_exact) {
+
+    const size_t K = 5;
+    const size_t number_of_pairs = K * (K + 1) / 2;
+
+    // Create a positive definite pair matrix and the corresponding (8-fold symmetric) two-electron integrals.
+    const GQCP::MatrixX<double> A = GQCP::MatrixX<double>::Random(number_of_pairs, number_of_pairs);
+    const GQCP::SquareMatrix<double> M = A * A.transpose() + GQCP::MatrixX<double>::Identity(number_of_pairs, number_of_pairs);
+
+    GQCP::PackedSymmetricRankFourTensor packed {K};
+    for (size_t PQ = 0; PQ < number_of_pairs; PQ++) {
+        for (size_t RS = 0; RS <= PQ; RS++) {
+            packed.packedElements()(PQ * (PQ + 1) / 2 + RS) = M(PQ, RS);
+        }
+    }
+    const auto g = packed.full();
+
+    GQCP::MatrixX<double> three_center_integrals {K * K, number_of_pairs};
+    for (size_t mu = 0; mu < K; mu++) {
+        for (size_t nu = 0; nu < K; nu++) {
+            three_center_integrals.row(mu + K * nu) = M.row(GQCP::PackedSymmetricRankFourTensor::pairIndex(mu, nu));
+        }
+    }
+
+
+    const GQCP::SquareMatrix<double> P_random = GQCP::SquareMatrix<double>::Random(K);
+    const GQCP::SquareMatrix<double> P_symmetric = P_random + P_random.transpose();
+    const std::vector<GQCP::SquareMatrix<double>> density_matrices {P_random, P_symmetric};
+
+    for (const size_t number_of_threads : {1, 3}) {
+        const GQCP::DensityFittedJKCalculator jk_calculator {three_center_integrals, M, number_of_threads};
+        BOOST_CHECK(jk_calculator.numberOfBasisFunctions() == K);
+        BOOST_CHECK(jk_calculator.numberOfAuxiliaryBasisFunctions() == number_of_pairs);
+
+        const auto J_and_K = jk_calculator.calculate(density_matrices);
+        BOOST_REQUIRE(J_and_K.first.size() == 2);
+        BOOST_REQUIRE(J_and_K.second.size() == 2);
+
+        for (size_t i = 0; i < 2; i++) {
+            const auto& P = density_matrices[i];
+            const GQCP::MatrixX<double> J_ref = g.einsum<2>("ijkl,kl->ij", P).asMatrix();
+            const GQCP::MatrixX<double> K_ref = g.einsum<2>("ijkl,kj->il", P).asMatrix();
+
+            BOOST_CHECK(J_and_K.first[i].isApprox(J_ref, 1.0e-10));
+            BOOST_CHECK(J_and_K.second[i].isApprox(K_ref, 1.0e-10));
+        }
+
+        BOOST_CHECK(jk_calculator.calculateCoulomb(P_random).isApprox(J_and_K.first[0], 1.0e-12));
+        BOOST_CHECK(jk_calculator.calculateExchange(P_random).isApprox(J_and_K.second[0], 1.0e-12));
+    }
+}
+
+
+/**
+ *  Check if the density-fitted Coulomb and exchange matrices for H2O are close to the exact ones, when a JK-fitting auxiliary basis is used.
+ */
+BOOST_AUTO_TEST_CASE(libint_h2o_631g) {
+
+    const auto water = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {water, "6-31G"};
+    const GQCP::ScalarBasis<GQCP::GTOShell> auxiliary_basis {water, "def2-universal-jkfit"};
+    const auto K = scalar_basis.numberOfBasisFunctions();
+
+    // Use a symmetric, positive semi-definite density matrix of 5 orbitals, like an RHF density matrix.
+    const GQCP::MatrixX<double> C = GQCP::MatrixX<double>::Random(K, 5);
+    const GQCP::SquareMatrix<double> D = 0.1 * C * C.transpose();
+
+    const auto direct_calculator = GQCP::DirectJKCalculator::Libint(scalar_basis, 0.0);
+    const auto J_and_K_ref = direct_calculator.calculate({D});
+
+    const auto df_calculator = GQCP::DensityFittedJKCalculator::Libint(scalar_basis, auxiliary_basis, 2);
+    const auto J_and_K = df_calculator.calculate({D});
+
+    BOOST_CHECK(J_and_K.first[0].isApprox(J_and_K_ref.first[0], 1.0e-03));
+    BOOST_CHECK(J_and_K.second[0].isApprox(J_and_K_ref.second[0], 1.0e-03));
+}
+
+
+/**
+ *  Check if the density-fitted J/K calculator throws for incompatible dimensions, a metric that isn't positive definite or no threads.
+ */
+BOOST_AUTO_TEST_CASE(density_fitted_throws) {
+
+    const GQCP::MatrixX<double> three_center_integrals = GQCP::MatrixX<double>::Random(9, 4);
+    const GQCP::SquareMatrix<double> metric = GQCP::SquareMatrix<double>::Identity(4);
+
+    BOOST_CHECK_THROW(GQCP::DensityFittedJKCalculator(GQCP::MatrixX<double>::Random(8, 4), metric), std::invalid_argument);
+    BOOST_CHECK_THROW(GQCP::DensityFittedJKCalculator(three_center_integrals, GQCP::SquareMatrix<double>::Identity(3)), std::invalid_argument);
+    BOOST_CHECK_THROW(GQCP::DensityFittedJKCalculator(three_center_integrals, GQCP::SquareMatrix<double>(-metric)), std::invalid_argument);
+    BOOST_CHECK_THROW(GQCP::DensityFittedJKCalculator(three_center_integrals, metric, 0), std::invalid_argument);
+
+    const GQCP::DensityFittedJKCalculator jk_calculator {three_center_integrals, metric};
+    BOOST_CHECK_THROW(jk_calculator.calculate({GQCP::SquareMatrix<double>::Zero(4)}), std::invalid_argument);
+}
@@ -0,0 +1,88 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "DirectJKCalculator"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/DirectJKCalculator.hpp"
+#include "Basis/Integrals/IntegralCalculator.hpp"
+#include "Molecule/Molecule.hpp"
+#include "Operator/FirstQuantized/Operator.hpp"
+
+
+/**
+ *  Check if the Coulomb and exchange matrices that are calculated directly (i.e. without storing the two-electron integrals) match the contractions of the stored two-electron integrals, also when they are calculated on multiple threads.
+ *
+ *  The test system is H2O in an STO-3G basisset. The density matrices are random, so they are not symmetric.
+ */
+BOOST_AUTO_TEST_CASE(direct_vs_stored_h2o_sto3g) {
+
+    const auto water = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {water, "STO-3G"};
+    const auto K = scalar_basis.numberOfBasisFunctions();
+
+    const auto g = GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::Operator::Coulomb(), scalar_basis);
+
+    const std::vector<GQCP::SquareMatrix<double>> density_matrices {GQCP::SquareMatrix<double>::Random(K), GQCP::SquareMatrix<double>::Random(K)};
+
+
+    // A screening threshold of zero makes sure that no shell quartet is neglected.
+    for (const size_t number_of_threads : {1, 3}) {
+        const auto jk_calculator = GQCP::DirectJKCalculator::Libint(scalar_basis, 0.0, number_of_threads);
+        BOOST_CHECK(jk_calculator.numberOfBasisFunctions() == K);
+        BOOST_CHECK(jk_calculator.numberOfThreads() == number_of_threads);
+
+        const auto J_and_K = jk_calculator.calculate(density_matrices);
+        BOOST_REQUIRE(J_and_K.first.size() == 2);
+        BOOST_REQUIRE(J_and_K.second.size() == 2);
+
+        for (size_t i = 0; i < 2; i++) {
+            const auto& P = density_matrices[i];
+            const GQCP::MatrixX<double> J_ref = g.einsum<2>("ijkl,kl->ij", P).asMatrix();
+            const GQCP::MatrixX<double> K_ref = g.einsum<2>("ijkl,kj->il", P).asMatrix();
+
+            BOOST_CHECK(J_and_K.first[i].isApprox(J_ref, 1.0e-10));
+            BOOST_CHECK(J_and_K.second[i].isApprox(K_ref, 1.0e-10));
+        }
+
+        BOOST_CHECK(jk_calculator.calculateCoulomb(density_matrices[0]).isApprox(J_and_K.first[0], 1.0e-12));
+        BOOST_CHECK(jk_calculator.calculateExchange(density_matrices[0]).isApprox(J_and_K.second[0], 1.0e-12));
+    }
+
+
+    // The default screening threshold should only neglect contributions that are far below the default SCF convergence thresholds.
+    const auto screened_jk_calculator = GQCP::DirectJKCalculator::Libint(scalar_basis);
+    const GQCP::MatrixX<double> J_ref = g.einsum<2>("ijkl,kl->ij", density_matrices[0]).asMatrix();
+    BOOST_CHECK(screened_jk_calculator.calculateCoulomb(density_matrices[0]).isApprox(J_ref, 1.0e-08));
+}
+
+
+/**
+ *  Check if the direct J/K calculator throws when it is asked to use a negative screening threshold or no threads, or when the dimension of a density matrix is incompatible with the scalar basis.
+ */
+BOOST_AUTO_TEST_CASE(direct_throws) {
+
+    const auto water = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {water, "STO-3G"};  // 7 basis functions
+
+    BOOST_CHECK_THROW(GQCP::DirectJKCalculator::Libint(scalar_basis, -1.0), std::invalid_argument);
+    BOOST_CHECK_THROW(GQCP::DirectJKCalculator::Libint(scalar_basis, 1.0e-12, 0), std::invalid_argument);
+
+    const auto jk_calculator = GQCP::DirectJKCalculator::Libint(scalar_basis);
+    BOOST_CHECK_THROW(jk_calculator.calculate({GQCP::SquareMatrix<double>::Zero(6)}), std::invalid_argument);
+}
@@ -0,0 +1,110 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "FCIDUMP"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/FCIDUMP.hpp"
+
+#include <cmath>
+#include <cstdio>
+
+
+/**
+ *  Check if the header and some integrals of FCIDUMP files are read in correctly, for both ways of terminating the header ('/' and '&END').
+ */
+BOOST_AUTO_TEST_CASE(Read_header) {
+
+    const auto fcidump = GQCP::FCIDUMP::Read("data/h2o_sto3g_klaas.FCIDUMP");
+
+    BOOST_CHECK(fcidump.numberOfOrbitals() == 7);
+    BOOST_CHECK(fcidump.numberOfElectrons() == 10);
+    BOOST_CHECK(fcidump.twiceSpinProjection() == 0);
+    BOOST_CHECK(fcidump.waveFunctionSymmetry() == 1);
+    BOOST_CHECK(fcidump.orbitalSymmetries() == (std::vector<int> {1, 1, 1, 1, 2, 3, 3}));
+
+    BOOST_CHECK(fcidump.twoElectronIntegrals()(0, 0, 0, 0) == 4.7434533171556730);
+    BOOST_CHECK(fcidump.twoElectronIntegrals()(0, 0, 1, 0) == 0.41290974162490696);
+    BOOST_CHECK(fcidump.oneElectronIntegrals()(6, 6) == -5.6336597239292621);
+    BOOST_CHECK(fcidump.coreEnergy() == 9.7794061444134091);
+
+
+    const auto fcidump_end = GQCP::FCIDUMP::Read("data/beh_cation_631g_caitlin.FCIDUMP");
+
+    BOOST_CHECK(fcidump_end.numberOfOrbitals() == 16);
+    BOOST_CHECK(fcidump_end.numberOfElectrons() == 4);
+    BOOST_CHECK(std::abs(fcidump_end.oneElectronIntegrals()(0, 0) - (-8.34082)) < 1.0e-5);
+    BOOST_CHECK(std::abs(fcidump_end.coreEnergy() - 1.5900757460937498) < 1.0e-15);
+}
+
+
+/**
+ *  Check if reading an FCIDUMP file in many small blocks, on multiple threads, gives the same result as reading it at once, on a single thread.
+ */
+BOOST_AUTO_TEST_CASE(Read_threads) {
+
+    const auto fcidump = GQCP::FCIDUMP::Read("data/lif_631g_klaas.FCIDUMP");
+    const auto fcidump_threaded = GQCP::FCIDUMP::Read("data/lif_631g_klaas.FCIDUMP", 4, 1 << 17);
+
+    BOOST_CHECK(fcidump_threaded.numberOfOrbitals() == 28);
+    BOOST_CHECK(fcidump_threaded.oneElectronIntegrals().isApprox(fcidump.oneElectronIntegrals(), 0.0));
+    BOOST_CHECK(fcidump_threaded.twoElectronIntegrals().packedElements() == fcidump.twoElectronIntegrals().packedElements());
+    BOOST_CHECK(fcidump_threaded.coreEnergy() == fcidump.coreEnergy());
+}
+
+
+/**
+ *  Check if writing an FCIDUMP file and reading it back in reproduces the original integrals.
+ */
+BOOST_AUTO_TEST_CASE(write_roundtrip) {
+
+    const auto fcidump = GQCP::FCIDUMP::Read("data/lif_631g_klaas.FCIDUMP");
+    fcidump.write("FCIDUMP_test_write.FCIDUMP", 0.0, 3);
+    const auto fcidump_read = GQCP::FCIDUMP::Read("FCIDUMP_test_write.FCIDUMP");
+    std::remove("FCIDUMP_test_write.FCIDUMP");
+
+    BOOST_CHECK(fcidump_read.numberOfOrbitals() == fcidump.numberOfOrbitals());
+    BOOST_CHECK(fcidump_read.numberOfElectrons() == fcidump.numberOfElectrons());
+    BOOST_CHECK(fcidump_read.orbitalSymmetries() == fcidump.orbitalSymmetries());
+    BOOST_CHECK(fcidump_read.oneElectronIntegrals().isApprox(fcidump.oneElectronIntegrals(), 1.0e-15));
+    BOOST_CHECK(fcidump_read.twoElectronIntegrals().isApprox(fcidump.twoElectronIntegrals(), 1.0e-15));
+    BOOST_CHECK(std::abs(fcidump_read.coreEnergy() - fcidump.coreEnergy()) < 1.0e-15);
+}
+
+
+/**
+ *  Check if the binary integral format reproduces the original integrals exactly.
+ */
+BOOST_AUTO_TEST_CASE(writeBinary_roundtrip) {
+
+    const std::vector<int> orbital_symmetries {1, 2, 1, 3, 4};
+    const GQCP::FCIDUMP fcidump {GQCP::SquareMatrix<double>::RandomSymmetric(5), GQCP::PackedSymmetricRankFourTensor::Random(5), 6, -1.5, 2, orbital_symmetries, 3};
+
+    fcidump.writeBinary("FCIDUMP_test_writeBinary.gqcpint");
+    const auto fcidump_read = GQCP::FCIDUMP::ReadBinary("FCIDUMP_test_writeBinary.gqcpint");
+    std::remove("FCIDUMP_test_writeBinary.gqcpint");
+
+    BOOST_CHECK(fcidump_read.numberOfOrbitals() == 5);
+    BOOST_CHECK(fcidump_read.numberOfElectrons() == 6);
+    BOOST_CHECK(fcidump_read.twiceSpinProjection() == 2);
+    BOOST_CHECK(fcidump_read.waveFunctionSymmetry() == 3);
+    BOOST_CHECK(fcidump_read.orbitalSymmetries() == orbital_symmetries);
+    BOOST_CHECK(fcidump_read.coreEnergy() == -1.5);
+    BOOST_CHECK(fcidump_read.oneElectronIntegrals().isApprox(fcidump.oneElectronIntegrals(), 0.0));
+    BOOST_CHECK(fcidump_read.twoElectronIntegrals().packedElements() == fcidump.twoElectronIntegrals().packedElements());
+}
@@ -116,6 +116,64 @@ BOOST_AUTO_TEST_CASE(HORTON_integrals_h2o_sto3g) {
 }
 
 
+/**
+ *  Check if the two-electron integrals that are calculated using the permutational symmetry of the shell quartets and Cauchy-Schwarz screening match the ones that are calculated over all shell quartets.
+ */
+BOOST_AUTO_TEST_CASE(screened_two_electron_integrals) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto shell_set = scalar_basis.shellSet();
+
+    auto engine = GQCP::IntegralEngine::Libint(GQCP::Operator::Coulomb(), shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum());
+    const auto g_full = GQCP::IntegralCalculator::calculate(engine, shell_set, shell_set)[0];
+
+
+    // Without screening, only the permutational symmetry is used, so the integrals should be (numerically) identical.
+    const auto g_symmetric = GQCP::IntegralCalculator::calculateScreened(engine, shell_set, 0.0)[0];
+    BOOST_CHECK(g_symmetric.isApprox(g_full, 1.0e-12));
+
+    // With screening, the neglected integrals are bounded by the threshold.
+    const auto g_screened = GQCP::IntegralCalculator::calculateScreened(engine, shell_set, 1.0e-08)[0];
+    BOOST_CHECK(g_screened.isApprox(g_full, 1.0e-08));
+
+    // The convenience function should use the screened driver as well.
+    BOOST_CHECK(GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::Operator::Coulomb(), scalar_basis).isApprox(g_full, 1.0e-10));
+
+    BOOST_CHECK_THROW(GQCP::IntegralCalculator::calculateScreened(engine, shell_set, -1.0), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the integrals that are calculated on multiple threads, each with their own clone of the engine, are equal to the ones that are calculated on a single thread.
+ */
+BOOST_AUTO_TEST_CASE(multithreaded_integrals) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};
+    const auto shell_set = scalar_basis.shellSet();
+    const auto max_nprim = shell_set.maximumNumberOfPrimitives();
+    const auto max_l = shell_set.maximumAngularMomentum();
+
+    auto one_electron_engine = GQCP::IntegralEngine::Libint(GQCP::Operator::NuclearAttraction(molecule), max_nprim, max_l);
+    auto two_electron_engine = GQCP::IntegralEngine::Libint(GQCP::Operator::Coulomb(), max_nprim, max_l);
+
+    const auto V_serial = GQCP::IntegralCalculator::calculate(one_electron_engine, shell_set, shell_set)[0];
+    const auto g_serial = GQCP::IntegralCalculator::calculate(two_electron_engine, shell_set, shell_set)[0];
+    const auto g_screened_serial = GQCP::IntegralCalculator::calculateScreened(two_electron_engine, shell_set)[0];
+
+    // The number of shells is 9, so we also check a number of threads that exceeds it.
+    for (const size_t number_of_threads : {2, 3, 16}) {
+        BOOST_CHECK(GQCP::IntegralCalculator::calculate(one_electron_engine, shell_set, shell_set, number_of_threads)[0].isApprox(V_serial, 1.0e-12));
+        BOOST_CHECK(GQCP::IntegralCalculator::calculate(two_electron_engine, shell_set, shell_set, number_of_threads)[0].isApprox(g_serial, 1.0e-12));
+        BOOST_CHECK(GQCP::IntegralCalculator::calculateScreened(two_electron_engine, shell_set, 1.0e-12, number_of_threads)[0].isApprox(g_screened_serial, 1.0e-12));
+    }
+
+    BOOST_CHECK_THROW(GQCP::IntegralCalculator::calculate(one_electron_engine, shell_set, shell_set, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(GQCP::IntegralCalculator::calculateScreened(two_electron_engine, shell_set, 1.0e-12, 0), std::invalid_argument);
+}
+
+
 // The following test has been commented out as this test has been shown to fail on the current Docker infrastructure.
 /**
  *  Check the calculation of some integrals between Libint2 and libcint.
@@ -0,0 +1,87 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "McMurchieDavidsonCoefficient"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/McMurchieDavidsonCoefficient.hpp"
+
+#include <cmath>
+
+
+/**
+ *  Check the tabulated McMurchie-Davidson coefficients against their closed-form expressions for low Cartesian exponents (Helgaker, Jørgensen, Olsen (2000), section 9.5).
+ */
+BOOST_AUTO_TEST_CASE(closed_form) {
+
+    const double K = 0.3;
+    const double alpha = 1.7;
+    const double L = -0.9;
+    const double beta = 0.6;
+
+    const GQCP::McMurchieDavidsonCoefficient E {K, alpha, L, beta, 2, 2};
+
+
+    // Prepare the quantities that appear in the closed-form expressions.
+    const double p = alpha + beta;
+    const double X_AB = K - L;
+    const double X_PA = -beta / p * X_AB;
+    const double X_PB = alpha / p * X_AB;
+    const double K_AB = std::exp(-alpha * beta / p * X_AB * X_AB);
+
+    BOOST_CHECK(std::abs(E(0, 0, 0) - K_AB) < 1.0e-12);
+
+    BOOST_CHECK(std::abs(E(1, 0, 0) - X_PA * K_AB) < 1.0e-12);
+    BOOST_CHECK(std::abs(E(1, 0, 1) - K_AB / (2 * p)) < 1.0e-12);
+    BOOST_CHECK(std::abs(E(0, 1, 0) - X_PB * K_AB) < 1.0e-12);
+    BOOST_CHECK(std::abs(E(0, 1, 1) - K_AB / (2 * p)) < 1.0e-12);
+
+    BOOST_CHECK(std::abs(E(1, 1, 0) - (X_PA * X_PB + 1.0 / (2 * p)) * K_AB) < 1.0e-12);
+    BOOST_CHECK(std::abs(E(1, 1, 1) - (X_PA + X_PB) / (2 * p) * K_AB) < 1.0e-12);
+    BOOST_CHECK(std::abs(E(1, 1, 2) - K_AB / (4 * p * p)) < 1.0e-12);
+
+    BOOST_CHECK(std::abs(E(2, 0, 0) - (X_PA * X_PA + 1.0 / (2 * p)) * K_AB) < 1.0e-12);
+    BOOST_CHECK(std::abs(E(0, 2, 0) - (X_PB * X_PB + 1.0 / (2 * p)) * K_AB) < 1.0e-12);
+
+    // Coefficients with a degree outside of [0, i + j] vanish.
+    BOOST_CHECK(E(1, 1, 3) == 0.0);
+    BOOST_CHECK(E(1, 1, -1) == 0.0);
+}
+
+
+/**
+ *  Check if the tabulated coefficients do not depend on the size of the table, and if looking up a coefficient that is not tabulated throws.
+ */
+BOOST_AUTO_TEST_CASE(table_size) {
+
+    const GQCP::McMurchieDavidsonCoefficient E_small {0.3, 1.7, -0.9, 0.6, 1, 2};
+    const GQCP::McMurchieDavidsonCoefficient E_large {0.3, 1.7, -0.9, 0.6, 5, 4};
+
+    for (int i = 0; i <= 1; i++) {
+        for (int j = 0; j <= 2; j++) {
+            for (int t = 0; t <= i + j; t++) {
+                BOOST_CHECK(std::abs(E_small(i, j, t) - E_large(i, j, t)) < 1.0e-14);
+            }
+        }
+    }
+
+    BOOST_CHECK_THROW(E_small(2, 0, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(E_small(0, 3, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(E_small(-1, 0, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(GQCP::McMurchieDavidsonCoefficient(0.3, 1.7, -0.9, 0.6, -1, 0), std::invalid_argument);
+}
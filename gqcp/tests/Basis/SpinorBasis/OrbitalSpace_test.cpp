@@ -110,3 +110,40 @@ BOOST_AUTO_TEST_CASE(isIndex) {
     BOOST_CHECK(orbital_space.isIndex(virt, 6));
     BOOST_CHECK(orbital_space.isIndex(virt, 7));
 }
+
+
+/**
+ *  Check if denseBlockOf() extracts the correct elements, in the order of the indices of the occupation types.
+ */
+BOOST_AUTO_TEST_CASE(denseBlockOf) {
+
+    const GQCP::OrbitalSpace orbital_space {{0, 3}, {1, 2, 4}};  // deliberately not contiguous
+
+    GQCP::MatrixX<double> M {5, 5};
+    M.setRandom();
+
+    const auto M_ov = orbital_space.denseBlockOf(occ, virt, M);
+    BOOST_CHECK(M_ov.rows() == 2 && M_ov.cols() == 3);
+    BOOST_CHECK(M_ov(1, 2) == M(3, 4));
+    BOOST_CHECK(M_ov(0, 1) == M(0, 2));
+
+
+    GQCP::Tensor<double, 4> T {5, 5, 5, 5};
+    T.setRandom();
+
+    const auto T_ovvo = orbital_space.denseBlockOf(occ, virt, virt, occ, T);
+    BOOST_CHECK(T_ovvo.dimension(0) == 2 && T_ovvo.dimension(1) == 3 && T_ovvo.dimension(2) == 3 && T_ovvo.dimension(3) == 2);
+    for (size_t i = 0; i < 2; i++) {
+        for (size_t a = 0; a < 3; a++) {
+            for (size_t b = 0; b < 3; b++) {
+                for (size_t j = 0; j < 2; j++) {
+                    BOOST_CHECK(T_ovvo(i, a, b, j) == T(orbital_space.indices(occ)[i], orbital_space.indices(virt)[a], orbital_space.indices(virt)[b], orbital_space.indices(occ)[j]));
+                }
+            }
+        }
+    }
+
+    // The dense block is laid out in the same way as the dense representation of an implicit slice for the same occupation types.
+    const auto slice = orbital_space.createRepresentableObjectFor(occ, virt, virt, occ, T_ovvo);
+    BOOST_CHECK(slice(3, 1, 4, 0) == T(3, 1, 4, 0));
+}
@@ -365,3 +365,230 @@ BOOST_AUTO_TEST_CASE(Davidson_Liu_1000_number_of_requested_eigenpairs) {
         BOOST_CHECK(std::abs(davidson_environment.eigenvectors.col(i).norm() - 1) < 1.0e-12);
     }
 }
+
+
+/**
+ *  Check if the block-Davidson algorithm works for Liu's reference test (Liu1978) with large dimensions, when it tracks more eigenpairs than requested.
+ */
+BOOST_AUTO_TEST_CASE(BlockDavidson_Liu_1000) {
+
+    const size_t number_of_requested_eigenpairs = 3;
+    const size_t block_size = 4;
+
+    // Build up the example matrix
+    const size_t N = 1000;
+    GQCP::SquareMatrix<double> A = GQCP::SquareMatrix<double>::Ones(N, N);
+    for (size_t i = 0; i < N; i++) {
+        if (i < 5) {
+            A(i, i) = 1 + 0.1 * i;
+        } else {
+            A(i, i) = 2 * (i + 1) - 1;
+        }
+    }
+
+
+    // Solve the eigenvalue problem with Eigen
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {A};
+    const GQCP::VectorX<double> ref_lowest_eigenvalues = eigensolver.eigenvalues().head(number_of_requested_eigenpairs);
+    const GQCP::MatrixX<double> ref_lowest_eigenvectors = eigensolver.eigenvectors().topLeftCorner(N, number_of_requested_eigenpairs);
+
+
+    // Solve using our block-Davidson diagonalization algorithm, supplying an initial guess for every vector in the block
+    const GQCP::MatrixX<double> X_0 = GQCP::MatrixX<double>::Identity(N, N).topLeftCorner(N, block_size);
+
+    auto davidson_environment = GQCP::EigenproblemEnvironment::Iterative(A, X_0);
+    auto davidson_solver = GQCP::EigenproblemSolver::BlockDavidson(number_of_requested_eigenpairs, block_size, 12);
+    davidson_solver.perform(davidson_environment);
+
+
+    for (size_t i = 0; i < number_of_requested_eigenpairs; i++) {
+        BOOST_CHECK(std::abs(davidson_environment.eigenvalues(i) - ref_lowest_eigenvalues(i)) < 1.0e-08);
+
+        const GQCP::VectorX<double> davidson_eigenvector = davidson_environment.eigenvectors.col(i);
+        const GQCP::VectorX<double> ref_eigenvector = ref_lowest_eigenvectors.col(i);
+        BOOST_CHECK(davidson_eigenvector.isEqualEigenvectorAs(ref_eigenvector, 1.0e-08));
+
+        BOOST_CHECK(std::abs(davidson_environment.eigenvectors.col(i).norm() - 1) < 1.0e-12);
+    }
+}
+
+
+/**
+ *  Check if the block-Davidson algorithm works for Liu's reference test (Liu1978) with large dimensions, when the maximum subspace dimension is so small that the subspace collapses in (almost) every iteration.
+ */
+BOOST_AUTO_TEST_CASE(BlockDavidson_Liu_1000_collapse) {
+
+    const size_t number_of_requested_eigenpairs = 3;
+    const size_t block_size = 4;
+
+    // Build up the example matrix
+    const size_t N = 1000;
+    GQCP::SquareMatrix<double> A = GQCP::SquareMatrix<double>::Ones(N, N);
+    for (size_t i = 0; i < N; i++) {
+        if (i < 5) {
+            A(i, i) = 1 + 0.1 * i;
+        } else {
+            A(i, i) = 2 * (i + 1) - 1;
+        }
+    }
+
+
+    // Solve the eigenvalue problem with Eigen
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {A};
+    const GQCP::VectorX<double> ref_lowest_eigenvalues = eigensolver.eigenvalues().head(number_of_requested_eigenpairs);
+
+
+    // Solve using our block-Davidson diagonalization algorithm, for the smallest allowed maximum subspace dimensions.
+    const GQCP::MatrixX<double> X_0 = GQCP::MatrixX<double>::Identity(N, N).topLeftCorner(N, block_size);
+
+    for (const size_t maximum_subspace_dimension : {8, 9}) {
+        auto davidson_environment = GQCP::EigenproblemEnvironment::Iterative(A, X_0);
+        auto davidson_solver = GQCP::EigenproblemSolver::BlockDavidson(number_of_requested_eigenpairs, block_size, maximum_subspace_dimension);
+        davidson_solver.perform(davidson_environment);
+
+        for (size_t i = 0; i < number_of_requested_eigenpairs; i++) {
+            BOOST_CHECK(std::abs(davidson_environment.eigenvalues(i) - ref_lowest_eigenvalues(i)) < 1.0e-08);
+        }
+    }
+}
+
+
+/**
+ *  Check if the block-Davidson algorithm throws upon construction with an incompatible block size or maximum subspace dimension, and upon execution with too few initial guess vectors.
+ */
+BOOST_AUTO_TEST_CASE(BlockDavidson_throws) {
+
+    BOOST_CHECK_THROW(GQCP::EigenproblemSolver::BlockDavidson(3, 2), std::invalid_argument);     // the block size is smaller than the number of requested eigenpairs
+    BOOST_CHECK_THROW(GQCP::EigenproblemSolver::BlockDavidson(3, 4, 7), std::invalid_argument);  // the maximum subspace dimension is too small
+    BOOST_CHECK_NO_THROW(GQCP::EigenproblemSolver::BlockDavidson(3, 4, 8));
+
+    const GQCP::SquareMatrix<double> A = GQCP::SquareMatrix<double>::Random(10);
+    const GQCP::SquareMatrix<double> B = A + A.transpose();
+    auto davidson_environment = GQCP::EigenproblemEnvironment::Iterative(B, GQCP::MatrixX<double>::Identity(10, 2));
+    auto davidson_solver = GQCP::EigenproblemSolver::BlockDavidson(3, 4);
+    BOOST_CHECK_THROW(davidson_solver.perform(davidson_environment), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the Davidson algorithm with preallocated workspaces works for Liu's reference test (Liu1978) with large dimensions, when a number of in-place subspace collapses is forced.
+ */
+BOOST_AUTO_TEST_CASE(PreallocatedDavidson_Liu_1000_collapse) {
+
+    const size_t number_of_requested_eigenpairs = 3;
+    const size_t maximum_subspace_dimension = 8;
+
+    // Build up the example matrix
+    const size_t N = 1000;
+    GQCP::SquareMatrix<double> A = GQCP::SquareMatrix<double>::Ones(N, N);
+    for (size_t i = 0; i < N; i++) {
+        if (i < 5) {
+            A(i, i) = 1 + 0.1 * i;
+        } else {
+            A(i, i) = 2 * (i + 1) - 1;
+        }
+    }
+
+
+    // Solve the eigenvalue problem with Eigen
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {A};
+    const GQCP::VectorX<double> ref_lowest_eigenvalues = eigensolver.eigenvalues().head(number_of_requested_eigenpairs);
+    const GQCP::MatrixX<double> ref_lowest_eigenvectors = eigensolver.eigenvectors().topLeftCorner(N, number_of_requested_eigenpairs);
+
+
+    // Solve using our Davidson diagonalization algorithm with preallocated workspaces, supplying a number of initial guesses
+    const GQCP::MatrixX<double> X_0 = GQCP::MatrixX<double>::Identity(N, N).topLeftCorner(N, number_of_requested_eigenpairs);
+
+    auto davidson_environment = GQCP::EigenproblemEnvironment::Iterative(A, X_0);
+    auto davidson_solver = GQCP::EigenproblemSolver::PreallocatedDavidson(number_of_requested_eigenpairs, maximum_subspace_dimension);
+    davidson_solver.perform(davidson_environment);
+
+
+    for (size_t i = 0; i < number_of_requested_eigenpairs; i++) {
+        BOOST_CHECK(std::abs(davidson_environment.eigenvalues(i) - ref_lowest_eigenvalues(i)) < 1.0e-08);
+
+        const GQCP::VectorX<double> davidson_eigenvector = davidson_environment.eigenvectors.col(i);
+        const GQCP::VectorX<double> ref_eigenvector = ref_lowest_eigenvectors.col(i);
+        BOOST_CHECK(davidson_eigenvector.isEqualEigenvectorAs(ref_eigenvector, 1.0e-08));
+
+        BOOST_CHECK(std::abs(davidson_environment.eigenvectors.col(i).norm() - 1) < 1.0e-12);
+    }
+
+
+    // The workspaces should never have been reallocated, and the incrementally updated subspace matrix should be equal to the one that is calculated from scratch. Note that the last correction vectors may have been added to the subspace after the last update of the subspace matrix.
+    const auto m = davidson_environment.S.cols();
+    BOOST_CHECK(davidson_environment.V.cols() == maximum_subspace_dimension);
+    BOOST_CHECK(davidson_environment.VA.cols() == maximum_subspace_dimension);
+    BOOST_CHECK(davidson_environment.subspace_dimension >= static_cast<size_t>(m));
+
+    const GQCP::MatrixX<double> V = davidson_environment.V.leftCols(m);
+    const GQCP::MatrixX<double> S = V.transpose() * A * V;
+    BOOST_CHECK(davidson_environment.S.isApprox(S, 1.0e-08));
+}
+
+
+/**
+ *  Check if the Davidson algorithm with preallocated workspaces throws upon construction with a maximum subspace dimension that is too small, and upon execution with too many initial guess vectors.
+ */
+BOOST_AUTO_TEST_CASE(PreallocatedDavidson_throws) {
+
+    BOOST_CHECK_THROW(GQCP::EigenproblemSolver::PreallocatedDavidson(3, 5), std::invalid_argument);  // the maximum subspace dimension is too small
+    BOOST_CHECK_NO_THROW(GQCP::EigenproblemSolver::PreallocatedDavidson(3, 6));
+
+    const GQCP::SquareMatrix<double> A = GQCP::SquareMatrix<double>::Random(10);
+    const GQCP::SquareMatrix<double> B = A + A.transpose();
+    auto davidson_environment = GQCP::EigenproblemEnvironment::Iterative(B, GQCP::MatrixX<double>::Identity(10, 7));
+    auto davidson_solver = GQCP::EigenproblemSolver::PreallocatedDavidson(3, 6);
+    BOOST_CHECK_THROW(davidson_solver.perform(davidson_environment), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the Davidson algorithm finds the same eigenpairs for Liu's reference test (Liu1978) with large dimensions when the subspace is stored in memory-mapped files, while forcing subspace collapses.
+ */
+BOOST_AUTO_TEST_CASE(Davidson_Liu_1000_memory_mapped) {
+
+    const size_t number_of_requested_eigenpairs = 3;
+
+    // Build up the example matrix
+    const size_t N = 1000;
+    GQCP::SquareMatrix<double> A = GQCP::SquareMatrix<double>::Ones(N, N);
+    for (size_t i = 0; i < N; i++) {
+        if (i < 5) {
+            A(i, i) = 1 + 0.1 * i;
+        } else {
+            A(i, i) = 2 * (i + 1) - 1;
+        }
+    }
+
+
+    // Solve the eigenvalue problem with Eigen
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {A};
+    const GQCP::VectorX<double> ref_lowest_eigenvalues = eigensolver.eigenvalues().head(number_of_requested_eigenpairs);
+    const GQCP::MatrixX<double> ref_lowest_eigenvectors = eigensolver.eigenvectors().topLeftCorner(N, number_of_requested_eigenpairs);
+
+
+    // Solve using our Davidson diagonalization algorithm, keeping the subspace in memory-mapped files in the current directory. We use a small row block size to make sure that the subspace is streamed in multiple blocks, and a tight convergence threshold so that the accuracy of the eigenvectors can be checked.
+    const GQCP::MatrixX<double> X_0 = GQCP::MatrixX<double>::Identity(N, N).topLeftCorner(N, number_of_requested_eigenpairs);
+
+    auto davidson_environment = GQCP::EigenproblemEnvironment::Iterative(A, X_0);
+    davidson_environment.row_block_size = 300;
+    auto davidson_solver = GQCP::EigenproblemSolver::Davidson(number_of_requested_eigenpairs, 8, 1.0e-10, 1.0e-12, 128, 1.0e-03, GQCP::DavidsonSubspaceStorage::MemoryMapped("."));
+    davidson_solver.perform(davidson_environment);
+
+    BOOST_CHECK(davidson_environment.mapped_V && davidson_environment.mapped_VA);
+    BOOST_CHECK(davidson_environment.V.size() == 0);  // the in-memory subspace should have been released
+
+
+    for (size_t i = 0; i < number_of_requested_eigenpairs; i++) {
+        BOOST_CHECK(std::abs(davidson_environment.eigenvalues(i) - ref_lowest_eigenvalues(i)) < 1.0e-08);
+
+        const GQCP::VectorX<double> davidson_eigenvector = davidson_environment.eigenvectors.col(i);
+        const GQCP::VectorX<double> ref_eigenvector = ref_lowest_eigenvectors.col(i);
+BOOST_CHECK(davidson_eigenvector.isEqualEigenvectorAs(ref_eigenvector, 1.0e-08));
+
+        BOOST_CHECK(std::abs(davidson_environment.eigenvectors.col(i).norm() - 1) < 1.0e-12);
+    }
+
+    BOOST_CHECK_THROW(GQCP::DavidsonSubspaceStorage::MemoryMapped(""), std::invalid_argument);
+}
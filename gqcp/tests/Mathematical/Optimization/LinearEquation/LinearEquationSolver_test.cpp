@@ -0,0 +1,167 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "LinearEquationSolver"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Optimization/LinearEquation/LinearEquationSolver.hpp"
+
+
+/*
+ *  MARK: Helper functions
+ */
+
+/**
+ *  @return A random symmetric, positive definite matrix.
+ */
+GQCP::MatrixX<double> randomPositiveDefiniteMatrix(const size_t dim) {
+
+    const GQCP::MatrixX<double> B = GQCP::MatrixX<double>::Random(dim, dim);
+    return B * B.transpose() + dim * GQCP::MatrixX<double>::Identity(dim, dim);
+}
+
+
+/*
+ *  MARK: Tests
+ */
+
+/**
+ *  Check if the dense linear equations solvers solve a system of equations with multiple right-hand sides.
+ */
+BOOST_AUTO_TEST_CASE(dense) {
+
+    const size_t dim = 20;
+    const GQCP::MatrixX<double> A = randomPositiveDefiniteMatrix(dim);
+    const GQCP::MatrixX<double> b = GQCP::MatrixX<double>::Random(dim, 3);
+
+    auto environment = GQCP::LinearEquationEnvironment<double>::Dense(A, b);
+    auto solver = GQCP::LinearEquationSolver<double>::HouseholderQR();
+    solver.perform(environment);
+
+    BOOST_CHECK((A * environment.x).isApprox(b, 1.0e-10));
+}
+
+
+/**
+ *  Check if the preconditioned conjugate gradient algorithm solves a positive definite system of equations with multiple right-hand sides, using one block matrix-vector product per iteration.
+ */
+BOOST_AUTO_TEST_CASE(ConjugateGradient) {
+
+    const size_t dim = 100;
+    const GQCP::MatrixX<double> A = randomPositiveDefiniteMatrix(dim);
+    const GQCP::MatrixX<double> b = GQCP::MatrixX<double>::Random(dim, 3);
+
+    size_t number_of_block_matvecs = 0;
+    const auto matvec = [&A](const GQCP::VectorX<double>& x) { return GQCP::VectorX<double> {A * x}; };
+    const auto block_matvec = [&A, &number_of_block_matvecs](const GQCP::MatrixX<double>& X) {
+        number_of_block_matvecs++;
+        return GQCP::MatrixX<double> {A * X};
+    };
+
+    auto environment = GQCP::LinearEquationEnvironment<double>::Iterative(matvec, block_matvec, A.diagonal(), b);
+    auto solver = GQCP::LinearEquationSolver<double>::ConjugateGradient(1.0e-10);
+    solver.perform(environment);
+
+    BOOST_CHECK((A * environment.x).isApprox(b, 1.0e-08));
+    BOOST_CHECK(number_of_block_matvecs == solver.numberOfIterations() + 1);  // +1 for the initial residual vectors
+
+
+    // Starting from the solution, the algorithm should converge after one iteration.
+    auto environment_solved = GQCP::LinearEquationEnvironment<double>::Iterative(A, b, environment.x);
+    auto solver_solved = GQCP::LinearEquationSolver<double>::ConjugateGradient(1.0e-08);
+    solver_solved.perform(environment_solved);
+    BOOST_CHECK(solver_solved.numberOfIterations() == 1);
+}
+
+
+/**
+ *  Check if the preconditioned MINRES algorithm solves a symmetric, indefinite system of equations with multiple right-hand sides.
+ */
+BOOST_AUTO_TEST_CASE(MINRES) {
+
+    const size_t dim = 100;
+
+    // Create a symmetric matrix with both positive and negative eigenvalues.
+    const GQCP::MatrixX<double> B = GQCP::MatrixX<double>::Random(dim, dim);
+    GQCP::MatrixX<double> A = 0.1 * (B + B.transpose());
+    for (size_t i = 0; i < dim; i++) {
+        A(i, i) += (i % 2 == 0) ? 5.0 + i : -5.0 - i;
+    }
+    const GQCP::MatrixX<double> b = GQCP::MatrixX<double>::Random(dim, 3);
+
+    auto environment = GQCP::LinearEquationEnvironment<double>::Iterative(A, b);
+    auto solver = GQCP::LinearEquationSolver<double>::MINRES(1.0e-10);
+    solver.perform(environment);
+
+    BOOST_CHECK((A * environment.x).isApprox(b, 1.0e-08));
+
+
+    // Without a preconditioner, the solution should be the same.
+    const auto matvec = [&A](const GQCP::VectorX<double>& x) { return GQCP::VectorX<double> {A * x}; };
+    auto environment_unpreconditioned = GQCP::LinearEquationEnvironment<double>::Iterative(matvec, GQCP::VectorX<double> {}, b);
+    auto solver_unpreconditioned = GQCP::LinearEquationSolver<double>::MINRES(1.0e-10, 256);
+    solver_unpreconditioned.perform(environment_unpreconditioned);
+
+    BOOST_CHECK(environment_unpreconditioned.x.isApprox(environment.x, 1.0e-08));
+}
+
+
+/**
+ *  Check if the restarted GMRES algorithm solves a non-symmetric system of equations with multiple right-hand sides.
+ */
+BOOST_AUTO_TEST_CASE(GMRES) {
+
+    const size_t dim = 100;
+    const GQCP::MatrixX<double> A = GQCP::MatrixX<double>::Random(dim, dim) + 20 * GQCP::MatrixX<double>::Identity(dim, dim);
+    const GQCP::MatrixX<double> b = GQCP::MatrixX<double>::Random(dim, 3);
+
+    // Use a small Krylov subspace, so that the algorithm has to restart.
+    auto environment = GQCP::LinearEquationEnvironment<double>::Iterative(A, b);
+    auto solver = GQCP::LinearEquationSolver<double>::GMRES(5, 1.0e-10);
+    solver.perform(environment);
+
+    BOOST_CHECK(solver.numberOfIterations() > 5);
+    BOOST_CHECK((A * environment.x).isApprox(b, 1.0e-08));
+
+
+    // GMRES should also be able to solve complex systems of equations.
+    const GQCP::MatrixX<GQCP::complex> A_complex = GQCP::MatrixX<GQCP::complex>::Random(dim, dim) + 20 * GQCP::MatrixX<GQCP::complex>::Identity(dim, dim);
+    const GQCP::MatrixX<GQCP::complex> b_complex = GQCP::MatrixX<GQCP::complex>::Random(dim, 2);
+
+    auto environment_complex = GQCP::LinearEquationEnvironment<GQCP::complex>::Iterative(A_complex, b_complex);
+    auto solver_complex = GQCP::LinearEquationSolver<GQCP::complex>::GMRES(10, 1.0e-10);
+    solver_complex.perform(environment_complex);
+
+    BOOST_CHECK((A_complex * environment_complex.x).isApprox(b_complex, 1.0e-08));
+}
+
+
+/**
+ *  Check if incompatible initial guesses and diagonals are rejected.
+ */
+BOOST_AUTO_TEST_CASE(Iterative_throws) {
+
+    const size_t dim = 10;
+    const GQCP::MatrixX<double> A = randomPositiveDefiniteMatrix(dim);
+    const GQCP::MatrixX<double> b = GQCP::MatrixX<double>::Random(dim, 3);
+
+    BOOST_CHECK_THROW(GQCP::LinearEquationEnvironment<double>::Iterative(A, b, GQCP::MatrixX<double>::Zero(dim, 2)), std::invalid_argument);
+
+    const auto matvec = [&A](const GQCP::VectorX<double>& x) { return GQCP::VectorX<double> {A * x}; };
+    BOOST_CHECK_THROW(GQCP::LinearEquationEnvironment<double>::Iterative(matvec, GQCP::VectorX<double>::Ones(dim + 1), b), std::invalid_argument);
+}
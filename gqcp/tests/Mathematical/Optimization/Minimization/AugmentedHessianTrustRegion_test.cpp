@@ -0,0 +1,87 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "AugmentedHessianTrustRegion"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Optimization/Minimization/AugmentedHessianTrustRegion.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+
+#include <Eigen/Dense>
+
+
+/**
+ *  Check if the augmented-Hessian step for a positive definite Hessian and a small gradient is close to the Newton step, both with the dense fallback and with Davidson's algorithm.
+ */
+BOOST_AUTO_TEST_CASE(small_gradient) {
+
+    const size_t dim = 40;
+    const GQCP::MatrixX<double> A = GQCP::MatrixX<double>::Random(dim, dim);
+    const GQCP::SquareMatrix<double> H = A * A.transpose() + 10 * GQCP::SquareMatrix<double>::Identity(dim);
+    const GQCP::VectorX<double> g = 1.0e-04 * GQCP::VectorX<double>::Random(dim);
+
+    const GQCP::VectorFunction<double> hessian_vector_product = [&H](const GQCP::VectorX<double>& x) { return H * x; };
+    const GQCP::VectorX<double> newton_step = -H.ldlt().solve(g);
+
+    const GQCP::AugmentedHessianTrustRegion dense_trust_region {0.5, 64, 1.0e-10};  // the augmented Hessian fits into the subspace
+    const auto dense_step = dense_trust_region.calculateStep(g, hessian_vector_product, H.diagonal());
+    BOOST_CHECK(dense_step.isApprox(newton_step, 1.0e-06));
+
+    const GQCP::AugmentedHessianTrustRegion davidson_trust_region {0.5, 15, 1.0e-10};
+    const auto davidson_step = davidson_trust_region.calculateStep(g, hessian_vector_product, H.diagonal());
+    BOOST_CHECK(davidson_step.isApprox(newton_step, 1.0e-06));
+}
+
+
+/**
+ *  Check if the augmented-Hessian step for an indefinite Hessian is a descent direction that respects the trust radius, and if the lowest eigenpair of the Hessian is found.
+ */
+BOOST_AUTO_TEST_CASE(indefinite_hessian) {
+
+    const size_t dim = 30;
+    const GQCP::MatrixX<double> A = GQCP::MatrixX<double>::Random(dim, dim);
+    const GQCP::SquareMatrix<double> H = A + A.transpose();  // has negative eigenvalues
+    const GQCP::VectorX<double> g = GQCP::VectorX<double>::Random(dim);
+
+    const GQCP::VectorFunction<double> hessian_vector_product = [&H](const GQCP::VectorX<double>& x) { return H * x; };
+
+    const double trust_radius = 0.2;
+    const GQCP::AugmentedHessianTrustRegion trust_region {trust_radius, 15, 1.0e-10};
+
+    const auto step = trust_region.calculateStep(g, hessian_vector_product, H.diagonal());
+    BOOST_CHECK(step.norm() <= trust_radius + 1.0e-12);
+    BOOST_CHECK(g.dot(step) < 0.0);
+
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> diagonalizer {H};
+    const auto lowest_eigenpair = trust_region.calculateLowestHessianEigenpair(hessian_vector_product, H.diagonal());
+    BOOST_CHECK(std::abs(lowest_eigenpair.eigenvalue() - diagonalizer.eigenvalues()(0)) < 1.0e-08);
+    BOOST_CHECK(lowest_eigenpair.isEqualTo(GQCP::Eigenpair<double>(diagonalizer.eigenvalues()(0), diagonalizer.eigenvectors().col(0)), 1.0e-06));
+}
+
+
+/**
+ *  Check if invalid arguments are rejected.
+ */
+BOOST_AUTO_TEST_CASE(invalid_arguments) {
+
+    BOOST_CHECK_THROW(GQCP::AugmentedHessianTrustRegion(0.0), std::invalid_argument);
+
+    const GQCP::AugmentedHessianTrustRegion trust_region {};
+    const GQCP::VectorFunction<double> identity = [](const GQCP::VectorX<double>& x) { return x; };
+    BOOST_CHECK_THROW(trust_region.calculateStep(GQCP::VectorX<double>::Zero(3), identity, GQCP::VectorX<double>::Ones(4)), std::invalid_argument);
+}
@@ -0,0 +1,203 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "CholeskyDecomposedRankFourTensor"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Transformations/JacobiRotation.hpp"
+#include "Mathematical/Representation/CholeskyDecomposedRankFourTensor.hpp"
+#include "Mathematical/Representation/FourIndexTransformation.hpp"
+#include "Mathematical/Representation/PackedSymmetricRankFourTensor.hpp"
+
+
+/**
+ *  Create a random tensor with the 8-fold permutational symmetry of two-electron integrals, whose pair matrix is positive semi-definite with the given rank.
+ */
+GQCP::SquareRankFourTensor<double> randomPositiveSemiDefiniteTensor(const size_t K, const size_t rank) {
+
+    const size_t number_of_pairs = K * (K + 1) / 2;
+    const GQCP::MatrixX<double> A = GQCP::MatrixX<double>::Random(number_of_pairs, rank);
+    const GQCP::MatrixX<double> M = A * A.transpose();
+
+    GQCP::PackedSymmetricRankFourTensor packed {K};
+    for (size_t PQ = 0; PQ < number_of_pairs; PQ++) {
+        for (size_t RS = 0; RS <= PQ; RS++) {
+            packed.packedElements()(PQ * (PQ + 1) / 2 + RS) = M(PQ, RS);
+        }
+    }
+
+    return packed.full();
+}
+
+
+/**
+ *  Check if the pivoted Cholesky decomposition of a tensor with a low-rank pair matrix needs as many Cholesky vectors as its rank, and if it reproduces the original tensor.
+ */
+BOOST_AUTO_TEST_CASE(FromFull_low_rank) {
+
+    const size_t K = 6;
+    const size_t rank = 8;
+    const auto g = randomPositiveSemiDefiniteTensor(K, rank);
+
+    const auto cholesky = GQCP::CholeskyDecomposedRankFourTensor::FromFull(g, 1.0e-12);
+    BOOST_CHECK(cholesky.dimension() == K);
+    BOOST_CHECK(cholesky.numberOfCholeskyVectors() == rank);
+    BOOST_CHECK(cholesky.full().isApprox(g, 1.0e-10));
+    BOOST_CHECK(std::abs(cholesky(4, 1, 2, 5) - g(4, 1, 2, 5)) < 1.0e-10);
+
+    // Every Cholesky vector should be symmetric.
+    for (size_t index = 0; index < cholesky.numberOfCholeskyVectors(); index++) {
+        const auto L = cholesky.choleskyVector(index);
+        BOOST_CHECK(L.isApprox(L.transpose(), 1.0e-12));
+    }
+}
+
+
+/**
+ *  Check if the threshold of the decomposition bounds the error of every element.
+ */
+BOOST_AUTO_TEST_CASE(FromFull_threshold) {
+
+    const size_t K = 5;
+    const auto g = randomPositiveSemiDefiniteTensor(K, 15);  // A full-rank pair matrix.
+
+    const double threshold = 1.0e-01;
+    const auto cholesky = GQCP::CholeskyDecomposedRankFourTensor::FromFull(g, threshold);
+    BOOST_CHECK(cholesky.numberOfCholeskyVectors() < 15);
+
+    const auto g_approximated = cholesky.full();
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q < K; q++) {
+            for (size_t r = 0; r < K; r++) {
+                for (size_t s = 0; s < K; s++) {
+                    BOOST_CHECK(std::abs(g_approximated(p, q, r, s) - g(p, q, r, s)) <= threshold);
+                }
+            }
+        }
+    }
+
+    BOOST_CHECK_THROW(GQCP::CholeskyDecomposedRankFourTensor::FromFull(g, -1.0), std::invalid_argument);
+}
+
+
+/**
+ *  Check if calculating the columns of groups of pairs gives an (exact) decomposition, and if invalid groups are rejected.
+ */
+BOOST_AUTO_TEST_CASE(FromPairColumns) {
+
+    const size_t K = 4;
+    const size_t number_of_pairs = 10;
+    const auto g = randomPositiveSemiDefiniteTensor(K, number_of_pairs);
+    const auto M = GQCP::PackedSymmetricRankFourTensor::FromFull(g).pairMatrix();
+
+    // Divide the pairs into groups of (at most) three consecutive pairs.
+    std::vector<std::vector<size_t>> pair_groups;
+    for (size_t pq = 0; pq < number_of_pairs; pq++) {
+        if (pq % 3 == 0) {
+            pair_groups.push_back({});
+        }
+        pair_groups.back().push_back(pq);
+    }
+
+    size_t number_of_calculations = 0;
+    const auto calculate_columns = [&](const size_t group_index) {
+        number_of_calculations++;
+
+        const auto& group = pair_groups[group_index];
+        GQCP::MatrixX<double> columns {number_of_pairs, group.size()};
+        for (size_t j = 0; j < group.size(); j++) {
+            columns.col(j) = M.col(group[j]);
+        }
+        return columns;
+    };
+
+    const auto cholesky = GQCP::CholeskyDecomposedRankFourTensor::FromPairColumns(K, M.diagonal(), pair_groups, calculate_columns, 0.0);
+    BOOST_CHECK(cholesky.numberOfCholeskyVectors() == number_of_pairs);
+    BOOST_CHECK(number_of_calculations < number_of_pairs);
+    BOOST_CHECK(cholesky.full().isApprox(g, 1.0e-10));
+
+    pair_groups.pop_back();
+    BOOST_CHECK_THROW(GQCP::CholeskyDecomposedRankFourTensor::FromPairColumns(K, M.diagonal(), pair_groups, calculate_columns, 0.0), std::invalid_argument);
+}
+
+
+/**
+ *  Check the contractions of the Cholesky vectors with the corresponding contractions of the dense tensor.
+ */
+BOOST_AUTO_TEST_CASE(contractions) {
+
+    const size_t K = 5;
+    const auto g = randomPositiveSemiDefiniteTensor(K, 12);
+    const auto cholesky = GQCP::CholeskyDecomposedRankFourTensor::FromFull(g, 0.0);
+
+    const GQCP::SquareMatrix<double> D = GQCP::SquareMatrix<double>::Random(K);
+    const GQCP::MatrixX<double> J_ref = g.einsum<2>("pqrs,rs->pq", D).asMatrix();
+    const GQCP::MatrixX<double> K_ref = g.einsum<2>("pqrs,qr->ps", D).asMatrix();
+
+    BOOST_CHECK(cholesky.contractWithLastPair(D).isApprox(J_ref, 1.0e-10));
+    BOOST_CHECK(cholesky.contractWithInnerPair(D).isApprox(K_ref, 1.0e-10));
+
+    const auto d = GQCP::SquareRankFourTensor<double>::Random(K);
+    const Eigen::Tensor<double, 0> contraction_ref = g.einsum<4>("pqrs,pqrs->", d);
+    BOOST_CHECK(std::abs(cholesky.contractFully(d) - contraction_ref(0)) < 1.0e-10);
+
+    BOOST_CHECK_THROW(cholesky.contractWithLastPair(GQCP::SquareMatrix<double>::Zero(K + 1)), std::invalid_argument);
+}
+
+
+/**
+ *  Check if transforming the Cholesky vectors (to all orbitals and to a subset of them, on multiple threads) matches the dense four-index transformation.
+ */
+BOOST_AUTO_TEST_CASE(transformed) {
+
+    const size_t K = 6;
+    const auto g = randomPositiveSemiDefiniteTensor(K, 10);
+    const auto cholesky = GQCP::CholeskyDecomposedRankFourTensor::FromFull(g, 0.0);
+
+    const GQCP::MatrixX<double> C = GQCP::MatrixX<double>::Random(K, K);
+    BOOST_CHECK(cholesky.transformed(C).full().isApprox(GQCP::fourIndexTransformed(g, C), 1.0e-10));
+
+    const GQCP::MatrixX<double> C_active = GQCP::MatrixX<double>::Random(K, 3);
+    const auto cholesky_active = cholesky.transformed(C_active, 4);
+    BOOST_CHECK(cholesky_active.dimension() == 3);
+    BOOST_CHECK(cholesky_active.numberOfCholeskyVectors() == cholesky.numberOfCholeskyVectors());
+    BOOST_CHECK(cholesky_active.full().isApprox(GQCP::fourIndexTransformed(g, C_active), 1.0e-10));
+
+    BOOST_CHECK_THROW(cholesky.transformed(GQCP::MatrixX<double>::Identity(K + 1, K + 1)), std::invalid_argument);
+}
+
+
+/**
+ *  Check if a plane rotation of the Cholesky vectors matches the rotation of every axis of the dense tensor.
+ */
+BOOST_AUTO_TEST_CASE(rotatePlane) {
+
+    const size_t K = 5;
+    auto g = randomPositiveSemiDefiniteTensor(K, 9);
+    auto cholesky = GQCP::CholeskyDecomposedRankFourTensor::FromFull(g, 0.0);
+
+    const GQCP::JacobiRotation jacobi_rotation {4, 1, 0.6};
+    const Eigen::Matrix2d G = jacobi_rotation.planeMatrix();
+
+    cholesky.rotatePlane(4, 1, G);
+    for (size_t axis = 0; axis < 4; axis++) {
+        g.rotateAxis(axis, 4, 1, G);
+    }
+
+    BOOST_CHECK(cholesky.full().isApprox(g, 1.0e-10));
+}
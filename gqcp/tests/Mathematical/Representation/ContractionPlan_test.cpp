@@ -0,0 +1,191 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "ContractionPlan"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Representation/ContractionPlan.hpp"
+#include "Mathematical/Representation/Tensor.hpp"
+#include "Mathematical/Representation/ThreadPoolTensorDevice.hpp"
+#include "Utilities/threading.hpp"
+
+#include <map>
+
+
+namespace {
+
+
+/**
+ *  @return Two random tensors T1(i, a, j) and T2(b, j, a, k) with different dimensions along every axis.
+ */
+std::pair<GQCP::Tensor<double, 3>, GQCP::Tensor<double, 4>> randomTensors() {
+
+    GQCP::Tensor<double, 3> T1 {2, 3, 4};
+    T1.setRandom();
+
+    GQCP::Tensor<double, 4> T2 {5, 4, 3, 6};
+    T2.setRandom();
+
+    return {T1, T2};
+}
+
+
+/**
+ *  @return The reference contraction R(i, k, b) = T1(i, a, j) T2(b, j, a, k), calculated through explicit summation.
+ */
+GQCP::Tensor<double, 3> referenceContraction(const GQCP::Tensor<double, 3>& T1, const GQCP::Tensor<double, 4>& T2) {
+
+    GQCP::Tensor<double, 3> R {2, 6, 5};
+    R.setZero();
+    for (size_t i = 0; i < 2; i++) {
+        for (size_t k = 0; k < 6; k++) {
+            for (size_t b = 0; b < 5; b++) {
+                for (size_t a = 0; a < 3; a++) {
+                    for (size_t j = 0; j < 4; j++) {
+                        R(i, k, b) += T1(i, a, j) * T2(b, j, a, k);
+                    }
+                }
+            }
+        }
+    }
+
+    return R;
+}
+
+
+/**
+ *  @return If the given rank-3 tensors have the same dimensions and (approximately) the same elements.
+ */
+bool areApprox(const GQCP::Tensor<double, 3>& A, const GQCP::Tensor<double, 3>& B, const double tolerance = 1.0e-12) {
+
+    if (A.dimensions() != B.dimensions()) {
+        return false;
+    }
+
+    for (Eigen::Index i = 0; i < A.size(); i++) {
+        if (std::abs(A.data()[i] - B.data()[i]) > tolerance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+}  // namespace
+
+
+/**
+ *  Check if a contraction plan can be reused for every ordering of the output axes, including the orderings in which the output shuffle is fused into the operands (e.g. 'ikb' and 'bki').
+ */
+BOOST_AUTO_TEST_CASE(output_orderings) {
+
+    const auto tensors = randomTensors();
+    const auto& T1 = tensors.first;
+    const auto& T2 = tensors.second;
+    const auto R = referenceContraction(T1, T2);
+
+    for (const std::string output_labels : {"ikb", "ibk", "kib", "kbi", "bik", "bki"}) {
+        const GQCP::ContractionPlan<2, 3, 4> plan {"iaj", "bjak", output_labels};
+
+        // Evaluate the plan twice, to check that it can be reused.
+        for (size_t repetition = 0; repetition < 2; repetition++) {
+            const auto output = plan.evaluate(T1, T2);
+
+            for (size_t i = 0; i < 2; i++) {
+                for (size_t k = 0; k < 6; k++) {
+                    for (size_t b = 0; b < 5; b++) {
+                        const std::map<char, size_t> index_of {{'i', i}, {'k', k}, {'b', b}};
+                        const auto value = output(index_of.at(output_labels[0]), index_of.at(output_labels[1]), index_of.at(output_labels[2]));
+                        BOOST_CHECK(std::abs(value - R(i, k, b)) < 1.0e-12);
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ *  Check if the evaluation on a thread pool device matches the evaluation on the calling thread, both for the cached einsum API and for a plan.
+ */
+BOOST_AUTO_TEST_CASE(thread_pool_device) {
+
+    const auto tensors = randomTensors();
+    const auto& T1 = tensors.first;
+    const auto& T2 = tensors.second;
+
+    const GQCP::ThreadPoolTensorDevice device {3};
+    BOOST_CHECK(device.numberOfThreads() == 3);
+
+    const auto output = T1.einsum<2>("iaj,bjak->kib", T2);
+    const auto output_device = T1.einsum<2>("iaj,bjak->kib", T2, device.eigen());
+    BOOST_CHECK(areApprox(output_device, output));
+
+    const auto plan = GQCP::ContractionPlan<2, 3, 4>::FromString("iaj, bjak -> ikb");
+    BOOST_CHECK(areApprox(plan.evaluate(T1, T2, device.eigen()), referenceContraction(T1, T2)));
+
+    // Check a full contraction, which has a rank-zero result.
+    const auto norm = T1.einsum<3>("iaj,iaj->", T1, device.eigen());
+    BOOST_CHECK(std::abs(norm(0) - T1.einsum<3>("iaj,iaj->", T1)(0)) < 1.0e-12);
+}
+
+
+/**
+ *  Check if einsum evaluates on the library-wide device when the library-wide number of threads is larger than 1, and if that device follows the library-wide number of threads.
+ */
+BOOST_AUTO_TEST_CASE(library_tensor_device) {
+
+    const auto tensors = randomTensors();
+    const auto& T1 = tensors.first;
+    const auto& T2 = tensors.second;
+    const auto output = T1.einsum<2>("iaj,bjak->kib", T2);
+
+    GQCP::setNumberOfThreads(3);
+    const auto device = GQCP::libraryTensorDevice();
+    BOOST_CHECK(device->numberOfThreads() == 3);
+    BOOST_CHECK(GQCP::libraryTensorDevice() == device);  // The device is reused while the number of threads doesn't change.
+
+    BOOST_CHECK(areApprox(T1.einsum<2>("iaj,bjak->kib", T2), output));
+    BOOST_CHECK(areApprox(T1.einsum<2>(T2, "iaj", "bjak", "kib"), output));
+
+    GQCP::setNumberOfThreads(2);
+    BOOST_CHECK(GQCP::libraryTensorDevice()->numberOfThreads() == 2);
+    BOOST_CHECK(device->numberOfThreads() == 3);  // A device that is still in use stays alive.
+
+    GQCP::setNumberOfThreads(1);
+}
+
+
+/**
+ *  Check if invalid labels and incompatible dimensions are rejected.
+ */
+BOOST_AUTO_TEST_CASE(invalid) {
+
+    using Plan = GQCP::ContractionPlan<1, 2, 2>;
+
+    BOOST_CHECK_THROW(Plan("ija", "ab", "ib"), std::invalid_argument);  // Wrong rank of the left-hand side.
+    BOOST_CHECK_THROW(Plan("ij", "kl", "ij"), std::invalid_argument);   // No common labels.
+    BOOST_CHECK_THROW(Plan("ia", "ab", "ii"), std::invalid_argument);   // Duplicate output labels.
+    BOOST_CHECK_THROW(Plan("ia", "ab", "ic"), std::invalid_argument);   // Unknown output label.
+    BOOST_CHECK_THROW(Plan::FromString("ia,ab"), std::invalid_argument);
+
+    GQCP::Tensor<double, 2> A {2, 3};
+    A.setRandom();
+    BOOST_CHECK_THROW(Plan("ia", "ab", "ib").evaluate(A, A), std::invalid_argument);  // The contracted dimensions (3 and 2) don't match.
+    BOOST_CHECK_THROW(GQCP::ThreadPoolTensorDevice {0}, std::invalid_argument);
+}
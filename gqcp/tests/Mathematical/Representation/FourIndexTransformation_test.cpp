@@ -0,0 +1,96 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "FourIndexTransformation"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Representation/FourIndexTransformation.hpp"
+#include "Utilities/aliases.hpp"
+
+
+namespace {
+
+
+/**
+ *  A KISS implementation of the four-index transformation g'(P Q R S) = C^*(p P) C(q Q) C^*(r R) C(s S) g(p q r s), which is used as a reference.
+ */
+template <typename Scalar>
+GQCP::SquareRankFourTensor<Scalar> naiveFourIndexTransformed(const GQCP::SquareRankFourTensor<Scalar>& g, const GQCP::MatrixX<Scalar>& C) {
+
+    const size_t K = C.rows();
+    const size_t k = C.cols();
+
+    auto result = GQCP::SquareRankFourTensor<Scalar>::Zero(k);
+    for (size_t P = 0; P < k; P++) {
+        for (size_t Q = 0; Q < k; Q++) {
+            for (size_t R = 0; R < k; R++) {
+                for (size_t S = 0; S < k; S++) {
+
+                    for (size_t p = 0; p < K; p++) {
+                        for (size_t q = 0; q < K; q++) {
+                            for (size_t r = 0; r < K; r++) {
+                                for (size_t s = 0; s < K; s++) {
+                                    result(P, Q, R, S) += Eigen::numext::conj(C(p, P)) * C(q, Q) * Eigen::numext::conj(C(r, R)) * C(s, S) * g(p, q, r, s);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+
+}  // namespace
+
+
+/**
+ *  Check if the four-index transformation of a real tensor to a smaller orbital basis matches the naive implementation, for several numbers of threads and batch sizes.
+ */
+BOOST_AUTO_TEST_CASE(real_active_space) {
+
+    const size_t K = 6;
+    const size_t k = 4;
+    const auto g = GQCP::SquareRankFourTensor<double>::Random(K);
+    const GQCP::MatrixX<double> C = GQCP::MatrixX<double>::Random(K, k);
+
+    const auto ref = naiveFourIndexTransformed(g, C);
+
+    BOOST_CHECK(GQCP::fourIndexTransformed(g, C).isApprox(ref, 1.0e-10));
+    BOOST_CHECK(GQCP::fourIndexTransformed(g, C, 3).isApprox(ref, 1.0e-10));
+    BOOST_CHECK(GQCP::fourIndexTransformed(g, C, 2, 3).isApprox(ref, 1.0e-10));
+
+    BOOST_CHECK_THROW(GQCP::fourIndexTransformed(g, GQCP::MatrixX<double> {GQCP::MatrixX<double>::Random(K + 1, k)}), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the four-index transformation of a complex tensor conjugates the transformation coefficients of the first and third index.
+ */
+BOOST_AUTO_TEST_CASE(complex) {
+
+    const size_t K = 4;
+    GQCP::SquareRankFourTensor<GQCP::complex> g {K};
+    g.setRandom();
+    const GQCP::MatrixX<GQCP::complex> C = GQCP::MatrixX<GQCP::complex>::Random(K, K);
+
+    BOOST_CHECK(GQCP::fourIndexTransformed(g, C, 2).isApprox(naiveFourIndexTransformed(g, C), 1.0e-10));
+}
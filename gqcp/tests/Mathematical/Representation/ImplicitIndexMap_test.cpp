@@ -0,0 +1,81 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "ImplicitIndexMap_test"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Representation/ImplicitIndexMap.hpp"
+
+
+/**
+ *  Check if a contiguous range of implicit indices is mapped correctly, and if indices outside of that range are rejected.
+ */
+BOOST_AUTO_TEST_CASE(contiguous) {
+
+    // The implicit indices 3, 4 and 5 map onto the dense indices 0, 1 and 2, like a virtual orbital block.
+    const std::map<size_t, size_t> implicit_to_dense {{3, 0}, {4, 1}, {5, 2}};
+    const GQCP::ImplicitIndexMap index_map {implicit_to_dense};
+
+    BOOST_CHECK(index_map.isContiguous());
+    BOOST_CHECK_EQUAL(index_map.dimension(), 3);
+
+    BOOST_CHECK_EQUAL(index_map.denseIndexOf(3), 0);
+    BOOST_CHECK_EQUAL(index_map.denseIndexOf(4), 1);
+    BOOST_CHECK_EQUAL(index_map.denseIndexOf(5), 2);
+
+    BOOST_CHECK_THROW(index_map.denseIndexOf(2), std::out_of_range);
+    BOOST_CHECK_THROW(index_map.denseIndexOf(6), std::out_of_range);
+}
+
+
+/**
+ *  Check if non-contiguous implicit indices, and implicit indices that map onto the dense indices out of order, are mapped correctly.
+ */
+BOOST_AUTO_TEST_CASE(non_contiguous) {
+
+    const std::map<size_t, size_t> gapped {{0, 0}, {2, 1}, {5, 2}};
+    const GQCP::ImplicitIndexMap gapped_map {gapped};
+
+    BOOST_CHECK(!gapped_map.isContiguous());
+    BOOST_CHECK_EQUAL(gapped_map.denseIndexOf(0), 0);
+    BOOST_CHECK_EQUAL(gapped_map.denseIndexOf(2), 1);
+    BOOST_CHECK_EQUAL(gapped_map.denseIndexOf(5), 2);
+    BOOST_CHECK_THROW(gapped_map.denseIndexOf(1), std::out_of_range);
+    BOOST_CHECK_THROW(gapped_map.denseIndexOf(6), std::out_of_range);
+
+
+    const std::map<size_t, size_t> permuted {{1, 1}, {2, 0}};
+    const GQCP::ImplicitIndexMap permuted_map {permuted};
+
+    BOOST_CHECK(!permuted_map.isContiguous());
+    BOOST_CHECK_EQUAL(permuted_map.denseIndexOf(1), 1);
+    BOOST_CHECK_EQUAL(permuted_map.denseIndexOf(2), 0);
+    BOOST_CHECK_THROW(permuted_map.denseIndexOf(0), std::out_of_range);
+}
+
+
+/**
+ *  Check if an empty index map rejects every index.
+ */
+BOOST_AUTO_TEST_CASE(empty) {
+
+    const GQCP::ImplicitIndexMap index_map {};
+
+    BOOST_CHECK_EQUAL(index_map.dimension(), 0);
+    BOOST_CHECK_THROW(index_map.denseIndexOf(0), std::out_of_range);
+}
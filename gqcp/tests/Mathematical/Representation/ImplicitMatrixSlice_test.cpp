@@ -148,3 +148,35 @@ BOOST_AUTO_TEST_CASE(operator_call_AP1roG) {
     BOOST_CHECK_EQUAL(variables(1, 3), 5);
     BOOST_CHECK_EQUAL(variables(1, 4), 6);
 }
+
+
+/**
+ *  Check if the call operator works for non-contiguous indices, and if it throws for indices that aren't part of the slice.
+ */
+BOOST_AUTO_TEST_CASE(operator_call_non_contiguous) {
+
+    // Imagine the following 2x2 slice is part of an implicit 4x4 matrix:
+    // x x x x
+    // 1 x x 2
+    // x x x x
+    // 3 x x 4
+    GQCP::MatrixX<size_t> slice {2, 2};
+    // clang-format off
+    slice << 1, 2,
+             3, 4;
+    // clang-format on
+
+    auto B = GQCP::ImplicitMatrixSlice<size_t>::FromIndices({1, 3}, {0, 3}, slice);
+
+    BOOST_CHECK(B(1, 0) == 1);
+    BOOST_CHECK(B(1, 3) == 2);
+    BOOST_CHECK(B(3, 0) == 3);
+    BOOST_CHECK(B(3, 3) == 4);
+
+    B(3, 0) = 5;
+    BOOST_CHECK(B.asMatrix()(1, 0) == 5);
+
+    BOOST_CHECK_THROW(B(0, 0), std::out_of_range);
+    BOOST_CHECK_THROW(B(1, 1), std::out_of_range);
+    BOOST_CHECK_THROW(B(4, 3), std::out_of_range);
+}
@@ -44,3 +44,25 @@ BOOST_AUTO_TEST_CASE(operator_call) {
     BOOST_CHECK(dense_slice_representation(0, 1, 1, 0) == 3);
     BOOST_CHECK(dense_slice_representation(0, 1, 0, 1) == 4);
 }
+
+
+/**
+ *  Check if the call operator works for non-contiguous indices, and if it throws for indices that aren't part of the slice.
+ */
+BOOST_AUTO_TEST_CASE(operator_call_non_contiguous) {
+
+    // Create an implicit rank-four tensor whose first two axes cover the implicit indices 0 and 2, and whose last two axes cover the implicit indices 1 and 3.
+    auto B = GQCP::ImplicitRankFourTensorSlice<size_t>::ZeroFromIndices({0, 2}, {0, 2}, {1, 3}, {1, 3});
+
+    B(0, 2, 1, 3) = 1;
+    B(2, 2, 3, 1) = 2;
+
+    const auto& dense_slice_representation = B.asTensor();
+    BOOST_CHECK(dense_slice_representation(0, 1, 0, 1) == 1);
+    BOOST_CHECK(dense_slice_representation(1, 1, 1, 0) == 2);
+    BOOST_CHECK(B(0, 2, 1, 3) == 1);
+
+    BOOST_CHECK_THROW(B(1, 0, 1, 1), std::out_of_range);
+    BOOST_CHECK_THROW(B(0, 0, 2, 1), std::out_of_range);
+    BOOST_CHECK_THROW(B(0, 0, 1, 4), std::out_of_range);
+}
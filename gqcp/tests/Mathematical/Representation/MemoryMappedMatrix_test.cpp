@@ -0,0 +1,52 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "MemoryMappedMatrix"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Representation/MemoryMappedMatrix.hpp"
+
+
+/**
+ *  Check if a memory-mapped matrix is zero-initialized and if its elements can be written and read back through its Eigen views.
+ */
+BOOST_AUTO_TEST_CASE(map) {
+
+    GQCP::MemoryMappedMatrix matrix {100, 3, "."};
+    BOOST_CHECK(matrix.rows() == 100);
+    BOOST_CHECK(matrix.cols() == 3);
+    BOOST_CHECK(matrix.map().isZero());
+
+    const Eigen::MatrixXd M = Eigen::MatrixXd::Random(100, 3);
+    matrix.map() = M;
+
+    const auto& const_matrix = matrix;
+    BOOST_CHECK(const_matrix.map().isApprox(M, 1.0e-12));
+    BOOST_CHECK(matrix.map().col(1).dot(M.col(2)) == M.col(1).dot(M.col(2)));
+}
+
+
+/**
+ *  Check if the constructor of a memory-mapped matrix throws upon zero dimensions or a directory that doesn't exist.
+ */
+BOOST_AUTO_TEST_CASE(constructor_throws) {
+
+    BOOST_CHECK_THROW(GQCP::MemoryMappedMatrix(0, 3, "."), std::invalid_argument);
+    BOOST_CHECK_THROW(GQCP::MemoryMappedMatrix(3, 0, "."), std::invalid_argument);
+    BOOST_CHECK_THROW(GQCP::MemoryMappedMatrix(3, 3, "this/directory/does/not/exist"), std::runtime_error);
+}
@@ -0,0 +1,133 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "PackedSymmetricRankFourTensor"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Transformations/RTransformation.hpp"
+#include "Mathematical/Representation/FourIndexTransformation.hpp"
+#include "Mathematical/Representation/PackedSymmetricRankFourTensor.hpp"
+#include "Operator/SecondQuantized/RSQTwoElectronOperator.hpp"
+
+
+/**
+ *  Check if a packed tensor stores only the unique elements, and if packing and unpacking are each other's inverses.
+ */
+BOOST_AUTO_TEST_CASE(FromFull_full) {
+
+    const size_t K = 4;
+    const auto packed = GQCP::PackedSymmetricRankFourTensor::Random(K);
+    BOOST_CHECK(packed.numberOfPairs() == 10);
+    BOOST_CHECK(packed.numberOfElements() == 55);
+
+
+    // Check the 8-fold permutational symmetry of the unpacked tensor.
+    const auto g = packed.full();
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q < K; q++) {
+            for (size_t r = 0; r < K; r++) {
+                for (size_t s = 0; s < K; s++) {
+                    BOOST_CHECK(g(p, q, r, s) == packed(p, q, r, s));
+                    BOOST_CHECK(g(p, q, r, s) == g(q, p, r, s));
+                    BOOST_CHECK(g(p, q, r, s) == g(p, q, s, r));
+                    BOOST_CHECK(g(p, q, r, s) == g(r, s, p, q));
+                }
+            }
+        }
+    }
+
+    BOOST_CHECK(GQCP::PackedSymmetricRankFourTensor::FromFull(g).isApprox(packed, 1.0e-12));
+    BOOST_CHECK(packed.pairMatrix().isApprox(packed.pairMatrix().transpose(), 1.0e-12));
+}
+
+
+/**
+ *  Check if the packed basis transformation matches the dense basis transformation of a two-electron operator.
+ */
+BOOST_AUTO_TEST_CASE(transformed) {
+
+    const size_t K = 5;
+    const auto packed = GQCP::PackedSymmetricRankFourTensor::Random(K);
+    const auto T = GQCP::RTransformation<double>::RandomUnitary(K);
+
+    auto g_op = GQCP::ScalarRSQTwoElectronOperator<double>::FromPacked(packed);
+    g_op.transform(T);
+
+    const auto packed_transformed = packed.transformed(T.matrix());
+    BOOST_CHECK(packed_transformed.isApprox(g_op.packed(), 1.0e-12));
+    BOOST_CHECK(packed_transformed.full().isApprox(g_op.parameters(), 1.0e-12));
+
+    BOOST_CHECK_THROW(packed.transformed(GQCP::SquareMatrix<double>::Identity(K + 1)), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the packed basis transformation to a subset of the orbitals, on multiple threads, matches the dense four-index transformation.
+ */
+BOOST_AUTO_TEST_CASE(transformed_active_space) {
+
+    const size_t K = 7;
+    const size_t k = 3;
+    const auto packed = GQCP::PackedSymmetricRankFourTensor::Random(K);
+    const GQCP::MatrixX<double> C = GQCP::MatrixX<double>::Random(K, k);
+
+    const auto packed_transformed = packed.transformed(C, 4);
+    BOOST_CHECK(packed_transformed.dimension() == k);
+    BOOST_CHECK(packed_transformed.full().isApprox(GQCP::fourIndexTransformed(packed.full(), C), 1.0e-12));
+}
+
+
+/**
+ *  Check if a plane rotation of the packed tensor matches the Jacobi rotation of a dense two-electron operator, also when the rotated indices are adjacent or include the first or the last orbital.
+ */
+BOOST_AUTO_TEST_CASE(rotatePlane) {
+
+    const size_t K = 6;
+    const auto packed = GQCP::PackedSymmetricRankFourTensor::Random(K);
+    const auto g_op = GQCP::ScalarRSQTwoElectronOperator<double>::FromPacked(packed);
+
+    for (const auto& jacobi_rotation : {GQCP::JacobiRotation {4, 1, 0.6}, GQCP::JacobiRotation {1, 0, -2.1}, GQCP::JacobiRotation {5, 4, 1.3}}) {
+        auto packed_rotated = packed;
+        packed_rotated.rotatePlane(jacobi_rotation.p(), jacobi_rotation.q(), jacobi_rotation.planeMatrix());
+
+        BOOST_CHECK(packed_rotated.full().isApprox(g_op.rotated(jacobi_rotation).parameters(), 1.0e-12));
+    }
+
+    auto packed_copy = packed;
+    BOOST_CHECK_THROW(packed_copy.rotatePlane(2, 2, Eigen::Matrix2d::Identity()), std::invalid_argument);
+    BOOST_CHECK_THROW(packed_copy.rotatePlane(K, 2, Eigen::Matrix2d::Identity()), std::invalid_argument);
+}
+
+
+/**
+ *  Check if only two-electron operators with the 8-fold permutational symmetry can be packed.
+ */
+BOOST_AUTO_TEST_CASE(packed_throws) {
+
+    const auto g_op = GQCP::ScalarRSQTwoElectronOperator<double>::FromPacked(GQCP::PackedSymmetricRankFourTensor::Random(3));
+
+    BOOST_CHECK_NO_THROW(g_op.packed());
+
+    auto g_op_antisymmetrized = g_op;
+    g_op_antisymmetrized.antisymmetrize();
+    BOOST_CHECK_THROW(g_op_antisymmetrized.packed(), std::invalid_argument);
+
+    auto g_op_physicists = g_op;
+    g_op_physicists.convertToPhysicistsNotation();
+    BOOST_CHECK_THROW(g_op_physicists.packed(), std::invalid_argument);
+}
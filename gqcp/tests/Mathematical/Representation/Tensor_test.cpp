@@ -457,6 +457,63 @@ BOOST_AUTO_TEST_CASE(einsum_all_indices) {
     BOOST_CHECK_EQUAL(output3(0), 62);
 }
 
+/**
+ *  Check if einsum produces the correct axis order for non-square tensors, when the requested output axes are a permutation of the free axes that is not its own inverse.
+ */
+BOOST_AUTO_TEST_CASE(einsum_permuted_axes) {
+
+    // Create two example tensors with different dimensions along every axis.
+    GQCP::Tensor<double, 3> T1 {2, 3, 4};
+    T1.setRandom();
+
+    GQCP::Tensor<double, 2> T2 {5, 3};
+    T2.setRandom();
+
+    GQCP::Tensor<double, 4> T3 {5, 4, 3, 2};
+    T3.setRandom();
+
+
+    // Check a contraction over one axis against an explicit summation.
+    const auto output = T1.einsum<1>("iaj,ba->jbi", T2);
+    BOOST_CHECK(output.dimension(0) == 4 && output.dimension(1) == 5 && output.dimension(2) == 2);
+
+    for (size_t i = 0; i < 2; i++) {
+        for (size_t j = 0; j < 4; j++) {
+            for (size_t b = 0; b < 5; b++) {
+                double reference = 0.0;
+                for (size_t a = 0; a < 3; a++) {
+                    reference += T1(i, a, j) * T2(b, a);
+                }
+                BOOST_CHECK(std::abs(output(j, b, i) - reference) < 1.0e-12);
+            }
+        }
+    }
+
+
+    // Check a contraction over two axes, whose labels appear in a different order in both tensors.
+    const auto output2 = T1.einsum<2>("iaj,bjak->kib", T3);
+    BOOST_CHECK(output2.dimension(0) == 2 && output2.dimension(1) == 2 && output2.dimension(2) == 5);
+
+    for (size_t i = 0; i < 2; i++) {
+        for (size_t k = 0; k < 2; k++) {
+            for (size_t b = 0; b < 5; b++) {
+                double reference = 0.0;
+                for (size_t a = 0; a < 3; a++) {
+                    for (size_t j = 0; j < 4; j++) {
+                        reference += T1(i, a, j) * T3(b, j, a, k);
+                    }
+                }
+                BOOST_CHECK(std::abs(output2(k, i, b) - reference) < 1.0e-12);
+            }
+        }
+    }
+
+
+    // Check if einsum throws when the number of common labels does not match the number of axes that should be contracted over.
+    BOOST_CHECK_THROW(T2.einsum<1>(T2, "ij", "kl", "ij"), std::invalid_argument);
+}
+
+
 /**
  *  Test the numpy-like reshape method and check whether it behaves correctly.
  */
@@ -21,6 +21,7 @@
 
 #include "ONVBasis/SeniorityZeroONVBasis.hpp"
 #include "ONVBasis/SpinResolvedSelectedONVBasis.hpp"
+#include "QCModel/CI/LinearExpansion.hpp"
 
 
 /**
@@ -51,3 +52,74 @@ BOOST_AUTO_TEST_CASE(evaluateOperatorDiagonal) {
     BOOST_CHECK(sz_onv_basis.evaluateOperatorDiagonal(g).isApprox(selected_onv_basis.evaluateOperatorDiagonal(g), 1.0e-08));
     BOOST_CHECK(sz_onv_basis.evaluateOperatorDiagonal(sq_hamiltonian).isApprox(selected_onv_basis.evaluateOperatorDiagonal(sq_hamiltonian), 1.0e-08));
 }
+
+
+/**
+ *  Check if the multithreaded matrix-vector product of a restricted Hamiltonian is equal to the single-threaded one and the one through the dense Hamiltonian matrix representation.
+ *
+ *  The test system is H2O in an STO-3G basisset, which has a seniority-zero dimension of 21.
+ */
+BOOST_AUTO_TEST_CASE(multithreaded_matvec) {
+
+    // Read in the molecular Hamiltonian from a FCIDUMP file and set up the seniority-zero ONV basis.
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const GQCP::SeniorityZeroONVBasis onv_basis {sq_hamiltonian.numberOfOrbitals(), 5};
+
+    const auto linear_expansion = GQCP::LinearExpansion<GQCP::SeniorityZeroONVBasis>::Random(onv_basis);
+    const auto& x = linear_expansion.coefficients();
+
+    const GQCP::VectorX<double> direct_mvp = onv_basis.evaluateOperatorDense(sq_hamiltonian) * x;  // mvp: matrix-vector-product
+    const auto serial_mvp = onv_basis.evaluateOperatorMatrixVectorProduct(sq_hamiltonian, x);
+    BOOST_CHECK(serial_mvp.isApprox(direct_mvp, 1.0e-08));
+
+    for (const size_t number_of_threads : {2, 4, 64}) {
+        BOOST_CHECK(onv_basis.evaluateOperatorMatrixVectorProduct(sq_hamiltonian, x, number_of_threads).isApprox(serial_mvp, 1.0e-12));
+    }
+}
+
+
+/**
+ *  Check if the block matrix-vector products of a restricted Hamiltonian are equal to the separate matrix-vector products, also when they are calculated on multiple threads.
+ *
+ *  The test system is H2O in an STO-3G basisset, which has a seniority-zero dimension of 21.
+ */
+BOOST_AUTO_TEST_CASE(block_matvec) {
+
+    // Read in the molecular Hamiltonian from a FCIDUMP file and set up the seniority-zero ONV basis.
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const GQCP::SeniorityZeroONVBasis onv_basis {sq_hamiltonian.numberOfOrbitals(), 5};
+
+    const GQCP::MatrixX<double> X = GQCP::MatrixX<double>::Random(onv_basis.dimension(), 3);
+
+    for (const size_t number_of_threads : {1, 4}) {
+        const auto block_mvp = onv_basis.evaluateOperatorBlockMatrixVectorProduct(sq_hamiltonian, X, number_of_threads);
+
+        for (size_t i = 0; i < 3; i++) {
+            const GQCP::VectorX<double> x = X.col(i);
+            BOOST_CHECK(block_mvp.col(i).isApprox(onv_basis.evaluateOperatorMatrixVectorProduct(sq_hamiltonian, x), 1.0e-12));
+        }
+    }
+}
+
+
+/**
+ *  Check if the evaluations of a Hamiltonian with packed two-electron integrals are equal to the ones of the dense Hamiltonian.
+ *
+ *  The test system is H2O in an STO-3G basisset, which has a seniority-zero dimension of 21.
+ */
+BOOST_AUTO_TEST_CASE(packed_hamiltonian) {
+
+    // Read in the molecular Hamiltonian from a FCIDUMP file, both with dense and with packed two-electron integrals, and set up the seniority-zero ONV basis.
+    const auto fcidump = GQCP::FCIDUMP::Read("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP(fcidump);
+    const auto packed_hamiltonian = GQCP::PackedRSQHamiltonian::FromFCIDUMP(fcidump);
+    const GQCP::SeniorityZeroONVBasis onv_basis {sq_hamiltonian.numberOfOrbitals(), 5};
+
+    const GQCP::MatrixX<double> X = GQCP::MatrixX<double>::Random(onv_basis.dimension(), 3);
+    const GQCP::VectorX<double> x = X.col(0);
+
+    BOOST_CHECK(onv_basis.evaluateOperatorDense(packed_hamiltonian).isApprox(onv_basis.evaluateOperatorDense(sq_hamiltonian), 1.0e-12));
+    BOOST_CHECK(onv_basis.evaluateOperatorDiagonal(packed_hamiltonian).isApprox(onv_basis.evaluateOperatorDiagonal(sq_hamiltonian), 1.0e-12));
+    BOOST_CHECK(onv_basis.evaluateOperatorMatrixVectorProduct(packed_hamiltonian, x, 4).isApprox(onv_basis.evaluateOperatorMatrixVectorProduct(sq_hamiltonian, x), 1.0e-12));
+    BOOST_CHECK(onv_basis.evaluateOperatorBlockMatrixVectorProduct(packed_hamiltonian, X).isApprox(onv_basis.evaluateOperatorBlockMatrixVectorProduct(sq_hamiltonian, X), 1.0e-12));
+}
@@ -0,0 +1,158 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "SpinResolvedMatrixVectorProductEngine"
+
+#include <boost/test/unit_test.hpp>
+
+#include "ONVBasis/SpinResolvedMatrixVectorProductEngine.hpp"
+#include "QCModel/CI/LinearExpansion.hpp"
+
+
+/**
+ *  Check if the matrix-vector products of a restricted Hamiltonian that are calculated through a (reused) matrix-vector product engine match the ones through the dense Hamiltonian matrix representation.
+ *
+ *  The test system is H2O in an STO-3G basisset, which has a FCI dimension of 441.
+ */
+BOOST_AUTO_TEST_CASE(restricted_dense_vs_engine) {
+
+    // Read in the molecular Hamiltonian from a FCIDUMP file and set up the full spin-resolved ONV basis.
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = hamiltonian.numberOfOrbitals();
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 5};
+
+    const auto H_dense = onv_basis.evaluateOperatorDense(hamiltonian);
+    const GQCP::SpinResolvedMatrixVectorProductEngine engine {onv_basis, hamiltonian};
+    BOOST_CHECK(engine.dimension() == onv_basis.dimension());
+
+
+    // Let the Hamiltonian act on some random linear expansions, reusing the same engine.
+    for (size_t i = 0; i < 3; i++) {
+        const auto linear_expansion = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::Random(onv_basis);
+        const GQCP::VectorX<double> direct_mvp = H_dense * linear_expansion.coefficients();  // mvp: matrix-vector-product
+
+        BOOST_CHECK(engine.evaluate(linear_expansion.coefficients()).isApprox(direct_mvp, 1.0e-08));
+        BOOST_CHECK(engine(linear_expansion.coefficients()).isApprox(direct_mvp, 1.0e-08));
+    }
+}
+
+
+/**
+ *  Check if the matrix-vector product of an unrestricted Hamiltonian that is calculated through a matrix-vector product engine matches the one through the dense Hamiltonian matrix representation.
+ *
+ *  The test system is H2O in an STO-3G basisset, which has a FCI dimension of 441.
+ */
+BOOST_AUTO_TEST_CASE(unrestricted_dense_vs_engine) {
+
+    // Read in the molecular Hamiltonian from a FCIDUMP file, and rotate it to a random unrestricted orthonormal spin-orbital basis.
+    const auto restricted_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = restricted_hamiltonian.numberOfOrbitals();
+
+    auto hamiltonian = GQCP::USQHamiltonian<double> {GQCP::ScalarUSQOneElectronOperator<double>::FromRestricted(restricted_hamiltonian.core()),
+                                                     GQCP::ScalarUSQTwoElectronOperator<double>::FromRestricted(restricted_hamiltonian.twoElectron())};
+    hamiltonian.rotate(GQCP::UTransformation<double>::RandomUnitary(K));
+
+    // Set up the full spin-resolved ONV basis.
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 5};
+
+
+    // Determine the Hamiltonian matrix and let it act on a random linear expansion. Check if the engine's result matches.
+    const auto linear_expansion = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::Random(onv_basis);
+    const auto H_dense = onv_basis.evaluateOperatorDense(hamiltonian);
+    const GQCP::VectorX<double> direct_mvp = H_dense * linear_expansion.coefficients();  // mvp: matrix-vector-product
+
+    const GQCP::SpinResolvedMatrixVectorProductEngine engine {onv_basis, hamiltonian};
+    BOOST_CHECK(engine.evaluate(linear_expansion.coefficients()).isApprox(direct_mvp, 1.0e-08));
+}
+
+
+/**
+ *  Check if the matrix-vector products that are calculated on multiple threads are equal to the ones that are calculated on a single thread.
+ *
+ *  The test system is H2O in an STO-3G basisset, which has a FCI dimension of 441.
+ */
+BOOST_AUTO_TEST_CASE(multithreaded_engine) {
+
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const GQCP::SpinResolvedONVBasis onv_basis {hamiltonian.numberOfOrbitals(), 5, 5};
+    const auto linear_expansion = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::Random(onv_basis);
+
+    const GQCP::SpinResolvedMatrixVectorProductEngine serial_engine {onv_basis, hamiltonian};
+    const auto serial_mvp = serial_engine.evaluate(linear_expansion.coefficients());
+
+    // The number of alpha strings is 21, so we also check a number of threads that does not divide it, and one that exceeds it.
+    for (const size_t number_of_threads : {2, 4, 64}) {
+        const GQCP::SpinResolvedMatrixVectorProductEngine engine {onv_basis, hamiltonian, number_of_threads};
+        BOOST_CHECK(engine.numberOfThreads() == number_of_threads);
+        BOOST_CHECK(engine.evaluate(linear_expansion.coefficients()).isApprox(serial_mvp, 1.0e-12));
+        BOOST_CHECK(onv_basis.evaluateOperatorMatrixVectorProduct(hamiltonian, linear_expansion.coefficients(), number_of_threads).isApprox(serial_mvp, 1.0e-12));
+    }
+}
+
+
+/**
+ *  Check if the block matrix-vector products of an unrestricted Hamiltonian are equal to the separate matrix-vector products, also when they are calculated on multiple threads.
+ *
+ *  The test system is H2O in an STO-3G basisset, which has a FCI dimension of 441.
+ */
+BOOST_AUTO_TEST_CASE(block_engine) {
+
+    // Read in the molecular Hamiltonian from a FCIDUMP file, and rotate it to a random unrestricted orthonormal spin-orbital basis.
+    const auto restricted_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = restricted_hamiltonian.numberOfOrbitals();
+
+    auto hamiltonian = GQCP::USQHamiltonian<double> {GQCP::ScalarUSQOneElectronOperator<double>::FromRestricted(restricted_hamiltonian.core()),
+                                                     GQCP::ScalarUSQTwoElectronOperator<double>::FromRestricted(restricted_hamiltonian.twoElectron())};
+    hamiltonian.rotate(GQCP::UTransformation<double>::RandomUnitary(K));
+
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 5};
+    const GQCP::MatrixX<double> X = GQCP::MatrixX<double>::Random(onv_basis.dimension(), 3);
+
+
+    // Check the block matrix-vector products against the separate ones.
+    for (const size_t number_of_threads : {1, 4}) {
+        const GQCP::SpinResolvedMatrixVectorProductEngine engine {onv_basis, hamiltonian, number_of_threads};
+        const auto block_mvp = engine.evaluateBlock(X);
+        BOOST_CHECK(block_mvp.cols() == 3);
+
+        for (size_t i = 0; i < 3; i++) {
+            const GQCP::VectorX<double> x = X.col(i);
+            BOOST_CHECK(block_mvp.col(i).isApprox(engine.evaluate(x), 1.0e-12));
+        }
+
+        BOOST_CHECK(onv_basis.evaluateOperatorBlockMatrixVectorProduct(hamiltonian, X, number_of_threads).isApprox(block_mvp, 1.0e-12));
+    }
+}
+
+
+/**
+ *  Check if the matrix-vector product engine throws when the dimensions of the Hamiltonian or the coefficient vector are incompatible with the ONV basis, or when it is asked to use no threads.
+ */
+BOOST_AUTO_TEST_CASE(engine_throws) {
+
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");  // 7 spatial orbitals
+
+    const GQCP::SpinResolvedONVBasis onv_basis_faulty {6, 3, 3};
+    BOOST_CHECK_THROW(GQCP::SpinResolvedMatrixVectorProductEngine(onv_basis_faulty, hamiltonian), std::invalid_argument);
+
+    const GQCP::SpinResolvedONVBasis onv_basis {7, 5, 5};
+    BOOST_CHECK_THROW(GQCP::SpinResolvedMatrixVectorProductEngine(onv_basis, hamiltonian, 0), std::invalid_argument);
+
+    const GQCP::SpinResolvedMatrixVectorProductEngine engine {onv_basis, hamiltonian};
+    BOOST_CHECK_THROW(engine.evaluate(GQCP::VectorX<double>::Zero(10)), std::invalid_argument);
+    BOOST_CHECK_THROW(engine.evaluateBlock(GQCP::MatrixX<double>::Zero(10, 2)), std::invalid_argument);
+}
@@ -0,0 +1,144 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "SpinResolvedSelectedONVConnections"
+
+#include <boost/test/unit_test.hpp>
+
+#include "ONVBasis/SpinResolvedONVBasis.hpp"
+#include "ONVBasis/SpinResolvedSelectedONVBasis.hpp"
+#include "ONVBasis/SpinResolvedSelectedONVConnections.hpp"
+
+#include <algorithm>
+
+
+/**
+ *  Check if the connections that are found through the string-indexed lookup are exactly the pairs of ONVs that differ in at most a double excitation, by comparing with a brute-force comparison of all pairs of ONVs.
+ *
+ *  The ONVs are those of a full spin-resolved ONV basis with K = 6, N_alpha = 3 and N_beta = 2, of which every third one is left out so that not every excitation is present.
+ */
+BOOST_AUTO_TEST_CASE(connections_vs_brute_force) {
+
+    const GQCP::SpinResolvedSelectedONVBasis full_onv_basis {GQCP::SpinResolvedONVBasis {6, 3, 2}};
+
+    std::vector<GQCP::SpinResolvedONV> onvs;
+    for (size_t I = 0; I < full_onv_basis.dimension(); I++) {
+        if (I % 3 != 2) {
+            onvs.push_back(full_onv_basis.onvWithIndex(I));
+        }
+    }
+
+    const GQCP::SpinResolvedSelectedONVConnections connections {onvs};
+    for (size_t I = 0; I < onvs.size(); I++) {
+        const auto& alpha_I = onvs[I].onv(GQCP::Spin::alpha);
+        const auto& beta_I = onvs[I].onv(GQCP::Spin::beta);
+
+        // Find the connected ONVs J > I by comparing with every ONV.
+        std::vector<size_t> ref_connected_addresses;
+        for (size_t J = I + 1; J < onvs.size(); J++) {
+            const auto number_of_differences = alpha_I.countNumberOfDifferences(onvs[J].onv(GQCP::Spin::alpha)) + beta_I.countNumberOfDifferences(onvs[J].onv(GQCP::Spin::beta));
+            if (number_of_differences <= 4) {
+                ref_connected_addresses.push_back(J);
+            }
+        }
+
+        std::vector<size_t> connected_addresses;
+        connections.forEachConnectionOf(I, [&connected_addresses](const size_t J) { connected_addresses.push_back(J); });
+        std::sort(connected_addresses.begin(), connected_addresses.end());
+
+        BOOST_TEST(connected_addresses == ref_connected_addresses, boost::test_tools::per_element());
+    }
+}
+
+
+/**
+ *  Check if indexing the ONVs one by one yields the same connections as indexing them all at once.
+ */
+BOOST_AUTO_TEST_CASE(expandWith) {
+
+    const GQCP::SpinResolvedSelectedONVBasis full_onv_basis {GQCP::SpinResolvedONVBasis {5, 2, 2}};
+
+    std::vector<GQCP::SpinResolvedONV> onvs;
+    GQCP::SpinResolvedSelectedONVConnections expanded_connections {5};
+    for (size_t I = 0; I < full_onv_basis.dimension(); I++) {
+        onvs.push_back(full_onv_basis.onvWithIndex(I));
+        expanded_connections.expandWith(full_onv_basis.onvWithIndex(I));
+    }
+
+    const GQCP::SpinResolvedSelectedONVConnections connections {onvs};
+    for (size_t I = 0; I < onvs.size(); I++) {
+        std::vector<size_t> ref_connected_addresses;
+        connections.forEachConnectionOf(I, [&ref_connected_addresses](const size_t J) { ref_connected_addresses.push_back(J); });
+
+        std::vector<size_t> connected_addresses;
+        expanded_connections.forEachConnectionOf(I, [&connected_addresses](const size_t J) { connected_addresses.push_back(J); });
+
+        BOOST_TEST(connected_addresses == ref_connected_addresses, boost::test_tools::per_element());
+    }
+}
+
+
+/**
+ *  Check if the connections between ONVs of more than 64 spatial orbitals, whose strings are represented by multi-word bitstrings, are exactly the pairs of ONVs that differ in at most a double excitation.
+ *
+ *  The ONVs have K = 66, N_alpha = 2 and N_beta = 2, and only occupy the orbitals 0, 1, 62, 63, 64 and 65, so that their strings straddle the boundary between the first and the second word. Every third one is left out so that not every excitation is present.
+ */
+BOOST_AUTO_TEST_CASE(multi_word_connections_vs_brute_force) {
+
+    using ONV = GQCP::MultiWordSpinUnresolvedONV<128>;
+
+    const size_t K = 66;
+    const std::vector<size_t> orbitals {0, 1, 62, 63, 64, 65};
+
+    // Generate all strings with two electrons in the given orbitals.
+    std::vector<ONV> strings;
+    for (size_t i = 0; i < orbitals.size(); i++) {
+        for (size_t j = i + 1; j < orbitals.size(); j++) {
+            strings.push_back(ONV::FromOccupiedIndices({orbitals[i], orbitals[j]}, K));
+        }
+    }
+
+    std::vector<std::pair<ONV, ONV>> onvs;
+    GQCP::BasicSpinResolvedSelectedONVConnections<GQCP::Bitstring<128>> connections {K};
+    for (size_t I = 0; I < strings.size() * strings.size(); I++) {
+        if (I % 3 != 2) {
+            const auto& alpha = strings[I / strings.size()];
+            const auto& beta = strings[I % strings.size()];
+
+            onvs.emplace_back(alpha, beta);
+            connections.expandWith(alpha, beta);
+        }
+    }
+
+    for (size_t I = 0; I < onvs.size(); I++) {
+
+        // Find the connected ONVs J > I by comparing with every ONV.
+        std::vector<size_t> ref_connected_addresses;
+        for (size_t J = I + 1; J < onvs.size(); J++) {
+            const auto number_of_differences = onvs[I].first.countNumberOfDifferences(onvs[J].first) + onvs[I].second.countNumberOfDifferences(onvs[J].second);
+            if (number_of_differences <= 4) {
+                ref_connected_addresses.push_back(J);
+            }
+        }
+
+        std::vector<size_t> connected_addresses;
+        connections.forEachConnectionOf(I, [&connected_addresses](const size_t J) { connected_addresses.push_back(J); });
+        std::sort(connected_addresses.begin(), connected_addresses.end());
+
+        BOOST_TEST(connected_addresses == ref_connected_addresses, boost::test_tools::per_element());
+    }
+}
@@ -382,6 +382,63 @@ BOOST_AUTO_TEST_CASE(generalized_dense_vs_matvec) {
 }
 
 
+/**
+ *  Check if the multithreaded matrix-vector product is equal to the single-threaded one, for a number of threads that does not divide the dimension of the ONV basis.
+ *
+ *  The test system is H2O in an STO-3G basisset, read in from a FCIDUMP file, whose spatial orbitals are used as generalized spinors. The spin-unresolved ONV basis with 3 electrons has dimension 35.
+ */
+BOOST_AUTO_TEST_CASE(multithreaded_matvec) {
+
+    // Wrap the restricted integrals in a generalized Hamiltonian.
+    const auto restricted_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const GQCP::ScalarGSQOneElectronOperator<double> h {restricted_hamiltonian.core().parameters()};
+    const GQCP::ScalarGSQTwoElectronOperator<double> g {restricted_hamiltonian.twoElectron().parameters()};
+    const GQCP::GSQHamiltonian<double> hamiltonian {h, g};
+
+    const GQCP::SpinUnresolvedONVBasis onv_basis {hamiltonian.numberOfOrbitals(), 3};
+    const auto linear_expansion = GQCP::LinearExpansion<GQCP::SpinUnresolvedONVBasis>::Random(onv_basis);
+    const auto& x = linear_expansion.coefficients();
+
+
+    // Check the one-electron operator, the two-electron operator and the Hamiltonian.
+    const GQCP::VectorX<double> direct_mvp = onv_basis.evaluateOperatorDense(hamiltonian) * x;  // mvp: matrix-vector-product
+    for (const size_t number_of_threads : {2, 3, 64}) {
+        BOOST_CHECK(onv_basis.evaluateOperatorMatrixVectorProduct(h, x, number_of_threads).isApprox(onv_basis.evaluateOperatorMatrixVectorProduct(h, x), 1.0e-12));
+        BOOST_CHECK(onv_basis.evaluateOperatorMatrixVectorProduct(g, x, number_of_threads).isApprox(onv_basis.evaluateOperatorMatrixVectorProduct(g, x), 1.0e-12));
+        BOOST_CHECK(onv_basis.evaluateOperatorMatrixVectorProduct(hamiltonian, x, number_of_threads).isApprox(direct_mvp, 1.0e-08));
+    }
+
+    BOOST_CHECK_THROW(onv_basis.evaluateOperatorMatrixVectorProduct(hamiltonian, x, 0), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the block matrix-vector products of a generalized Hamiltonian are equal to the separate matrix-vector products, also when they are calculated on multiple threads.
+ *
+ *  The test system is H2O in an STO-3G basisset, read in from a FCIDUMP file, whose spatial orbitals are used as generalized spinors. The spin-unresolved ONV basis with 3 electrons has dimension 35.
+ */
+BOOST_AUTO_TEST_CASE(block_matvec) {
+
+    // Wrap the restricted integrals in a generalized Hamiltonian.
+    const auto restricted_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const GQCP::ScalarGSQOneElectronOperator<double> h {restricted_hamiltonian.core().parameters()};
+    const GQCP::ScalarGSQTwoElectronOperator<double> g {restricted_hamiltonian.twoElectron().parameters()};
+    const GQCP::GSQHamiltonian<double> hamiltonian {h, g};
+
+    const GQCP::SpinUnresolvedONVBasis onv_basis {hamiltonian.numberOfOrbitals(), 3};
+    const GQCP::MatrixX<double> X = GQCP::MatrixX<double>::Random(onv_basis.dimension(), 3);
+
+    for (const size_t number_of_threads : {1, 4}) {
+        const auto block_mvp = onv_basis.evaluateOperatorBlockMatrixVectorProduct(hamiltonian, X, number_of_threads);
+
+        for (size_t i = 0; i < 3; i++) {
+            const GQCP::VectorX<double> x = X.col(i);
+            BOOST_CHECK(block_mvp.col(i).isApprox(onv_basis.evaluateOperatorMatrixVectorProduct(hamiltonian, x), 1.0e-12));
+        }
+    }
+}
+
+
 /*
  *  MARK: Legacy code
  */
@@ -520,4 +577,101 @@ BOOST_AUTO_TEST_CASE(shiftToPreviousOrbital_signed) {
     BOOST_CHECK(e == -1);
     BOOST_CHECK(q == 1);
     BOOST_CHECK(sign == -1);
-}
\ No newline at end of file
+}
+
+/**
+ *  Check if the addresses and permutations of multi-word spin-unresolved ONVs match the ones of single-word spin-unresolved ONVs.
+ */
+BOOST_AUTO_TEST_CASE(multi_word_addressOf_nextPermutationOf) {
+
+    const GQCP::SpinUnresolvedONVBasis onv_basis {7, 3};
+
+    // Walk through the whole ONV basis with both representations.
+    auto representation_single = onv_basis.constructONVFromAddress(0).unsignedRepresentation();
+    auto representation_multi = GQCP::Bitstring<128> {representation_single};
+    for (size_t I = 0; I < onv_basis.dimension(); I++) {
+        BOOST_CHECK(representation_multi.word(0) == representation_single);
+        BOOST_CHECK(representation_multi.word(1) == 0);
+
+        const GQCP::MultiWordSpinUnresolvedONV<128> onv {7, 3, representation_multi};
+        BOOST_CHECK_EQUAL(onv_basis.addressOf(onv), I);
+
+        if (I < onv_basis.dimension() - 1) {
+            representation_single = onv_basis.nextPermutationOf(representation_single);
+            representation_multi = onv_basis.nextPermutationOf(representation_multi);
+        }
+    }
+}
+
+
+/**
+ *  Check if a generalized Hamiltonian can be evaluated in an ONV basis with more than 64 spinors, which needs a multi-word representation.
+ * 
+ *  The Hamiltonian of a water molecule in an STO-3G basis (7 spinors) is embedded in 65 spinors: its first four spinors keep their indices and its last three spinors get the indices 62, 63 and 64, so that its ONVs straddle the boundary between the first and the second word. All other integrals are zero, so the matrix elements between the ONVs that only occupy the embedded spinors should match the ones in the original 7 spinors.
+ */
+BOOST_AUTO_TEST_CASE(evaluate_hamiltonian_more_than_64_spinors) {
+
+    // Wrap the restricted integrals in a generalized Hamiltonian.
+    const auto restricted_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const GQCP::ScalarGSQOneElectronOperator<double> h {restricted_hamiltonian.core().parameters()};
+    const GQCP::ScalarGSQTwoElectronOperator<double> g {restricted_hamiltonian.twoElectron().parameters()};
+    const GQCP::GSQHamiltonian<double> hamiltonian {h, g};
+
+    const auto M_small = hamiltonian.numberOfOrbitals();
+    const size_t M = 65;
+    const size_t N = 2;
+
+
+    // Embed the integrals in the larger spinor basis.
+    const auto embedded_index = [M_small, M](const size_t p) { return (p < 4) ? p : (M - M_small + p); };
+
+    const auto& h_small = h.parameters();
+    const auto& g_small = g.parameters();
+    GQCP::SquareMatrix<double> h_embedded = GQCP::SquareMatrix<double>::Zero(M);
+    auto g_embedded = GQCP::SquareRankFourTensor<double>::Zero(M);
+    for (size_t p = 0; p < M_small; p++) {
+        for (size_t q = 0; q < M_small; q++) {
+            h_embedded(embedded_index(p), embedded_index(q)) = h_small(p, q);
+
+            for (size_t r = 0; r < M_small; r++) {
+                for (size_t s = 0; s < M_small; s++) {
+                    g_embedded(embedded_index(p), embedded_index(q), embedded_index(r), embedded_index(s)) = g_small(p, q, r, s);
+                }
+            }
+        }
+    }
+    const GQCP::GSQHamiltonian<double> hamiltonian_embedded {GQCP::ScalarGSQOneElectronOperator<double> {h_embedded}, GQCP::ScalarGSQTwoElectronOperator<double> {g_embedded}};
+
+
+    // Evaluate the Hamiltonian in both ONV bases.
+    const GQCP::SpinUnresolvedONVBasis onv_basis_small {M_small, N};
+    const GQCP::SpinUnresolvedONVBasis onv_basis {M, N};
+
+    const auto H_small = onv_basis_small.evaluateOperatorDense(hamiltonian);
+    const auto H = onv_basis.evaluateOperatorSparse(hamiltonian_embedded);
+
+
+    // Check the matrix elements between the embedded ONVs.
+    const auto embedded_address = [&onv_basis, &embedded_index, M](const GQCP::SpinUnresolvedONV& onv) {
+        std::vector<size_t> occupied_indices;
+        for (const auto& p : onv.occupiedIndices()) {
+            occupied_indices.push_back(embedded_index(p));
+        }
+
+        return onv_basis.addressOf(GQCP::MultiWordSpinUnresolvedONV<128>::FromOccupiedIndices(occupied_indices, M));
+    };
+
+    onv_basis_small.forEach([&](const GQCP::SpinUnresolvedONV& onv_I, const size_t I) {
+        onv_basis_small.forEach([&](const GQCP::SpinUnresolvedONV& onv_J, const size_t J) {
+            BOOST_CHECK(std::abs(H.coeff(embedded_address(onv_I), embedded_address(onv_J)) - H_small(I, J)) < 1.0e-12);
+        });
+    });
+
+
+    // Check if the diagonal and the matrix-vector products are consistent with the sparse evaluation.
+    const GQCP::VectorX<double> x = GQCP::VectorX<double>::Random(onv_basis.dimension());
+    const GQCP::VectorX<double> H_x = H * x;
+
+    BOOST_CHECK(onv_basis.evaluateOperatorDiagonal(hamiltonian_embedded).isApprox(H.diagonal(), 1.0e-12));
+    BOOST_CHECK(onv_basis.evaluateOperatorMatrixVectorProduct(hamiltonian_embedded, x, 4).isApprox(H_x, 1.0e-12));
+}
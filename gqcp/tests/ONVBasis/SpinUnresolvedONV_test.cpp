@@ -726,3 +726,50 @@ BOOST_AUTO_TEST_CASE(RHF_UHF_projection) {
     // Check if both approaches yield the same result.
     BOOST_CHECK(std::abs(uhf_on_rhf_projection_general - uhf_on_rhf_projection_specialized) < 1.0e-12);
 }
+
+
+/**
+ *  Check if a spin-unresolved ONV with a multi-word representation can be expressed in more than 64 spinors, and if its bit operations cross word boundaries correctly.
+ */
+BOOST_AUTO_TEST_CASE(multi_word_ONV) {
+
+    const size_t M = 130;
+    const auto onv1 = GQCP::MultiWordSpinUnresolvedONV<192>::FromOccupiedIndices({0, 63, 64, 129}, M);
+    const auto onv2 = GQCP::MultiWordSpinUnresolvedONV<192>::FromOccupiedIndices({0, 62, 64, 128}, M);
+
+    BOOST_CHECK(onv1.isOccupied(129));
+    BOOST_CHECK(onv1.isUnoccupied(128));
+    BOOST_TEST(onv1.occupiedIndices() == (std::vector<size_t> {0, 63, 64, 129}), boost::test_tools::per_element());
+
+    BOOST_CHECK_EQUAL(onv1.countNumberOfDifferences(onv2), 4);
+    BOOST_TEST(onv1.findDifferentOccupations(onv2) == (std::vector<size_t> {63, 129}), boost::test_tools::per_element());
+    BOOST_TEST(onv1.findMatchingOccupations(onv2) == (std::vector<size_t> {0, 64}), boost::test_tools::per_element());
+
+    // There are three electrons in the spinors up to 129 (not included).
+    BOOST_CHECK_EQUAL(onv1.operatorPhaseFactor(64), 1);
+    BOOST_CHECK_EQUAL(onv1.operatorPhaseFactor(129), -1);
+
+    // The slice [62, 66) should be "0110".
+    BOOST_CHECK(onv1.slice(62, 66) == GQCP::Bitstring<192> {6});
+
+    // The single-word representation can't hold 130 spinors.
+    BOOST_CHECK_THROW(GQCP::SpinUnresolvedONV::FromOccupiedIndices({0, 129}, M), std::invalid_argument);
+}
+
+
+/**
+ *  Check if a spin-unresolved ONV with a multi-word representation behaves like a single-word one for less than 64 spinors.
+ */
+BOOST_AUTO_TEST_CASE(multi_word_ONV_vs_single_word) {
+
+    const auto onv_single = GQCP::SpinUnresolvedONV::FromString("0101101");
+    const auto onv_multi = GQCP::MultiWordSpinUnresolvedONV<128>::FromString("0101101");
+
+    BOOST_CHECK_EQUAL(onv_multi.asString(), onv_single.asString());
+    BOOST_CHECK(onv_multi.occupiedIndices() == onv_single.occupiedIndices());
+    BOOST_CHECK(onv_multi.unsignedRepresentation().word(0) == onv_single.unsignedRepresentation());
+
+    for (size_t p = 0; p < 7; p++) {
+        BOOST_CHECK_EQUAL(onv_multi.operatorPhaseFactor(p), onv_single.operatorPhaseFactor(p));
+    }
+}
@@ -0,0 +1,129 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "CholeskyDecomposedRSQTwoElectronOperator"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/SpinorBasis/RSpinOrbitalBasis.hpp"
+#include "Molecule/Molecule.hpp"
+#include "Operator/SecondQuantized/CholeskyDecomposedRSQTwoElectronOperator.hpp"
+
+
+/*
+ *  MARK: Helper functions
+ */
+
+/**
+ *  @return A restricted two-electron operator with random parameters that have the 8-fold permutational symmetry of two-electron integrals, and whose pair matrix is positive semi-definite.
+ */
+GQCP::ScalarRSQTwoElectronOperator<double> randomPositiveSemiDefiniteOperator(const size_t K) {
+
+    const size_t number_of_pairs = K * (K + 1) / 2;
+    const GQCP::MatrixX<double> A = GQCP::MatrixX<double>::Random(number_of_pairs, number_of_pairs);
+    const GQCP::MatrixX<double> M = A * A.transpose();
+
+    GQCP::PackedSymmetricRankFourTensor packed {K};
+    for (size_t PQ = 0; PQ < number_of_pairs; PQ++) {
+        for (size_t RS = 0; RS <= PQ; RS++) {
+            packed.packedElements()(PQ * (PQ + 1) / 2 + RS) = M(PQ, RS);
+        }
+    }
+
+    return GQCP::ScalarRSQTwoElectronOperator<double>::FromPacked(packed);
+}
+
+
+/*
+ *  MARK: Tests
+ */
+
+/**
+ *  Check if decomposing a dense operator and expanding it again gives the original parameters, and if antisymmetrized integrals are rejected.
+ */
+BOOST_AUTO_TEST_CASE(FromDense_dense) {
+
+    const size_t K = 5;
+    const auto g_op = randomPositiveSemiDefiniteOperator(K);
+
+    const auto cholesky_op = GQCP::CholeskyDecomposedRSQTwoElectronOperator::FromDense(g_op, 1.0e-12);
+    BOOST_CHECK(cholesky_op.numberOfOrbitals() == K);
+    BOOST_CHECK(cholesky_op.dense().parameters().isApprox(g_op.parameters(), 1.0e-10));
+
+    auto g_op_antisymmetrized = g_op;
+    g_op_antisymmetrized.antisymmetrize();
+    BOOST_CHECK_THROW(GQCP::CholeskyDecomposedRSQTwoElectronOperator::FromDense(g_op_antisymmetrized), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the expectation value and the effective one-electron partition match the ones of the dense operator.
+ */
+BOOST_AUTO_TEST_CASE(calculations) {
+
+    const size_t K = 4;
+    const auto g_op = randomPositiveSemiDefiniteOperator(K);
+    const auto cholesky_op = GQCP::CholeskyDecomposedRSQTwoElectronOperator::FromDense(g_op, 0.0);
+
+    const GQCP::Orbital2DM<double> d {GQCP::SquareRankFourTensor<double>::Random(K)};
+    const double expectation_value = cholesky_op.calculateExpectationValue(d);
+    const double expectation_value_ref = g_op.calculateExpectationValue(d);
+    BOOST_CHECK(std::abs(expectation_value - expectation_value_ref) < 1.0e-10);
+
+    BOOST_CHECK(cholesky_op.effectiveOneElectronPartition().parameters().isApprox(g_op.effectiveOneElectronPartition().parameters(), 1.0e-10));
+
+    BOOST_CHECK_THROW(cholesky_op.calculateExpectationValue(GQCP::Orbital2DM<double> {GQCP::SquareRankFourTensor<double>::Random(K + 1)}), std::invalid_argument);
+}
+
+
+/**
+ *  Check if basis transformations and Jacobi rotations of the Cholesky vectors match the ones of the dense operator.
+ */
+BOOST_AUTO_TEST_CASE(transform_rotate) {
+
+    const size_t K = 5;
+    const auto g_op = randomPositiveSemiDefiniteOperator(K);
+    const auto cholesky_op = GQCP::CholeskyDecomposedRSQTwoElectronOperator::FromDense(g_op, 0.0);
+
+    const auto T = GQCP::RTransformation<double>::RandomUnitary(K);
+    BOOST_CHECK(cholesky_op.transformed(T).dense().parameters().isApprox(g_op.transformed(T).parameters(), 1.0e-10));
+    BOOST_CHECK(cholesky_op.rotated(T).dense().parameters().isApprox(g_op.rotated(T).parameters(), 1.0e-10));
+
+    const GQCP::JacobiRotation jacobi_rotation {4, 1, 0.6};
+    auto cholesky_op_rotated = cholesky_op;
+    cholesky_op_rotated.rotate(jacobi_rotation);
+    BOOST_CHECK(cholesky_op_rotated.dense().parameters().isApprox(g_op.rotated(jacobi_rotation).parameters(), 1.0e-10));
+    BOOST_CHECK(cholesky_op.rotated(jacobi_rotation).dense().parameters().isApprox(cholesky_op_rotated.dense().parameters(), 1.0e-12));
+}
+
+
+/**
+ *  Check if the Cholesky-decomposed Coulomb integrals, which are generated from the shell-pair diagonals, match the dense Coulomb integrals for H2O.
+ */
+BOOST_AUTO_TEST_CASE(quantizeCholeskyDecomposed_h2o) {
+
+    const auto water = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {water, "6-31G"};
+    spin_orbital_basis.lowdinOrthonormalize();
+
+    const auto g_op = spin_orbital_basis.quantize(GQCP::Operator::Coulomb());
+    const auto cholesky_op = spin_orbital_basis.quantizeCholeskyDecomposed(GQCP::Operator::Coulomb(), 1.0e-10, 2);
+
+    const auto K = spin_orbital_basis.numberOfSpatialOrbitals();
+    BOOST_CHECK(cholesky_op.numberOfCholeskyVectors() < K * (K + 1) / 2);
+    BOOST_CHECK(cholesky_op.dense().parameters().isApprox(g_op.parameters(), 1.0e-08));
+}
@@ -0,0 +1,124 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "PackedRSQTwoElectronOperator"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Operator/SecondQuantized/PackedRSQHamiltonian.hpp"
+#include "Operator/SecondQuantized/PackedRSQTwoElectronOperator.hpp"
+
+#include <cstdio>
+
+
+/**
+ *  Check if packing a dense operator and expanding it again gives the original parameters, and if antisymmetrized integrals are rejected.
+ */
+BOOST_AUTO_TEST_CASE(FromDense_dense) {
+
+    const size_t K = 5;
+    const auto g_op = GQCP::ScalarRSQTwoElectronOperator<double>::FromPacked(GQCP::PackedSymmetricRankFourTensor::Random(K));
+
+    const auto packed_op = GQCP::PackedRSQTwoElectronOperator::FromDense(g_op);
+    BOOST_CHECK(packed_op.numberOfOrbitals() == K);
+    BOOST_CHECK(packed_op.dense().parameters().isApprox(g_op.parameters(), 1.0e-12));
+    BOOST_CHECK(packed_op.parameters()(3, 1, 4, 2) == g_op.parameters()(3, 1, 4, 2));
+
+    auto g_op_antisymmetrized = g_op;
+    g_op_antisymmetrized.antisymmetrize();
+    BOOST_CHECK_THROW(GQCP::PackedRSQTwoElectronOperator::FromDense(g_op_antisymmetrized), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the expectation value and the effective one-electron partition match the ones of the dense operator.
+ */
+BOOST_AUTO_TEST_CASE(calculations) {
+
+    const size_t K = 4;
+    const GQCP::PackedRSQTwoElectronOperator packed_op {GQCP::PackedSymmetricRankFourTensor::Random(K)};
+    const auto g_op = packed_op.dense();
+
+    const GQCP::Orbital2DM<double> d {GQCP::SquareRankFourTensor<double>::Random(K)};
+    const double expectation_value = packed_op.calculateExpectationValue(d);
+    const double expectation_value_ref = g_op.calculateExpectationValue(d);
+    BOOST_CHECK(std::abs(expectation_value - expectation_value_ref) < 1.0e-12);
+
+    BOOST_CHECK(packed_op.effectiveOneElectronPartition().parameters().isApprox(g_op.effectiveOneElectronPartition().parameters(), 1.0e-12));
+
+    BOOST_CHECK_THROW(packed_op.calculateExpectationValue(GQCP::Orbital2DM<double> {GQCP::SquareRankFourTensor<double>::Random(K + 1)}), std::invalid_argument);
+}
+
+
+/**
+ *  Check if basis transformations and Jacobi rotations of the packed operator match the ones of the dense operator.
+ */
+BOOST_AUTO_TEST_CASE(transform_rotate) {
+
+    const size_t K = 5;
+    const GQCP::PackedRSQTwoElectronOperator packed_op {GQCP::PackedSymmetricRankFourTensor::Random(K)};
+    const auto g_op = packed_op.dense();
+
+    const auto T = GQCP::RTransformation<double>::RandomUnitary(K);
+    BOOST_CHECK(packed_op.transformed(T).dense().parameters().isApprox(g_op.transformed(T).parameters(), 1.0e-12));
+    BOOST_CHECK(packed_op.rotated(T).dense().parameters().isApprox(g_op.rotated(T).parameters(), 1.0e-12));
+
+    const GQCP::JacobiRotation jacobi_rotation {4, 1, 0.6};
+    auto packed_op_rotated = packed_op;
+    packed_op_rotated.rotate(jacobi_rotation);
+    BOOST_CHECK(packed_op_rotated.dense().parameters().isApprox(g_op.rotated(jacobi_rotation).parameters(), 1.0e-12));
+    BOOST_CHECK(packed_op.rotated(jacobi_rotation).parameters().isApprox(packed_op_rotated.parameters(), 1.0e-12));
+}
+
+
+/**
+ *  Check if a Hamiltonian with packed two-electron integrals that is read from an FCIDUMP file matches the dense one, also after a Jacobi rotation.
+ */
+BOOST_AUTO_TEST_CASE(PackedRSQHamiltonian_FromFCIDUMP) {
+
+    const auto fcidump = GQCP::FCIDUMP::Read("data/h2o_sto3g_klaas.FCIDUMP");
+    auto packed_hamiltonian = GQCP::PackedRSQHamiltonian::FromFCIDUMP(fcidump);
+    auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP(fcidump);
+
+    BOOST_CHECK(packed_hamiltonian.numberOfOrbitals() == sq_hamiltonian.numberOfOrbitals());
+    BOOST_CHECK(packed_hamiltonian.core().parameters().isApprox(sq_hamiltonian.core().parameters(), 1.0e-12));
+    BOOST_CHECK(packed_hamiltonian.dense().twoElectron().parameters().isApprox(sq_hamiltonian.twoElectron().parameters(), 1.0e-12));
+    BOOST_CHECK(GQCP::PackedRSQHamiltonian::FromDense(sq_hamiltonian).twoElectron().parameters().isApprox(packed_hamiltonian.twoElectron().parameters(), 1.0e-12));
+
+    const GQCP::JacobiRotation jacobi_rotation {5, 2, 0.3};
+    packed_hamiltonian.rotate(jacobi_rotation);
+    sq_hamiltonian.rotate(jacobi_rotation);
+    BOOST_CHECK(packed_hamiltonian.core().parameters().isApprox(sq_hamiltonian.core().parameters(), 1.0e-12));
+    BOOST_CHECK(packed_hamiltonian.dense().twoElectron().parameters().isApprox(sq_hamiltonian.twoElectron().parameters(), 1.0e-12));
+
+    BOOST_CHECK_THROW(GQCP::PackedRSQHamiltonian(GQCP::ScalarRSQOneElectronOperator<double>::Random(3), GQCP::PackedRSQTwoElectronOperator {GQCP::PackedSymmetricRankFourTensor::Random(4)}), std::invalid_argument);
+}
+
+
+/**
+ *  Check if a packed Hamiltonian can be read from a binary integral file, and if it matches the one that is parsed from the original FCIDUMP file on multiple threads.
+ */
+BOOST_AUTO_TEST_CASE(PackedRSQHamiltonian_FromBinary) {
+
+    GQCP::FCIDUMP::Read("data/h2o_sto3g_klaas.FCIDUMP").writeBinary("PackedRSQTwoElectronOperator_test_FromBinary.gqcpint");
+    const auto hamiltonian_binary = GQCP::PackedRSQHamiltonian::FromBinary("PackedRSQTwoElectronOperator_test_FromBinary.gqcpint");
+    std::remove("PackedRSQTwoElectronOperator_test_FromBinary.gqcpint");
+
+    const auto hamiltonian = GQCP::PackedRSQHamiltonian::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP", 2);
+    BOOST_CHECK(hamiltonian_binary.core().parameters().isApprox(hamiltonian.core().parameters(), 0.0));
+    BOOST_CHECK(hamiltonian_binary.twoElectron().parameters().packedElements() == hamiltonian.twoElectron().parameters().packedElements());
+}
@@ -331,3 +331,24 @@ BOOST_AUTO_TEST_CASE(dissociatedMoleculeParameters) {
     GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spinor_basis {NO, "STO-3G"};
     BOOST_CHECK_NO_THROW(GQCP::RSQHamiltonian<double>::Molecular(spinor_basis, NO));
 }
+
+
+/**
+ *  Check if an in-place Jacobi rotation of a Hamiltonian (and all of its contributions) matches the rotation with the corresponding Jacobi rotation matrix.
+ */
+BOOST_AUTO_TEST_CASE(rotate_jacobi) {
+
+    const size_t K = 5;
+    auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::Random(K);
+    sq_hamiltonian += GQCP::ScalarRSQOneElectronOperator<double>::Random(K);
+
+    const GQCP::JacobiRotation jacobi_rotation {4, 1, 0.6};
+    const auto sq_hamiltonian_ref = sq_hamiltonian.rotated(GQCP::RTransformation<double>::FromJacobi(jacobi_rotation, K));
+
+    sq_hamiltonian.rotate(jacobi_rotation);
+    BOOST_CHECK(sq_hamiltonian.core().parameters().isApprox(sq_hamiltonian_ref.core().parameters(), 1.0e-12));
+    BOOST_CHECK(sq_hamiltonian.twoElectron().parameters().isApprox(sq_hamiltonian_ref.twoElectron().parameters(), 1.0e-12));
+    for (size_t i = 0; i < sq_hamiltonian.coreContributions().size(); i++) {
+        BOOST_CHECK(sq_hamiltonian.coreContributions()[i].parameters().isApprox(sq_hamiltonian_ref.coreContributions()[i].parameters(), 1.0e-12));
+    }
+}
@@ -295,6 +295,26 @@ BOOST_AUTO_TEST_CASE(transform) {
 }
 
 
+/**
+ *  Check if the basis transformation gives the same result when it is distributed over multiple threads, using the library-wide number of threads.
+ */
+BOOST_AUTO_TEST_CASE(transform_multithreaded) {
+
+    const size_t dim = 7;
+    const auto g = GQCP::ScalarRSQTwoElectronOperator<double>::Random(dim);
+    const auto T = GQCP::RTransformation<double>::Random(dim);
+
+    const auto g_transformed_ref = g.transformed(T);
+
+    GQCP::setNumberOfThreads(3);
+    const auto g_transformed = g.transformed(T);
+    GQCP::setNumberOfThreads(1);
+
+    BOOST_CHECK(g_transformed.parameters().isApprox(g_transformed_ref.parameters(), 1.0e-12));
+    BOOST_CHECK_THROW(GQCP::setNumberOfThreads(0), std::invalid_argument);
+}
+
+
 /**
  * Check whether or not the jacobi rotation method works as expected
  */
@@ -331,6 +351,21 @@ BOOST_AUTO_TEST_CASE(transform_with_jacobi_matrix) {
 }
 
 
+/**
+ *  Check if the specialized Jacobi rotation of random two-electron integrals matches the rotation with the corresponding full Jacobi rotation matrix.
+ */
+BOOST_AUTO_TEST_CASE(rotate_with_jacobi_vs_transformation) {
+
+    const size_t dim = 5;
+    const GQCP::ScalarRSQTwoElectronOperator<double> op {GQCP::SquareRankFourTensor<double>::Random(dim)};
+
+    const GQCP::JacobiRotation jacobi_rotation {4, 1, 0.6};
+    const auto J = GQCP::RTransformation<double>::FromJacobi(jacobi_rotation, dim);
+
+    BOOST_CHECK(op.rotated(jacobi_rotation).parameters().isApprox(op.rotated(J).parameters(), 1.0e-12));
+}
+
+
 /**
  *  Check if antisymmetrizing two-electron integrals works as expected.
  * 
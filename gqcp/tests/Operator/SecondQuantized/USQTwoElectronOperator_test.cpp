@@ -403,3 +403,31 @@ BOOST_AUTO_TEST_CASE(transform_with_jacobi_matrix) {
     BOOST_CHECK(op.betaAlpha().parameters().isApprox(ref, 1.0e-08));
     BOOST_CHECK(op.betaBeta().parameters().isApprox(ref, 1.0e-08));
 }
+
+
+/**
+ *  Check if the specialized Jacobi rotation of random unrestricted two-electron integrals, with different alpha and beta rotations, matches the rotation with the corresponding full Jacobi rotation matrices.
+ */
+BOOST_AUTO_TEST_CASE(rotate_with_jacobi_vs_transformation) {
+
+    const size_t dim = 4;
+    const auto g_aa = GQCP::SquareRankFourTensor<double>::Random(dim);
+    const auto g_ab = GQCP::SquareRankFourTensor<double>::Random(dim);
+    const auto g_ba = GQCP::SquareRankFourTensor<double>::Random(dim);
+    const auto g_bb = GQCP::SquareRankFourTensor<double>::Random(dim);
+    const GQCP::ScalarUSQTwoElectronOperator<double> op {g_aa, g_ab, g_ba, g_bb};
+
+    const GQCP::JacobiRotation jacobi_alpha {3, 0, 0.4};
+    const GQCP::JacobiRotation jacobi_beta {2, 1, -1.1};
+    const GQCP::UJacobiRotation jacobi_rotation {jacobi_alpha, jacobi_beta};
+
+    const GQCP::UTransformation<double> U {GQCP::UTransformationComponent<double>::FromJacobi(jacobi_alpha, dim), GQCP::UTransformationComponent<double>::FromJacobi(jacobi_beta, dim)};
+
+    const auto rotated = op.rotated(jacobi_rotation);
+    const auto ref = op.rotated(U);
+
+    BOOST_CHECK(rotated.alphaAlpha().parameters().isApprox(ref.alphaAlpha().parameters(), 1.0e-12));
+    BOOST_CHECK(rotated.alphaBeta().parameters().isApprox(ref.alphaBeta().parameters(), 1.0e-12));
+    BOOST_CHECK(rotated.betaAlpha().parameters().isApprox(ref.betaAlpha().parameters(), 1.0e-12));
+    BOOST_CHECK(rotated.betaBeta().parameters().isApprox(ref.betaBeta().parameters(), 1.0e-12));
+}
@@ -22,6 +22,7 @@
 #include "Mathematical/Optimization/Eigenproblem/Davidson/DavidsonSolver.hpp"
 #include "Mathematical/Optimization/Eigenproblem/EigenproblemSolver.hpp"
 #include "ONVBasis/SeniorityZeroONVBasis.hpp"
+#include "Operator/SecondQuantized/PackedRSQHamiltonian.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 #include "QCMethod/CI/CI.hpp"
 #include "QCMethod/CI/CIEnvironment.hpp"
@@ -305,6 +306,37 @@ BOOST_AUTO_TEST_CASE(DOCI_H2O_6_31G_Davidson) {
     const auto electronic_energy = GQCP::QCMethod::CI<GQCP::SeniorityZeroONVBasis>(onv_basis).optimize(solver, environment).groundStateEnergy();
 
 
+    // Check our result with the reference.
+    const double internuclear_repulsion_energy = 9.7794061444134091e+00;
+    const auto energy = electronic_energy + internuclear_repulsion_energy;
+    BOOST_CHECK(std::abs(energy - (reference_energy)) < 1.0e-09);
+}
+
+
+/**
+ *  Check if we can reproduce the DOCI energy for H2O//6-31G, using a Davidson solver and a Hamiltonian whose two-electron integrals are parsed into packed storage on multiple threads and are never unpacked. The dimension of the seniority zero sub Fock space is 1287.
+ *  The reference values are obtained from Klaas Gunst.
+ */
+BOOST_AUTO_TEST_CASE(DOCI_H2O_6_31G_Davidson_packed) {
+
+    const double reference_energy = -76.0125161011;
+
+    // Read in the molecular Hamiltonian from a FCIDUMP file, keeping the two-electron integrals packed.
+    const auto sq_hamiltonian = GQCP::PackedRSQHamiltonian::FromFCIDUMP("data/h2o_631g_klaas.FCIDUMP", 4);
+    const auto K = sq_hamiltonian.numberOfOrbitals();  // the number of spatial orbitals
+
+    // The species contains 10 electrons, so 5 electron pairs.
+    // Construct an appropriate seniority-zero ONV basis.
+    const GQCP::SeniorityZeroONVBasis onv_basis {K, 5};
+
+
+    // Create a Davidson solver and corresponding environment and put them together in the QCMethod.
+    const auto initial_guess = GQCP::LinearExpansion<GQCP::SeniorityZeroONVBasis>::HartreeFock(onv_basis).coefficients();
+    auto environment = GQCP::CIEnvironment::Iterative(sq_hamiltonian, onv_basis, initial_guess, 4);
+    auto solver = GQCP::EigenproblemSolver::Davidson();
+    const auto electronic_energy = GQCP::QCMethod::CI<GQCP::SeniorityZeroONVBasis>(onv_basis).optimize(solver, environment).groundStateEnergy();
+
+
     // Check our result with the reference.
     const double internuclear_repulsion_energy = 9.7794061444134091e+00;
     const auto energy = electronic_energy + internuclear_repulsion_energy;
@@ -32,6 +32,9 @@
 #include "QCMethod/HF/RHF/RHFSCFEnvironment.hpp"
 #include "QCMethod/HF/RHF/RHFSCFSolver.hpp"
 
+#include <algorithm>
+#include <numeric>
+
 
 /**
  *  Check if we can reproduce the FCI energy for H2//6-31G**, with a dense solver. The reference is taken from Cristina (cfr. Ayers' lab).
@@ -284,6 +287,80 @@ BOOST_AUTO_TEST_CASE(FCI_H6_dense_vs_Davidson) {
 }
 
 
+/**
+ *  Check that, for H2O//STO-3G read in from a FCIDUMP file, the dense FCI energy equals the Davidson FCI energy, which uses a precalculated matrix-vector product engine.
+ */
+BOOST_AUTO_TEST_CASE(FCI_H2O_FCIDUMP_dense_vs_Davidson) {
+
+    // Read in the molecular Hamiltonian from a FCIDUMP file and set up the full spin-resolved ONV basis.
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = sq_hamiltonian.numberOfOrbitals();
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 5};  // dimension = 441
+
+
+    // Create a dense solver and corresponding environment and put them together in the QCMethod.
+    auto dense_environment = GQCP::CIEnvironment::Dense(sq_hamiltonian, onv_basis);
+    auto dense_solver = GQCP::EigenproblemSolver::Dense();
+    const auto dense_electronic_energy = GQCP::QCMethod::CI<GQCP::SpinResolvedONVBasis>(onv_basis).optimize(dense_solver, dense_environment).groundStateEnergy();
+
+
+    // Create a Davidson solver and corresponding environment and put them together in the QCMethod.
+    const auto x0 = GQCP::LinearExpansion<GQCP::SpinResolvedONVBasis>::HartreeFock(onv_basis).coefficients();  // initial guess
+    auto davidson_environment = GQCP::CIEnvironment::Iterative(sq_hamiltonian, onv_basis, x0);
+    auto davidson_solver = GQCP::EigenproblemSolver::Davidson();
+    const auto davidson_electronic_energy = GQCP::QCMethod::CI<GQCP::SpinResolvedONVBasis>(onv_basis).optimize(davidson_solver, davidson_environment).groundStateEnergy();
+
+
+    // Check if the dense and Davidson energies are equal.
+    BOOST_CHECK(std::abs(dense_electronic_energy - davidson_electronic_energy) < 1.0e-08);
+}
+
+
+/**
+ *  Check if the lowest eigenvalues of H2O//STO-3G, read in from a FCIDUMP file, can be found with a block-Davidson solver, which uses the block matrix-vector products of the ONV basis.
+ *
+ *  The test system is H2O in an STO-3G basisset, which has a FCI dimension of 441.
+ */
+BOOST_AUTO_TEST_CASE(FCI_H2O_FCIDUMP_dense_vs_BlockDavidson) {
+
+    const size_t number_of_states = 3;
+    const size_t block_size = 4;
+
+    // Read in the molecular Hamiltonian from a FCIDUMP file and set up the full spin-resolved ONV basis.
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = sq_hamiltonian.numberOfOrbitals();
+    const GQCP::SpinResolvedONVBasis onv_basis {K, 5, 5};  // dimension = 441
+
+
+    // Find the reference eigenvalues through a dense diagonalization.
+    auto dense_environment = GQCP::CIEnvironment::Dense(sq_hamiltonian, onv_basis);
+    auto dense_solver = GQCP::EigenproblemSolver::Dense();
+    dense_solver.perform(dense_environment);
+
+
+    // Use the unit vectors that correspond to the lowest diagonal elements as initial guesses for the block-Davidson solver.
+    const auto diagonal = onv_basis.evaluateOperatorDiagonal(sq_hamiltonian);
+    std::vector<size_t> addresses(onv_basis.dimension());
+    std::iota(addresses.begin(), addresses.end(), 0);
+    std::partial_sort(addresses.begin(), addresses.begin() + block_size, addresses.end(), [&diagonal](const size_t I, const size_t J) { return diagonal(I) < diagonal(J); });
+
+    GQCP::MatrixX<double> V = GQCP::MatrixX<double>::Zero(onv_basis.dimension(), block_size);
+    for (size_t i = 0; i < block_size; i++) {
+        V(addresses[i], i) = 1.0;
+    }
+
+    auto davidson_environment = GQCP::CIEnvironment::Iterative(sq_hamiltonian, onv_basis, V);
+    auto davidson_solver = GQCP::EigenproblemSolver::BlockDavidson(number_of_states, block_size);
+    const auto davidson_qc_structure = GQCP::QCMethod::CI<GQCP::SpinResolvedONVBasis>(onv_basis, number_of_states).optimize(davidson_solver, davidson_environment);
+
+
+    // Check if the dense and block-Davidson eigenvalues are equal.
+    for (size_t i = 0; i < number_of_states; i++) {
+        BOOST_CHECK(std::abs(dense_environment.eigenvalues(i) - davidson_qc_structure.energy(i)) < 1.0e-08);
+    }
+}
+
+
 /**
  *  Check if the ground state energy found using our dense unrestricted FCI routines matches Psi4 and GAMESS' FCI energy.
  * 
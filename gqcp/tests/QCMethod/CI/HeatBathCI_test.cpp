@@ -0,0 +1,140 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "HeatBathCI"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Transformations/RTransformation.hpp"
+#include "Mathematical/Optimization/Eigenproblem/EigenproblemSolver.hpp"
+#include "ONVBasis/SpinResolvedSelectedONVBasis.hpp"
+#include "Operator/SecondQuantized/ModelHamiltonian/HubbardHamiltonian.hpp"
+#include "QCMethod/CI/CI.hpp"
+#include "QCMethod/CI/CIEnvironment.hpp"
+#include "QCMethod/CI/HeatBathCI.hpp"
+#include "QCMethod/CI/HeatBathExcitationGenerator.hpp"
+
+
+namespace {
+
+
+/**
+ *  @return A Hubbard Hamiltonian for 6 sites, expressed in a random orthonormal orbital basis so that it has general one- and two-electron integrals.
+ */
+GQCP::RSQHamiltonian<double> rotatedHubbardHamiltonian() {
+
+    const size_t K = 6;
+    const auto H = GQCP::HoppingMatrix<double>::Random(K);
+    auto hamiltonian = GQCP::RSQHamiltonian<double>::FromHubbard(GQCP::HubbardHamiltonian<double> {H});
+    hamiltonian.rotate(GQCP::RTransformation<double>::RandomUnitary(K));
+
+    return hamiltonian;
+}
+
+
+}  // namespace
+
+
+/**
+ *  Check if the matrix elements that the heat-bath excitation generator calculates match the dense matrix representation of the Hamiltonian in a selected ONV basis.
+ */
+BOOST_AUTO_TEST_CASE(matrix_elements) {
+
+    const auto hamiltonian = rotatedHubbardHamiltonian();
+    const GQCP::SpinResolvedSelectedONVBasis onv_basis {GQCP::SpinResolvedONVBasis {6, 3, 2}};
+    const auto H = onv_basis.evaluateOperatorDense(hamiltonian);
+
+    const GQCP::HeatBathExcitationGenerator generator {hamiltonian};
+    for (size_t I = 0; I < onv_basis.dimension(); I++) {
+        const auto alpha_I = onv_basis.onvWithIndex(I).onv(GQCP::Spin::alpha).unsignedRepresentation();
+        const auto beta_I = onv_basis.onvWithIndex(I).onv(GQCP::Spin::beta).unsignedRepresentation();
+
+        for (size_t J = 0; J < onv_basis.dimension(); J++) {
+            const auto alpha_J = onv_basis.onvWithIndex(J).onv(GQCP::Spin::alpha).unsignedRepresentation();
+            const auto beta_J = onv_basis.onvWithIndex(J).onv(GQCP::Spin::beta).unsignedRepresentation();
+
+            BOOST_CHECK(std::abs(generator.calculateMatrixElement(alpha_J, beta_J, alpha_I, beta_I) - H(J, I)) < 1.0e-12);
+        }
+    }
+}
+
+
+/**
+ *  Check if the excitation generator yields exactly those ONVs whose coupling exceeds the threshold.
+ */
+BOOST_AUTO_TEST_CASE(excitations_vs_brute_force) {
+
+    const auto hamiltonian = rotatedHubbardHamiltonian();
+    const GQCP::SpinResolvedSelectedONVBasis onv_basis {GQCP::SpinResolvedONVBasis {6, 3, 2}};
+    const GQCP::HeatBathExcitationGenerator generator {hamiltonian};
+
+    const double threshold = 0.05;
+    const auto alpha_I = onv_basis.onvWithIndex(0).onv(GQCP::Spin::alpha).unsignedRepresentation();
+    const auto beta_I = onv_basis.onvWithIndex(0).onv(GQCP::Spin::beta).unsignedRepresentation();
+
+    std::vector<std::pair<size_t, size_t>> excitations;
+    generator.forEachExcitation(alpha_I, beta_I, threshold, [&excitations](const size_t alpha_J, const size_t beta_J) { excitations.emplace_back(alpha_J, beta_J); });
+    std::sort(excitations.begin(), excitations.end());
+
+    std::vector<std::pair<size_t, size_t>> ref_excitations;
+    for (size_t J = 1; J < onv_basis.dimension(); J++) {
+        const auto alpha_J = onv_basis.onvWithIndex(J).onv(GQCP::Spin::alpha).unsignedRepresentation();
+        const auto beta_J = onv_basis.onvWithIndex(J).onv(GQCP::Spin::beta).unsignedRepresentation();
+
+        if (std::abs(generator.calculateMatrixElement(alpha_J, beta_J, alpha_I, beta_I)) > threshold) {
+            ref_excitations.emplace_back(alpha_J, beta_J);
+        }
+    }
+    std::sort(ref_excitations.begin(), ref_excitations.end());
+
+    BOOST_CHECK(excitations == ref_excitations);
+}
+
+
+/**
+ *  Check if heat-bath CI with a very small selection threshold reproduces the FCI energy, and if the perturbative correction improves the energy for a larger selection threshold.
+ */
+BOOST_AUTO_TEST_CASE(HCI_vs_FCI) {
+
+    const auto hamiltonian = rotatedHubbardHamiltonian();
+
+    // Calculate the FCI energy.
+    const GQCP::SpinResolvedONVBasis full_onv_basis {6, 3, 3};
+    auto environment = GQCP::CIEnvironment::Dense(hamiltonian, full_onv_basis);
+    auto solver = GQCP::EigenproblemSolver::Dense();
+    const auto fci_energy = GQCP::QCMethod::CI<GQCP::SpinResolvedONVBasis>(full_onv_basis).optimize(solver, environment).groundStateEnergy();
+
+
+    // Start the selection from a single ONV.
+    GQCP::SpinResolvedSelectedONVBasis initial_onv_basis {6, 3, 3};
+    initial_onv_basis.expandWith(GQCP::SpinResolvedONV::FromString("000111", "000111"));
+
+    const auto hci_energy = GQCP::QCMethod::HeatBathCI(1.0e-08).optimize(hamiltonian, initial_onv_basis).groundStateEnergy();
+    BOOST_CHECK(std::abs(hci_energy - fci_energy) < 1.0e-06);
+
+
+    // A loose selection threshold should give a variational energy above the FCI energy, which is improved by the perturbative correction.
+    const GQCP::QCMethod::HeatBathCI loose_hci {2.0e-02};
+    const auto loose_structure = loose_hci.optimize(hamiltonian, initial_onv_basis);
+    const auto loose_energy = loose_structure.groundStateEnergy();
+    const auto correction = loose_hci.calculatePerturbativeCorrection(hamiltonian, loose_structure.parameters(), loose_energy, 1.0e-08);
+
+    BOOST_CHECK(loose_structure.parameters().onvBasis().dimension() < full_onv_basis.dimension());
+    BOOST_CHECK(loose_energy > fci_energy - 1.0e-10);
+    BOOST_CHECK(correction < 0.0);
+    BOOST_CHECK(std::abs(loose_energy + correction - fci_energy) < std::abs(loose_energy - fci_energy));
+}
@@ -20,6 +20,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Basis/SpinorBasis/GSpinorBasis.hpp"
+#include "Mathematical/Representation/PackedSymmetricRankFourTensor.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 #include "QCMethod/HF/GHF/GHF.hpp"
 #include "QCMethod/HF/GHF/GHFSCFSolver.hpp"
@@ -239,3 +240,168 @@ BOOST_AUTO_TEST_CASE(H3_test_DIIS) {
     BOOST_CHECK(std::abs(s_z1 - reference_s_z) < 1.0e-08);
     BOOST_CHECK(std::abs(s_z2 - reference_s_z) < 1.0e-08);
 }
+
+
+/**
+ *  Check if the direct DIIS GHF SCF solver (which calculates the two-electron integrals on the fly) finds the same solution as the DIIS GHF SCF solver.
+ *
+ *  The system of interest is a H3-triangle, 1 bohr apart and the reference implementation was done by @xdvriend.
+ */
+BOOST_AUTO_TEST_CASE(H3_test_direct_DIIS) {
+
+    // Set up a general spinor basis to obtain a spin-blocked core Hamiltonian. The direct solver only requires the core Hamiltonian, so we don't calculate the two-electron integrals up front.
+    const auto molecule = GQCP::Molecule::HRingFromDistance(3, 1.0);  // H3-triangle, 1 bohr apart
+    const auto N = molecule.numberOfElectrons();
+
+    const GQCP::GSpinorBasis<double, GQCP::GTOShell> g_spinor_basis {molecule, "STO-3G"};
+    const auto S = g_spinor_basis.overlap();
+
+    const auto H_core = g_spinor_basis.quantize(GQCP::Operator::Kinetic()) + g_spinor_basis.quantize(GQCP::Operator::NuclearAttraction(molecule));
+
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto jk_calculator = GQCP::DirectJKCalculator::Libint(scalar_basis);
+
+
+    // Create a solver and associated environment and let the QCMethod do its job.
+    GQCP::SquareMatrix<double> C_initial_matrix {6};
+    // clang-format off
+    C_initial_matrix << -0.3585282,  0.0,        0.89935394,  0.0,         0.0,        1.57117404,
+                        -0.3585282,  0.0,       -1.81035361,  0.0,         0.0,        0.00672366,
+                        -0.3585282,  0.0,        0.91099966,  0.0,         0.0,        1.56445038,
+                         0.0,       -0.3585282,  0.0,         0.89935394, -1.57117404, 0.0,
+                         0.0,       -0.3585282,  0.0,        -1.81035361,  0.00672366, 0.0,
+                         0.0,       -0.3585282,  0.0,         0.91099966,  1.56445038, 0.0;
+    // clang-format on
+    const GQCP::GTransformation<double> C_initial {C_initial_matrix};
+    GQCP::GHFSCFEnvironment<double> environment {N, H_core, S, C_initial};
+
+    auto solver = GQCP::GHFSCFSolver<double>::DirectDIIS(jk_calculator, 6, 6, 1.0e-06, 3000);
+    const auto qc_structure = GQCP::QCMethod::GHF<double>().optimize(solver, environment);
+
+
+    // Provide reference values (from @xdvriend implementation) and check the results.
+    const double ref_total_energy = -0.630521948908159;
+    GQCP::VectorX<double> ref_orbital_energies {6};
+    ref_orbital_energies << -1.03313925, -0.88946247, 0.18899685, 0.76709853, 0.81828059, 0.93860157;
+
+    const auto total_energy = qc_structure.groundStateEnergy() + GQCP::Operator::NuclearRepulsion(molecule).value();
+    BOOST_CHECK(std::abs(total_energy - ref_total_energy) < 1.0e-08);
+    BOOST_CHECK(qc_structure.groundStateParameters().orbitalEnergies().isApprox(ref_orbital_energies, 1.0e-06));
+}
+
+
+/**
+ *  Check if the density-fitted DIIS GHF SCF solver finds (approximately) the same solution as the DIIS GHF SCF solver. The density fitting error of a JK-fitting auxiliary basis is of the order of 1e-5 hartree.
+ *
+ *  The system of interest is a H3-triangle, 1 bohr apart and the reference implementation was done by @xdvriend.
+ */
+BOOST_AUTO_TEST_CASE(H3_test_density_fitted_DIIS) {
+
+    // Set up a general spinor basis to obtain a spin-blocked core Hamiltonian. The density-fitted solver only requires the core Hamiltonian, so we don't calculate the two-electron integrals up front.
+    const auto molecule = GQCP::Molecule::HRingFromDistance(3, 1.0);  // H3-triangle, 1 bohr apart
+    const auto N = molecule.numberOfElectrons();
+
+    const GQCP::GSpinorBasis<double, GQCP::GTOShell> g_spinor_basis {molecule, "STO-3G"};
+    const auto S = g_spinor_basis.overlap();
+
+    const auto H_core = g_spinor_basis.quantize(GQCP::Operator::Kinetic()) + g_spinor_basis.quantize(GQCP::Operator::NuclearAttraction(molecule));
+
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const GQCP::ScalarBasis<GQCP::GTOShell> auxiliary_basis {molecule, "def2-universal-jkfit"};
+    const auto jk_calculator = GQCP::DensityFittedJKCalculator::Libint(scalar_basis, auxiliary_basis);
+
+
+    // Create a solver and associated environment and let the QCMethod do its job.
+    GQCP::SquareMatrix<double> C_initial_matrix {6};
+    // clang-format off
+    C_initial_matrix << -0.3585282,  0.0,        0.89935394,  0.0,         0.0,        1.57117404,
+                        -0.3585282,  0.0,       -1.81035361,  0.0,         0.0,        0.00672366,
+                        -0.3585282,  0.0,        0.91099966,  0.0,         0.0,        1.56445038,
+                         0.0,       -0.3585282,  0.0,         0.89935394, -1.57117404, 0.0,
+                         0.0,       -0.3585282,  0.0,        -1.81035361,  0.00672366, 0.0,
+                         0.0,       -0.3585282,  0.0,         0.91099966,  1.56445038, 0.0;
+    // clang-format on
+    const GQCP::GTransformation<double> C_initial {C_initial_matrix};
+    GQCP::GHFSCFEnvironment<double> environment {N, H_core, S, C_initial};
+
+    auto solver = GQCP::GHFSCFSolver<double>::DensityFittedDIIS(jk_calculator, 6, 6, 1.0e-06, 3000);
+    const auto qc_structure = GQCP::QCMethod::GHF<double>().optimize(solver, environment);
+
+
+    // Provide reference values (from @xdvriend implementation) and check the results.
+    const double ref_total_energy = -0.630521948908159;
+    GQCP::VectorX<double> ref_orbital_energies {6};
+    ref_orbital_energies << -1.03313925, -0.88946247, 0.18899685, 0.76709853, 0.81828059, 0.93860157;
+
+    const auto total_energy = qc_structure.groundStateEnergy() + GQCP::Operator::NuclearRepulsion(molecule).value();
+    BOOST_CHECK(std::abs(total_energy - ref_total_energy) < 1.0e-03);
+    BOOST_CHECK(qc_structure.groundStateParameters().orbitalEnergies().isApprox(ref_orbital_energies, 1.0e-02));
+}
+
+
+/**
+ *  Check if the density-fitted GHF Fock matrix matches the one that is calculated from the spin-blocked two-electron integrals, when the density fitting is exact.
+ *
+ *  Density fitting is exact when the auxiliary basis consists of all unique products of the basis functions, i.e. when the three-center integrals are the rows of the (positive definite) pair matrix M(pq, rs) = (pq|rs) and the metric is M itself.
+ */
+BOOST_AUTO_TEST_CASE(density_fitted_fock_matrix_product_basis) {
+
+    const size_t K = 4;
+    const size_t number_of_pairs = K * (K + 1) / 2;
+
+    // Create a positive definite pair matrix, the corresponding two-electron integrals over the scalar basis and an exact density-fitted J/K calculator.
+    const GQCP::MatrixX<double> A = GQCP::MatrixX<double>::Random(number_of_pairs, number_of_pairs);
+    const GQCP::SquareMatrix<double> M = A * A.transpose() + GQCP::MatrixX<double>::Identity(number_of_pairs, number_of_pairs);
+
+    GQCP::PackedSymmetricRankFourTensor packed {K};
+    for (size_t PQ = 0; PQ < number_of_pairs; PQ++) {
+        for (size_t RS = 0; RS <= PQ; RS++) {
+            packed.packedElements()(PQ * (PQ + 1) / 2 + RS) = M(PQ, RS);
+        }
+    }
+    const auto g = packed.full();
+
+    GQCP::MatrixX<double> three_center_integrals {K * K, number_of_pairs};
+    for (size_t mu = 0; mu < K; mu++) {
+        for (size_t nu = 0; nu < K; nu++) {
+            three_center_integrals.row(mu + K * nu) = M.row(GQCP::PackedSymmetricRankFourTensor::pairIndex(mu, nu));
+        }
+    }
+    const GQCP::DensityFittedJKCalculator jk_calculator {three_center_integrals, M};
+
+
+    // Set up the spin-blocked Hamiltonian, in which only the integrals (alpha alpha|alpha alpha), (alpha alpha|beta beta), (beta beta|alpha alpha) and (beta beta|beta beta) are non-zero.
+    auto g_spin_blocked = GQCP::SquareRankFourTensor<double>::Zero(2 * K);
+    for (size_t p = 0; p < 2 * K; p++) {
+        for (size_t q = 0; q < 2 * K; q++) {
+            for (size_t r = 0; r < 2 * K; r++) {
+                for (size_t s = 0; s < 2 * K; s++) {
+                    if ((p / K == q / K) && (r / K == s / K)) {
+                        g_spin_blocked(p, q, r, s) = g(p % K, q % K, r % K, s % K);
+                    }
+                }
+            }
+        }
+    }
+
+    const GQCP::SquareMatrix<double> h_random = GQCP::SquareMatrix<double>::Random(2 * K);
+    const GQCP::ScalarGSQOneElectronOperator<double> H_core {GQCP::SquareMatrix<double>(h_random + h_random.transpose())};
+    const GQCP::GSQHamiltonian<double> sq_hamiltonian {H_core, GQCP::ScalarGSQTwoElectronOperator<double> {g_spin_blocked}};
+
+
+    // Calculate the Fock matrix for a random symmetric density matrix, in an environment with the full Hamiltonian and in one with only the core Hamiltonian.
+    const GQCP::ScalarGSQOneElectronOperator<double> S {GQCP::SquareMatrix<double>::Identity(2 * K)};
+    const GQCP::GTransformation<double> C_initial {GQCP::SquareMatrix<double>::Identity(2 * K)};
+    GQCP::GHFSCFEnvironment<double> environment {2, sq_hamiltonian, S, C_initial};
+    GQCP::GHFSCFEnvironment<double> density_fitted_environment {2, H_core, S, C_initial};
+
+    const GQCP::SquareMatrix<double> P_random = GQCP::SquareMatrix<double>::Random(2 * K);
+    const GQCP::G1DM<double> P {GQCP::SquareMatrix<double>(P_random + P_random.transpose())};
+    environment.density_matrices.push_back(P);
+    density_fitted_environment.density_matrices.push_back(P);
+
+    GQCP::GHFFockMatrixCalculation<double>().execute(environment);
+    GQCP::GHFDensityFittedFockMatrixCalculation(jk_calculator).execute(density_fitted_environment);
+
+    BOOST_CHECK(density_fitted_environment.fock_matrices.back().parameters().isApprox(environment.fock_matrices.back().parameters(), 1.0e-10));
+}
@@ -305,6 +305,68 @@ BOOST_AUTO_TEST_CASE(crawdad_h2o_sto3g_diis) {
 }
 
 
+/**
+ *  Check if the total RHF energy for H2O that is calculated by our direct DIIS RHF SCF solver (which calculates the two-electron integrals on the fly, on multiple threads) matches the example from Crawdad.
+ */
+BOOST_AUTO_TEST_CASE(crawdad_h2o_sto3g_direct_diis) {
+
+    const double ref_total_energy = -74.9420799281920;
+
+
+    // Do our own RHF calculation. The direct solver only requires the core Hamiltonian, so we don't calculate the two-electron integrals up front.
+    const auto water = GQCP::Molecule::ReadXYZ("data/h2o_crawdad.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {water, "STO-3G"};
+    const auto H_core = spin_orbital_basis.quantize(GQCP::Operator::Kinetic()) + spin_orbital_basis.quantize(GQCP::Operator::NuclearAttraction(water));  // In an AO basis.
+
+    const auto jk_calculator = GQCP::DirectJKCalculator::Libint(spin_orbital_basis.scalarBasis(), 1.0e-12, 2);
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(water.numberOfElectrons(), H_core, spin_orbital_basis.overlap());
+    auto direct_diis_rhf_scf_solver = GQCP::RHFSCFSolver<double>::DirectDIIS(jk_calculator);
+    direct_diis_rhf_scf_solver.perform(rhf_environment);
+    const auto number_of_iterations = direct_diis_rhf_scf_solver.numberOfIterations();
+
+
+    // Check the total energy.
+    const double total_energy = rhf_environment.electronic_energies.back() + GQCP::Operator::NuclearRepulsion(water).value();
+    BOOST_CHECK(std::abs(total_energy - ref_total_energy) < 1.0e-06);
+
+
+    // Check if the solver can be reused for a new environment, i.e. that the state of the incremental Fock matrix builds doesn't leak between environments.
+    auto new_rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(water.numberOfElectrons(), H_core, spin_orbital_basis.overlap());
+    direct_diis_rhf_scf_solver.perform(new_rhf_environment);
+
+    BOOST_CHECK(std::abs(new_rhf_environment.electronic_energies.back() - rhf_environment.electronic_energies.back()) < 1.0e-08);
+    BOOST_CHECK(direct_diis_rhf_scf_solver.numberOfIterations() == number_of_iterations);
+}
+
+
+/**
+ *  Check if the total RHF energy for H2O that is calculated by our density-fitted DIIS RHF SCF solver is close to the example from Crawdad. The density fitting error of a JK-fitting auxiliary basis is of the order of 1e-5 hartree.
+ */
+BOOST_AUTO_TEST_CASE(crawdad_h2o_sto3g_density_fitted_diis) {
+
+    const double ref_total_energy = -74.9420799281920;
+
+
+    // Do our own RHF calculation. The density-fitted solver only requires the core Hamiltonian, so we don't calculate the two-electron integrals up front.
+    const auto water = GQCP::Molecule::ReadXYZ("data/h2o_crawdad.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {water, "STO-3G"};
+    const auto H_core = spin_orbital_basis.quantize(GQCP::Operator::Kinetic()) + spin_orbital_basis.quantize(GQCP::Operator::NuclearAttraction(water));  // In an AO basis.
+
+    const GQCP::ScalarBasis<GQCP::GTOShell> auxiliary_basis {water, "def2-universal-jkfit"};
+    const auto jk_calculator = GQCP::DensityFittedJKCalculator::Libint(spin_orbital_basis.scalarBasis(), auxiliary_basis, 2);
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(water.numberOfElectrons(), H_core, spin_orbital_basis.overlap());
+    auto density_fitted_diis_rhf_scf_solver = GQCP::RHFSCFSolver<double>::DensityFittedDIIS(jk_calculator);
+    density_fitted_diis_rhf_scf_solver.perform(rhf_environment);
+
+
+    // Check the total energy.
+    const double total_energy = rhf_environment.electronic_energies.back() + GQCP::Operator::NuclearRepulsion(water).value();
+    BOOST_CHECK(std::abs(total_energy - ref_total_energy) < 1.0e-03);
+}
+
+
 /**
  *  Check if the total RHF energy for CH4 (calculated by our plain RHF SCF solver) matches the example from Crawdad. This example is taken from (http://sirius.chem.vt.edu/wiki/doku.php?id=crawdad:programming:project3), but the input .xyz-file was converted to Angstrom.
  */
@@ -122,3 +122,62 @@ BOOST_AUTO_TEST_CASE(h2o_sto3g_diis) {
     BOOST_CHECK(ref_C.matrix().hasEqualSetsOfEigenvectorsAs(uhf_environment.coefficient_matrices.back().alpha().matrix(), 1.0e-05));
     BOOST_CHECK(ref_C.matrix().hasEqualSetsOfEigenvectorsAs(uhf_environment.coefficient_matrices.back().beta().matrix(), 1.0e-05));
 }
+
+
+/**
+ *  Check if our direct DIIS UHF SCF solver (which calculates the two-electron integrals on the fly) finds the same energy as our DIIS RHF SCF solver for H2O.
+ */
+BOOST_AUTO_TEST_CASE(h2o_sto3g_direct_diis) {
+
+    const double ref_total_energy = -74.942080055631;
+
+
+    // Do our own UHF calculation. The direct solver only requires the core Hamiltonian, so we don't calculate the two-electron integrals up front.
+    const auto water = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const auto N_alpha = water.numberOfElectronPairs();
+    const auto N_beta = water.numberOfElectronPairs();
+
+    const GQCP::USpinOrbitalBasis<double, GQCP::GTOShell> spinor_basis {water, "STO-3G"};
+    const auto H_core = spinor_basis.quantize(GQCP::Operator::Kinetic()) + spinor_basis.quantize(GQCP::Operator::NuclearAttraction(water));  // In an AO basis.
+
+    const auto jk_calculator = GQCP::DirectJKCalculator::Libint(spinor_basis.alpha().scalarBasis());
+
+    auto uhf_environment = GQCP::UHFSCFEnvironment<double>::WithCoreGuess(N_alpha, N_beta, H_core, spinor_basis.overlap());
+    auto direct_diis_uhf_scf_solver = GQCP::UHFSCFSolver<double>::DirectDIIS(jk_calculator);
+    direct_diis_uhf_scf_solver.perform(uhf_environment);
+
+
+    // Check the total energy.
+    const double total_energy = uhf_environment.electronic_energies.back() + GQCP::Operator::NuclearRepulsion(water).value();
+    BOOST_CHECK(std::abs(total_energy - ref_total_energy) < 1.0e-06);
+}
+
+
+/**
+ *  Check if our density-fitted DIIS UHF SCF solver finds (approximately) the same energy as our DIIS RHF SCF solver for H2O. The density fitting error of a JK-fitting auxiliary basis is of the order of 1e-5 hartree.
+ */
+BOOST_AUTO_TEST_CASE(h2o_sto3g_density_fitted_diis) {
+
+    const double ref_total_energy = -74.942080055631;
+
+
+    // Do our own UHF calculation. The density-fitted solver only requires the core Hamiltonian, so we don't calculate the two-electron integrals up front.
+    const auto water = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const auto N_alpha = water.numberOfElectronPairs();
+    const auto N_beta = water.numberOfElectronPairs();
+
+    const GQCP::USpinOrbitalBasis<double, GQCP::GTOShell> spinor_basis {water, "STO-3G"};
+    const auto H_core = spinor_basis.quantize(GQCP::Operator::Kinetic()) + spinor_basis.quantize(GQCP::Operator::NuclearAttraction(water));  // In an AO basis.
+
+    const GQCP::ScalarBasis<GQCP::GTOShell> auxiliary_basis {water, "def2-universal-jkfit"};
+    const auto jk_calculator = GQCP::DensityFittedJKCalculator::Libint(spinor_basis.alpha().scalarBasis(), auxiliary_basis, 2);
+
+    auto uhf_environment = GQCP::UHFSCFEnvironment<double>::WithCoreGuess(N_alpha, N_beta, H_core, spinor_basis.overlap());
+    auto density_fitted_diis_uhf_scf_solver = GQCP::UHFSCFSolver<double>::DensityFittedDIIS(jk_calculator);
+    density_fitted_diis_uhf_scf_solver.perform(uhf_environment);
+
+
+    // Check the total energy.
+    const double total_energy = uhf_environment.electronic_energies.back() + GQCP::Operator::NuclearRepulsion(water).value();
+    BOOST_CHECK(std::abs(total_energy - ref_total_energy) < 1.0e-03);
+}
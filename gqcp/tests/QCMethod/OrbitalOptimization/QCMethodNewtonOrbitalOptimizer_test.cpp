@@ -0,0 +1,64 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "QCMethodNewtonOrbitalOptimizer"
+
+#include <boost/test/unit_test.hpp>
+
+#include "QCMethod/OrbitalOptimization/QCMethodNewtonOrbitalOptimizer.hpp"
+
+
+/**
+ *  A Newton orbital optimizer for quantum chemical methods whose DMs are fixed, which makes it possible to test the orbital derivatives in isolation.
+ */
+class FixedDMsNewtonOrbitalOptimizer: public GQCP::QCMethodNewtonOrbitalOptimizer {
+private:
+    GQCP::Orbital1DM<double> fixed_D;
+    GQCP::Orbital2DM<double> fixed_d;
+
+public:
+    FixedDMsNewtonOrbitalOptimizer(const GQCP::Orbital1DM<double>& D, const GQCP::Orbital2DM<double>& d, const GQCP::AugmentedHessianTrustRegion& trust_region) :
+        GQCP::QCMethodNewtonOrbitalOptimizer(trust_region),
+        fixed_D {D},
+        fixed_d {d} {}
+
+    GQCP::Orbital1DM<double> calculate1DM() const override { return this->fixed_D; }
+    GQCP::Orbital2DM<double> calculate2DM() const override { return this->fixed_d; }
+    void prepareDMCalculation(const GQCP::RSQHamiltonian<double>&) override {}
+    GQCP::OrbitalRotationGenerators calculateNewFullOrbitalGenerators(const GQCP::RSQHamiltonian<double>& sq_hamiltonian) const override { return this->calculateNewFreeOrbitalGenerators(sq_hamiltonian); }
+};
+
+
+/**
+ *  Check if the matrix-free Hessian-vector products and the Hessian diagonal match the ones that are calculated from the dense orbital Hessian, for a random Hamiltonian and random DMs.
+ */
+BOOST_AUTO_TEST_CASE(matrix_free_hessian) {
+
+    const size_t K = 5;
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::Random(K);
+    const GQCP::Orbital1DM<double> D {GQCP::SquareMatrix<double>::Random(K)};
+    const GQCP::Orbital2DM<double> d {GQCP::SquareRankFourTensor<double>::Random(K)};
+
+    FixedDMsNewtonOrbitalOptimizer orbital_optimizer {D, d, GQCP::AugmentedHessianTrustRegion()};
+    orbital_optimizer.prepareConvergenceChecking(sq_hamiltonian);
+
+    const auto H = orbital_optimizer.calculateHessianMatrix(sq_hamiltonian);
+    BOOST_CHECK(orbital_optimizer.calculateHessianDiagonal(sq_hamiltonian).isApprox(H.diagonal(), 1.0e-10));
+
+    const GQCP::VectorX<double> x = GQCP::VectorX<double>::Random(K * (K - 1) / 2);
+    BOOST_CHECK(orbital_optimizer.calculateHessianVectorProduct(sq_hamiltonian, x).isApprox(H * x, 1.0e-10));
+}
@@ -0,0 +1,90 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "CCD"
+
+#include <boost/test/unit_test.hpp>
+
+#include "QCModel/CC/CCD.hpp"
+
+
+// Create some shortcuts to be used in the following tests.
+const auto occ = GQCP::OccupationType::k_occupied;
+const auto virt = GQCP::OccupationType::k_virtual;
+
+
+/**
+ *  Check if the T2-amplitude equations that are calculated all at once (through contractions of dense blocks) match the ones that are calculated one by one.
+ *
+ *  The orbital space is deliberately chosen not to be contiguous.
+ */
+BOOST_AUTO_TEST_CASE(amplitude_equations_all_vs_one_by_one) {
+
+    const GQCP::OrbitalSpace orbital_space {{1, 2, 6}, {0, 3, 4, 5}};
+    const size_t M = 7;
+
+    // Prepare a random Fock matrix, random two-electron integrals and random T2-amplitudes. Since the equations are only compared with each other, the integrals need not be antisymmetrized.
+    const GQCP::SquareMatrix<double> f = GQCP::SquareMatrix<double>::Random(M);
+    GQCP::SquareRankFourTensor<double> V_A {M};
+    V_A.setRandom();
+
+    GQCP::Tensor<double, 4> t2_dense {3, 3, 4, 4};
+    t2_dense.setRandom();
+    const GQCP::T2Amplitudes<double> t2 {orbital_space.createRepresentableObjectFor(occ, occ, virt, virt, t2_dense), orbital_space};
+
+
+    // Calculate the intermediates and the amplitude equations.
+    using CCD = GQCP::QCModel::CCD<double>;
+    const auto F1 = CCD::calculateF1(f, V_A, t2);
+    const auto F2 = CCD::calculateF2(f, V_A, t2);
+
+    const auto W1 = CCD::calculateW1(V_A, t2);
+    const auto W2 = CCD::calculateW2(V_A, t2);
+    const auto W3 = CCD::calculateW3(V_A, t2);
+
+    const auto f_T2 = CCD::calculateT2AmplitudeEquations(f, V_A, t2, F1, F2, W1, W2, W3);
+
+    for (const auto& i : orbital_space.indices(occ)) {
+        for (const auto& j : orbital_space.indices(occ)) {
+            for (const auto& a : orbital_space.indices(virt)) {
+                for (const auto& b : orbital_space.indices(virt)) {
+                    BOOST_CHECK(std::abs(f_T2(i, j, a, b) - CCD::calculateT2AmplitudeEquation(i, j, a, b, f, V_A, t2, F1, F2, W1, W2, W3)) < 1.0e-12);
+                }
+            }
+        }
+    }
+
+
+    // Check some elements of the intermediates with a naive implementation of their formulas in Stanton1991.
+    double ref_W3_1456 = V_A(1, 4, 5, 6);
+    for (const auto& n : orbital_space.indices(occ)) {
+        for (const auto& f : orbital_space.indices(virt)) {
+            ref_W3_1456 -= 0.5 * t2(6, n, f, 4) * V_A(1, n, 5, f);
+        }
+    }
+    BOOST_CHECK(std::abs(W3(1, 4, 5, 6) - ref_W3_1456) < 1.0e-12);
+
+    double ref_F2_26 = f(2, 6);
+    for (const auto& n : orbital_space.indices(occ)) {
+        for (const auto& e : orbital_space.indices(virt)) {
+            for (const auto& f : orbital_space.indices(virt)) {
+                ref_F2_26 += 0.5 * t2(6, n, e, f) * V_A(2, n, e, f);
+            }
+        }
+    }
+    BOOST_CHECK(std::abs(F2(2, 6) - ref_F2_26) < 1.0e-12);
+}
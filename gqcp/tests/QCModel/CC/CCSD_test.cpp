@@ -0,0 +1,197 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "CCSD"
+
+#include <boost/test/unit_test.hpp>
+
+#include "QCModel/CC/CCSD.hpp"
+#include "Utilities/threading.hpp"
+
+
+// Create some shortcuts to be used in the following tests.
+const auto occ = GQCP::OccupationType::k_occupied;
+const auto virt = GQCP::OccupationType::k_virtual;
+
+
+/**
+ *  @param M            the number of spinors
+ *
+ *  @return random two-electron integrals in physicist's notation, which are antisymmetric under the exchange of the creation or the annihilation indices
+ */
+GQCP::SquareRankFourTensor<double> randomAntisymmetrizedIntegrals(const size_t M) {
+
+    GQCP::SquareRankFourTensor<double> g {M};
+    g.setRandom();
+
+    GQCP::SquareRankFourTensor<double> V_A {M};
+    for (size_t p = 0; p < M; p++) {
+        for (size_t q = 0; q < M; q++) {
+            for (size_t r = 0; r < M; r++) {
+                for (size_t s = 0; s < M; s++) {
+                    V_A(p, q, r, s) = g(p, q, r, s) - g(q, p, r, s) - g(p, q, s, r) + g(q, p, s, r);
+                }
+            }
+        }
+    }
+
+    return V_A;
+}
+
+
+/**
+ *  Check if the T1- and T2-amplitude equations that are calculated all at once (through contractions of dense blocks) match the ones that are calculated one by one.
+ *
+ *  The orbital space is deliberately chosen not to be contiguous.
+ */
+BOOST_AUTO_TEST_CASE(amplitude_equations_all_vs_one_by_one) {
+
+    const GQCP::OrbitalSpace orbital_space {{0, 2, 5}, {1, 3, 4, 6, 7}};
+    const size_t M = 8;
+
+    // Prepare a random Fock matrix with a sensible occupied-virtual gap, random antisymmetrized two-electron integrals and random amplitudes.
+    GQCP::SquareMatrix<double> f = GQCP::SquareMatrix<double>::Random(M);
+    for (size_t p = 0; p < M; p++) {
+        f(p, p) += orbital_space.isIndex(occ, p) ? -2.0 : 2.0;
+    }
+    const auto V_A = randomAntisymmetrizedIntegrals(M);
+
+    const GQCP::MatrixX<double> t1_dense = GQCP::MatrixX<double>::Random(3, 5);
+    const GQCP::T1Amplitudes<double> t1 {orbital_space.createRepresentableObjectFor(occ, virt, t1_dense), orbital_space};
+
+    GQCP::Tensor<double, 4> t2_dense {3, 3, 5, 5};
+    t2_dense.setRandom();
+    const GQCP::T2Amplitudes<double> t2 {orbital_space.createRepresentableObjectFor(occ, occ, virt, virt, t2_dense), orbital_space};
+
+
+    // Calculate the intermediates and the amplitude equations.
+    using CCSD = GQCP::QCModel::CCSD<double>;
+    const auto tau2 = CCSD::calculateTau2(t1, t2);
+    const auto tau2_tilde = CCSD::calculateTau2Tilde(t1, t2);
+
+    const auto F1 = CCSD::calculateF1(f, V_A, t1, tau2_tilde);
+    const auto F2 = CCSD::calculateF2(f, V_A, t1, tau2_tilde);
+    const auto F3 = CCSD::calculateF3(f, V_A, t1);
+
+    const auto W1 = CCSD::calculateW1(V_A, t1, tau2);
+    const auto W2 = CCSD::calculateW2(V_A, t1, tau2);
+    const auto W3 = CCSD::calculateW3(V_A, t1, t2);
+
+    const auto f_T1 = CCSD::calculateT1AmplitudeEquations(f, V_A, t1, t2, F1, F2, F3);
+    const auto f_T2 = CCSD::calculateT2AmplitudeEquations(f, V_A, t1, t2, tau2, F1, F2, F3, W1, W2, W3);
+
+    for (const auto& i : orbital_space.indices(occ)) {
+        for (const auto& a : orbital_space.indices(virt)) {
+            BOOST_CHECK(std::abs(f_T1(i, a) - CCSD::calculateT1AmplitudeEquation(i, a, f, V_A, t1, t2, F1, F2, F3)) < 1.0e-12);
+
+            for (const auto& j : orbital_space.indices(occ)) {
+                for (const auto& b : orbital_space.indices(virt)) {
+                    BOOST_CHECK(std::abs(f_T2(i, j, a, b) - CCSD::calculateT2AmplitudeEquation(i, j, a, b, f, V_A, t1, t2, tau2, F1, F2, F3, W1, W2, W3)) < 1.0e-12);
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ *  Check if the amplitude equations are the same if their contractions are evaluated on the library-wide tensor device.
+ */
+BOOST_AUTO_TEST_CASE(amplitude_equations_multithreaded) {
+
+    const GQCP::OrbitalSpace orbital_space {{0, 2, 5}, {1, 3, 4, 6, 7}};
+    const size_t M = 8;
+
+    const GQCP::SquareMatrix<double> f = GQCP::SquareMatrix<double>::Random(M);
+    const auto V_A = randomAntisymmetrizedIntegrals(M);
+
+    const GQCP::MatrixX<double> t1_dense = GQCP::MatrixX<double>::Random(3, 5);
+    const GQCP::T1Amplitudes<double> t1 {orbital_space.createRepresentableObjectFor(occ, virt, t1_dense), orbital_space};
+
+    GQCP::Tensor<double, 4> t2_dense {3, 3, 5, 5};
+    t2_dense.setRandom();
+    const GQCP::T2Amplitudes<double> t2 {orbital_space.createRepresentableObjectFor(occ, occ, virt, virt, t2_dense), orbital_space};
+
+
+    // Calculate the amplitude equations, for a given library-wide number of threads.
+    using CCSD = GQCP::QCModel::CCSD<double>;
+    const auto calculate_amplitude_equations = [&](const size_t number_of_threads) {
+        GQCP::setNumberOfThreads(number_of_threads);
+
+        const auto tau2 = CCSD::calculateTau2(t1, t2);
+        const auto tau2_tilde = CCSD::calculateTau2Tilde(t1, t2);
+
+        const auto F1 = CCSD::calculateF1(f, V_A, t1, tau2_tilde);
+        const auto F2 = CCSD::calculateF2(f, V_A, t1, tau2_tilde);
+        const auto F3 = CCSD::calculateF3(f, V_A, t1);
+
+        const auto W1 = CCSD::calculateW1(V_A, t1, tau2);
+        const auto W2 = CCSD::calculateW2(V_A, t1, tau2);
+        const auto W3 = CCSD::calculateW3(V_A, t1, t2);
+
+        auto f_T1 = CCSD::calculateT1AmplitudeEquations(f, V_A, t1, t2, F1, F2, F3);
+        auto f_T2 = CCSD::calculateT2AmplitudeEquations(f, V_A, t1, t2, tau2, F1, F2, F3, W1, W2, W3);
+
+        GQCP::setNumberOfThreads(1);
+        return std::make_pair(f_T1, f_T2);
+    };
+
+    const auto amplitude_equations = calculate_amplitude_equations(1);
+    const auto amplitude_equations_multithreaded = calculate_amplitude_equations(4);
+
+    BOOST_CHECK(amplitude_equations_multithreaded.first.asMatrix().isApprox(amplitude_equations.first.asMatrix(), 1.0e-12));
+    BOOST_CHECK(amplitude_equations_multithreaded.second.asTensor().isApprox(amplitude_equations.second.asTensor(), 1.0e-12));
+}
+
+
+/**
+ *  Check if the CCSD intermediates and correlation energy reduce to their simple forms for zero T1-amplitudes.
+ */
+BOOST_AUTO_TEST_CASE(intermediates_zero_t1) {
+
+    const GQCP::OrbitalSpace orbital_space {{0, 2, 5}, {1, 3, 4, 6, 7}};
+    const size_t M = 8;
+
+    const GQCP::SquareMatrix<double> f = GQCP::SquareMatrix<double>::Random(M);
+    const auto V_A = randomAntisymmetrizedIntegrals(M);
+
+    const GQCP::T1Amplitudes<double> t1 {orbital_space.initializeRepresentableObjectFor<double>(occ, virt), orbital_space};
+    GQCP::Tensor<double, 4> t2_dense {3, 3, 5, 5};
+    t2_dense.setRandom();
+    const GQCP::T2Amplitudes<double> t2 {orbital_space.createRepresentableObjectFor(occ, occ, virt, virt, t2_dense), orbital_space};
+
+    using CCSD = GQCP::QCModel::CCSD<double>;
+
+    // For zero T1-amplitudes, tau2 is equal to the T2-amplitudes and F3 is the occupied-virtual block of the Fock matrix.
+    BOOST_CHECK(CCSD::calculateTau2(t1, t2).asTensor().isApprox(t2_dense, 1.0e-12));
+    BOOST_CHECK(CCSD::calculateF3(f, V_A, t1).asMatrix().isApprox(orbital_space.denseBlockOf(occ, virt, f), 1.0e-12));
+
+
+    // Check the correlation energy with a naive implementation.
+    double ref_energy = 0.0;
+    for (const auto& i : orbital_space.indices(occ)) {
+        for (const auto& j : orbital_space.indices(occ)) {
+            for (const auto& a : orbital_space.indices(virt)) {
+                for (const auto& b : orbital_space.indices(virt)) {
+                    ref_energy += 0.25 * V_A(i, j, a, b) * t2(i, j, a, b);
+                }
+            }
+        }
+    }
+
+    BOOST_CHECK(std::abs(CCSD::calculateCorrelationEnergy(f, V_A, t1, t2) - ref_energy) < 1.0e-12);
+}
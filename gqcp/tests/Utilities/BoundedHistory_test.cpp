@@ -0,0 +1,121 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "BoundedHistory"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Utilities/BoundedHistory.hpp"
+
+#include <vector>
+
+
+/**
+ *  Check if the constructor throws when given a zero capacity.
+ */
+BOOST_AUTO_TEST_CASE(constructor) {
+
+    BOOST_CHECK_NO_THROW(GQCP::BoundedHistory<double>(1));
+    BOOST_CHECK_THROW(GQCP::BoundedHistory<double>(0), std::invalid_argument);
+}
+
+
+/**
+ *  Check if a history discards its oldest elements once its capacity is reached, and if its elements are accessed in order from the oldest to the most recent one.
+ */
+BOOST_AUTO_TEST_CASE(push_back) {
+
+    GQCP::BoundedHistory<size_t> history {3};
+    BOOST_CHECK(history.empty());
+    BOOST_CHECK_THROW(history.back(), std::out_of_range);
+
+    history.push_back(0);
+    history.push_back(1);
+    BOOST_CHECK_EQUAL(history.size(), 2);
+    BOOST_CHECK(!history.isFull());
+    BOOST_CHECK_EQUAL(history.front(), 0);
+    BOOST_CHECK_EQUAL(history.back(), 1);
+
+    for (size_t i = 2; i < 8; i++) {
+        history.push_back(i);
+    }
+    BOOST_CHECK_EQUAL(history.size(), 3);
+    BOOST_CHECK(history.isFull());
+
+    const std::vector<size_t> ref_elements {5, 6, 7};
+    BOOST_CHECK(std::vector<size_t>(history.begin(), history.end()) == ref_elements);
+    for (size_t i = 0; i < 3; i++) {
+        BOOST_CHECK_EQUAL(history[i], ref_elements[i]);
+    }
+    BOOST_CHECK_EQUAL(*(history.end() - 2), 6);
+}
+
+
+/**
+ *  Check if popping the most recent element of a full history keeps the other elements intact, and if its slot is reused for the next element.
+ */
+BOOST_AUTO_TEST_CASE(pop_back) {
+
+    GQCP::BoundedHistory<size_t> history {3};
+    for (size_t i = 0; i < 5; i++) {
+        history.push_back(i);
+    }
+
+    history.pop_back();
+    BOOST_CHECK_EQUAL(history.size(), 2);
+    BOOST_CHECK_EQUAL(history.front(), 2);
+    BOOST_CHECK_EQUAL(history.back(), 3);
+
+    history.push_back(10);
+    const std::vector<size_t> ref_elements {2, 3, 10};
+    BOOST_CHECK(std::vector<size_t>(history.begin(), history.end()) == ref_elements);
+
+    history.clear();
+    BOOST_CHECK(history.empty());
+    BOOST_CHECK_THROW(history.pop_back(), std::out_of_range);
+}
+
+
+/**
+ *  Check if a window on the most recent elements gives access to them without copying, and if the storage of discarded matrices is reused.
+ */
+BOOST_AUTO_TEST_CASE(latest) {
+
+    GQCP::BoundedHistory<GQCP::MatrixX<double>> history {2};
+    const GQCP::MatrixX<double> A = GQCP::MatrixX<double>::Random(3, 3);
+    const GQCP::MatrixX<double> B = GQCP::MatrixX<double>::Random(3, 3);
+    const GQCP::MatrixX<double> C = GQCP::MatrixX<double>::Random(3, 3);
+
+    history.push_back(A);
+    history.push_back(B);
+    const double* storage_of_A = history.front().data();
+
+    // Pushing C discards A, and its storage should be reused for C.
+    history.push_back(C);
+    BOOST_CHECK(history.back().data() == storage_of_A);
+    BOOST_CHECK(history.back().isApprox(C));
+
+    const auto window = history.latest(2);
+    BOOST_CHECK_EQUAL(window.size(), 2);
+    BOOST_CHECK(&window[0] == &history[0]);
+    BOOST_CHECK(window[0].isApprox(B));
+    BOOST_CHECK(window[1].isApprox(C));
+
+    BOOST_CHECK_EQUAL(history.latest(1).size(), 1);
+    BOOST_CHECK_THROW(history.latest(3), std::out_of_range);
+}
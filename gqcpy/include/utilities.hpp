@@ -17,11 +17,15 @@
 
 #pragma once
 
+#include "Utilities/BoundedHistory.hpp"
+
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include <pybind11/eigen.h>
 #include <pybind11/pybind11.h>
 
+#include <vector>
+
 
 namespace gqcpy {
 
@@ -51,4 +55,32 @@ py::array_t<T> asNumpyArray(const Eigen::Tensor<T, 4>& tensor) {
 }
 
 
+/**
+ *  Copy the elements of a bounded history into a vector, which Pybind11 can convert to a Python list.
+ * 
+ *  @param history      The bounded history.
+ * 
+ *  @return The elements of the history, from the oldest to the most recent one.
+ */
+template <typename Element>
+std::vector<Element> asVector(const BoundedHistory<Element>& history) {
+    return std::vector<Element>(history.begin(), history.end());
+}
+
+
+/**
+ *  Replace the elements of a bounded history by the given ones.
+ * 
+ *  @param history      The bounded history.
+ *  @param elements     The new elements, from the oldest to the most recent one. If there are more elements than the capacity of the history, only the most recent ones are kept.
+ */
+template <typename Element>
+void assign(BoundedHistory<Element>& history, const std::vector<Element>& elements) {
+    history.clear();
+    for (const auto& element : elements) {
+        history.push_back(element);
+    }
+}
+
+
 }  // namespace gqcpy
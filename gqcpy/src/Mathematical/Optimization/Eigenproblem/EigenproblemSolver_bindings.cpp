@@ -19,6 +19,7 @@
 #include "Mathematical/Optimization/Eigenproblem/EigenproblemSolver.hpp"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 
 namespace gqcpy {
@@ -37,14 +38,20 @@ void bindEigenproblemSolver(py::module& module) {
                                    &EigenproblemSolver::Dense,
                                    "Return an algorithm that can diagonalize a dense matrix.");
 
-    module_eigenproblem_solver.def("Davidson",
-                                   &EigenproblemSolver::Davidson,
-                                   py::arg("number_of_requested_eigenpairs") = 1,
-                                   py::arg("maximum_subspace_dimension") = 15,
-                                   py::arg("convergence_threshold") = 1.0e-08,
-                                   py::arg("correction_threshold") = 1.0e-12,
-                                   py::arg("maximum_number_of_iterations") = 128,
-                                   py::arg("inclusion_threshold") = 1.0e-03);
+    module_eigenproblem_solver.def(
+        "Davidson",
+        [](const size_t number_of_requested_eigenpairs, const size_t maximum_subspace_dimension, const double convergence_threshold, const double correction_threshold, const size_t maximum_number_of_iterations, const double inclusion_threshold, const std::string& memory_mapped_directory) {
+            const auto subspace_storage = memory_mapped_directory.empty() ? DavidsonSubspaceStorage::InMemory() : DavidsonSubspaceStorage::MemoryMapped(memory_mapped_directory);
+            return EigenproblemSolver::Davidson(number_of_requested_eigenpairs, maximum_subspace_dimension, convergence_threshold, correction_threshold, maximum_number_of_iterations, inclusion_threshold, subspace_storage);
+        },
+        py::arg("number_of_requested_eigenpairs") = 1,
+        py::arg("maximum_subspace_dimension") = 15,
+        py::arg("convergence_threshold") = 1.0e-08,
+        py::arg("correction_threshold") = 1.0e-12,
+        py::arg("maximum_number_of_iterations") = 128,
+        py::arg("inclusion_threshold") = 1.0e-03,
+        py::arg("memory_mapped_directory") = "",
+        "Return Davidson's algorithm. If a directory is given, the subspace vectors and their matrix-vector products are stored in memory-mapped files in that directory.");
 }
 
 
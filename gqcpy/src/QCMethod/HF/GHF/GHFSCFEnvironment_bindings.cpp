@@ -17,9 +17,11 @@
 
 #include "QCMethod/HF/GHF/GHFSCFEnvironment.hpp"
 #include "Utilities/aliases.hpp"
+#include "gqcpy/include/utilities.hpp"
 
 #include <pybind11/eigen.h>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 
 namespace gqcpy {
@@ -53,9 +55,13 @@ void bindQCModelGHFSCFEnvironmentInterface(Class& py_class) {
 
         .def_static(
             "WithCoreGuess",
-            [](const size_t N, const GSQHamiltonian<Scalar>& hamiltonian, const ScalarGSQOneElectronOperator<Scalar>& S) {
-                return GHFSCFEnvironment<Scalar>::WithCoreGuess(N, hamiltonian, S);
+            [](const size_t N, const GSQHamiltonian<Scalar>& hamiltonian, const ScalarGSQOneElectronOperator<Scalar>& S, const size_t history_capacity) {
+                return GHFSCFEnvironment<Scalar>::WithCoreGuess(N, hamiltonian, S, history_capacity);
             },
+            py::arg("N"),
+            py::arg("hamiltonian"),
+            py::arg("S"),
+            py::arg("history_capacity") = 8,
             "Initialize an GHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix.")
 
 
@@ -65,9 +71,23 @@ void bindQCModelGHFSCFEnvironmentInterface(Class& py_class) {
 
         .def_readwrite("N", &GHFSCFEnvironment<Scalar>::N)
 
-        .def_readwrite("electronic_energies", &GHFSCFEnvironment<Scalar>::electronic_energies)
+        .def_property(
+            "electronic_energies",
+            [](const GHFSCFEnvironment<Scalar>& environment) {
+                return asVector(environment.electronic_energies);
+            },
+            [](GHFSCFEnvironment<Scalar>& environment, const std::vector<Scalar>& electronic_energies) {
+                assign(environment.electronic_energies, electronic_energies);
+            })
 
-        .def_readwrite("orbital_energies", &GHFSCFEnvironment<Scalar>::orbital_energies)
+        .def_property(
+            "orbital_energies",
+            [](const GHFSCFEnvironment<Scalar>& environment) {
+                return asVector(environment.orbital_energies);
+            },
+            [](GHFSCFEnvironment<Scalar>& environment, const std::vector<VectorX<Scalar>>& orbital_energies) {
+                assign(environment.orbital_energies, orbital_energies);
+            })
 
         .def_property(
             "S",
@@ -83,21 +103,29 @@ void bindQCModelGHFSCFEnvironmentInterface(Class& py_class) {
          *  MARK: Read-only 'getters'
          */
 
-        .def_readonly(
+        .def_property_readonly(
             "coefficient_matrices",
-            &GHFSCFEnvironment<Scalar>::coefficient_matrices)
+            [](const GHFSCFEnvironment<Scalar>& environment) {
+                return asVector(environment.coefficient_matrices);
+            })
 
-        .def_readonly(
+        .def_property_readonly(
             "density_matrices",
-            &GHFSCFEnvironment<Scalar>::density_matrices)
+            [](const GHFSCFEnvironment<Scalar>& environment) {
+                return asVector(environment.density_matrices);
+            })
 
-        .def_readonly(
+        .def_property_readonly(
             "fock_matrices",
-            &GHFSCFEnvironment<Scalar>::fock_matrices)
+            [](const GHFSCFEnvironment<Scalar>& environment) {
+                return asVector(environment.fock_matrices);
+            })
 
-        .def_readonly(
+        .def_property_readonly(
             "error_vectors",
-            &GHFSCFEnvironment<Scalar>::error_vectors)
+            [](const GHFSCFEnvironment<Scalar>& environment) {
+                return asVector(environment.error_vectors);
+            })
 
 
         /*
@@ -123,9 +151,9 @@ void bindQCModelGHFSCFEnvironmentInterface(Class& py_class) {
              })
 
         .def("replace_current_error_vectors",
-             [](GHFSCFEnvironment<Scalar>& environment, const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>& new_error_vectors) {
-                 environment.fock_matrices.pop_back();
-                 environment.fock_matrices.push_back(SquareMatrix<Scalar>(new_error_vectors));
+             [](GHFSCFEnvironment<Scalar>& environment, const Eigen::Matrix<Scalar, Eigen::Dynamic, 1>& new_error_vector) {
+                 environment.error_vectors.pop_back();
+                 environment.error_vectors.push_back(VectorX<Scalar>(new_error_vector));
              });
 }
 
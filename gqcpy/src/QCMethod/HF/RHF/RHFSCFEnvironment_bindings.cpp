@@ -16,9 +16,11 @@
 // along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "QCMethod/HF/RHF/RHFSCFEnvironment.hpp"
+#include "gqcpy/include/utilities.hpp"
 
 #include <pybind11/eigen.h>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 
 namespace gqcpy {
@@ -36,18 +38,36 @@ void bindRHFSCFEnvironment(py::module& module) {
 
         .def_static(
             "WithCoreGuess",
-            [](const size_t N, const RSQHamiltonian<double>& sq_hamiltonian, const ScalarRSQOneElectronOperator<double>& S) {
-                return RHFSCFEnvironment<double>::WithCoreGuess(N, sq_hamiltonian, S);
+            [](const size_t N, const RSQHamiltonian<double>& sq_hamiltonian, const ScalarRSQOneElectronOperator<double>& S, const size_t history_capacity) {
+                return RHFSCFEnvironment<double>::WithCoreGuess(N, sq_hamiltonian, S, history_capacity);
             },
+            py::arg("N"),
+            py::arg("sq_hamiltonian"),
+            py::arg("S"),
+            py::arg("history_capacity") = 8,
             "Initialize an RHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix.")
 
 
         // Bind read-write members/properties, exposing intermediary environment variables to the Python interface.
         .def_readwrite("N", &RHFSCFEnvironment<double>::N)
 
-        .def_readwrite("electronic_energies", &RHFSCFEnvironment<double>::electronic_energies)
+        .def_property(
+            "electronic_energies",
+            [](const RHFSCFEnvironment<double>& environment) {
+                return asVector(environment.electronic_energies);
+            },
+            [](RHFSCFEnvironment<double>& environment, const std::vector<double>& electronic_energies) {
+                assign(environment.electronic_energies, electronic_energies);
+            })
 
-        .def_readwrite("orbital_energies", &RHFSCFEnvironment<double>::orbital_energies)
+        .def_property(
+            "orbital_energies",
+            [](const RHFSCFEnvironment<double>& environment) {
+                return asVector(environment.orbital_energies);
+            },
+            [](RHFSCFEnvironment<double>& environment, const std::vector<VectorX<double>>& orbital_energies) {
+                assign(environment.orbital_energies, orbital_energies);
+            })
 
         .def_property(
             "S",
@@ -60,21 +80,29 @@ void bindRHFSCFEnvironment(py::module& module) {
 
 
         // Define read-only 'getters'.
-        .def_readonly(
+        .def_property_readonly(
             "coefficient_matrices",
-            &RHFSCFEnvironment<double>::coefficient_matrices)
+            [](const RHFSCFEnvironment<double>& environment) {
+                return asVector(environment.coefficient_matrices);
+            })
 
-        .def_readonly(
+        .def_property_readonly(
             "density_matrices",
-            &RHFSCFEnvironment<double>::density_matrices)
+            [](const RHFSCFEnvironment<double>& environment) {
+                return asVector(environment.density_matrices);
+            })
 
-        .def_readonly(
+        .def_property_readonly(
             "fock_matrices",
-            &RHFSCFEnvironment<double>::fock_matrices)
+            [](const RHFSCFEnvironment<double>& environment) {
+                return asVector(environment.fock_matrices);
+            })
 
-        .def_readonly(
+        .def_property_readonly(
             "error_vectors",
-            &RHFSCFEnvironment<double>::fock_matrices)
+            [](const RHFSCFEnvironment<double>& environment) {
+                return asVector(environment.error_vectors);
+            })
 
 
         // Bind methods for the replacement of the most current iterates.
@@ -97,9 +125,9 @@ void bindRHFSCFEnvironment(py::module& module) {
              })
 
         .def("replace_current_error_vectors",
-             [](RHFSCFEnvironment<double>& environment, const Eigen::MatrixXd& new_error_vectors) {
-                 environment.fock_matrices.pop_back();
-                 environment.fock_matrices.push_back(SquareMatrix<double>(new_error_vectors));
+             [](RHFSCFEnvironment<double>& environment, const Eigen::VectorXd& new_error_vector) {
+                 environment.error_vectors.pop_back();
+                 environment.error_vectors.push_back(VectorX<double>(new_error_vector));
              });
 }
 
@@ -16,6 +16,7 @@
 // along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "QCMethod/HF/UHF/UHFSCFEnvironment.hpp"
+#include "gqcpy/include/utilities.hpp"
 
 #include <pybind11/eigen.h>
 #include <pybind11/pybind11.h>
@@ -35,38 +36,59 @@ void bindUHFSCFEnvironment(py::module& module) {
 
         // CONSTRUCTORS
 
-        .def(py::init([](const size_t N_alpha, const size_t N_beta, const USQHamiltonian<double>& sq_hamiltonian, const ScalarUSQOneElectronOperator<double>& S, const UTransformation<double>& C_initial) {
-                 return UHFSCFEnvironment<double>(N_alpha, N_beta, sq_hamiltonian, S, C_initial);
+        .def(py::init([](const size_t N_alpha, const size_t N_beta, const USQHamiltonian<double>& sq_hamiltonian, const ScalarUSQOneElectronOperator<double>& S, const UTransformation<double>& C_initial, const size_t history_capacity) {
+                 return UHFSCFEnvironment<double>(N_alpha, N_beta, sq_hamiltonian, S, C_initial, history_capacity);
              }),
              py::arg("N_alpha"),
              py::arg("N_beta"),
              py::arg("sq_hamiltonian"),
              py::arg("S"),
              py::arg("C_initial"),
+             py::arg("history_capacity") = 8,
              "A constructor that initializes the environment with initial guesses for the alpha and beta coefficient matrices.")
 
-        .def(py::init([](const QCModel::RHF<double>& rhf_parameters, const USQHamiltonian<double>& sq_hamiltonian, const ScalarUSQOneElectronOperator<double>& S) {
-                 return UHFSCFEnvironment<double>(rhf_parameters, sq_hamiltonian, S);
+        .def(py::init([](const QCModel::RHF<double>& rhf_parameters, const USQHamiltonian<double>& sq_hamiltonian, const ScalarUSQOneElectronOperator<double>& S, const size_t history_capacity) {
+                 return UHFSCFEnvironment<double>(rhf_parameters, sq_hamiltonian, S, history_capacity);
              }),
              py::arg("rhf_parameters"),
              py::arg("sq_hamiltonian"),
              py::arg("S"),
+             py::arg("history_capacity") = 8,
              "A constructor that initializes the environment from converged RHF model parameters.")
 
         .def_static(
             "WithCoreGuess",
-            [](const size_t N_alpha, const size_t N_beta, const USQHamiltonian<double>& sq_hamiltonian, const ScalarUSQOneElectronOperator<double>& S) {
-                return UHFSCFEnvironment<double>::WithCoreGuess(N_alpha, N_beta, sq_hamiltonian, S);
+            [](const size_t N_alpha, const size_t N_beta, const USQHamiltonian<double>& sq_hamiltonian, const ScalarUSQOneElectronOperator<double>& S, const size_t history_capacity) {
+                return UHFSCFEnvironment<double>::WithCoreGuess(N_alpha, N_beta, sq_hamiltonian, S, history_capacity);
             },
+            py::arg("N_alpha"),
+            py::arg("N_beta"),
+            py::arg("sq_hamiltonian"),
+            py::arg("S"),
+            py::arg("history_capacity") = 8,
             "Initialize an UHF SCF environment with initial coefficient matrices (equal for alpha and beta) that is obtained by diagonalizing the core Hamiltonian matrix.")
 
 
         // Bind read-write members/properties, exposing intermediary environment variables to the Python interface.
         .def_readwrite("N", &UHFSCFEnvironment<double>::N)
 
-        .def_readwrite("electronic_energies", &UHFSCFEnvironment<double>::electronic_energies)
+        .def_property(
+            "electronic_energies",
+            [](const UHFSCFEnvironment<double>& environment) {
+                return asVector(environment.electronic_energies);
+            },
+            [](UHFSCFEnvironment<double>& environment, const std::vector<double>& electronic_energies) {
+                assign(environment.electronic_energies, electronic_energies);
+            })
 
-        .def_readwrite("orbital_energies", &UHFSCFEnvironment<double>::orbital_energies)
+        .def_property(
+            "orbital_energies",
+            [](const UHFSCFEnvironment<double>& environment) {
+                return asVector(environment.orbital_energies);
+            },
+            [](UHFSCFEnvironment<double>& environment, const std::vector<SpinResolved<VectorX<double>>>& orbital_energies) {
+                assign(environment.orbital_energies, orbital_energies);
+            })
 
         .def_property(
             "S",
@@ -79,13 +101,17 @@ void bindUHFSCFEnvironment(py::module& module) {
 
 
         // Define read-only 'getters'
-        .def_readonly(
+        .def_property_readonly(
             "density_matrices",
-            &UHFSCFEnvironment<double>::density_matrices)
+            [](const UHFSCFEnvironment<double>& environment) {
+                return asVector(environment.density_matrices);
+            })
 
-        .def_readonly(
+        .def_property_readonly(
             "error_vectors",
-            &UHFSCFEnvironment<double>::error_vectors)
+            [](const UHFSCFEnvironment<double>& environment) {
+                return asVector(environment.error_vectors);
+            })
 
 
         // Define getters for non-native components